@@ -45,6 +45,7 @@ extern "C"
     daqErrCode EXPORTED daqDeserializer_deserialize(daqDeserializer* self, daqString* serialized, daqBaseObject* context, daqFunction* factoryCallback, daqBaseObject** object);
     daqErrCode EXPORTED daqDeserializer_update(daqDeserializer* self, daqUpdatable* updatable, daqString* serialized, daqBaseObject* config);
     daqErrCode EXPORTED daqDeserializer_callCustomProc(daqDeserializer* self, daqProcedure* customDeserialize, daqString* serialized);
+    daqErrCode EXPORTED daqDeserializer_deserializeFile(daqDeserializer* self, daqString* fileName, daqBaseObject* context, daqFunction* factoryCallback, daqBaseObject** object);
 
 #ifdef __cplusplus
 }
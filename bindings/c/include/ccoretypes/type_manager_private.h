@@ -40,6 +40,7 @@ extern "C"
     EXPORTED extern const daqIntfID DAQ_TYPE_MANAGER_PRIVATE_INTF_ID;
 
     daqErrCode EXPORTED daqTypeManagerPrivate_setCoreEventCallback(daqTypeManagerPrivate* self, daqProcedure* callback);
+    daqErrCode EXPORTED daqTypeManagerPrivate_getEpoch(daqTypeManagerPrivate* self, daqSizeT* epoch);
 
 #ifdef __cplusplus
 }
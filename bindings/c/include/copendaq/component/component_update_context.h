@@ -49,6 +49,7 @@ extern "C"
     daqErrCode EXPORTED daqComponentUpdateContext_getSignal(daqComponentUpdateContext* self, daqString* parentId, daqString* portId, daqSignal** signal);
     daqErrCode EXPORTED daqComponentUpdateContext_setSignalDependency(daqComponentUpdateContext* self, daqString* signalId, daqString* parentId);
     daqErrCode EXPORTED daqComponentUpdateContext_getReAddDevicesEnabled(daqComponentUpdateContext* self, daqBool* enabled);
+    daqErrCode EXPORTED daqComponentUpdateContext_getParallelUpdateEnabled(daqComponentUpdateContext* self, daqBool* enabled);
 
 #ifdef __cplusplus
 }
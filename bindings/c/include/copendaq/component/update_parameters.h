@@ -40,6 +40,8 @@ extern "C"
 
     daqErrCode EXPORTED daqUpdateParameters_getReAddDevicesEnabled(daqUpdateParameters* self, daqBool* enabled);
     daqErrCode EXPORTED daqUpdateParameters_setReAddDevicesEnabled(daqUpdateParameters* self, daqBool enabled);
+    daqErrCode EXPORTED daqUpdateParameters_getParallelUpdateEnabled(daqUpdateParameters* self, daqBool* enabled);
+    daqErrCode EXPORTED daqUpdateParameters_setParallelUpdateEnabled(daqUpdateParameters* self, daqBool enabled);
     daqErrCode EXPORTED daqUpdateParameters_createUpdateParameters(daqUpdateParameters** obj);
 
 #ifdef __cplusplus
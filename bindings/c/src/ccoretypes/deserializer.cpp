@@ -31,3 +31,8 @@ daqErrCode daqDeserializer_callCustomProc(daqDeserializer* self, daqProcedure* c
 {
     return reinterpret_cast<daq::IDeserializer*>(self)->callCustomProc(reinterpret_cast<daq::IProcedure*>(customDeserialize), reinterpret_cast<daq::IString*>(serialized));
 }
+
+daqErrCode daqDeserializer_deserializeFile(daqDeserializer* self, daqString* fileName, daqBaseObject* context, daqFunction* factoryCallback, daqBaseObject** object)
+{
+    return reinterpret_cast<daq::IDeserializer*>(self)->deserializeFile(reinterpret_cast<daq::IString*>(fileName), reinterpret_cast<daq::IBaseObject*>(context), reinterpret_cast<daq::IFunction*>(factoryCallback), reinterpret_cast<daq::IBaseObject**>(object));
+}
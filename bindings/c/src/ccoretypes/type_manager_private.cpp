@@ -21,3 +21,8 @@ daqErrCode daqTypeManagerPrivate_setCoreEventCallback(daqTypeManagerPrivate* sel
 {
     return reinterpret_cast<daq::ITypeManagerPrivate*>(self)->setCoreEventCallback(reinterpret_cast<daq::IProcedure*>(callback));
 }
+
+daqErrCode daqTypeManagerPrivate_getEpoch(daqTypeManagerPrivate* self, daqSizeT* epoch)
+{
+    return reinterpret_cast<daq::ITypeManagerPrivate*>(self)->getEpoch(epoch);
+}
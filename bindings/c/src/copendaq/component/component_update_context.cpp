@@ -51,3 +51,8 @@ daqErrCode daqComponentUpdateContext_getReAddDevicesEnabled(daqComponentUpdateCo
 {
     return reinterpret_cast<daq::IComponentUpdateContext*>(self)->getReAddDevicesEnabled(enabled);
 }
+
+daqErrCode daqComponentUpdateContext_getParallelUpdateEnabled(daqComponentUpdateContext* self, daqBool* enabled)
+{
+    return reinterpret_cast<daq::IComponentUpdateContext*>(self)->getParallelUpdateEnabled(enabled);
+}
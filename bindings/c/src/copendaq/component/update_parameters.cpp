@@ -27,6 +27,16 @@ daqErrCode daqUpdateParameters_setReAddDevicesEnabled(daqUpdateParameters* self,
     return reinterpret_cast<daq::IUpdateParameters*>(self)->setReAddDevicesEnabled(enabled);
 }
 
+daqErrCode daqUpdateParameters_getParallelUpdateEnabled(daqUpdateParameters* self, daqBool* enabled)
+{
+    return reinterpret_cast<daq::IUpdateParameters*>(self)->getParallelUpdateEnabled(enabled);
+}
+
+daqErrCode daqUpdateParameters_setParallelUpdateEnabled(daqUpdateParameters* self, daqBool enabled)
+{
+    return reinterpret_cast<daq::IUpdateParameters*>(self)->setParallelUpdateEnabled(enabled);
+}
+
 daqErrCode daqUpdateParameters_createUpdateParameters(daqUpdateParameters** obj)
 {
     daq::IUpdateParameters* ptr = nullptr;
@@ -62,6 +62,11 @@ daqErrCode daqContext_getDiscoveryServers(daqContext* self, daqDict** servers)
     return reinterpret_cast<daq::IContext*>(self)->getDiscoveryServers(reinterpret_cast<daq::IDict**>(servers));
 }
 
+daqErrCode daqContext_getDiscoveryCache(daqContext* self, daqBaseObject** cache)
+{
+    return reinterpret_cast<daq::IContext*>(self)->getDiscoveryCache(reinterpret_cast<daq::IBaseObject**>(cache));
+}
+
 daqErrCode daqContext_createContext(daqContext** obj, daqScheduler* Scheduler, daqLogger* Logger, daqTypeManager* typeManager, daqModuleManager* moduleManager, daqAuthenticationProvider* authenticationProvider, daqDict* options, daqDict* discoveryServers)
 {
     daq::IContext* ptr = nullptr;
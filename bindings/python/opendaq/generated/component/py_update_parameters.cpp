@@ -56,4 +56,18 @@ void defineIUpdateParameters(pybind11::module_ m, PyDaqIntf<daq::IUpdateParamete
             objectPtr.setReAddDevicesEnabled(enabled);
         },
         "Returns whether the re-add devices is enabled. If enabled, the devices will be re-added in update process. / Sets the re-add devices enabled flag.");
+    cls.def_property("parallel_update_enabled",
+        [](daq::IUpdateParameters *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::UpdateParametersPtr::Borrow(object);
+            return objectPtr.getParallelUpdateEnabled();
+        },
+        [](daq::IUpdateParameters *object, const bool enabled)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::UpdateParametersPtr::Borrow(object);
+            objectPtr.setParallelUpdateEnabled(enabled);
+        },
+        "Returns whether the parallel update is enabled. If enabled, the existing channels and function blocks of a component are updated concurrently on the scheduler of the context. / Sets the parallel update enabled flag.");
 }
@@ -33,6 +33,12 @@
 
 PyDaqIntf<daq::IMultiReaderBuilder, daq::IBaseObject> declareIMultiReaderBuilder(pybind11::module_ m)
 {
+    py::enum_<daq::ResampleMethod>(m, "ResampleMethod")
+        .value("None", daq::ResampleMethod::None)
+        .value("Hold", daq::ResampleMethod::Hold)
+        .value("Linear", daq::ResampleMethod::Linear)
+        .value("Polyphase", daq::ResampleMethod::Polyphase);
+
     return wrapInterface<daq::IMultiReaderBuilder, daq::IBaseObject>(m, "IMultiReaderBuilder");
 }
 
@@ -251,4 +257,46 @@ void defineIMultiReaderBuilder(pybind11::module_ m, PyDaqIntf<daq::IMultiReaderB
         },
         py::return_value_policy::take_ownership,
         "Gets the notification methods of ports created/owned by the multi reader. The default notification method is Unspecified. / Sets the notification methods of ports created/owned by the multi reader. The default notification method is Unspecified.");
+    cls.def_property("interleaved_output",
+        [](daq::IMultiReaderBuilder *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::MultiReaderBuilderPtr::Borrow(object);
+            return objectPtr.getInterleavedOutput();
+        },
+        [](daq::IMultiReaderBuilder *object, const bool interleaved)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::MultiReaderBuilderPtr::Borrow(object);
+            objectPtr.setInterleavedOutput(interleaved);
+        },
+        "Gets whether the reader writes into a single interleaved (frame-major) buffer. / Sets whether the reader writes into a single interleaved (frame-major) buffer.");
+    cls.def_property("parallel_read_threshold",
+        [](daq::IMultiReaderBuilder *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::MultiReaderBuilderPtr::Borrow(object);
+            return objectPtr.getParallelReadThreshold();
+        },
+        [](daq::IMultiReaderBuilder *object, const size_t threshold)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::MultiReaderBuilderPtr::Borrow(object);
+            objectPtr.setParallelReadThreshold(threshold);
+        },
+        "Gets the number of values a single read must copy before the per-signal copy is distributed across the context scheduler. / Sets the number of values a single read must copy before the per-signal copy is distributed across the context scheduler.");
+    cls.def_property("resample_method",
+        [](daq::IMultiReaderBuilder *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::MultiReaderBuilderPtr::Borrow(object);
+            return objectPtr.getResampleMethod();
+        },
+        [](daq::IMultiReaderBuilder *object, daq::ResampleMethod method)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::MultiReaderBuilderPtr::Borrow(object);
+            objectPtr.setResampleMethod(method);
+        },
+        "Gets the method used to resample all signals to a single output rate. / Sets the method used to resample all signals to a single output rate.");
 }
@@ -264,6 +264,19 @@ BEGIN_NAMESPACE_OPENDAQ
  *
  * The ID of the event is 170, and the event name is "ConnectionStatusChanged".
  *
+ * @subsubsection opendaq_core_event_types_components_added Components added
+ *
+ * Triggered once at the end of a bulk construction scope of a folder, in place of the Component added events
+ * that would otherwise be triggered for each component added within the scope.
+ *
+ * The sender of the event is the folder that owns the scope.
+ *
+ * The event contains the following parameters:
+ *  - The list of the roots of the added subtrees under the key "Components". The components below the roots
+ *    were added as well, and do not appear in the list.
+ *
+ * The ID of the event is 200, and the event name is "ComponentsAdded".
+ *
  * @subsection opendaq_core_event_muting Muting core events
  *
  * Components, as previously mentioned, do not trigger core events until they are connected to the root of the
@@ -47,6 +47,7 @@ enum class CoreEventId : EnumType
     ConnectionStatusChanged = 170,
     DeviceOperationModeChanged = 180,
     PropertyOrderChanged = 190,
+    ComponentsAdded = 200,
 };
 
 /*!@}*/
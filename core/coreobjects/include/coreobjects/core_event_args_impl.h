@@ -69,6 +69,8 @@ namespace core_event_args_impl
                 return "DeviceOperationModeChanged";
             case CoreEventId::PropertyOrderChanged:
                 return "PropertyOrderChanged";
+            case CoreEventId::ComponentsAdded:
+                return "ComponentsAdded";
             default:
                 break;
         }
@@ -241,6 +243,8 @@ inline bool CoreEventArgsImpl::validateParameters() const
             return parameters.hasKey("OperationMode");
         case CoreEventId::PropertyOrderChanged:
             return parameters.hasKey("PropertyOrder") && parameters.hasKey("Path");
+        case CoreEventId::ComponentsAdded:
+            return parameters.hasKey("Components") && parameters.get("Components").supportsInterface<IList>();
         default:
             break;
     }
@@ -69,6 +69,17 @@ struct StringEqualTo
     {
         assert(a != nullptr && b != nullptr);
 
+        // fast path for interned strings, which are shared by all users of the same name
+        if (a.getObject() == b.getObject())
+            return true;
+
+        SizeT aLength;
+        a->getLength(&aLength);
+        SizeT bLength;
+        b->getLength(&bLength);
+        if (aLength != bLength)
+            return false;
+
         ConstCharPtr aChPtr;
         a->getCharPtr(&aChPtr);
         ConstCharPtr bChPtr;
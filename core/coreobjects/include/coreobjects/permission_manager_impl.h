@@ -22,6 +22,10 @@
 #include <coreobjects/permission_manager_internal_ptr.h>
 #include <coretypes/weakrefptr.h>
 #include <coretypes/cloneable.h>
+#include <coreobjects/user_ptr.h>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -45,13 +49,36 @@ protected:
     ErrCode INTERFACE_FUNC updateInheritedPermissions() override;
 
 private:
+    struct PermissionMasks
+    {
+        Int allowed = 0;
+        Int denied = 0;
+    };
+
+    struct CachedUserMasks
+    {
+        UserPtr user;
+        PermissionMasks masks;
+        uint64_t epoch;
+    };
+
     void updateChildPermissions();
+    void compilePermissions();
+    PermissionMasks getUserMasks(IUser* user);
     PermissionManagerInternalPtr getParentManager();
 
     WeakRefPtr<IPermissionManager> parent;
     std::unordered_set<IPermissionManager*> children;
     PermissionsPtr permissions;
     PermissionsPtr localPermissions;
+
+    // Effective permissions compiled into per-group masks whenever they change. The combined masks of each
+    // user are cached and invalidated by bumping the epoch. Users are immutable, the cache holds a reference
+    // to each user so its address cannot be reused by another user.
+    std::mutex sync;
+    uint64_t epoch;
+    std::unordered_map<std::string, PermissionMasks> groupMasks;
+    std::unordered_map<IUser*, CachedUserMasks> userMasks;
 };
 
 #else
@@ -84,14 +84,14 @@ public:
     explicit PropertyImpl(const StringPtr& name)
         : PropertyImpl()
     {
-        this->name = name;
+        this->name = InternedString(name);
     }
 
     explicit PropertyImpl(IPropertyBuilder* propertyBuilder)
     {
         const auto propertyBuilderPtr = PropertyBuilderPtr::Borrow(propertyBuilder);
         this->valueType = propertyBuilderPtr.getValueType();
-        this->name = propertyBuilderPtr.getName();
+        this->name = InternedString(propertyBuilderPtr.getName());
         this->description = propertyBuilderPtr.getDescription();
         this->unit = propertyBuilderPtr.getUnit();
         this->minValue = propertyBuilderPtr.getMinValue();
@@ -24,6 +24,9 @@
 #include <coretypes/type_manager_ptr.h>
 #include <coreobjects/object_keys.h>
 #include <tsl/ordered_map.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -56,13 +59,26 @@ public:
     static ErrCode Deserialize(ISerializedObject* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj);
 
 private:
+    // Properties of the class including the inherited ones, in the order returned by `getProperties(True)`.
+    struct FlattenedLayout
+    {
+        SizeT epoch;
+        std::unordered_map<StringPtr, PropertyPtr, StringHash, StringEqualTo> index;
+        std::vector<PropertyPtr> ordered;
+    };
+
     StringPtr name;
     StringPtr parent;
     PropertyOrderedMap props;
     std::vector<StringPtr> customOrder;
     WeakRefPtr<ITypeManager> manager;
 
+    std::mutex layoutSync;
+    std::shared_ptr<const FlattenedLayout> layout;
+
     ErrCode getManager(TypeManagerPtr& managerPtr) const;
+    ErrCode getLayout(std::shared_ptr<const FlattenedLayout>& flattened);
+    ErrCode buildLayout(SizeT epoch, std::shared_ptr<const FlattenedLayout>& flattened);
     ErrCode getWithNormalOrder(Bool includeInherited, IList** list);
     ErrCode getWithCustomOrder(Bool includeInherited, IList** list);
     ErrCode getInheritedProperties(ListPtr<IProperty>& properties) const;
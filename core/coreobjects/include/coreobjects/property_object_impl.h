@@ -1394,7 +1394,7 @@ bool GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::writeLocalValue
     }
     else if (forceWrite)
     {
-        propValues.emplace(name, value);
+        propValues.emplace(InternedString(name), value);
     }
     else
     {
@@ -1408,7 +1408,7 @@ bool GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::writeLocalValue
         }
 
         if (shouldWrite)
-            propValues.emplace(name, value);
+            propValues.emplace(InternedString(name), value);
         else
             return false;
     }
@@ -19,11 +19,15 @@ namespace detail
         daqEnableObjectTracking();
         return permissions;
     }();
+
+    // Cached users are dropped once the cache grows past this size, to bound the memory held by short-lived users
+    static constexpr size_t MaxCachedUsers = 256;
 }
 
 PermissionManagerImpl::PermissionManagerImpl(const PermissionManagerPtr& parent)
     : permissions(detail::DefaultPermissions)
     , localPermissions(detail::DefaultPermissions)
+    , epoch(0)
 {
     if (parent.assigned())
         setParent(parent);
@@ -59,43 +63,28 @@ ErrCode INTERFACE_FUNC PermissionManagerImpl::setPermissions(IPermissions* permi
         this->permissions = localPermissions;
     }
 
+    compilePermissions();
     updateChildPermissions();
     return OPENDAQ_SUCCESS;
 }
 
 ErrCode INTERFACE_FUNC PermissionManagerImpl::isAuthorized(IUser* user, Permission permission, Bool* authorizedOut)
 {
+    OPENDAQ_PARAM_NOT_NULL(user);
     OPENDAQ_PARAM_NOT_NULL(authorizedOut);
-    *authorizedOut = false;
 
-    const UserPtr userPtr = UserPtr::Borrow(user);
-    const auto& groups = userPtr.getGroups();
     const Int targetPermissionInt = (Int) permission;
-    Int permissionMask;
 
-    for (const auto& group : groups)
+    return daqTry([&]
     {
-        permissionMask = (Int) permissions.getDenied().getOrDefault(group, Int(0));
+        const auto masks = getUserMasks(user);
 
-        if ((permissionMask & targetPermissionInt) != 0)
-        {
+        // denied permissions of any group take precedence over the allowed ones
+        if ((masks.denied & targetPermissionInt) != 0)
             *authorizedOut = false;
-            return OPENDAQ_SUCCESS;
-        }
-    }
-
-    for (const auto& group : groups)
-    {
-        permissionMask = (Int) permissions.getAllowed().getOrDefault(group, Int(0));
-
-        if ((permissionMask & targetPermissionInt) != 0)
-        {
-            *authorizedOut = true;
-            return OPENDAQ_SUCCESS;
-        }
-    }
-    
-    return OPENDAQ_SUCCESS;
+        else
+            *authorizedOut = (masks.allowed & targetPermissionInt) != 0;
+    });
 }
 
 ErrCode INTERFACE_FUNC PermissionManagerImpl::clone(IBaseObject** cloneOut)
@@ -160,6 +149,48 @@ void PermissionManagerImpl::updateChildPermissions()
     }
 }
 
+void PermissionManagerImpl::compilePermissions()
+{
+    std::unordered_map<std::string, PermissionMasks> masks;
+
+    for (const auto& [group, mask] : permissions.getAllowed())
+        masks[group.toStdString()].allowed = (Int) mask;
+
+    for (const auto& [group, mask] : permissions.getDenied())
+        masks[group.toStdString()].denied = (Int) mask;
+
+    std::scoped_lock lock(sync);
+    groupMasks = std::move(masks);
+    userMasks.clear();
+    epoch++;
+}
+
+PermissionManagerImpl::PermissionMasks PermissionManagerImpl::getUserMasks(IUser* user)
+{
+    std::scoped_lock lock(sync);
+
+    if (const auto it = userMasks.find(user); it != userMasks.end() && it->second.epoch == epoch)
+        return it->second.masks;
+
+    const auto userPtr = UserPtr::Borrow(user);
+    PermissionMasks masks;
+
+    for (const auto& group : userPtr.getGroups())
+    {
+        if (const auto it = groupMasks.find(group.toStdString()); it != groupMasks.end())
+        {
+            masks.allowed |= it->second.allowed;
+            masks.denied |= it->second.denied;
+        }
+    }
+
+    if (userMasks.size() >= detail::MaxCachedUsers)
+        userMasks.clear();
+
+    userMasks[user] = CachedUserMasks{userPtr, masks, epoch};
+    return masks;
+}
+
 PermissionManagerInternalPtr PermissionManagerImpl::getParentManager()
 {
     if (parent.assigned()) 
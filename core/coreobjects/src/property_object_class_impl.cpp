@@ -3,6 +3,7 @@
 #include <coreobjects/property_ptr.h>
 #include <coreobjects/errors.h>
 #include <coreobjects/property_internal_ptr.h>
+#include <coretypes/type_manager_private.h>
 
 #include <coreobjects/property_object_class_builder.h>
 #include <coreobjects/property_object_internal.h>
@@ -45,32 +46,29 @@ ErrCode PropertyObjectClassImpl::getProperty(IString* propertyName, IProperty**
     OPENDAQ_PARAM_NOT_NULL(propertyName);
     OPENDAQ_PARAM_NOT_NULL(property);
 
-    auto res = props.find(propertyName);
-    if (res == props.cend())
+    const auto res = props.find(propertyName);
+    if (res != props.cend())
     {
-        if (parent.assigned())
-        {
-            TypeManagerPtr managerPtr;
-            ErrCode err = getManager(managerPtr);
-            OPENDAQ_RETURN_IF_FAILED(err);
-
-            TypePtr type;
-            err = managerPtr->getType(parent, &type);
-            OPENDAQ_RETURN_IF_FAILED(err);
+        *property = res.value().addRefAndReturn();
+        return OPENDAQ_SUCCESS;
+    }
 
-            const auto parentClass = type.asPtrOrNull<IPropertyObjectClass>();
-            if (!parentClass.assigned())
-                return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+    if (parent.assigned())
+    {
+        std::shared_ptr<const FlattenedLayout> flattened;
+        const ErrCode err = getLayout(flattened);
+        OPENDAQ_RETURN_IF_FAILED(err);
 
-            return parentClass->getProperty(propertyName, property);
+        const auto inherited = flattened->index.find(propertyName);
+        if (inherited != flattened->index.cend())
+        {
+            *property = inherited->second.addRefAndReturn();
+            return OPENDAQ_SUCCESS;
         }
-
-        StringPtr str = propertyName;
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTFOUND, fmt::format(R"(Property with name {} not found.)", str));
     }
 
-    *property = res.value().addRefAndReturn();
-    return OPENDAQ_SUCCESS;
+    StringPtr str = propertyName;
+    return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTFOUND, fmt::format(R"(Property with name {} not found.)", str));
 }
 
 ErrCode PropertyObjectClassImpl::hasProperty(IString* propertyName, Bool* hasProperty)
@@ -78,31 +76,80 @@ ErrCode PropertyObjectClassImpl::hasProperty(IString* propertyName, Bool* hasPro
     OPENDAQ_PARAM_NOT_NULL(propertyName);
     OPENDAQ_PARAM_NOT_NULL(hasProperty);
 
-    const auto res = props.find(propertyName);
-    if (res == props.end())
+    if (props.find(propertyName) != props.end())
     {
-        if (parent.assigned())
-        {
-            TypeManagerPtr managerPtr;
-            ErrCode err = getManager(managerPtr);
-            OPENDAQ_RETURN_IF_FAILED(err);
+        *hasProperty = true;
+        return OPENDAQ_SUCCESS;
+    }
+
+    if (parent.assigned())
+    {
+        std::shared_ptr<const FlattenedLayout> flattened;
+        const ErrCode err = getLayout(flattened);
+        OPENDAQ_RETURN_IF_FAILED(err);
+
+        *hasProperty = flattened->index.find(propertyName) != flattened->index.cend();
+        return OPENDAQ_SUCCESS;
+    }
+
+    *hasProperty = false;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PropertyObjectClassImpl::getLayout(std::shared_ptr<const FlattenedLayout>& flattened)
+{
+    // The layout of a class without a parent never changes. Otherwise it depends on the parent classes, which
+    // can be replaced in the type manager, so it is rebuilt whenever the types of the manager change.
+    SizeT epoch = 0;
+    if (parent.assigned())
+    {
+        TypeManagerPtr managerPtr;
+        const ErrCode err = getManager(managerPtr);
+        OPENDAQ_RETURN_IF_FAILED(err);
 
-            TypePtr type;
-            err = managerPtr->getType(parent, &type);
-            OPENDAQ_RETURN_IF_FAILED(err);
+        const auto managerPrivate = managerPtr.asPtrOrNull<ITypeManagerPrivate>(true);
+        if (!managerPrivate.assigned())
+            return buildLayout(epoch, flattened);
 
-            const auto parentClass = type.asPtrOrNull<IPropertyObjectClass>();
-            if (!parentClass.assigned())
-                return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+        OPENDAQ_RETURN_IF_FAILED(managerPrivate->getEpoch(&epoch));
+    }
 
-            return parentClass->hasProperty(propertyName, hasProperty);
+    {
+        std::scoped_lock lock(layoutSync);
+        if (layout && layout->epoch == epoch)
+        {
+            flattened = layout;
+            return OPENDAQ_SUCCESS;
         }
+    }
 
-        *hasProperty = false;
-        return OPENDAQ_SUCCESS;
+    const ErrCode err = buildLayout(epoch, flattened);
+    OPENDAQ_RETURN_IF_FAILED(err);
+
+    std::scoped_lock lock(layoutSync);
+    layout = flattened;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PropertyObjectClassImpl::buildLayout(SizeT epoch, std::shared_ptr<const FlattenedLayout>& flattened)
+{
+    ListPtr<IProperty> properties;
+    const ErrCode err = customOrder.empty() ? getWithNormalOrder(True, &properties) : getWithCustomOrder(True, &properties);
+    OPENDAQ_RETURN_IF_FAILED(err);
+
+    auto newLayout = std::make_shared<FlattenedLayout>();
+    newLayout->epoch = epoch;
+    newLayout->ordered.reserve(properties.getCount());
+    newLayout->index.reserve(properties.getCount());
+
+    // Properties redefined by a derived class come later in the list and replace the inherited ones
+    for (const auto& prop : properties)
+    {
+        newLayout->index.insert_or_assign(prop.getName(), prop);
+        newLayout->ordered.push_back(prop);
     }
 
-    *hasProperty = true;
+    flattened = std::move(newLayout);
     return OPENDAQ_SUCCESS;
 }
 
@@ -221,6 +268,21 @@ ErrCode PropertyObjectClassImpl::getProperties(Bool includeInherited, IList** pr
 {
     OPENDAQ_PARAM_NOT_NULL(properties);
 
+    if (includeInherited)
+    {
+        std::shared_ptr<const FlattenedLayout> flattened;
+        const ErrCode err = getLayout(flattened);
+        OPENDAQ_RETURN_IF_FAILED(err);
+
+        // The callers own the returned list and may modify it, so the cached layout is copied
+        auto list = List<IProperty>();
+        for (const auto& prop : flattened->ordered)
+            list.unsafePushBack(prop);
+
+        *properties = list.detach();
+        return OPENDAQ_SUCCESS;
+    }
+
     if (customOrder.empty())
     {
         return getWithNormalOrder(includeInherited, properties);
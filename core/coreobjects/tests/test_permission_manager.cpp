@@ -281,6 +281,32 @@ TEST_F(PermissionManagerTest, AssignAddPermission)
     ASSERT_TRUE(manager.isAuthorized(admin, Permission::Execute));
 }
 
+TEST_F(PermissionManagerTest, CachedPermissionsParentChange)
+{
+    auto user = User("user", "password", List<IString>("guest"));
+
+    auto managerRoot = PermissionManager();
+    managerRoot.setPermissions(PermissionsBuilder().allow("guest", PermissionMaskBuilder().read().write()).build());
+
+    auto manager = PermissionManager(managerRoot);
+    manager.setPermissions(PermissionsBuilder().inherit(true).build());
+
+    ASSERT_TRUE(manager.isAuthorized(user, Permission::Read));
+    ASSERT_TRUE(manager.isAuthorized(user, Permission::Write));
+
+    managerRoot.setPermissions(PermissionsBuilder().allow("guest", PermissionMaskBuilder().read()).deny("everyone", PermissionMaskBuilder().write()).build());
+
+    ASSERT_TRUE(manager.isAuthorized(user, Permission::Read));
+    ASSERT_FALSE(manager.isAuthorized(user, Permission::Write));
+
+    auto newRoot = PermissionManager();
+    newRoot.setPermissions(PermissionsBuilder().allow("guest", PermissionMaskBuilder().execute()).build());
+    manager.asPtr<IPermissionManagerInternal>().setParent(newRoot);
+
+    ASSERT_FALSE(manager.isAuthorized(user, Permission::Read));
+    ASSERT_TRUE(manager.isAuthorized(user, Permission::Execute));
+}
+
 #else
 
 TEST_F(PermissionManagerTest, CreateDisabledPermissionManager)
@@ -1,6 +1,7 @@
 #include <testutils/testutils.h>
 #include <coreobjects/property_object_class_ptr.h>
 #include <coretypes/type_manager_factory.h>
+#include <coretypes/type_manager_private.h>
 #include <coreobjects/property_factory.h>
 #include <coreobjects/property_object_class_factory.h>
 
@@ -111,3 +112,69 @@ TEST_F(PropertyObjectClassManagerTest, HasPropertyParent)
     ASSERT_TRUE(propObjClass2.hasProperty("Name"));
     manager.removeType("PropertyObject2");
 }
+
+TEST_F(PropertyObjectClassManagerTest, EpochChangesWithTypes)
+{
+    SizeT epoch;
+    manager.asPtr<ITypeManagerPrivate>()->getEpoch(&epoch);
+
+    manager.addType(PropertyObjectClassBuilder("Epoch").build());
+
+    SizeT epochAfterAdd;
+    manager.asPtr<ITypeManagerPrivate>()->getEpoch(&epochAfterAdd);
+    ASSERT_GT(epochAfterAdd, epoch);
+
+    manager.removeType("Epoch");
+
+    SizeT epochAfterRemove;
+    manager.asPtr<ITypeManagerPrivate>()->getEpoch(&epochAfterRemove);
+    ASSERT_GT(epochAfterRemove, epochAfterAdd);
+}
+
+TEST_F(PropertyObjectClassManagerTest, InheritedPropertiesMultipleLevels)
+{
+    manager.addType(PropertyObjectClassBuilder(manager, "Level1")
+                        .setParentName("PropertyObject")
+                        .addProperty(StringProperty("Level1Prop", "level1"))
+                        .addProperty(StringProperty("Name", "overridden"))
+                        .build());
+    const auto level2 = PropertyObjectClassBuilder(manager, "Level2")
+                            .setParentName("Level1")
+                            .addProperty(StringProperty("Level2Prop", "level2"))
+                            .build();
+    manager.addType(level2);
+
+    ASSERT_TRUE(level2.hasProperty("Level1Prop"));
+    ASSERT_TRUE(level2.hasProperty("Index"));
+    ASSERT_FALSE(level2.hasProperty("Missing"));
+    ASSERT_EQ(level2.getProperty("Name").getDefaultValue(), "overridden");
+    ASSERT_THROW(level2.getProperty("Missing"), NotFoundException);
+
+    // repeated calls return equal lists that do not share state with the class
+    auto props = level2.getProperties(true);
+    props.pushBack(StringProperty("Extra", ""));
+    ASSERT_EQ(level2.getProperties(true).getCount(), props.getCount() - 1);
+
+    manager.removeType("Level2");
+    manager.removeType("Level1");
+}
+
+TEST_F(PropertyObjectClassManagerTest, ParentReplaced)
+{
+    manager.addType(PropertyObjectClassBuilder(manager, "Parent").addProperty(StringProperty("Old", "")).build());
+    const auto child = PropertyObjectClassBuilder(manager, "Child").setParentName("Parent").build();
+    manager.addType(child);
+
+    ASSERT_TRUE(child.hasProperty("Old"));
+    ASSERT_EQ(child.getProperties(true).getCount(), 1u);
+
+    manager.removeType("Parent");
+    manager.addType(PropertyObjectClassBuilder(manager, "Parent").addProperty(StringProperty("New", "")).build());
+
+    ASSERT_FALSE(child.hasProperty("Old"));
+    ASSERT_TRUE(child.hasProperty("New"));
+    ASSERT_EQ(child.getProperties(true)[0].getName(), "New");
+
+    manager.removeType("Child");
+    manager.removeType("Parent");
+}
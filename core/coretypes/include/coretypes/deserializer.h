@@ -40,6 +40,9 @@ DECLARE_OPENDAQ_INTERFACE(IDeserializer, IBaseObject)
 
     // customDeserialize should accept ISerializedObject* as parameter
     virtual ErrCode INTERFACE_FUNC callCustomProc(IProcedure* customDeserialize, IString* serialized) = 0;
+
+    // reads the file in fixed-size chunks, so its content is never held in memory as a whole
+    virtual ErrCode INTERFACE_FUNC deserializeFile(IString* fileName, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object) = 0;
 };
 
 /*!
@@ -67,6 +67,19 @@ public:
 
         checkErrorInfo(object->callCustomProc(customProc, serialized));
     }
+
+    BaseObjectPtr deserializeFile(const StringPtr& fileName, const BaseObjectPtr& context = nullptr, const FunctionPtr& factoryCallback = nullptr) const
+    {
+        if (!object)
+        {
+            DAQ_THROW_EXCEPTION(InvalidParameterException);
+        }
+
+        BaseObjectPtr baseObj;
+        checkErrorInfo(object->deserializeFile(fileName, context, factoryCallback, &baseObj));
+
+        return baseObj;
+    }
 };
 
 /*!
@@ -17,6 +17,7 @@
 #pragma once
 #include <utility>
 #include <coretypes/coretypes.h>
+#include <coretypes/slab_allocator.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -29,7 +30,7 @@ template <typename... TInterfaces>
 using EventArgsBase = EventArgsImplTemplate<TInterfaces...>;
 
 template <typename... TInterfaces>
-class EventArgsImplTemplate : public ImplementationOf<TInterfaces...>
+class EventArgsImplTemplate : public ImplementationOf<TInterfaces...>, public SlabAllocated<EventArgsImplTemplate<TInterfaces...>>
 {
 public:
     EventArgsImplTemplate(Int id, const StringPtr& name)
@@ -33,6 +33,7 @@ public:
     ErrCode INTERFACE_FUNC deserialize(IString* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object) override;
     ErrCode INTERFACE_FUNC update(IUpdatable* updatable, IString* serialized, IBaseObject* config) override;
     ErrCode INTERFACE_FUNC callCustomProc(IProcedure* customDeserialize, IString* serialized) override;
+    ErrCode INTERFACE_FUNC deserializeFile(IString* fileName, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object) override;
 
     ErrCode INTERFACE_FUNC toString(CharPtr* str) override;
 
@@ -40,6 +41,10 @@ public:
     static ErrCode Deserialize(JsonValue& document, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object);
 
 private:
+    static constexpr size_t FILE_READ_BUFFER_SIZE = 64 * 1024;
+
+    static ErrCode ParseDocument(IString* serialized, JsonDocument& document);
+    static ErrCode ParseRootObject(IString* serialized, JsonDocument& document, ISerializedObject** serializedObject);
     static ErrCode DeserializeTagged(JsonValue& document, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object);
     static ErrCode DeserializeList(const JsonList& array, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object);
 };
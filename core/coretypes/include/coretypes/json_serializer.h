@@ -15,6 +15,9 @@
  */
 
 #pragma once
+#include <coretypes/serializer.h>
+#include <coretypes/serializer_sink.h>
+#include <coretypes/ctutils.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -44,4 +47,26 @@ inline ISerializer* JsonSerializer_Create(Int version, Bool pretty = False)
     throw std::bad_alloc();
 }
 
+extern "C"
+ErrCode PUBLIC_EXPORT createJsonSerializerWithSink(ISerializer** obj, ISerializerSink* sink, Bool pretty = False);
+
+inline ISerializer* JsonSerializerWithSink_Create(ISerializerSink* sink, Bool pretty = False)
+{
+    ISerializer* obj;
+    ErrCode res = createJsonSerializerWithSink(&obj, sink, pretty);
+    checkErrorInfo(res);
+    return obj;
+}
+
+extern "C"
+ErrCode PUBLIC_EXPORT createJsonSerializerWithSinkAndVersion(ISerializer** obj, ISerializerSink* sink, Int version, Bool pretty = False);
+
+inline ISerializer* JsonSerializerWithSink_Create(ISerializerSink* sink, Int version, Bool pretty = False)
+{
+    ISerializer* obj;
+    ErrCode res = createJsonSerializerWithSinkAndVersion(&obj, sink, version, pretty);
+    checkErrorInfo(res);
+    return obj;
+}
+
 END_NAMESPACE_OPENDAQ
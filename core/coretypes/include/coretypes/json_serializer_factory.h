@@ -19,6 +19,7 @@
 #include <coretypes/serializer.h>
 #include <coretypes/json_serializer.h>
 #include <coretypes/serializer_ptr.h>
+#include <coretypes/serializer_sink_factory.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -32,4 +33,22 @@ inline SerializerPtr JsonSerializerWithVersion(Int version, Bool pretty = False)
     return SerializerPtr(JsonSerializer_Create(version, pretty));
 }
 
+/*!
+ * @brief Creates a JSON serializer that writes its output to the sink in chunks instead of keeping it in memory.
+ * @param sink The sink receiving the output.
+ * @param pretty If true, the output is indented.
+ *
+ * The output of the serializer cannot be retrieved with `getOutput`. Resetting the serializer discards
+ * the output that was not yet passed to the sink.
+ */
+inline SerializerPtr JsonSerializerWithSink(const SerializerSinkPtr& sink, Bool pretty = False)
+{
+    return SerializerPtr(JsonSerializerWithSink_Create(sink, pretty));
+}
+
+inline SerializerPtr JsonSerializerWithSinkAndVersion(const SerializerSinkPtr& sink, Int version, Bool pretty = False)
+{
+    return SerializerPtr(JsonSerializerWithSink_Create(sink, version, pretty));
+}
+
 END_NAMESPACE_OPENDAQ
@@ -16,20 +16,81 @@
 
 #pragma once
 #include <coretypes/serializer.h>
+#include <coretypes/serializer_sink.h>
 #include <coretypes/intfs.h>
 #include <rapidjson/writer.h>
 #include <rapidjson/prettywriter.h>
 #include <coretypes/deserializer.h>
 #include <coretypes/baseobject_factory.h>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
-template <typename TWriter = rapidjson::Writer<rapidjson::StringBuffer>>
+/*
+ * RapidJSON output stream that collects the output into chunks of a fixed size and passes each full chunk
+ * to the sink. The writer flushes the stream when a document is complete. The first error returned by the
+ * sink is kept and no further output is written until the stream is cleared.
+ */
+class JsonSinkStream
+{
+public:
+    using Ch = char;
+
+    static constexpr SizeT ChunkSize = 64 * 1024;
+
+    explicit JsonSinkStream(ISerializerSink* sink)
+        : sink(sink)
+        , errCode(OPENDAQ_SUCCESS)
+    {
+        chunk.reserve(ChunkSize);
+    }
+
+    void Put(Ch c)
+    {
+        chunk.push_back(c);
+        if (chunk.size() >= ChunkSize)
+            writeChunk();
+    }
+
+    void Flush()
+    {
+        writeChunk();
+        if (OPENDAQ_SUCCEEDED(errCode))
+            errCode = sink->flush();
+    }
+
+    void Clear()
+    {
+        chunk.clear();
+        errCode = OPENDAQ_SUCCESS;
+    }
+
+    ErrCode getErrCode() const
+    {
+        return errCode;
+    }
+
+private:
+    void writeChunk()
+    {
+        if (!chunk.empty() && OPENDAQ_SUCCEEDED(errCode))
+            errCode = sink->write(chunk.data(), chunk.size());
+        chunk.clear();
+    }
+
+    ObjectPtr<ISerializerSink> sink;
+    std::vector<Ch> chunk;
+    ErrCode errCode;
+};
+
+template <typename TWriter = rapidjson::Writer<rapidjson::StringBuffer>, typename TBuffer = rapidjson::StringBuffer>
 class JsonSerializerImpl : public ImplementationOf<ISerializer>
 {
 public:
     JsonSerializerImpl();
     JsonSerializerImpl(Int version);
+    explicit JsonSerializerImpl(ISerializerSink* sink);
+    JsonSerializerImpl(ISerializerSink* sink, Int version);
 
     ErrCode INTERFACE_FUNC startList() override;
     ErrCode INTERFACE_FUNC endList() override;
@@ -64,23 +125,27 @@ public:
     ErrCode INTERFACE_FUNC getVersion(Int* version) override;
 
 protected:
-    rapidjson::StringBuffer buffer;
+    ErrCode getOutputStatus() const;
+
+    TBuffer buffer;
     TWriter writer;
     BaseObjectPtr userContext;
     Int version;
 };
 
-template <typename TWriter>
+template <typename TWriter, typename TBuffer>
 template <typename TSerializable>
-ErrCode JsonSerializerImpl<TWriter>::startTaggedObject(TSerializable* obj)
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::startTaggedObject(TSerializable* obj)
 {
     writer.StartObject();
     writer.Key("__type");
     writer.Int(TSerializable::serializeId());
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
 using PrettyJsonSerializer = JsonSerializerImpl<rapidjson::PrettyWriter<rapidjson::StringBuffer>>;
+using JsonSinkSerializer = JsonSerializerImpl<rapidjson::Writer<JsonSinkStream>, JsonSinkStream>;
+using PrettyJsonSinkSerializer = JsonSerializerImpl<rapidjson::PrettyWriter<JsonSinkStream>, JsonSinkStream>;
 
 END_NAMESPACE_OPENDAQ
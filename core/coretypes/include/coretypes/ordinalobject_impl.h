@@ -22,11 +22,13 @@
 #include <coretypes/coretype.h>
 #include <coretypes/coretype_traits.h>
 #include <coretypes/serializable.h>
+#include <coretypes/slab_allocator.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
 template <class V, class Intf, class ... Intfs>
-class OrdinalObjectImpl : public ImplementationOf<Intf, IConvertible, ICoreType, IComparable, ISerializable, Intfs...>
+class OrdinalObjectImpl : public ImplementationOf<Intf, IConvertible, ICoreType, IComparable, ISerializable, Intfs...>,
+                          public SlabAllocated<OrdinalObjectImpl<V, Intf, Intfs...>>
 {
 public:
     using Super = ImplementationOf<Intf, IConvertible, ICoreType, IComparable, ISerializable, Intfs...>;
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup types_serialization
+ * @defgroup types_serializer_sink SerializerSink
+ * @{
+ */
+
+/*!
+ * @brief Receives the output of a serializer in chunks while it is being written.
+ *
+ * A serializer created with a sink keeps at most one chunk of the output in memory and never materializes
+ * the whole document. The sink decides what to do with the chunks, e.g. write them to a file, append them
+ * to a transport buffer or send them to a peer.
+ */
+DECLARE_OPENDAQ_INTERFACE(ISerializerSink, IBaseObject)
+{
+    /*!
+     * @brief Writes the next chunk of the output.
+     * @param data The chunk. Only valid for the duration of the call.
+     * @param length The length of the chunk in bytes.
+     */
+    virtual ErrCode INTERFACE_FUNC write(ConstCharPtr data, SizeT length) = 0;
+
+    /*!
+     * @brief Called once the last chunk of a complete document has been written.
+     */
+    virtual ErrCode INTERFACE_FUNC flush() = 0;
+};
+
+/*!
+ * @}
+ */
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/serializer_sink_impl.h>
+#include <coretypes/objectptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @addtogroup types_serializer_sink
+ * @{
+ */
+
+using SerializerSinkPtr = ObjectPtr<ISerializerSink>;
+
+/*!
+ * @brief Creates a serializer sink that passes every chunk of the output to a callback.
+ * @param writeCallback Called with each chunk of the output. The chunk is only valid for the duration of the call.
+ * @param flushCallback Optional callback called once a complete document has been written.
+ */
+inline SerializerSinkPtr SerializerSink(CallbackSerializerSinkImpl::WriteCallback writeCallback,
+                                        CallbackSerializerSinkImpl::FlushCallback flushCallback = nullptr)
+{
+    return createWithImplementation<ISerializerSink, CallbackSerializerSinkImpl>(std::move(writeCallback), std::move(flushCallback));
+}
+
+/*!
+ * @}
+ */
+
+END_NAMESPACE_OPENDAQ
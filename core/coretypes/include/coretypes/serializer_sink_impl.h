@@ -0,0 +1,77 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/serializer_sink.h>
+#include <coretypes/intfs.h>
+#include <functional>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+class CallbackSerializerSinkImpl : public ImplementationOf<ISerializerSink>
+{
+public:
+    using WriteCallback = std::function<void(const char* data, SizeT length)>;
+    using FlushCallback = std::function<void()>;
+
+    explicit CallbackSerializerSinkImpl(WriteCallback writeCallback, FlushCallback flushCallback = nullptr);
+
+    ErrCode INTERFACE_FUNC write(ConstCharPtr data, SizeT length) override;
+    ErrCode INTERFACE_FUNC flush() override;
+
+private:
+    WriteCallback writeCallback;
+    FlushCallback flushCallback;
+};
+
+inline CallbackSerializerSinkImpl::CallbackSerializerSinkImpl(WriteCallback writeCallback, FlushCallback flushCallback)
+    : writeCallback(std::move(writeCallback))
+    , flushCallback(std::move(flushCallback))
+{
+}
+
+inline ErrCode CallbackSerializerSinkImpl::write(ConstCharPtr data, SizeT length)
+{
+    if (length == 0)
+        return OPENDAQ_SUCCESS;
+
+    OPENDAQ_PARAM_NOT_NULL(data);
+
+    if (!writeCallback)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTASSIGNED);
+
+    const ErrCode errCode = daqTry([&]
+    {
+        writeCallback(data, length);
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+inline ErrCode CallbackSerializerSinkImpl::flush()
+{
+    if (!flushCallback)
+        return OPENDAQ_SUCCESS;
+
+    const ErrCode errCode = daqTry([&]
+    {
+        flushCallback();
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <atomic>
+#include <new>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+struct SlabAllocationCounters
+{
+    const char* typeName;
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> deallocations;
+    SlabAllocationCounters* next;
+};
+
+using SlabCountersCallback = void (*)(const char* typeName, uint64_t allocations, uint64_t deallocations, void* userData);
+
+END_NAMESPACE_OPENDAQ
+
+/*
+ * Size-class slab allocator for small, frequently created objects.
+ *
+ * Blocks are served from thread-local free lists that are refilled from, and drained into, a shared pool
+ * in batches. Memory of freed blocks is kept for reuse and is never returned to the system. Requests larger
+ * than the largest size class fall back to the global operator new.
+ */
+extern "C"
+PUBLIC_EXPORT void* daqSlabAllocate(size_t size);
+
+extern "C"
+PUBLIC_EXPORT void daqSlabFree(void* ptr, size_t size);
+
+extern "C"
+PUBLIC_EXPORT void daqSlabRegisterCounters(daq::SlabAllocationCounters* counters);
+
+// Calls the callback for each type with registered counters; the type name is demangled where supported.
+extern "C"
+PUBLIC_EXPORT void daqSlabEnumerateCounters(daq::SlabCountersCallback callback, void* userData);
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*
+ * Base class of implementations whose instances are allocated with the slab allocator. Allocations and
+ * deallocations are counted per type.
+ *
+ * When the slab allocator is disabled at build time (OPENDAQ_ENABLE_SLAB_ALLOCATOR is not defined), the
+ * class is empty and the instances are allocated with the global operator new.
+ */
+template <typename T>
+class SlabAllocated
+{
+#ifdef OPENDAQ_ENABLE_SLAB_ALLOCATOR
+public:
+    static void* operator new(std::size_t size)
+    {
+        counters().allocations.fetch_add(1, std::memory_order_relaxed);
+        return daqSlabAllocate(size);
+    }
+
+    static void operator delete(void* ptr, std::size_t size) noexcept
+    {
+        counters().deallocations.fetch_add(1, std::memory_order_relaxed);
+        daqSlabFree(ptr, size);
+    }
+
+private:
+    static SlabAllocationCounters& counters()
+    {
+        static SlabAllocationCounters* typeCounters = []
+        {
+            // never deleted, objects can still be freed during static destruction
+            auto newCounters = new SlabAllocationCounters{typeid(T).name(), {0}, {0}, nullptr};
+            daqSlabRegisterCounters(newCounters);
+            return newCounters;
+        }();
+
+        return *typeCounters;
+    }
+#endif
+};
+
+struct SlabAllocationStats
+{
+    std::string typeName;
+    uint64_t allocations;
+    uint64_t deallocations;
+};
+
+inline std::vector<SlabAllocationStats> getSlabAllocationStats()
+{
+    std::vector<SlabAllocationStats> stats;
+
+    daqSlabEnumerateCounters(
+        [](const char* typeName, uint64_t allocations, uint64_t deallocations, void* userData)
+        {
+            auto& stats = *static_cast<std::vector<SlabAllocationStats>*>(userData);
+
+            // counters of the same type can be registered by several modules
+            for (auto& typeStats : stats)
+            {
+                if (typeStats.typeName == typeName)
+                {
+                    typeStats.allocations += allocations;
+                    typeStats.deallocations += deallocations;
+                    return;
+                }
+            }
+
+            stats.push_back({typeName, allocations, deallocations});
+        },
+        &stats);
+
+    return stats;
+}
+
+END_NAMESPACE_OPENDAQ
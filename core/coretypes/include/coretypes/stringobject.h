@@ -81,4 +81,20 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
     SizeT, length
 )
 
+/*!
+ * @brief Returns the interned instance of the string.
+ *
+ * All calls with equal strings return the same object, which is never destroyed. Interned strings are meant for
+ * names that are used as lookup keys, such as property names, so that equality checks of the keys can be resolved
+ * by comparing the object pointers. Their hash code is computed when they are first interned.
+ */
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
+    LIBRARY_FACTORY,
+    InternedStringN,
+    IString,
+    createInternedStringN,
+    ConstCharPtr, str,
+    SizeT, length
+)
+
 END_NAMESPACE_OPENDAQ
@@ -16,6 +16,7 @@
 
 #pragma once
 #include <coretypes/string_ptr.h>
+#include <cstring>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -37,6 +38,27 @@ inline StringPtr String(const std::string& str)
     return obj;
 }
 
+inline StringPtr InternedString(ConstCharPtr str)
+{
+    StringPtr obj(InternedStringN_Create(str, std::strlen(str)));
+    return obj;
+}
+
+inline StringPtr InternedString(const std::string& str)
+{
+    StringPtr obj(InternedStringN_Create(str.c_str(), str.size()));
+    return obj;
+}
+
+inline StringPtr InternedString(const StringPtr& str)
+{
+    if (!str.assigned() || str.getCharPtr() == nullptr)
+        return str;
+
+    StringPtr obj(InternedStringN_Create(str.getCharPtr(), str.getLength()));
+    return obj;
+}
+
 inline StringPtr operator""_daq(const char* str)
 {
     return String(str);
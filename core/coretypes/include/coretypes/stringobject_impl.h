@@ -21,14 +21,17 @@
 #include <coretypes/coretype.h>
 #include <coretypes/comparable.h>
 #include <coretypes/serializable.h>
+#include <coretypes/slab_allocator.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
-class StringImpl : public ImplementationOf<IString, IConvertible, ICoreType, IComparable, ISerializable>
+class StringImpl : public ImplementationOf<IString, IConvertible, ICoreType, IComparable, ISerializable>, public SlabAllocated<StringImpl>
 {
 public:
     StringImpl(ConstCharPtr str);
     StringImpl(ConstCharPtr data, SizeT length);
+    // Copies the string into the given storage, which must outlive the object and hold length + 1 chars
+    StringImpl(ConstCharPtr data, SizeT length, char* storage);
 
     ~StringImpl() override;
 
@@ -57,10 +60,15 @@ public:
     ErrCode INTERFACE_FUNC getSerializeId(ConstCharPtr* id) const override;
 
 private:
+    // Strings shorter than the inline capacity are stored in the object itself, without a separate allocation
+    static constexpr SizeT InlineCapacity = 24;
+
     char* str;
     SizeT hashCode;
     bool hashCalculated;
+    bool ownsStr;
     SizeT length;
+    char inlineStr[InlineCapacity];
 };
 
 END_NAMESPACE_OPENDAQ
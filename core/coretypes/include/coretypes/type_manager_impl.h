@@ -23,6 +23,7 @@
 #include <coretypes/deserializer.h>
 #include <coretypes/procedure_ptr.h>
 #include <coretypes/utility_sync.h>
+#include <atomic>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -38,6 +39,7 @@ public:
     ErrCode INTERFACE_FUNC hasType(IString* typeName, Bool* hasType) override;
 
     ErrCode INTERFACE_FUNC setCoreEventCallback(IProcedure* callback) override;
+    ErrCode INTERFACE_FUNC getEpoch(SizeT* epoch) override;
     
     ErrCode INTERFACE_FUNC serialize(ISerializer* serializer) override;
     ErrCode INTERFACE_FUNC getSerializeId(ConstCharPtr* id) const override;
@@ -51,6 +53,7 @@ private:
     ProcedurePtr coreEventCallback;
     std::unordered_set<std::string> reservedTypeNames;
     daq::mutex sync;
+    std::atomic<SizeT> epoch;
 };
 
 OPENDAQ_REGISTER_DESERIALIZE_FACTORY(TypeManagerImpl)
@@ -27,6 +27,15 @@ BEGIN_NAMESPACE_OPENDAQ
 DECLARE_OPENDAQ_INTERFACE(ITypeManagerPrivate, IBaseObject)
 {
     virtual ErrCode INTERFACE_FUNC setCoreEventCallback(IProcedure* callback) = 0;
+
+    /*!
+     * @brief Gets a counter that is incremented every time a type is added or removed.
+     * @param[out] epoch The current value of the counter.
+     *
+     * Objects that cache information derived from the types of the manager, such as the flattened property
+     * layout of a property object class, compare the counter to detect that the cache is stale.
+     */
+    virtual ErrCode INTERFACE_FUNC getEpoch(SizeT* epoch) = 0;
 };
 
 /*!@}*/
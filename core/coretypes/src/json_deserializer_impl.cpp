@@ -5,7 +5,10 @@
 #include <coretypes/updatable.h>
 #include <coretypes/ctutils.h>
 #include <rapidjson/document.h>
-#include <memory>
+#include <rapidjson/filereadstream.h>
+#include <fmt/format.h>
+#include <cstdio>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -143,78 +146,57 @@ ErrCode JsonDeserializerImpl::Deserialize(JsonValue& document, IBaseObject* cont
     return errCode;
 }
 
-ErrCode JsonDeserializerImpl::deserialize(IString* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object)
+// static
+ErrCode JsonDeserializerImpl::ParseDocument(IString* serialized, JsonDocument& document)
 {
-    OPENDAQ_PARAM_NOT_NULL(serialized);
-
     SizeT length;
-    serialized->getLength(&length);
+    ErrCode errCode = serialized->getLength(&length);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
 
     ConstCharPtr ptr;
-    serialized->getCharPtr(&ptr);
-
-#if defined(_WIN32)
-    constexpr size_t dataPaddingSize = 0;
-#else
-//heap-buffer-overflow in _mm_load_si128 https://github.com/Tencent/rapidjson/issues/1723 
-    constexpr size_t dataPaddingSize = 16;
-#endif 
-
-    char* buffer = new(std::nothrow) char[length + 1 + dataPaddingSize * 2];
-    if (!buffer)
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
-    }
-
-    JsonDocument document;
-    strcpy(&buffer[dataPaddingSize], ptr);
+    errCode = serialized->getCharPtr(&ptr);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
 
-    if (document.ParseInsitu(&buffer[dataPaddingSize]).HasParseError())
-    {
-        delete[] buffer;
+    // Parses straight from the string's buffer. The length-bounded parse reads through a memory stream that never
+    // looks past the end of the input, so the input needs neither a padded copy nor to be parsed in-situ. Only the
+    // string values are copied into the document's allocator.
+    if (document.Parse(ptr, length).HasParseError())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_PARSE_ERROR);
-    }
 
-    ErrCode errCode = Deserialize(document, context, factoryCallback, object);
-    delete[] buffer;
-
-    return errCode;
+    return OPENDAQ_SUCCESS;
 }
 
-ErrCode JsonDeserializerImpl::update(IUpdatable* updatable, IString* serialized, IBaseObject* config)
+// static
+ErrCode JsonDeserializerImpl::ParseRootObject(IString* serialized, JsonDocument& document, ISerializedObject** serializedObject)
 {
-    OPENDAQ_PARAM_NOT_NULL(updatable);
-    OPENDAQ_PARAM_NOT_NULL(serialized);
+    ErrCode errCode = ParseDocument(serialized, document);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
 
-    SizeT length;
-    ErrCode err = serialized->getLength(&length);
-    OPENDAQ_RETURN_IF_FAILED(err);
+    if (document.GetType() != rapidjson::kObjectType)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
 
-    ConstCharPtr ptr;
-    err = serialized->getCharPtr(&ptr);
-    OPENDAQ_RETURN_IF_FAILED(err);
+    return createObject<ISerializedObject, JsonSerializedObject>(serializedObject, document.GetObject(), true);
+}
 
-    std::unique_ptr<char[]> buffer(new(std::nothrow) char[length + 1]);
-    if (!buffer)
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
-    }
+ErrCode JsonDeserializerImpl::deserialize(IString* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object)
+{
+    OPENDAQ_PARAM_NOT_NULL(serialized);
 
     JsonDocument document;
-    strcpy(buffer.get(), ptr);
+    const ErrCode errCode = ParseDocument(serialized, document);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
 
-    if (document.ParseInsitu(buffer.get()).HasParseError())
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_PARSE_ERROR);
-    }
+    return Deserialize(document, context, factoryCallback, object);
+}
 
-    if (document.GetType() != rapidjson::kObjectType)
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
-    }
+ErrCode JsonDeserializerImpl::update(IUpdatable* updatable, IString* serialized, IBaseObject* config)
+{
+    OPENDAQ_PARAM_NOT_NULL(updatable);
+    OPENDAQ_PARAM_NOT_NULL(serialized);
 
+    JsonDocument document;
     SerializedObjectPtr jsonSerObj;
-    ErrCode errCode = createObject<ISerializedObject, JsonSerializedObject>(&jsonSerObj, document.GetObject(), true);
+    const ErrCode errCode = ParseRootObject(serialized, document, &jsonSerObj);
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
     return updatable->update(jsonSerObj, config);
@@ -225,35 +207,9 @@ ErrCode JsonDeserializerImpl::callCustomProc(IProcedure* customDeserialize, IStr
     OPENDAQ_PARAM_NOT_NULL(customDeserialize);
     OPENDAQ_PARAM_NOT_NULL(serialized);
 
-    SizeT length;
-    ErrCode err = serialized->getLength(&length);
-    OPENDAQ_RETURN_IF_FAILED(err);
-
-    ConstCharPtr ptr;
-    err = serialized->getCharPtr(&ptr);
-    OPENDAQ_RETURN_IF_FAILED(err);
-
-    std::unique_ptr<char[]> buffer(new(std::nothrow) char[length + 1]);
-    if (!buffer)
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
-    }
-
     JsonDocument document;
-    strcpy(buffer.get(), ptr);
-
-    if (document.ParseInsitu(buffer.get()).HasParseError())
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_PARSE_ERROR);
-    }
-
-    if (document.GetType() != rapidjson::kObjectType)
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
-    }
-
     SerializedObjectPtr jsonSerObj;
-    ErrCode errCode = createObject<ISerializedObject, JsonSerializedObject>(&jsonSerObj, document.GetObject(), true);
+    ErrCode errCode = ParseRootObject(serialized, document, &jsonSerObj);
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
     const ProcedurePtr proc = ProcedurePtr::Borrow(customDeserialize);
@@ -266,6 +222,34 @@ ErrCode JsonDeserializerImpl::callCustomProc(IProcedure* customDeserialize, IStr
     return errCode;
 }
 
+ErrCode JsonDeserializerImpl::deserializeFile(IString* fileName, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object)
+{
+    OPENDAQ_PARAM_NOT_NULL(fileName);
+
+    ConstCharPtr path;
+    const ErrCode errCode = fileName->getCharPtr(&path);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTFOUND, fmt::format(R"(File "{}" could not be opened)", path));
+
+    // The document is parsed while the file is read chunk by chunk, so unlike deserialize() the input is not
+    // held in memory next to the document.
+    JsonDocument document;
+    {
+        std::vector<char> readBuffer(FILE_READ_BUFFER_SIZE);
+        rapidjson::FileReadStream stream(file, readBuffer.data(), readBuffer.size());
+        document.ParseStream(stream);
+        std::fclose(file);
+    }
+
+    if (document.HasParseError())
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_PARSE_ERROR);
+
+    return Deserialize(document, context, factoryCallback, object);
+}
+
 ErrCode JsonDeserializerImpl::toString(CharPtr* str)
 {
     OPENDAQ_PARAM_NOT_NULL(str);
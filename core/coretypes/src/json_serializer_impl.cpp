@@ -4,22 +4,38 @@
 
 BEGIN_NAMESPACE_OPENDAQ
 
-template <typename TWriter>
-JsonSerializerImpl<TWriter>::JsonSerializerImpl()
+template <typename TWriter, typename TBuffer>
+JsonSerializerImpl<TWriter, TBuffer>::JsonSerializerImpl()
     : writer(buffer)
     , version(3)
 {
 }
 
-template <typename TWriter>
-JsonSerializerImpl<TWriter>::JsonSerializerImpl(Int version)
+template <typename TWriter, typename TBuffer>
+JsonSerializerImpl<TWriter, TBuffer>::JsonSerializerImpl(Int version)
     : writer(buffer)
     , version(version)
 {
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::startTaggedObject(ISerializable* serializable)
+template <typename TWriter, typename TBuffer>
+JsonSerializerImpl<TWriter, TBuffer>::JsonSerializerImpl(ISerializerSink* sink)
+    : buffer(sink)
+    , writer(buffer)
+    , version(3)
+{
+}
+
+template <typename TWriter, typename TBuffer>
+JsonSerializerImpl<TWriter, TBuffer>::JsonSerializerImpl(ISerializerSink* sink, Int version)
+    : buffer(sink)
+    , writer(buffer)
+    , version(version)
+{
+}
+
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::startTaggedObject(ISerializable* serializable)
 {
     OPENDAQ_PARAM_NOT_NULL(serializable);
 
@@ -31,29 +47,29 @@ ErrCode JsonSerializerImpl<TWriter>::startTaggedObject(ISerializable* serializab
     writer.Key("__type");
     writer.String(id);
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::startObject()
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::startObject()
 {
     bool boolean = writer.StartObject();
 
-    return boolean ? OPENDAQ_SUCCESS :  OPENDAQ_ERR_GENERALERROR;
+    return boolean ? getOutputStatus() : OPENDAQ_ERR_GENERALERROR;
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::startList()
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::startList()
 {
     writer.StartArray();
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::endList()
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::endList()
 {
     writer.EndArray();
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
 inline ErrCode getCharLen(ConstCharPtr string, SizeT& length)
@@ -64,8 +80,8 @@ inline ErrCode getCharLen(ConstCharPtr string, SizeT& length)
     return OPENDAQ_SUCCESS;
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::keyRaw(ConstCharPtr string, SizeT length)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::keyRaw(ConstCharPtr string, SizeT length)
 {
     OPENDAQ_PARAM_NOT_NULL(string);
 
@@ -76,11 +92,11 @@ ErrCode JsonSerializerImpl<TWriter>::keyRaw(ConstCharPtr string, SizeT length)
 
     writer.Key(string, static_cast<rapidjson::SizeType>(length));
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::key(ConstCharPtr string)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::key(ConstCharPtr string)
 {
     SizeT length;
     ErrCode errCode = getCharLen(string, length);
@@ -93,11 +109,11 @@ ErrCode JsonSerializerImpl<TWriter>::key(ConstCharPtr string)
 
     writer.Key(string, static_cast<rapidjson::SizeType>(length));
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::keyStr(IString* name)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::keyStr(IString* name)
 {
     OPENDAQ_PARAM_NOT_NULL(name);
 
@@ -109,6 +125,7 @@ ErrCode JsonSerializerImpl<TWriter>::keyStr(IString* name)
 
     SizeT length;
     errCode = name->getLength(&length);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
 
     if (length == 0)
     {
@@ -117,43 +134,43 @@ ErrCode JsonSerializerImpl<TWriter>::keyStr(IString* name)
 
     writer.Key(str, static_cast<rapidjson::SizeType>(length));
 
-    return errCode;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::writeInt(Int integer)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::writeInt(Int integer)
 {
     writer.Int64(integer);
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::writeBool(Bool boolean)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::writeBool(Bool boolean)
 {
     writer.Bool(boolean == True);
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::writeFloat(Float real)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::writeFloat(Float real)
 {
     writer.Double(real);
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::writeNull()
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::writeNull()
 {
     writer.Null();
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::reset()
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::reset()
 {
     buffer.Clear();
     writer.Reset(buffer);
@@ -161,24 +178,24 @@ ErrCode JsonSerializerImpl<TWriter>::reset()
     return OPENDAQ_SUCCESS;
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::isComplete(Bool* complete)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::isComplete(Bool* complete)
 {
     *complete = writer.IsComplete();
 
     return OPENDAQ_SUCCESS;
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::endObject()
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::endObject()
 {
     writer.EndObject();
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::writeString(ConstCharPtr string, SizeT length)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::writeString(ConstCharPtr string, SizeT length)
 {
     if (length == 0)
     {
@@ -189,11 +206,11 @@ ErrCode JsonSerializerImpl<TWriter>::writeString(ConstCharPtr string, SizeT leng
         writer.String(string, static_cast<rapidjson::SizeType>(length));
     }
 
-    return OPENDAQ_SUCCESS;
+    return getOutputStatus();
 }
 
-template <typename TWriter>
-ErrCode INTERFACE_FUNC JsonSerializerImpl<TWriter>::getUser(daq::IBaseObject** user)
+template <typename TWriter, typename TBuffer>
+ErrCode INTERFACE_FUNC JsonSerializerImpl<TWriter, TBuffer>::getUser(daq::IBaseObject** user)
 {
     OPENDAQ_PARAM_NOT_NULL(user);
 
@@ -201,15 +218,15 @@ ErrCode INTERFACE_FUNC JsonSerializerImpl<TWriter>::getUser(daq::IBaseObject** u
     return OPENDAQ_SUCCESS;
 }
 
-template <typename TWriter>
-ErrCode INTERFACE_FUNC JsonSerializerImpl<TWriter>::setUser(daq::IBaseObject* user)
+template <typename TWriter, typename TBuffer>
+ErrCode INTERFACE_FUNC JsonSerializerImpl<TWriter, TBuffer>::setUser(daq::IBaseObject* user)
 {
     this->userContext = user;
     return OPENDAQ_SUCCESS;
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::getVersion(Int* version)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::getVersion(Int* version)
 {
     OPENDAQ_PARAM_NOT_NULL(version);
 
@@ -217,12 +234,29 @@ ErrCode JsonSerializerImpl<TWriter>::getVersion(Int* version)
     return OPENDAQ_SUCCESS;
 }
 
-template <typename TWriter>
-ErrCode JsonSerializerImpl<TWriter>::getOutput(IString** output)
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::getOutput(IString** output)
 {
-    *output = String_Create(buffer.GetString());
+    OPENDAQ_PARAM_NOT_NULL(output);
 
-    return OPENDAQ_SUCCESS;
+    if constexpr (std::is_same_v<TBuffer, JsonSinkStream>)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALID_OPERATION, "The output of the serializer is written to its sink");
+    }
+    else
+    {
+        *output = String_Create(buffer.GetString());
+        return OPENDAQ_SUCCESS;
+    }
+}
+
+template <typename TWriter, typename TBuffer>
+ErrCode JsonSerializerImpl<TWriter, TBuffer>::getOutputStatus() const
+{
+    if constexpr (std::is_same_v<TBuffer, JsonSinkStream>)
+        return buffer.getErrCode();
+    else
+        return OPENDAQ_SUCCESS;
 }
 
 // createJsonSerializer
@@ -277,4 +311,58 @@ ErrCode PUBLIC_EXPORT createJsonSerializerWithVersion(ISerializer** jsonSerializ
     return OPENDAQ_SUCCESS;
 }
 
+// createJsonSerializerWithSink
+extern "C"
+ErrCode PUBLIC_EXPORT createJsonSerializerWithSink(ISerializer** jsonSerializer, ISerializerSink* sink, Bool pretty = False)
+{
+    OPENDAQ_PARAM_NOT_NULL(jsonSerializer);
+    OPENDAQ_PARAM_NOT_NULL(sink);
+
+    ISerializer* object;
+    if (pretty)
+    {
+        object = new(std::nothrow) PrettyJsonSinkSerializer(sink);
+    }
+    else
+    {
+        object = new(std::nothrow) JsonSinkSerializer(sink);
+    }
+
+    if (!object)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
+    }
+
+    object->addRef();
+    *jsonSerializer = object;
+    return OPENDAQ_SUCCESS;
+}
+
+// createJsonSerializerWithSinkAndVersion
+extern "C"
+ErrCode PUBLIC_EXPORT createJsonSerializerWithSinkAndVersion(ISerializer** jsonSerializer, ISerializerSink* sink, Int version, Bool pretty = False)
+{
+    OPENDAQ_PARAM_NOT_NULL(jsonSerializer);
+    OPENDAQ_PARAM_NOT_NULL(sink);
+
+    ISerializer* object;
+    if (pretty)
+    {
+        object = new(std::nothrow) PrettyJsonSinkSerializer(sink, version);
+    }
+    else
+    {
+        object = new(std::nothrow) JsonSinkSerializer(sink, version);
+    }
+
+    if (!object)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
+    }
+
+    object->addRef();
+    *jsonSerializer = object;
+    return OPENDAQ_SUCCESS;
+}
+
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,261 @@
+#include <coretypes/slab_allocator.h>
+#include <cstdlib>
+#include <mutex>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #include <cxxabi.h>
+    #define SLAB_DEMANGLE
+#endif
+
+#if defined(__MINGW32__) | defined(_MSC_VER)
+    #undef DECLARE_OPENDAQ_INTERFACE
+    #undef DECLARE_OPENDAQ_INTERFACE_EX
+    #include <Windows.h>
+    #define SLAB_WINHEAP
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace slab
+{
+    static constexpr std::size_t Granularity = 16;
+    static constexpr std::size_t MaxBlockSize = 256;
+    static constexpr std::size_t SizeClassCount = MaxBlockSize / Granularity;
+    static constexpr std::size_t ChunkSize = 64 * 1024;
+
+    // Number of blocks moved between a thread cache and the shared pool at once
+    static constexpr std::size_t TransferBatch = 64;
+    // A thread cache returns a batch to the shared pool when it holds more free blocks of a size class
+    static constexpr std::size_t MaxThreadCacheBlocks = 4 * TransferBatch;
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* head = nullptr;
+        std::size_t count = 0;
+
+        void push(void* ptr)
+        {
+            auto block = static_cast<FreeBlock*>(ptr);
+            block->next = head;
+            head = block;
+            count++;
+        }
+
+        void* pop()
+        {
+            FreeBlock* block = head;
+            head = block->next;
+            count--;
+            return block;
+        }
+
+        // Moves up to maxCount blocks from this list to the other list
+        void moveTo(FreeList& other, std::size_t maxCount)
+        {
+            while (head != nullptr && maxCount-- > 0)
+                other.push(pop());
+        }
+    };
+
+    static std::size_t sizeClassOf(std::size_t size)
+    {
+        return (size + Granularity - 1) / Granularity - 1;
+    }
+
+    static std::size_t blockSizeOf(std::size_t sizeClass)
+    {
+        return (sizeClass + 1) * Granularity;
+    }
+
+    class SharedPool
+    {
+    public:
+        SharedPool()
+        {
+#ifdef SLAB_WINHEAP
+            // a separate heap keeps the chunks out of the CRT heap statistics used for leak detection
+            heapHandle = HeapCreate(0, 0, 0);
+#endif
+        }
+
+        void fetch(std::size_t sizeClass, FreeList& target)
+        {
+            std::scoped_lock lock(sync);
+
+            auto& list = lists[sizeClass];
+            if (list.head == nullptr)
+                carveChunk(sizeClass, list);
+
+            list.moveTo(target, TransferBatch);
+        }
+
+        void release(std::size_t sizeClass, FreeList& source, std::size_t count)
+        {
+            std::scoped_lock lock(sync);
+            source.moveTo(lists[sizeClass], count);
+        }
+
+        void registerCounters(SlabAllocationCounters* counters)
+        {
+            std::scoped_lock lock(sync);
+            counters->next = countersHead;
+            countersHead = counters;
+        }
+
+        SlabAllocationCounters* getCounters()
+        {
+            std::scoped_lock lock(sync);
+            return countersHead;
+        }
+
+    private:
+        void carveChunk(std::size_t sizeClass, FreeList& list)
+        {
+#ifdef SLAB_WINHEAP
+            auto chunk = static_cast<char*>(HeapAlloc(heapHandle, 0, ChunkSize));
+#else
+            auto chunk = static_cast<char*>(std::malloc(ChunkSize));
+#endif
+            if (chunk == nullptr)
+                throw std::bad_alloc();
+
+            const std::size_t blockSize = blockSizeOf(sizeClass);
+            for (std::size_t offset = 0; offset + blockSize <= ChunkSize; offset += blockSize)
+                list.push(chunk + offset);
+        }
+
+        std::mutex sync;
+        FreeList lists[SizeClassCount];
+        SlabAllocationCounters* countersHead = nullptr;
+#ifdef SLAB_WINHEAP
+        HANDLE heapHandle;
+#endif
+    };
+
+    // Never destroyed, so that objects freed during static destruction and in exiting threads can still be returned
+    static SharedPool& sharedPool()
+    {
+        static SharedPool* pool = new SharedPool();
+        return *pool;
+    }
+
+    class ThreadCache
+    {
+    public:
+        ~ThreadCache();
+
+        void* allocate(std::size_t sizeClass)
+        {
+            auto& list = lists[sizeClass];
+            if (list.head == nullptr)
+                sharedPool().fetch(sizeClass, list);
+
+            return list.pop();
+        }
+
+        void free(void* ptr, std::size_t sizeClass)
+        {
+            auto& list = lists[sizeClass];
+            list.push(ptr);
+
+            if (list.count > MaxThreadCacheBlocks)
+                sharedPool().release(sizeClass, list, TransferBatch);
+        }
+
+    private:
+        FreeList lists[SizeClassCount];
+    };
+
+    // Trivially destructible, so it can be checked after the thread cache of an exiting thread was destroyed
+    static thread_local bool threadCacheDestroyed = false;
+    static thread_local ThreadCache threadCache;
+
+    ThreadCache::~ThreadCache()
+    {
+        threadCacheDestroyed = true;
+
+        for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+            sharedPool().release(sizeClass, lists[sizeClass], lists[sizeClass].count);
+    }
+}
+
+END_NAMESPACE_OPENDAQ
+
+using namespace daq;
+
+extern "C"
+void* daqSlabAllocate(size_t size)
+{
+    if (size == 0 || size > slab::MaxBlockSize)
+        return ::operator new(size);
+
+    const std::size_t sizeClass = slab::sizeClassOf(size);
+    if (slab::threadCacheDestroyed)
+    {
+        slab::FreeList list;
+        slab::sharedPool().fetch(sizeClass, list);
+
+        void* ptr = list.pop();
+        slab::sharedPool().release(sizeClass, list, list.count);
+        return ptr;
+    }
+
+    return slab::threadCache.allocate(sizeClass);
+}
+
+extern "C"
+void daqSlabFree(void* ptr, size_t size)
+{
+    if (ptr == nullptr)
+        return;
+
+    if (size == 0 || size > slab::MaxBlockSize)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    const std::size_t sizeClass = slab::sizeClassOf(size);
+    if (slab::threadCacheDestroyed)
+    {
+        slab::FreeList list;
+        list.push(ptr);
+        slab::sharedPool().release(sizeClass, list, 1);
+        return;
+    }
+
+    slab::threadCache.free(ptr, sizeClass);
+}
+
+extern "C"
+void daqSlabRegisterCounters(SlabAllocationCounters* counters)
+{
+    slab::sharedPool().registerCounters(counters);
+}
+
+extern "C"
+void daqSlabEnumerateCounters(SlabCountersCallback callback, void* userData)
+{
+    if (callback == nullptr)
+        return;
+
+    for (auto counters = slab::sharedPool().getCounters(); counters != nullptr; counters = counters->next)
+    {
+        const auto allocations = counters->allocations.load(std::memory_order_relaxed);
+        const auto deallocations = counters->deallocations.load(std::memory_order_relaxed);
+
+#ifdef SLAB_DEMANGLE
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(counters->typeName, nullptr, nullptr, &status);
+        callback(status == 0 ? demangled : counters->typeName, allocations, deallocations, userData);
+        std::free(demangled);
+#else
+        callback(counters->typeName, allocations, deallocations, userData);
+#endif
+    }
+}
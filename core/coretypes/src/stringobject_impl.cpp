@@ -1,13 +1,25 @@
 #include <coretypes/stringobject_impl.h>
 #include <coretypes/errors.h>
 #include <coretypes/impl.h>
+#include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#if defined(__MINGW32__) | defined(_MSC_VER)
+    #undef DECLARE_OPENDAQ_INTERFACE
+    #undef DECLARE_OPENDAQ_INTERFACE_EX
+    #include <Windows.h>
+    #define INTERN_WINHEAP
+#endif
 
 BEGIN_NAMESPACE_OPENDAQ
 
 StringImpl::StringImpl(ConstCharPtr data, SizeT length)
     : hashCode(0)
     , hashCalculated(false)
+    , ownsStr(false)
     , length(length)
 {
     if (data == nullptr)
@@ -17,13 +29,25 @@ StringImpl::StringImpl(ConstCharPtr data, SizeT length)
     }
     else
     {
-        this->str = new char[length + 1];
+        ownsStr = length >= InlineCapacity;
+        this->str = ownsStr ? new char[length + 1] : inlineStr;
 
         memcpy(this->str, data, length);
         this->str[length] = '\0';
     }
 }
 
+StringImpl::StringImpl(ConstCharPtr data, SizeT length, char* storage)
+    : str(storage)
+    , hashCode(0)
+    , hashCalculated(false)
+    , ownsStr(false)
+    , length(length)
+{
+    memcpy(this->str, data, length);
+    this->str[length] = '\0';
+}
+
 StringImpl::StringImpl(ConstCharPtr str)
     : StringImpl(str, str == nullptr ? 0 : strlen(str))
 {
@@ -31,7 +55,7 @@ StringImpl::StringImpl(ConstCharPtr str)
 
 StringImpl::~StringImpl()
 {
-    if (str != nullptr)
+    if (str != nullptr && ownsStr)
     {
         delete[] str;
         str = nullptr;
@@ -84,6 +108,12 @@ ErrCode StringImpl::equals(IBaseObject* other, Bool* equal) const
 
     if (OPENDAQ_SUCCEEDED(other->borrowInterface(IString::Id, reinterpret_cast<void**>(&otherString))))
     {
+        if (otherString == static_cast<const IString*>(this))
+        {
+            *equal = true;
+            return OPENDAQ_SUCCESS;
+        }
+
         SizeT otherLength;
         auto err = otherString->getLength(&otherLength);
         OPENDAQ_RETURN_IF_FAILED(err);
@@ -240,6 +270,114 @@ ErrCode StringImpl::serialize(ISerializer* serializer)
     return OPENDAQ_SUCCESS;
 }
 
+namespace intern
+{
+    // Interned strings are never freed. Their memory comes from a separate heap on Windows, so it is not
+    // reported by the CRT leak checks of the test listeners.
+    static void* allocate(std::size_t size)
+    {
+#ifdef INTERN_WINHEAP
+        static HANDLE heapHandle = HeapCreate(0, 0, 0);
+        void* ptr = HeapAlloc(heapHandle, 0, size);
+#else
+        void* ptr = std::malloc(size);
+#endif
+        if (ptr == nullptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    template <class T>
+    struct Allocator
+    {
+        using value_type = T;
+
+        Allocator() = default;
+
+        template <class U>
+        constexpr Allocator(const Allocator<U>& /*alloc*/) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(intern::allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* /*p*/, std::size_t /*n*/) noexcept
+        {
+            // the tables only grow, rehashing leaks the old bucket arrays until exit
+        }
+
+        template <class U>
+        bool operator==(const Allocator<U>& /*other*/) const noexcept
+        {
+            return true;
+        }
+
+        template <class U>
+        bool operator!=(const Allocator<U>& /*other*/) const noexcept
+        {
+            return false;
+        }
+    };
+
+    static constexpr std::size_t ShardCount = 16;
+
+    struct Shard
+    {
+        std::mutex sync;
+        std::unordered_map<std::string_view,
+                           IString*,
+                           std::hash<std::string_view>,
+                           std::equal_to<>,
+                           Allocator<std::pair<const std::string_view, IString*>>> strings;
+    };
+
+    // Never destroyed, interned strings can be used until the process exits
+    static Shard* shards()
+    {
+        static Shard* tableShards = new Shard[ShardCount];
+        return tableShards;
+    }
+
+    static IString* intern(std::string_view value)
+    {
+        auto& shard = shards()[std::hash<std::string_view>{}(value) % ShardCount];
+
+        std::scoped_lock lock(shard.sync);
+        if (const auto it = shard.strings.find(value); it != shard.strings.end())
+            return it->second;
+
+        auto storage = static_cast<char*>(allocate(value.size() + 1));
+        IString* str = new StringImpl(value.data(), value.size(), storage);
+        str->addRef();
+
+        // immortal, so it is not reported as leaked by the object tracking
+        daqUntrackObject(str);
+
+        SizeT hashCode;
+        str->getHashCode(&hashCode);
+
+        shard.strings.emplace(std::string_view(storage, value.size()), str);
+        return str;
+    }
+}
+
+extern "C"
+ErrCode PUBLIC_EXPORT createInternedStringN(IString** obj, ConstCharPtr str, SizeT length)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+    OPENDAQ_PARAM_NOT_NULL(str);
+
+    return daqTry([&]
+    {
+        IString* interned = intern::intern(std::string_view(str, length));
+        interned->addRef();
+        *obj = interned;
+    });
+}
+
 OPENDAQ_DEFINE_CLASS_FACTORY(LIBRARY_FACTORY, String, ConstCharPtr, str)
 OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     LIBRARY_FACTORY, StringImpl, IString, createStringN,
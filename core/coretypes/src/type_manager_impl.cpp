@@ -25,6 +25,7 @@ TypeManagerImpl::TypeManagerImpl()
                          "dimensionrule",
                          "range",
                          "scaling"})
+    , epoch(0)
 {
 }
 
@@ -57,6 +58,7 @@ ErrCode TypeManagerImpl::addType(IType* type)
 
         const ErrCode err = types->set(typeName, typePtr);
         OPENDAQ_RETURN_IF_FAILED(err);
+        ++epoch;
     }
 
     const ErrCode errCode = daqTry([&]
@@ -82,6 +84,7 @@ ErrCode TypeManagerImpl::removeType(IString* name)
         BaseObjectPtr obj;
         const ErrCode err = types->remove(name, &obj);
         OPENDAQ_RETURN_IF_FAILED(err);
+        ++epoch;
     }
 
     const ErrCode errCode = daqTry([&]
@@ -136,6 +139,14 @@ ErrCode TypeManagerImpl::setCoreEventCallback(IProcedure* callback)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode TypeManagerImpl::getEpoch(SizeT* epoch)
+{
+    OPENDAQ_PARAM_NOT_NULL(epoch);
+
+    *epoch = this->epoch;
+    return OPENDAQ_SUCCESS;
+}
+
 ErrCode TypeManagerImpl::serialize(ISerializer* serializer)
 {
     std::scoped_lock lock(this->sync);
@@ -1,10 +1,53 @@
 #include <testutils/testutils.h>
 #include <limits>
 #include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
 #include <coretypes/coretypes.h>
 
+#if defined(__GLIBC__)
+    #include <malloc.h>
+#endif
+
 using namespace daq;
 
+static std::string writeTempFile(const std::string& name, const std::string& content)
+{
+    const auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream(path, std::ios::binary) << content;
+    return path;
+}
+
+#if defined(__linux__)
+// Resets the peak resident set size of the process to its current size.
+static bool resetPeakRss()
+{
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    clearRefs.flush();
+    return clearRefs.good();
+}
+
+static size_t readProcStatusKb(const std::string& key)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.rfind(key, 0) == 0)
+            return std::stoul(line.substr(key.size()));
+    }
+    return 0;
+}
+#endif
+
 static ErrCode serializedObjectFactory(ISerializedObject*, IBaseObject*, IFunction*, IBaseObject**)
 {
     return OPENDAQ_SUCCESS;
@@ -360,6 +403,128 @@ TEST_F(JsonDeserializerTest, deserializeNullString)
     ASSERT_THROW(deserializer.deserialize(nullptr), ArgumentNullException);
 }
 
+TEST_F(JsonDeserializerTest, deserializeFile)
+{
+    const auto path = writeTempFile("opendaq_deserialize_file.json", R"([1, "two", [true]])");
+
+    const ListPtr<IBaseObject> list = deserializer.deserializeFile(path);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(list.getCount(), 3u);
+
+    IntegerPtr item1 = list.getItemAt(0);
+    StringPtr item2 = list.getItemAt(1);
+    ListPtr<IBoolean> item3 = list.getItemAt(2);
+    ASSERT_EQ(item1.getValue<Int>(0), 1);
+    ASSERT_EQ(item2.toStdString(), "two");
+    ASSERT_EQ(item3.getCount(), 1u);
+}
+
+TEST_F(JsonDeserializerTest, deserializeFileInvalidJson)
+{
+    const auto path = writeTempFile("opendaq_deserialize_file_invalid.json", "[1, 2");
+
+    ASSERT_THROW(deserializer.deserializeFile(path), DeserializeException);
+    std::remove(path.c_str());
+}
+
+TEST_F(JsonDeserializerTest, deserializeFileMissing)
+{
+    const auto path = (std::filesystem::temp_directory_path() / "opendaq_deserialize_file_missing.json").string();
+
+    ASSERT_THROW(deserializer.deserializeFile(path), NotFoundException);
+}
+
+// Reports the peak memory of deserializing a large file through a string and directly from the file.
+TEST_F(JsonDeserializerTest, deserializeFilePeakMemory)
+{
+#if !defined(__linux__)
+    GTEST_SKIP() << "Peak resident set size is only measured on Linux";
+#else
+    constexpr size_t elementCount = 200000;
+
+    std::string json = "[";
+    for (size_t i = 0; i < elementCount; ++i)
+    {
+        if (i > 0)
+            json += ",";
+        json += R"({"name": "element)" + std::to_string(i) + R"(", "values": [1.5, 2.5, 3.5, 4.5], "enabled": true})";
+    }
+    json += "]";
+
+    const auto path = writeTempFile("opendaq_deserialize_file_large.json", json);
+    const auto fileSizeKb = json.size() / 1024;
+    json = {};
+
+    const auto measurePeakKb = [](const std::function<void()>& deserialize) -> size_t
+    {
+        if (!resetPeakRss())
+            return 0;
+
+        const auto baselineKb = readProcStatusKb("VmRSS:");
+        deserialize();
+        return readProcStatusKb("VmHWM:") - baselineKb;
+    };
+
+    const auto fromStringKb = measurePeakKb([&]
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+
+        const ListPtr<IBaseObject> list = deserializer.deserialize(String(content.str()));
+        ASSERT_EQ(list.getCount(), elementCount);
+    });
+
+    const auto fromFileKb = measurePeakKb([&]
+    {
+        const ListPtr<IBaseObject> list = deserializer.deserializeFile(path);
+        ASSERT_EQ(list.getCount(), elementCount);
+    });
+
+    std::remove(path.c_str());
+
+    if (fromStringKb == 0 || fromFileKb == 0)
+        GTEST_SKIP() << "Peak resident set size cannot be reset";
+
+    RecordProperty("FileSizeKb", std::to_string(fileSizeKb));
+    RecordProperty("PeakFromStringKb", std::to_string(fromStringKb));
+    RecordProperty("PeakFromFileKb", std::to_string(fromFileKb));
+    std::cout << "[          ] file " << fileSizeKb << " kB, peak RSS increase from string " << fromStringKb
+              << " kB, from file " << fromFileKb << " kB" << std::endl;
+#endif
+}
+
+TEST_F(JsonDeserializerTest, customProcReadsRootObject)
+{
+    std::string value;
+    Int count = 0;
+    ProcedurePtr proc = [&value, &count](const SerializedObjectPtr& obj)
+    {
+        value = obj.readString("value");
+        count = obj.readInt("count");
+        ASSERT_TRUE(obj.isRoot());
+    };
+
+    deserializer.callCustomProc(proc, R"({"value": "a\"b\\c", "count": 3} )");
+
+    ASSERT_EQ(value, "a\"b\\c");
+    ASSERT_EQ(count, 3);
+}
+
+TEST_F(JsonDeserializerTest, customProcInvalidJson)
+{
+    ProcedurePtr proc = [](const SerializedObjectPtr&) {};
+
+    ASSERT_THROW(deserializer.callCustomProc(proc, R"({"value": )"), DeserializeException);
+    ASSERT_THROW(deserializer.callCustomProc(proc, "[1, 2]"), InvalidTypeException);
+}
+
+TEST_F(JsonDeserializerTest, DeserializeTrailingContent)
+{
+    ASSERT_THROW(deserializer.deserialize("[1, 2] 3"), DeserializeException);
+}
+
 TEST_F(JsonDeserializerTest, registerFactory)
 {
     ErrCode errCode = daqRegisterSerializerFactory(factoryId, serializedObjectFactory);
@@ -404,3 +404,67 @@ TEST_F(JsonSerializerTest, UserContext)
     auto userContextOut = serializer.getUser();
     ASSERT_EQ(userContext, userContextOut);
 }
+
+TEST_F(JsonSerializerTest, SinkOutputMatchesBufferedOutput)
+{
+    auto list = List<IBaseObject>();
+    for (Int i = 0; i < 20000; ++i)
+        list.pushBack(String("Item " + std::to_string(i)));
+
+    list.serialize(serializer);
+    const std::string expected = serializer.getOutput();
+
+    std::string output;
+    SizeT chunkCount = 0;
+    SizeT flushCount = 0;
+    const auto sink = SerializerSink(
+        [&output, &chunkCount](const char* data, SizeT length)
+        {
+            output.append(data, length);
+            chunkCount++;
+        },
+        [&flushCount] { flushCount++; });
+
+    const auto sinkSerializer = JsonSerializerWithSinkAndVersion(sink, 1);
+    list.serialize(sinkSerializer);
+
+    ASSERT_EQ(output, expected);
+    ASSERT_GT(chunkCount, 1u);
+    ASSERT_EQ(flushCount, 1u);
+    ASSERT_TRUE(sinkSerializer.isComplete());
+}
+
+TEST_F(JsonSerializerTest, SinkGetOutput)
+{
+    const auto sinkSerializer = JsonSerializerWithSink(SerializerSink([](const char*, SizeT) {}));
+    Boolean(true).serialize(sinkSerializer);
+
+    ASSERT_THROW(sinkSerializer.getOutput(), InvalidOperationException);
+}
+
+TEST_F(JsonSerializerTest, SinkError)
+{
+    const auto sink = SerializerSink([](const char*, SizeT) { throw GeneralErrorException("Sink failed"); });
+    const auto sinkSerializer = JsonSerializerWithSink(sink);
+
+    ASSERT_THROW(Boolean(true).serialize(sinkSerializer), GeneralErrorException);
+}
+
+TEST_F(JsonSerializerTest, SinkReset)
+{
+    std::string output;
+    const auto sinkSerializer = JsonSerializerWithSink(SerializerSink([&output](const char* data, SizeT length) { output.append(data, length); }));
+
+    sinkSerializer.startList();
+    sinkSerializer.writeInt(1);
+    sinkSerializer.reset();
+
+    Boolean(true).serialize(sinkSerializer);
+    ASSERT_EQ(output, "true");
+}
+
+TEST_F(JsonSerializerTest, SinkNull)
+{
+    ISerializer* obj;
+    ASSERT_ERROR_CODE_EQ(createJsonSerializerWithSink(&obj, nullptr), OPENDAQ_ERR_ARGUMENT_NULL);
+}
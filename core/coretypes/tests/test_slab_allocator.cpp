@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <coretypes/coretypes.h>
+#include <coretypes/slab_allocator.h>
+#include <cstring>
+#include <thread>
+
+using namespace daq;
+
+using SlabAllocatorTest = testing::Test;
+
+TEST_F(SlabAllocatorTest, AllocateFreeSizes)
+{
+    std::vector<std::pair<void*, size_t>> blocks;
+    for (size_t size = 1; size <= 512; size += 7)
+    {
+        void* ptr = daqSlabAllocate(size);
+        ASSERT_NE(ptr, nullptr);
+        std::memset(ptr, 0xAB, size);
+        blocks.emplace_back(ptr, size);
+    }
+
+    for (const auto& [ptr, size] : blocks)
+        daqSlabFree(ptr, size);
+}
+
+TEST_F(SlabAllocatorTest, FreeOnOtherThread)
+{
+    std::vector<void*> blocks;
+    for (int i = 0; i < 1000; ++i)
+        blocks.push_back(daqSlabAllocate(48));
+
+    std::thread thread([&blocks]
+    {
+        for (auto ptr : blocks)
+            daqSlabFree(ptr, 48);
+    });
+    thread.join();
+
+    void* ptr = daqSlabAllocate(48);
+    ASSERT_NE(ptr, nullptr);
+    daqSlabFree(ptr, 48);
+}
+
+TEST_F(SlabAllocatorTest, InlineAndHeapStrings)
+{
+    const std::string shortString = "short";
+    const std::string longString(100, 'x');
+
+    const auto shortObj = String(shortString);
+    const auto longObj = String(longString);
+
+    ASSERT_EQ(shortObj.toStdString(), shortString);
+    ASSERT_EQ(shortObj.getLength(), shortString.size());
+    ASSERT_EQ(longObj.toStdString(), longString);
+    ASSERT_EQ(longObj.getLength(), longString.size());
+}
+
+#ifdef OPENDAQ_ENABLE_SLAB_ALLOCATOR
+
+TEST_F(SlabAllocatorTest, Counters)
+{
+    const auto countIntegerAllocations = []
+    {
+        uint64_t allocations = 0;
+        for (const auto& stats : getSlabAllocationStats())
+        {
+            if (stats.typeName.find("IInteger") != std::string::npos)
+                allocations += stats.allocations;
+        }
+        return allocations;
+    };
+
+    // make sure the counters are registered
+    Integer(0);
+
+    const auto before = countIntegerAllocations();
+    for (Int i = 0; i < 10; ++i)
+        Integer(i);
+
+    ASSERT_GE(countIntegerAllocations() - before, 10u);
+}
+
+#endif
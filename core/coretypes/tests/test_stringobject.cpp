@@ -223,6 +223,38 @@ TEST_F(StringObjectTest, ImplementationName)
     ASSERT_EQ(className, "daq::StringImpl");
 }
 
+TEST_F(StringObjectTest, Interned)
+{
+    const auto interned1 = InternedString("InternedStringTestName");
+    const auto interned2 = InternedString(std::string("InternedStringTestName"));
+    const auto interned3 = InternedString(String("InternedStringTestName"));
+    const auto other = InternedString("InternedStringTestOther");
+
+    ASSERT_EQ(interned1.getObject(), interned2.getObject());
+    ASSERT_EQ(interned1.getObject(), interned3.getObject());
+    ASSERT_NE(interned1.getObject(), other.getObject());
+
+    ASSERT_EQ(interned1, String("InternedStringTestName"));
+    ASSERT_EQ(interned1.getHashCode(), String("InternedStringTestName").getHashCode());
+    ASSERT_EQ(interned1.getLength(), 22u);
+}
+
+TEST_F(StringObjectTest, InternedLong)
+{
+    const std::string name(100, 'n');
+
+    const auto interned1 = InternedString(name);
+    const auto interned2 = InternedString(name);
+
+    ASSERT_EQ(interned1.getObject(), interned2.getObject());
+    ASSERT_EQ(interned1.toStdString(), name);
+}
+
+TEST_F(StringObjectTest, InternedNull)
+{
+    ASSERT_FALSE(InternedString(StringPtr()).assigned());
+}
+
 static constexpr auto INTERFACE_ID = FromTemplatedTypeName("IString", "daq");
 
 TEST_F(StringObjectTest, InterfaceId)
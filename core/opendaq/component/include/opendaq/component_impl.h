@@ -34,8 +34,10 @@
 #include <coreobjects/core_event_args_impl.h>
 #include <coretypes/recursive_search_ptr.h>
 #include <opendaq/component_private_ptr.h>
+#include <opendaq/component_index_ptr.h>
 #include <opendaq/tags_impl.h>
 #include <cctype>
+#include <algorithm>
 #include <coretypes/coretype_utils.h>
 #include <opendaq/ids_parser.h>
 #include <opendaq/component_status_container_impl.h>
@@ -48,6 +50,9 @@
 #include <opendaq/component_status_container_ptr.h>
 #include <opendaq/component_status_container_private_ptr.h>
 #include <opendaq/search_filter_factory.h>
+#include <tsl/ordered_map.h>
+#include <unordered_map>
+#include <unordered_set>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -70,6 +75,7 @@ public:
                   const StringPtr& localId,
                   const StringPtr& className = nullptr,
                   const StringPtr& name = nullptr);
+    ~ComponentImpl();
 
     // IPropertyObjectInternal
     ErrCode INTERFACE_FUNC enableCoreEventTrigger() override;
@@ -131,8 +137,22 @@ protected:
     virtual ErrCode lockAllAttributesInternal();
     ListPtr<IComponent> searchItems(const SearchFilterPtr& searchFilter, const std::vector<ComponentPtr>& items);
     void setActiveRecursive(const std::vector<ComponentPtr>& items, Bool active);
+    void notifyTreeChanged();
+
+    // Bulk construction scope. Core events of the subtree are muted until the outermost endBulkConstruction,
+    // which triggers a single "ComponentsAdded" event with the roots of all subtrees added within the scope,
+    // and a "ComponentRemoved" event for each removed subtree that existed before the scope. Other core events
+    // of the subtree triggered within the scope are not reported. The scope has no effect on components whose
+    // core events are muted, as they are reported when they are attached to the tree.
+    void beginBulkConstruction();
+    void endBulkConstruction();
 
     ContextPtr context;
+    ComponentIndexPtr componentIndex;
+
+    SizeT bulkConstructionDepth;
+    bool bulkConstructionCoalescing;
+    tsl::ordered_map<std::string, WeakRefPtr<IComponent>> bulkConstructionSnapshot;
 
     bool isComponentRemoved;
     WeakRefPtr<IComponent> parent;
@@ -176,6 +196,7 @@ protected:
 
     virtual BaseObjectPtr getDeserializedParameter(const StringPtr& parameter);
     ComponentPtr findComponentInternal(const ComponentPtr& component, const std::string& id);
+    ComponentPtr findIndexedComponent(const std::string& id);
 
     PropertyObjectPtr getPropertyObjectParent() override;
 
@@ -211,6 +232,8 @@ ComponentImpl<Intf, Intfs...>::ComponentImpl(
         className,
         [&](const CoreEventArgsPtr& args){ triggerCoreEvent(args); })
       , context(context)
+      , bulkConstructionDepth(0)
+      , bulkConstructionCoalescing(false)
       , isComponentRemoved(false)
       , parent(parent)
       , localId(localId)
@@ -249,6 +272,7 @@ ComponentImpl<Intf, Intfs...>::ComponentImpl(
     }
 
     context->getOnCoreEvent(&this->coreEvent);
+    componentIndex = context.asPtrOrNull<IComponentIndex>(true);
     lockedAttributes.insert("Visible");
 
     if (parent.assigned())
@@ -259,6 +283,14 @@ ComponentImpl<Intf, Intfs...>::ComponentImpl(
     }
 }
 
+template <class Intf, class ... Intfs>
+ComponentImpl<Intf, Intfs...>::~ComponentImpl()
+{
+    // Cached query results of the component index hold strong references to the components in the subtree;
+    // they are dropped so that they do not outlive this component
+    notifyTreeChanged();
+}
+
 template <class Intf, class ... Intfs>
 ErrCode ComponentImpl<Intf, Intfs...>::enableCoreEventTrigger()
 {
@@ -783,7 +815,17 @@ ErrCode ComponentImpl<Intf, Intfs...>::findComponent(IString* id, IComponent** o
                 str = restStr;
         }
 
-        *outComponent = findComponentInternal(this->template borrowPtr<ComponentPtr>(), str).detach();
+        ComponentPtr component = findIndexedComponent(str);
+        if (!component.assigned())
+        {
+            component = findComponentInternal(this->template borrowPtr<ComponentPtr>(), str);
+
+            // Components added while core events were muted are indexed once they are found
+            if (component.assigned() && componentIndex.assigned() && !str.empty())
+                checkErrorInfo(componentIndex->indexComponent(component));
+        }
+
+        *outComponent = component.detach();
 
         return *outComponent == nullptr ? OPENDAQ_NOTFOUND : OPENDAQ_SUCCESS;
     });
@@ -1037,6 +1079,106 @@ ListPtr<IComponent> ComponentImpl<Intf, Intfs...>::searchItems(const SearchFilte
     return childList.detach();
 }
 
+template <class Intf, class ... Intfs>
+void ComponentImpl<Intf, Intfs...>::notifyTreeChanged()
+{
+    if (componentIndex.assigned())
+        componentIndex->treeChanged();
+}
+
+template <class Intf, class ... Intfs>
+void ComponentImpl<Intf, Intfs...>::beginBulkConstruction()
+{
+    if (bulkConstructionDepth++ > 0)
+        return;
+
+    if (this->coreEventMuted || !this->coreEvent.assigned())
+        return;
+
+    const auto thisFolder = this->template borrowPtr<ComponentPtr>().template asPtrOrNull<IFolder>(true);
+    if (thisFolder.assigned())
+        for (const auto& item : thisFolder.getItems(search::Recursive(search::Any())))
+            bulkConstructionSnapshot.insert({item.getGlobalId().toStdString(), item});
+
+    checkErrorInfo(this->disableCoreEventTrigger());
+    bulkConstructionCoalescing = true;
+}
+
+template <class Intf, class ... Intfs>
+void ComponentImpl<Intf, Intfs...>::endBulkConstruction()
+{
+    if (bulkConstructionDepth == 0)
+        DAQ_THROW_EXCEPTION(InvalidStateException, "Bulk construction was not started");
+
+    if (--bulkConstructionDepth > 0 || !bulkConstructionCoalescing)
+        return;
+
+    bulkConstructionCoalescing = false;
+    const auto snapshot = std::move(bulkConstructionSnapshot);
+    bulkConstructionSnapshot.clear();
+
+    if (isComponentRemoved)
+        return;
+
+    checkErrorInfo(this->enableCoreEventTrigger());
+
+    const ComponentPtr thisComponent = this->template borrowPtr<ComponentPtr>();
+    const std::string thisGlobalId = globalId.toStdString();
+    const auto parentIdOf = [](const std::string& id) { return id.substr(0, id.rfind('/')); };
+
+    std::unordered_map<std::string, ComponentPtr> kept;
+    std::unordered_set<std::string> added;
+    auto addedRoots = List<IComponent>();
+
+    // The recursive search lists every component before its descendants
+    ListPtr<IComponent> subtree = List<IComponent>();
+    if (const auto thisFolder = thisComponent.template asPtrOrNull<IFolder>(true); thisFolder.assigned())
+        subtree = thisFolder.getItems(search::Recursive(search::Any()));
+
+    for (const auto& item : subtree)
+    {
+        auto id = item.getGlobalId().toStdString();
+        const auto it = snapshot.find(id);
+        if (it != snapshot.end() && it->second.getRef().getObject() == item.getObject())
+        {
+            kept.emplace(std::move(id), item);
+            continue;
+        }
+
+        if (added.find(parentIdOf(id)) == added.end())
+            addedRoots.pushBack(item);
+        added.insert(std::move(id));
+    }
+
+    for (const auto& [id, _] : snapshot)
+    {
+        if (kept.find(id) != kept.end())
+            continue;
+
+        const auto parentId = parentIdOf(id);
+        ComponentPtr sender;
+        if (parentId == thisGlobalId)
+            sender = thisComponent;
+        else if (const auto parentIt = kept.find(parentId); parentIt != kept.end())
+            sender = parentIt->second;
+        else
+            continue;
+
+        const auto args = createWithImplementation<ICoreEventArgs, CoreEventArgsImpl>(
+            CoreEventId::ComponentRemoved,
+            Dict<IString, IBaseObject>({{"Id", id.substr(parentId.size() + 1)}}));
+        this->coreEvent(sender, args);
+    }
+
+    if (addedRoots.getCount() > 0)
+    {
+        const auto args = createWithImplementation<ICoreEventArgs, CoreEventArgsImpl>(
+            CoreEventId::ComponentsAdded,
+            Dict<IString, IBaseObject>({{"Components", addedRoots}}));
+        triggerCoreEvent(args);
+    }
+}
+
 template <class Intf, class ... Intfs>
 void ComponentImpl<Intf, Intfs...>::setActiveRecursive(const std::vector<ComponentPtr>& items, Bool active)
 {
@@ -1160,6 +1302,35 @@ BaseObjectPtr ComponentImpl<Intf, Intfs...>::getDeserializedParameter(const Stri
     return {};
 }
 
+template <class Intf, class ... Intfs>
+ComponentPtr ComponentImpl<Intf, Intfs...>::findIndexedComponent(const std::string& id)
+{
+    if (!componentIndex.assigned() || id.empty())
+        return nullptr;
+
+    ComponentPtr component;
+    const ErrCode errCode = componentIndex->getIndexedComponent(String(globalId.toStdString() + "/" + id), &component);
+    checkErrorInfo(errCode);
+    if (!component.assigned())
+        return nullptr;
+
+    // The index is shared by all component trees of the context, so the component must be verified to be
+    // a descendant of this one
+    ComponentPtr ancestor = component;
+    for (auto depth = std::count(id.begin(), id.end(), '/') + 1; depth > 0 && ancestor.assigned(); --depth)
+        ancestor = ancestor.getParent();
+
+    if (!ancestor.assigned() || ancestor != this->template borrowPtr<ComponentPtr>())
+        return nullptr;
+
+    Bool removed = false;
+    checkErrorInfo(component.asPtr<IRemovable>(true)->isRemoved(&removed));
+    if (removed)
+        return nullptr;
+
+    return component;
+}
+
 template <class Intf, class ... Intfs>
 ComponentPtr ComponentImpl<Intf, Intfs...>::findComponentInternal(const ComponentPtr& component, const std::string& id)
 {
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <coretypes/listobject.h>
+#include <opendaq/component.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_components
+ * @addtogroup opendaq_component Component
+ * @{
+ */
+
+/*!
+ * @brief The recursive queries served from the cached lists of the component index.
+ */
+enum class ComponentIndexQuery : EnumType
+{
+    Signals = 0,    ///< All signals of the root, as returned by a recursive signal search without a filter.
+    InputPorts,     ///< All input ports in the subtree of the root.
+    FunctionBlocks, ///< All function blocks of the root, as returned by a recursive function block search without a filter.
+    Devices         ///< All devices of the root, as returned by a recursive device search without a filter.
+};
+
+/*!
+ * @brief Context-level index of the component tree.
+ *
+ * Maps the global IDs of components to weak references to them. The index is maintained on the `ComponentAdded`,
+ * `ComponentsAdded` and `ComponentRemoved` core events; components added while core events are muted are indexed
+ * the first time they are found by a tree walk.
+ *
+ * The index also keeps versioned lists of the results of common recursive queries. The tree version is increased
+ * whenever a component is added to or removed from any folder of the context, and cached lists are rebuilt on the
+ * first query after the version changes.
+ */
+DECLARE_OPENDAQ_INTERFACE(IComponentIndex, IBaseObject)
+{
+    /*!
+     * @brief Gets an indexed component by its global ID.
+     * @param globalId The global ID of the component.
+     * @param[out] component The component, or nullptr if no live component with the ID is indexed.
+     * @retval OPENDAQ_NOTFOUND if no live component with the ID is indexed.
+     *
+     * The index does not guarantee that the component still belongs to the tree of the caller. Callers must
+     * validate the parent chain if multiple trees with the same global IDs can share the context.
+     */
+    virtual ErrCode INTERFACE_FUNC getIndexedComponent(IString* globalId, IComponent** component) = 0;
+
+    /*!
+     * @brief Adds a component to the index, replacing any component indexed under the same global ID.
+     * @param component The component.
+     */
+    virtual ErrCode INTERFACE_FUNC indexComponent(IComponent* component) = 0;
+
+    /*!
+     * @brief Marks the component tree as changed, invalidating all cached query results.
+     */
+    virtual ErrCode INTERFACE_FUNC treeChanged() = 0;
+
+    /*!
+     * @brief Gets the current version of the component tree.
+     * @param[out] version The version; increased on every change of the tree.
+     */
+    virtual ErrCode INTERFACE_FUNC getTreeVersion(SizeT* version) = 0;
+
+    // [elementType(items, IComponent)]
+    /*!
+     * @brief Gets the result of a recursive query, rebuilt only if the tree changed since the last query.
+     * @param root The component at which the query starts.
+     * @param query The query.
+     * @param[out] items The frozen list of components found by the query. The list is shared between callers
+     * and must not be modified.
+     */
+    virtual ErrCode INTERFACE_FUNC getRecursiveItems(IComponent* root, ComponentIndexQuery query, IList** items) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -80,6 +80,15 @@ DECLARE_OPENDAQ_INTERFACE(IComponentUpdateContext, IBaseObject)
      * The configuration is set from the property `ReAddDevices` of configuration object.
      */
     virtual ErrCode INTERFACE_FUNC getReAddDevicesEnabled(Bool* enabled) = 0;
+
+    /*!
+     * @brief Returns whether the parallel update is enabled. If enabled, independent sibling subtrees are updated
+     * concurrently on the scheduler of the context.
+     * @param[out] enabled The flag indicating whether the parallel update is enabled.
+     *
+     * The configuration is set from the property `ParallelUpdate` of configuration object.
+     */
+    virtual ErrCode INTERFACE_FUNC getParallelUpdateEnabled(Bool* enabled) = 0;
 };
 
 /*!
@@ -20,6 +20,7 @@
 #include <opendaq/signal_ptr.h>
 #include <opendaq/update_parameters_factory.h>
 #include <opendaq/device_ptr.h>
+#include <mutex>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -44,6 +45,7 @@ public:
     ErrCode INTERFACE_FUNC setSignalDependency(IString* signalId, IString* parentId) override;
 
     ErrCode INTERFACE_FUNC getReAddDevicesEnabled(Bool* enabled) override;
+    ErrCode INTERFACE_FUNC getParallelUpdateEnabled(Bool* enabled) override;
 
 private:
     ErrCode INTERFACE_FUNC resolveSignalDependency(IString* signalId, ISignal** signal);
@@ -54,6 +56,9 @@ private:
 
     UpdateParametersPtr config;
 
+    // Guards the connections and signal dependencies, which are registered concurrently
+    // by sibling subtrees during a parallel update.
+    std::mutex sync;
     DictPtr<IString, IDict> connections;
     DictPtr<IString, IString> signalDependencies;
     ListPtr<IString> parentDependencies;
@@ -100,6 +105,8 @@ inline ErrCode ComponentUpdateContextImpl::setInputPortConnection(IString* paren
     OPENDAQ_PARAM_NOT_NULL(portId);
     OPENDAQ_PARAM_NOT_NULL(signalId);
 
+    std::scoped_lock lock(sync);
+
     DictPtr<IString, IString> ports;
     
     if (!connections.hasKey(parentId))
@@ -122,6 +129,7 @@ inline ErrCode ComponentUpdateContextImpl::getInputPortConnections(IString* pare
     OPENDAQ_PARAM_NOT_NULL(parentId);
     OPENDAQ_PARAM_NOT_NULL(connections);
 
+    std::scoped_lock lock(sync);
     DictPtr<IString, IBaseObject> ports = this->connections.getOrDefault(parentId, Dict<IString, IBaseObject>());
     *connections = ports.detach();
     return OPENDAQ_SUCCESS;
@@ -131,6 +139,7 @@ inline ErrCode ComponentUpdateContextImpl::removeInputPortConnection(IString* pa
 {
     OPENDAQ_PARAM_NOT_NULL(parentId);
 
+    std::scoped_lock lock(sync);
     return connections->deleteItem(parentId);
 }
 
@@ -213,21 +222,27 @@ inline ErrCode ComponentUpdateContextImpl::setSignalDependency(IString* signalId
     OPENDAQ_PARAM_NOT_NULL(signalId);
     OPENDAQ_PARAM_NOT_NULL(parentId);
 
+    std::scoped_lock lock(sync);
     signalDependencies.set(signalId, parentId);
     return OPENDAQ_SUCCESS;
 }
 
 inline ErrCode ComponentUpdateContextImpl::resolveSignalDependency(IString* signalId, ISignal** signal)
 {
-    // Check that signal has parent
-    if (!signalDependencies.hasKey(signalId))
-        return OPENDAQ_NOTFOUND;
-    
-    auto parentId = signalDependencies.get(signalId);
+    StringPtr parentId;
+    {
+        std::scoped_lock lock(sync);
 
-    // Check that the parent is function block which is not finished with the update
-    if (!connections.hasKey(parentId + "/IP"))
-        return OPENDAQ_NOTFOUND;
+        // Check that signal has parent
+        if (!signalDependencies.hasKey(signalId))
+            return OPENDAQ_NOTFOUND;
+
+        parentId = signalDependencies.get(signalId);
+
+        // Check that the parent is function block which is not finished with the update
+        if (!connections.hasKey(parentId + "/IP"))
+            return OPENDAQ_NOTFOUND;
+    }
 
     // Find the function block
     ComponentPtr parentComponent;
@@ -240,7 +255,10 @@ inline ErrCode ComponentUpdateContextImpl::resolveSignalDependency(IString* sign
     parentComponent.as<IUpdatable>(true)->updateEnded(this->borrowInterface<IBaseObject>());
 
     // unregister dependency
-    signalDependencies->deleteItem(signalId);
+    {
+        std::scoped_lock lock(sync);
+        signalDependencies->deleteItem(signalId);
+    }
     
     auto signalIdPtr = StringPtr::Borrow(signalId);
     StringPtr signalLocalId = signalIdPtr.toStdString().substr(parentId.getLength());
@@ -263,4 +281,9 @@ inline ErrCode ComponentUpdateContextImpl::getReAddDevicesEnabled(Bool* enabled)
     return config->getReAddDevicesEnabled(enabled);
 }
 
+inline ErrCode ComponentUpdateContextImpl::getParallelUpdateEnabled(Bool* enabled)
+{
+    return config->getParallelUpdateEnabled(enabled);
+}
+
 END_NAMESPACE_OPENDAQ
\ No newline at end of file
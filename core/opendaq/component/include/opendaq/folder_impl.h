@@ -455,6 +455,9 @@ void FolderImpl<Intf, Intfs...>::clearInternal()
         }
     }
 
+    if (!items.empty())
+        this->notifyTreeChanged();
+
     items.clear();
 }
 
@@ -471,7 +474,9 @@ bool FolderImpl<Intf, Intfs...>::addItemInternal(const ComponentPtr& component)
         DAQ_THROW_EXCEPTION(InvalidParameterException, "Type of item not allowed in the folder");
 
     const auto res = items.emplace(component.getLocalId(), component);
-    
+    if (res.second)
+        this->notifyTreeChanged();
+
     return res.second;
 }
 
@@ -596,6 +601,7 @@ bool FolderImpl<Intf, Intfs...>::removeItemWithLocalIdInternal(const std::string
     it->second.template asPtr<IPropertyObjectInternal>(true).disableCoreEventTrigger();
     it->second.remove();
     items.erase(it);
+    this->notifyTreeChanged();
     return true;
 }
 
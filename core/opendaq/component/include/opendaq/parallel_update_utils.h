@@ -0,0 +1,144 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/component_update_context_ptr.h>
+#include <opendaq/context_ptr.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/scheduler_ptr.h>
+#include <opendaq/work_factory.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace parallel_update
+{
+
+using SubtreeUpdate = std::pair<std::string, std::function<void()>>;
+
+/*
+ * Set on the threads that run a subtree of a parallel update. Folders nested in the subtree are updated
+ * sequentially on the same thread, so scheduler workers never block waiting on work queued behind them.
+ */
+inline bool& inSubtreeUpdate()
+{
+    thread_local bool value = false;
+    return value;
+}
+
+/*
+ * Returns true if the update context requests a parallel update, the scheduler has more than one worker and the
+ * calling thread is not already updating a subtree of a parallel update.
+ */
+inline bool isEnabled(const ContextPtr& context, const BaseObjectPtr& updateContext)
+{
+    if (inSubtreeUpdate() || !context.assigned())
+        return false;
+
+    const auto updateContextPtr = updateContext.asPtrOrNull<IComponentUpdateContext>(true);
+    if (!updateContextPtr.assigned() || !updateContextPtr.getParallelUpdateEnabled())
+        return false;
+
+    const auto scheduler = context.getScheduler();
+    return scheduler.assigned() && scheduler.isMultiThreaded();
+}
+
+/*
+ * Runs the subtree updates on the scheduler of the context and blocks until all of them complete. The time spent
+ * on each subtree is logged as it completes. If any of the updates throws, the first exception is rethrown once
+ * all updates have finished. Updates that cannot be scheduled are run on the calling thread.
+ */
+inline void run(const ContextPtr& context,
+                const LoggerComponentPtr& loggerComponent,
+                const std::string& parentId,
+                const std::vector<SubtreeUpdate>& updates)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    SizeT completed = 0;
+    std::exception_ptr firstException;
+
+    const auto start = Clock::now();
+    const auto runUpdate = [&](const SubtreeUpdate& update)
+    {
+        const auto subtreeStart = Clock::now();
+        std::exception_ptr exception;
+
+        const bool wasInSubtreeUpdate = inSubtreeUpdate();
+        inSubtreeUpdate() = true;
+        try
+        {
+            update.second();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+            daqClearErrorInfo();
+        }
+        inSubtreeUpdate() = wasInSubtreeUpdate;
+
+        [[maybe_unused]] const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - subtreeStart).count();
+
+        std::scoped_lock lock(mutex);
+        completed++;
+        if (exception && !firstException)
+            firstException = exception;
+
+        if (loggerComponent.assigned())
+        {
+            LOG_D("{}: Updated subtree {} in {} us ({}/{})", parentId, update.first, elapsed, completed, updates.size())
+        }
+
+        cv.notify_one();
+    };
+
+    const auto scheduler = context.getScheduler();
+    for (const auto& update : updates)
+    {
+        const ErrCode errCode = scheduler->scheduleWork(Work([&runUpdate, &update] { runUpdate(update); }));
+        if (OPENDAQ_FAILED(errCode))
+        {
+            daqClearErrorInfo();
+            runUpdate(update);
+        }
+    }
+
+    std::unique_lock lock(mutex);
+    cv.wait(lock, [&completed, &updates] { return completed == updates.size(); });
+
+    if (loggerComponent.assigned())
+    {
+        [[maybe_unused]] const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+        LOG_I("{}: Updated {} subtrees in parallel in {} ms", parentId, updates.size(), elapsed)
+    }
+
+    if (firstException)
+        std::rethrow_exception(firstException);
+}
+
+}
+
+END_NAMESPACE_OPENDAQ
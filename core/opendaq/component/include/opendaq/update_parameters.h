@@ -55,6 +55,27 @@ DECLARE_OPENDAQ_INTERFACE(IUpdateParameters, IPropertyObject)
      * The configuration is set to the property `ReAddDevices` of configuration object.
      */
     virtual ErrCode INTERFACE_FUNC setReAddDevicesEnabled(Bool enabled) = 0;
+
+    /*!
+     * @brief Returns whether the parallel update is enabled. If enabled, the existing channels and function blocks
+     * of a component are updated concurrently on the scheduler of the context.
+     * @param[out] enabled The flag indicating whether the parallel update is enabled.
+     *
+     * The configuration is set from the property `ParallelUpdate` of configuration object.
+     */
+    virtual ErrCode INTERFACE_FUNC getParallelUpdateEnabled(Bool* enabled) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets the parallel update enabled flag.
+     * @param enabled The flag indicating whether the parallel update is enabled.
+     *
+     * The configuration is set to the property `ParallelUpdate` of configuration object. Only the properties and
+     * child components of sibling subtrees are applied concurrently; connections, domain signals and the update-end
+     * callbacks are still resolved sequentially once all subtrees are updated. The parallel update should not be
+     * started from a thread that holds the configuration lock of the component tree.
+     */
+    virtual ErrCode INTERFACE_FUNC setParallelUpdateEnabled(Bool enabled) = 0;
 };
 /*!@}*/
 
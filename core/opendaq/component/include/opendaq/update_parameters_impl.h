@@ -29,6 +29,8 @@ public:
 
     ErrCode INTERFACE_FUNC getReAddDevicesEnabled(Bool* enabled) override;
     ErrCode INTERFACE_FUNC setReAddDevicesEnabled(Bool enabled) override;
+    ErrCode INTERFACE_FUNC getParallelUpdateEnabled(Bool* enabled) override;
+    ErrCode INTERFACE_FUNC setParallelUpdateEnabled(Bool enabled) override;
 
 protected:
     template <typename T>
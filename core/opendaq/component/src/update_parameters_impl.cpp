@@ -6,6 +6,7 @@ UpdateParametersImpl::UpdateParametersImpl()
 {
     Super::addProperty(BoolProperty("ReAddDevices", false));
     Super::addProperty(BoolProperty("RemoteUpdate", false));
+    Super::addProperty(BoolProperty("ParallelUpdate", false));
 }
 
 template <typename T>
@@ -30,6 +31,24 @@ ErrCode UpdateParametersImpl::setReAddDevicesEnabled(Bool enabled)
     return Super::setPropertyValue(String("ReAddDevices"), BooleanPtr(enabled));
 }
 
+ErrCode UpdateParametersImpl::getParallelUpdateEnabled(Bool* enabled)
+{
+    OPENDAQ_PARAM_NOT_NULL(enabled);
+
+    const ErrCode errCode = daqTry([&]
+    {
+        *enabled = getTypedProperty<IBoolean>("ParallelUpdate");
+        return OPENDAQ_SUCCESS;
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+ErrCode UpdateParametersImpl::setParallelUpdateEnabled(Bool enabled)
+{
+    return Super::setPropertyValue(String("ParallelUpdate"), BooleanPtr(enabled));
+}
+
 OPENDAQ_DEFINE_CLASS_FACTORY(LIBRARY_FACTORY, UpdateParameters)
 
 END_NAMESPACE_OPENDAQ
\ No newline at end of file
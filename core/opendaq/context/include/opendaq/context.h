@@ -113,6 +113,16 @@ DECLARE_OPENDAQ_INTERFACE(IContext, IBaseObject)
      * @param[out] servers The dictionary of available discovery servers.
      */
     virtual ErrCode INTERFACE_FUNC getDiscoveryServers(IDict** servers) = 0;
+
+    /*!
+     * @brief Gets the context-wide mDNS discovery cache as a Base Object.
+     * @param[out] cache The discovery cache.
+     *
+     * The cache is shared by all client modules of the instance. It passively listens for mDNS announcements
+     * of the service types registered by the modules, so that listing the available devices does not require
+     * a new query on every call. The cache is created on first access.
+     */
+    virtual ErrCode INTERFACE_FUNC getDiscoveryCache(IBaseObject** cache) = 0;
 };
 /*!@}*/
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/component_index_ptr.h>
+#include <opendaq/device_ptr.h>
+#include <opendaq/function_block_ptr.h>
+#include <opendaq/input_port_ptr.h>
+#include <opendaq/search_filter_factory.h>
+#include <opendaq/signal_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace component_index
+{
+
+/*
+ * Runs a recursive query against the component tree. Devices and function blocks are queried through their
+ * own recursive getters, so the results match a recursive search with no filter.
+ */
+inline ListPtr<IComponent> buildRecursiveItems(const ComponentPtr& root, ComponentIndexQuery query)
+{
+    const auto device = root.asPtrOrNull<IDevice>(true);
+    const auto functionBlock = root.asPtrOrNull<IFunctionBlock>(true);
+    const auto folder = root.asPtrOrNull<IFolder>(true);
+
+    IntfID intfId;
+    switch (query)
+    {
+        case ComponentIndexQuery::Signals:
+            if (device.assigned())
+                return device.getSignals(search::Recursive(search::Any()));
+            if (functionBlock.assigned())
+                return functionBlock.getSignals(search::Recursive(search::Any()));
+            intfId = ISignal::Id;
+            break;
+        case ComponentIndexQuery::FunctionBlocks:
+            if (device.assigned())
+                return device.getFunctionBlocks(search::Recursive(search::Any()));
+            if (functionBlock.assigned())
+                return functionBlock.getFunctionBlocks(search::Recursive(search::Any()));
+            intfId = IFunctionBlock::Id;
+            break;
+        case ComponentIndexQuery::Devices:
+            if (device.assigned())
+                return device.getDevices(search::Recursive(search::Any()));
+            intfId = IDevice::Id;
+            break;
+        case ComponentIndexQuery::InputPorts:
+            intfId = IInputPort::Id;
+            break;
+        default:
+            DAQ_THROW_EXCEPTION(InvalidParameterException, "Unknown component index query");
+    }
+
+    if (!folder.assigned())
+        return List<IComponent>();
+
+    return folder.getItems(search::Recursive(search::InterfaceId(intfId)));
+}
+
+/*
+ * Gets the result of a recursive query from the component index of the root's context. Falls back to running
+ * the query if the context has no index. The returned list must not be modified.
+ */
+inline ListPtr<IComponent> getRecursiveItems(const ComponentPtr& root, ComponentIndexQuery query)
+{
+    const auto context = root.getContext();
+    const ComponentIndexPtr index = context.assigned() ? context.asPtrOrNull<IComponentIndex>(true) : nullptr;
+    if (!index.assigned())
+        return buildRecursiveItems(root, query);
+
+    return index.getRecursiveItems(root, query);
+}
+
+}
+
+END_NAMESPACE_OPENDAQ
@@ -40,6 +40,18 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     IComponent*, component
 )
 
+/*!
+ * @brief Creates Core event args that are passed as argument at the end of a bulk construction scope.
+ * @param components The list of the roots of the added subtrees.
+ *
+ * The sender of the event is always the folder that owns the bulk construction scope.
+ * The ID of the event is 200, and the event name is "ComponentsAdded".
+ */
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, CoreEventArgsComponentsAdded, ICoreEventArgs,
+    IList*, components
+)
+
 /*!
  * @brief Creates Core event args that are passed as argument when a component is removed from the list of children.
  * @param componentId The local ID of the removed component.
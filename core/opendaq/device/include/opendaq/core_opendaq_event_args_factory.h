@@ -41,6 +41,19 @@ inline CoreEventArgsPtr CoreEventArgsComponentAdded(const ComponentPtr& componen
     return obj;
 }
 
+/*!
+ * @brief Creates Core event args that are passed as argument at the end of a bulk construction scope.
+ * @param components The list of the roots of the added subtrees.
+ *
+ * The sender of the event is always the folder that owns the bulk construction scope.
+ * The ID of the event is 200, and the event name is "ComponentsAdded".
+ */
+inline CoreEventArgsPtr CoreEventArgsComponentsAdded(const ListPtr<IComponent>& components)
+{
+    CoreEventArgsPtr obj(CoreEventArgsComponentsAdded_Create(components));
+    return obj;
+}
+
 /*!
  * @brief Creates Core event args that are passed as argument when a component is removed from the list of children.
  * @param componentId The local ID of the removed component.
@@ -238,6 +238,9 @@ DECLARE_OPENDAQ_INTERFACE(IDevice, IFolder)
     /*!
      * @brief Saves the configuration of the device to string.
      * @param[out] configuration Serialized configuration of the device.
+     *
+     * To write a large configuration without holding all of it in memory, pass a serializer created with
+     * `JsonSerializerWithSink` to `serializeForUpdate` of the device's `IUpdatable` interface instead.
      */
     virtual ErrCode INTERFACE_FUNC saveConfiguration(IString** configuration) = 0;
 
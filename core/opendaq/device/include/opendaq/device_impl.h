@@ -51,6 +51,8 @@
 #include <opendaq/module_info_factory.h>
 #include <opendaq/component_type_private.h>
 #include <opendaq/mirrored_device_ptr.h>
+#include <opendaq/connection_statistics_utils.h>
+#include <opendaq/component_index_utils.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 template <typename TInterface = IDevice, typename... Interfaces>
@@ -258,6 +260,7 @@ private:
     ErrCode unlockInternal(IUser* user);
     ErrCode forceUnlockInternal();
     ErrCode revertLockedDevices(ListPtr<IDevice> devices, const std::vector<bool>& targetLockStatuses, size_t deviceCount, IUser* user, bool doLock);
+    void addConnectionStatisticsProperty();
 
     DeviceDomainPtr deviceDomain;
     OperationModeType operationMode {OperationModeType::Idle};
@@ -307,6 +310,33 @@ GenericDevice<TInterface, Interfaces...>::GenericDevice(const ContextPtr& ctx,
     devices.asPtr<IComponentPrivate>().unlockAttributes(List<IString>("Active"));
     ioFolder.asPtr<IComponentPrivate>().unlockAttributes(List<IString>("Active"));
     servers.asPtr<IComponentPrivate>().unlockAttributes(List<IString>("Active"));
+
+    // mirrored devices receive the statistics of the remote device when they are deserialized
+    if constexpr (!std::is_base_of_v<IMirroredDevice, TInterface>)
+    {
+        if (getConnectionStatisticsEnabled(this->context.getOptions()))
+            addConnectionStatisticsProperty();
+    }
+}
+
+template <typename TInterface, typename... Interfaces>
+void GenericDevice<TInterface, Interfaces...>::addConnectionStatisticsProperty()
+{
+    Super::addProperty(
+        ObjectPropertyBuilder("ConnectionStatistics", connection_statistics::createStatisticsObject(true)).setReadOnly(true).build());
+
+    const PropertyObjectPtr statistics = this->objPtr.getPropertyValue("ConnectionStatistics");
+    connection_statistics::bindStatisticsObject(
+        statistics,
+        [deviceRef = this->template getWeakRefInternal<IDevice>()]() -> DictPtr<IString, IBaseObject>
+        {
+            const auto device = deviceRef.getRef();
+            if (!device.assigned())
+                return nullptr;
+
+            const ListPtr<IInputPort> inputPorts = component_index::getRecursiveItems(device, ComponentIndexQuery::InputPorts);
+            return connection_statistics::aggregate(inputPorts);
+        });
 }
 
 template <typename TInterface, typename... Interfaces>
@@ -1831,6 +1861,7 @@ inline IoFolderConfigPtr GenericDevice<TInterface, Interfaces...>::addIoFolder(c
             folder.template asPtr<IPropertyObjectInternal>().setLockingStrategy(lockingStrategy);
 
         this->components.push_back(folder);
+        this->notifyTreeChanged();
 
         if (!this->coreEventMuted && this->coreEvent.assigned())
         {
@@ -2097,13 +2128,15 @@ void GenericDevice<TInterface, Interfaces...>::updateIoFolderItem(const FolderPt
         const auto updatableFolder = item.asPtr<IUpdatable>(true);
         updatableFolder.updateInternal(serializedItem, context);
 
-        this->updateFolder(serializedItem,
-                           "IoFolder",
-                           "",
-                           [this, &item, &context](const std::string& itemId, const SerializedObjectPtr& obj)
-                           {
-                               updateIoFolderItem(item, itemId, obj, context);
-                           });
+        this->updateFolderItems(serializedItem,
+                                "IoFolder",
+                                "",
+                                item.asPtr<IFolder>(true),
+                                context,
+                                [this, &item, &context](const std::string& itemId, const SerializedObjectPtr& obj)
+                                {
+                                    updateIoFolderItem(item, itemId, obj, context);
+                                });
     }
 }
 
@@ -2240,11 +2273,13 @@ void GenericDevice<TInterface, Interfaces...>::updateObject(const SerializedObje
         const auto ioFolder = obj.readSerializedObject("IO");
         ioFolder.checkObjectType("IoFolder");
 
-        this->updateFolder(ioFolder,
-                           "IoFolder",
-                           "",
-                           [this, &context](const std::string& localId, const SerializedObjectPtr& obj)
-                           { updateIoFolderItem(this->ioFolder, localId, obj, context); });
+        this->updateFolderItems(ioFolder,
+                                "IoFolder",
+                                "",
+                                this->ioFolder,
+                                context,
+                                [this, &context](const std::string& localId, const SerializedObjectPtr& obj)
+                                { updateIoFolderItem(this->ioFolder, localId, obj, context); });
     }
 
     const auto keys = obj.getKeys();
@@ -13,6 +13,13 @@ ErrCode PUBLIC_EXPORT createCoreEventArgsComponentAdded(ICoreEventArgs** objTmp,
     return daq::createObject<ICoreEventArgs, CoreEventArgsImpl, CoreEventId, IDict*>(objTmp, CoreEventId::ComponentAdded, dict);
 }
 
+extern "C"
+ErrCode PUBLIC_EXPORT createCoreEventArgsComponentsAdded(ICoreEventArgs** objTmp, IList* components)
+{
+    const auto dict = Dict<IString, IBaseObject>({{"Components", components}});
+    return daq::createObject<ICoreEventArgs, CoreEventArgsImpl, CoreEventId, IDict*>(objTmp, CoreEventId::ComponentsAdded, dict);
+}
+
 extern "C"
 ErrCode PUBLIC_EXPORT createCoreEventArgsComponentRemoved(ICoreEventArgs** objTmp, IString* componentId)
 {
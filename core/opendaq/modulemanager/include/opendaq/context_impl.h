@@ -23,10 +23,16 @@
 #include <coretypes/type_manager_ptr.h>
 #include <coreobjects/authentication_provider_ptr.h>
 #include <opendaq/discovery_server_ptr.h>
+#include <opendaq/component_index.h>
+#include <opendaq/component_ptr.h>
+#include <coretypes/weakrefptr.h>
+
+#include <atomic>
+#include <map>
 
 BEGIN_NAMESPACE_OPENDAQ
 
-class ContextImpl : public ImplementationOf<IContext, IContextInternal>
+class ContextImpl : public ImplementationOf<IContext, IContextInternal, IComponentIndex>
 {
 public:
     explicit ContextImpl(SchedulerPtr scheduler,
@@ -48,9 +54,25 @@ public:
     ErrCode INTERFACE_FUNC getOptions(IDict** options) override;
     ErrCode INTERFACE_FUNC getModuleOptions(IString* moduleId, IDict** options) override;
     ErrCode INTERFACE_FUNC getDiscoveryServers(IDict** servers) override;
+    ErrCode INTERFACE_FUNC getDiscoveryCache(IBaseObject** cache) override;
+
+    // IComponentIndex
+    ErrCode INTERFACE_FUNC getIndexedComponent(IString* globalId, IComponent** component) override;
+    ErrCode INTERFACE_FUNC indexComponent(IComponent* component) override;
+    ErrCode INTERFACE_FUNC treeChanged() override;
+    ErrCode INTERFACE_FUNC getTreeVersion(SizeT* version) override;
+    ErrCode INTERFACE_FUNC getRecursiveItems(IComponent* root, ComponentIndexQuery query, IList** items) override;
 
 private:
+    struct CachedItems
+    {
+        SizeT treeVersion;
+        WeakRefPtr<IComponent> root;
+        ListPtr<IComponent> items;
+    };
+
     void componentCoreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs);
+    void updateComponentIndex(const ComponentPtr& component, const CoreEventArgsPtr& eventArgs);
     void registerOpenDaqTypes();
 
     LoggerPtr logger;
@@ -62,6 +84,14 @@ private:
     EventEmitter<ComponentPtr, CoreEventArgsPtr> coreEvent;
     DictPtr<IString, IBaseObject> options;
     DictPtr<IString, IDiscoveryServer> discoveryServers;
+
+    std::mutex discoveryCacheSync;
+    BaseObjectPtr discoveryCache;
+
+    std::mutex componentIndexSync;
+    std::atomic<SizeT> treeVersion;
+    std::map<std::string, WeakRefPtr<IComponent>> indexedComponents;
+    std::map<std::pair<std::string, ComponentIndexQuery>, CachedItems> cachedItems;
 };
 
 END_NAMESPACE_OPENDAQ
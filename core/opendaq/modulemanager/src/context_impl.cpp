@@ -10,6 +10,9 @@
 #include <coreobjects/property_object_class_factory.h>
 #include <coreobjects/property_object_factory.h>
 #include <coreobjects/coreobjects.h>
+#include <daq_discovery/mdns_discovery_cache.h>
+#include <opendaq/component_index_utils.h>
+#include <opendaq/folder_ptr.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -27,6 +30,7 @@ ContextImpl::ContextImpl(SchedulerPtr scheduler,
     , authenticationProvider(std::move(authenticationProvider))
     , options(std::move(options))
     , discoveryServers(std::move(discoveryServices))
+    , treeVersion(0)
 {
     if (!this->logger.assigned())
         DAQ_THROW_EXCEPTION(ArgumentNullException, "Logger must not be null");
@@ -195,6 +199,17 @@ ErrCode ContextImpl::getModuleOptions(IString* moduleId, IDict** options)
 
 void ContextImpl::componentCoreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs)
 {
+    try
+    {
+        updateComponentIndex(component, eventArgs);
+    }
+    catch (const std::exception& e)
+    {
+        // The index is only a cache; components missing from it are found by walking the tree
+        const auto loggerComponent = this->logger.getOrAddComponent("Component");
+        LOG_D("Failed to update the component index on core event {}: {}", eventArgs.getEventName(), e.what())
+    }
+
     if (!component.assigned())
         return;
 
@@ -227,6 +242,178 @@ ErrCode ContextImpl::getDiscoveryServers(IDict** servers)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode ContextImpl::getDiscoveryCache(IBaseObject** cache)
+{
+    OPENDAQ_PARAM_NOT_NULL(cache);
+
+    return daqTry([&]
+    {
+        std::scoped_lock lock(discoveryCacheSync);
+        if (!discoveryCache.assigned())
+            discoveryCache = discovery::MdnsDiscoveryCache();
+
+        *cache = discoveryCache.addRefAndReturn();
+    });
+}
+
+static bool isInSubtree(const std::string& globalId, const std::string& rootId)
+{
+    return globalId.size() >= rootId.size() && globalId.compare(0, rootId.size(), rootId) == 0 &&
+           (globalId.size() == rootId.size() || globalId[rootId.size()] == '/');
+}
+
+void ContextImpl::updateComponentIndex(const ComponentPtr& component, const CoreEventArgsPtr& eventArgs)
+{
+    switch (static_cast<CoreEventId>(eventArgs.getEventId()))
+    {
+        case CoreEventId::ComponentAdded:
+        case CoreEventId::ComponentsAdded:
+        {
+            // Components are added with their subtree, for which no separate events are triggered
+            ListPtr<IComponent> roots;
+            if (eventArgs.getEventId() == static_cast<Int>(CoreEventId::ComponentAdded))
+                roots = List<IComponent>(ComponentPtr(eventArgs.getParameters().get("Component")));
+            else
+                roots = eventArgs.getParameters().get("Components");
+
+            std::vector<std::pair<std::string, WeakRefPtr<IComponent>>> subtree;
+            for (const auto& added : roots)
+            {
+                subtree.emplace_back(added.getGlobalId().toStdString(), added);
+                if (const auto folder = added.asPtrOrNull<IFolder>(true); folder.assigned())
+                    for (const auto& item : folder.getItems(search::Recursive(search::Any())))
+                        subtree.emplace_back(item.getGlobalId().toStdString(), item);
+            }
+
+            std::scoped_lock lock(componentIndexSync);
+            for (auto& [id, ref] : subtree)
+                indexedComponents.insert_or_assign(std::move(id), std::move(ref));
+            break;
+        }
+        case CoreEventId::ComponentRemoved:
+        {
+            if (!component.assigned())
+                break;
+
+            const StringPtr localId = eventArgs.getParameters().get("Id");
+            const std::string removedId = component.getGlobalId().toStdString() + "/" + localId.toStdString();
+
+            std::scoped_lock lock(componentIndexSync);
+            for (auto it = indexedComponents.lower_bound(removedId); it != indexedComponents.end() && isInSubtree(it->first, removedId);)
+                it = indexedComponents.erase(it);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+ErrCode ContextImpl::getIndexedComponent(IString* globalId, IComponent** component)
+{
+    OPENDAQ_PARAM_NOT_NULL(globalId);
+    OPENDAQ_PARAM_NOT_NULL(component);
+
+    const ErrCode errCode = daqTry([&]
+    {
+        ComponentPtr found;
+        {
+            std::scoped_lock lock(componentIndexSync);
+            const auto it = indexedComponents.find(StringPtr::Borrow(globalId).toStdString());
+            if (it != indexedComponents.end())
+            {
+                found = it->second.getRef();
+                if (!found.assigned())
+                    indexedComponents.erase(it);
+            }
+        }
+
+        *component = found.detach();
+        return *component == nullptr ? OPENDAQ_NOTFOUND : OPENDAQ_SUCCESS;
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+ErrCode ContextImpl::indexComponent(IComponent* component)
+{
+    OPENDAQ_PARAM_NOT_NULL(component);
+
+    return daqTry([&]
+    {
+        const auto componentPtr = ComponentPtr::Borrow(component);
+        auto id = componentPtr.getGlobalId().toStdString();
+
+        std::scoped_lock lock(componentIndexSync);
+        indexedComponents.insert_or_assign(std::move(id), WeakRefPtr<IComponent>(componentPtr));
+    });
+}
+
+ErrCode ContextImpl::treeChanged()
+{
+    // Cached lists hold strong references to components. They are released outside of the lock, as releasing
+    // the last reference to a component can cause the tree to change again.
+    decltype(cachedItems) staleItems;
+    {
+        std::scoped_lock lock(componentIndexSync);
+        ++treeVersion;
+        staleItems.swap(cachedItems);
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ContextImpl::getTreeVersion(SizeT* version)
+{
+    OPENDAQ_PARAM_NOT_NULL(version);
+
+    *version = treeVersion;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ContextImpl::getRecursiveItems(IComponent* root, ComponentIndexQuery query, IList** items)
+{
+    OPENDAQ_PARAM_NOT_NULL(root);
+    OPENDAQ_PARAM_NOT_NULL(items);
+
+    return daqTry([&]
+    {
+        const auto rootPtr = ComponentPtr::Borrow(root);
+        auto key = std::make_pair(rootPtr.getGlobalId().toStdString(), query);
+
+        ComponentPtr cachedRoot;
+        {
+            std::scoped_lock lock(componentIndexSync);
+            const auto it = cachedItems.find(key);
+            if (it != cachedItems.end() && it->second.treeVersion == treeVersion)
+            {
+                cachedRoot = it->second.root.getRef();
+                if (cachedRoot.assigned() && cachedRoot == rootPtr)
+                {
+                    *items = it->second.items.addRefAndReturn();
+                    return;
+                }
+            }
+        }
+
+        // The query takes the locks of the components, so it must run without holding the index lock. If the tree
+        // changes during the query, the result is stored with the older version and rebuilt on the next call.
+        const SizeT version = treeVersion;
+        auto result = component_index::buildRecursiveItems(rootPtr, query);
+        result.freeze();
+
+        CachedItems replaced{version, rootPtr, result};
+        {
+            std::scoped_lock lock(componentIndexSync);
+            if (const auto it = cachedItems.find(key); it != cachedItems.end())
+                std::swap(it->second, replaced);
+            else
+                cachedItems.emplace(std::move(key), std::move(replaced));
+        }
+
+        *items = result.detach();
+    });
+}
+
 void ContextImpl::registerOpenDaqTypes()
 {
     if (typeManager == nullptr)
@@ -180,6 +180,7 @@ ErrCode ModuleManagerImpl::loadModules(IContext* context)
         }
 
         loggerComponent = this->logger.getOrAddComponent("ModuleManager");
+        discoveryClient.setDiscoveryCache(this->context.getDiscoveryCache());
     }
     else if (this->context != ContextPtr::Borrow(context))
     {
@@ -235,6 +235,16 @@ TEST_F(ModuleManagerTest, TestRescanTimer2)
     ASSERT_EQ(impl->scanCount, 2);
 }
 
+TEST_F(ModuleManagerTest, DiscoveryCacheSharedByContext)
+{
+    auto manager = ModuleManager("[[none]]");
+    const auto context = Context(nullptr, Logger(), nullptr, manager, nullptr);
+
+    const auto cache = context.getDiscoveryCache();
+    ASSERT_TRUE(cache.assigned());
+    ASSERT_EQ(cache, context.getDiscoveryCache());
+}
+
 TEST_F(ModuleManagerTest, ParallelDeviceCreationSuccess)
 {
     auto manager = ModuleManager("[[none]]");
@@ -17,6 +17,7 @@
 #pragma once
 #include <opendaq/context_ptr.h>
 #include <opendaq/context_internal_ptr.h>
+#include <coretypes/dictobject_factory.h>
 #include <coretypes/intfs.h>
 #include <gmock/gmock.h>
 #include <coretypes/gmock/mock_ptr.h>
@@ -46,12 +47,19 @@ struct MockContext : daq::ImplementationOf<daq::IContext, daq::IContextInternal>
         return OPENDAQ_SUCCESS;
     }
 
+    daq::ErrCode INTERFACE_FUNC getDiscoveryCache(daq::IBaseObject** cache) override
+    {
+        *cache = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
     daq::SchedulerPtr scheduler;
     daq::LoggerPtr logger;
     daq::TypeManagerPtr typeManager;
     daq::AuthenticationProviderPtr authenticationProvider;
     daq::BaseObjectPtr moduleManager;
     daq::EventEmitter<daq::ComponentPtr, daq::CoreEventArgsPtr> coreEvent;
+    daq::DictPtr<daq::IString, daq::IBaseObject> options = daq::Dict<daq::IString, daq::IBaseObject>();
 
     MockContext()
     {
@@ -83,5 +91,10 @@ struct MockContext : daq::ImplementationOf<daq::IContext, daq::IContextInternal>
             .Times(AnyNumber())
             .WillRepeatedly(DoAll(Invoke([&](daq::IEvent** event) { *event = coreEvent.addRefAndReturn(); }),
                                   Return(OPENDAQ_SUCCESS)));
+
+        EXPECT_CALL(*this, getOptions)
+            .Times(AnyNumber())
+            .WillRepeatedly(DoAll(Invoke([&](daq::IDict** optionsOut) { *optionsOut = options.addRefAndReturn(); }),
+                                  Return(OPENDAQ_SUCCESS)));
     }
 };
@@ -90,6 +90,16 @@ namespace daq::test_utils
         {
             removeComponentById(id);
         }
+
+        void beginBulkConstructionHelper()
+        {
+            beginBulkConstruction();
+        }
+
+        void endBulkConstructionHelper()
+        {
+            endBulkConstruction();
+        }
         
         void setDeviceDomainHelper(const DeviceDomainPtr& deviceDomain)
         {
@@ -19,9 +19,20 @@
 #include <opendaq/device_domain_factory.h>
 #include <coreobjects/authentication_provider_factory.h>
 #include <opendaq/mock/mock_streaming_factory.h>
+#include <opendaq/folder_factory.h>
+#include <opendaq/folder_impl.h>
 
 using namespace daq;
 
+class BulkConstructionFolderImpl : public FolderImpl<IFolderConfig>
+{
+public:
+    using Super = FolderImpl<IFolderConfig>;
+    using Super::Super;
+    using Super::beginBulkConstruction;
+    using Super::endBulkConstruction;
+};
+
 class CoreEventTest : public testing::Test
 {
 public:
@@ -1045,6 +1056,103 @@ TEST_F(CoreEventTest, SignalAddedRemovedMuted)
     ASSERT_EQ(callCount, 2);
 }
 
+TEST_F(CoreEventTest, BulkConstructionComponentsAdded)
+{
+    const auto context = instance.getContext();
+    const FolderConfigPtr folder = createWithImplementation<IFolderConfig, BulkConstructionFolderImpl>(context, nullptr, "bulk");
+    folder.asPtr<IPropertyObjectInternal>().enableCoreEventTrigger();
+    const auto folderImpl = dynamic_cast<BulkConstructionFolderImpl*>(folder.getObject());
+
+    const auto existing = Folder(context, folder, "existing");
+    folder.addItem(existing);
+
+    int callCount = 0;
+    int otherCount = 0;
+    ListPtr<IComponent> added;
+    getOnCoreEvent() +=
+        [&](const ComponentPtr& comp, const CoreEventArgsPtr& args)
+        {
+            if (args.getEventId() != static_cast<int>(CoreEventId::ComponentsAdded))
+            {
+                otherCount++;
+                return;
+            }
+
+            ASSERT_EQ(args.getEventName(), "ComponentsAdded");
+            ASSERT_TRUE(args.getParameters().hasKey("Components"));
+            ASSERT_EQ(comp, folder);
+            added = args.getParameters().get("Components");
+            callCount++;
+        };
+
+    folderImpl->beginBulkConstruction();
+    folderImpl->beginBulkConstruction();
+
+    const auto channels = Folder(context, folder, "channels");
+    folder.addItem(channels);
+    for (int i = 0; i < 10; ++i)
+        channels.addItem(Component(context, channels, "ch" + std::to_string(i)));
+
+    existing.addItem(Component(context, existing, "nested"));
+    existing.setName("renamed");
+
+    folderImpl->endBulkConstruction();
+    ASSERT_EQ(callCount, 0);
+    folderImpl->endBulkConstruction();
+
+    ASSERT_EQ(callCount, 1);
+    ASSERT_EQ(added.getCount(), 2u);
+    ASSERT_EQ(added[0], channels);
+    ASSERT_EQ(added[1].getGlobalId(), "/bulk/existing/nested");
+    ASSERT_EQ(otherCount, 0);
+
+    channels.addItem(Component(context, channels, "ch10"));
+    ASSERT_EQ(otherCount, 1);
+}
+
+TEST_F(CoreEventTest, BulkConstructionComponentRemoved)
+{
+    const auto context = instance.getContext();
+    const FolderConfigPtr folder = createWithImplementation<IFolderConfig, BulkConstructionFolderImpl>(context, nullptr, "bulk");
+    folder.asPtr<IPropertyObjectInternal>().enableCoreEventTrigger();
+    const auto folderImpl = dynamic_cast<BulkConstructionFolderImpl*>(folder.getObject());
+
+    const auto removed = Folder(context, folder, "removed");
+    folder.addItem(removed);
+    removed.addItem(Component(context, removed, "child"));
+    folder.addItem(Component(context, folder, "replaced"));
+
+    int removeCount = 0;
+    int addCount = 0;
+    getOnCoreEvent() +=
+        [&](const ComponentPtr& comp, const CoreEventArgsPtr& args)
+        {
+            ASSERT_EQ(comp, folder);
+            if (args.getEventId() == static_cast<int>(CoreEventId::ComponentRemoved))
+            {
+                ASSERT_TRUE(args.getParameters().get("Id") == "removed" || args.getParameters().get("Id") == "replaced");
+                removeCount++;
+            }
+            else
+            {
+                ASSERT_EQ(args.getEventId(), static_cast<int>(CoreEventId::ComponentsAdded));
+                const ListPtr<IComponent> added = args.getParameters().get("Components");
+                ASSERT_EQ(added.getCount(), 1u);
+                ASSERT_EQ(added[0].getLocalId(), "replaced");
+                addCount++;
+            }
+        };
+
+    folderImpl->beginBulkConstruction();
+    folder.removeItemWithLocalId("removed");
+    folder.removeItemWithLocalId("replaced");
+    folder.addItem(Component(context, folder, "replaced"));
+    folderImpl->endBulkConstruction();
+
+    ASSERT_EQ(removeCount, 2);
+    ASSERT_EQ(addCount, 1);
+}
+
 TEST_F(CoreEventTest, InputPortAdded)
 {
     const FolderConfigPtr ips = instance.getFunctionBlocks()[0].getItem("IP");
@@ -4,6 +4,8 @@
 #include <opendaq/update_parameters_factory.h>
 #include <opendaq/device_info_internal_ptr.h>
 #include <opendaq/module_impl.h>
+#include <opendaq/component_index_utils.h>
+#include <opendaq/folder_factory.h>
 #include <testutils/testutils.h>
 
 using InstanceTest = testing::Test;
@@ -756,6 +758,46 @@ TEST_F(InstanceTest, SaveLoadFunctionsOrdered)
     ASSERT_EQ(inputSignal.getGlobalId(), "/localIntanceId/FB/mock_fb_uid_1/Sig/UniqueId_1");
 }
 
+TEST_F(InstanceTest, SaveLoadFunctionsParallel)
+{
+    StringPtr config;
+    {
+        auto instance = test_helpers::setupInstance("localIntanceId");
+
+        auto fb1 = instance.addFunctionBlock("mock_fb_uid");
+        auto fb2 = instance.addFunctionBlock("mock_fb_uid");
+        auto fb3 = instance.addFunctionBlock("mock_fb_uid");
+        fb2.getInputPorts()[0].connect(fb1.getSignals()[0]);
+        fb3.getInputPorts()[0].connect(fb2.getSignals()[0]);
+        fb1.setName("fb1");
+        fb2.setName("fb2");
+        fb3.setName("fb3");
+
+        config = instance.saveConfiguration();
+    }
+
+    auto instance2 = test_helpers::setupInstance("localIntanceId");
+    for (SizeT i = 0; i < 3; ++i)
+        instance2.addFunctionBlock("mock_fb_uid");
+
+    auto loadConfig = UpdateParameters();
+    loadConfig.setParallelUpdateEnabled(true);
+    ASSERT_TRUE(loadConfig.getParallelUpdateEnabled());
+    instance2.loadConfiguration(config, loadConfig);
+
+    auto restoredFbs = instance2.getFunctionBlocks();
+    ASSERT_EQ(restoredFbs.getCount(), 3u);
+
+    for (const auto& fb : restoredFbs)
+    {
+        const auto id = fb.getLocalId().toStdString();
+        ASSERT_EQ(fb.getName(), "fb" + id.substr(id.size() - 1));
+    }
+
+    ASSERT_EQ(instance2.getFunctionBlocks()[1].getInputPorts()[0].getSignal().getGlobalId(), "/localIntanceId/FB/mock_fb_uid_1/Sig/UniqueId_1");
+    ASSERT_EQ(instance2.getFunctionBlocks()[2].getInputPorts()[0].getSignal().getGlobalId(), "/localIntanceId/FB/mock_fb_uid_2/Sig/UniqueId_1");
+}
+
 TEST_F(InstanceTest, SaveLoadFunctionsCircleDependcies)
 {
     StringPtr config;
@@ -1198,6 +1240,59 @@ TEST_F(InstanceTest, TestRemoved2)
     }
 }
 
+TEST_F(InstanceTest, FindComponentIndexed)
+{
+    auto instance = test_helpers::setupInstance();
+    const auto fb = instance.addFunctionBlock("mock_fb_uid");
+    const auto root = instance.getRootDevice();
+
+    const auto relativeId = "FB/" + fb.getLocalId().toStdString();
+    ASSERT_EQ(root.findComponent(relativeId), fb);
+    ASSERT_EQ(root.findComponent(fb.getGlobalId()), fb);
+
+    for (const auto& signal : fb.getSignals(search::Recursive(search::Any())))
+        ASSERT_EQ(root.findComponent(signal.getGlobalId()), signal);
+
+    instance.removeFunctionBlock(fb);
+    ASSERT_FALSE(root.findComponent(relativeId).assigned());
+}
+
+TEST_F(InstanceTest, FindComponentIndexedOtherTree)
+{
+    auto instance = test_helpers::setupInstance();
+    const auto fb = instance.addFunctionBlock("mock_fb_uid");
+
+    // a tree sharing the context and the global IDs of the instance must not resolve to its components
+    const auto folder = Folder(instance.getContext(), nullptr, instance.getRootDevice().getLocalId());
+    ASSERT_FALSE(folder.findComponent("FB/" + fb.getLocalId().toStdString()).assigned());
+}
+
+TEST_F(InstanceTest, RecursiveItemsCached)
+{
+    auto instance = test_helpers::setupInstance();
+    instance.addFunctionBlock("mock_fb_uid");
+    const auto root = instance.getRootDevice();
+    const auto index = instance.getContext().asPtr<IComponentIndex>();
+
+    const auto signals = component_index::getRecursiveItems(root, ComponentIndexQuery::Signals);
+    ASSERT_EQ(signals.getCount(), root.getSignals(search::Recursive(search::Any())).getCount());
+    ASSERT_EQ(signals.getObject(), component_index::getRecursiveItems(root, ComponentIndexQuery::Signals).getObject());
+    ASSERT_TRUE(signals.isFrozen());
+
+    const auto version = index.getTreeVersion();
+    instance.addFunctionBlock("mock_fb_uid");
+    ASSERT_GT(index.getTreeVersion(), version);
+
+    const auto newSignals = component_index::getRecursiveItems(root, ComponentIndexQuery::Signals);
+    ASSERT_NE(signals.getObject(), newSignals.getObject());
+    ASSERT_EQ(newSignals.getCount(), root.getSignals(search::Recursive(search::Any())).getCount());
+    ASSERT_GT(newSignals.getCount(), signals.getCount());
+
+    ASSERT_EQ(component_index::getRecursiveItems(root, ComponentIndexQuery::FunctionBlocks).getCount(), 2u);
+    ASSERT_EQ(component_index::getRecursiveItems(root, ComponentIndexQuery::InputPorts).getCount(),
+              root.getItems(search::Recursive(search::InterfaceId(IInputPort::Id))).getCount());
+}
+
 class MockClientModule : public Module
 {
 public:
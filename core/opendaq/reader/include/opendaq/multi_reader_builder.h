@@ -28,6 +28,17 @@ BEGIN_NAMESPACE_OPENDAQ
  * @{
  */
 
+/*!
+ * @brief Selects how the Multi reader aligns signals with different sample rates.
+ */
+enum class ResampleMethod
+{
+    None = 0,  /*!< Every signal is read at its own rate (default). */
+    Hold,      /*!< Every output sample repeats the most recent input sample. */
+    Linear,    /*!< Linear interpolation between the neighbouring input samples. */
+    Polyphase  /*!< Windowed-sinc polyphase FIR filter. Signals that are upsampled by a large factor are interpolated linearly. */
+};
+
 /*!
  * @brief Builder component of Multi reader objects. Contains setter methods to configure the Multi reader parameters
  * and a `build` method that builds the Unit object.
@@ -242,6 +253,60 @@ DECLARE_OPENDAQ_INTERFACE(IMultiReaderBuilder, IBaseObject)
      * If a method is set to "Unspecified", the reader keeps the mode of the input port. When building with signals, "Unspecified" is an invalid configuration.
      */
     virtual ErrCode INTERFACE_FUNC getInputPortNotificationMethods(IList** notificationMethods) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets whether the reader writes into a single interleaved (frame-major) buffer.
+     * @param interleaved If true, `read` and `readWithDomain` expect the `samples` (and `domain`) argument to point
+     * to one contiguous buffer laid out as `[sample][signal]` instead of an array of per-signal buffers.
+     *
+     * Samples are converted directly into their interleaved slots. All signals must be read at the common sample rate,
+     * the value (and domain) read type must have a fixed size and transform functions are not supported. Signals
+     * with array samples are not supported and invalidate the reader. The default is false.
+     */
+    virtual ErrCode INTERFACE_FUNC setInterleavedOutput(Bool interleaved) = 0;
+    /*!
+     * @brief Gets whether the reader writes into a single interleaved (frame-major) buffer.
+     * @param[out] interleaved True if the output layout is `[sample][signal]`.
+     */
+    virtual ErrCode INTERFACE_FUNC getInterleavedOutput(Bool* interleaved) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets the number of values a single read must copy before the per-signal copy is distributed
+     * across the context scheduler.
+     * @param threshold The minimal product of the number of samples read and the number of signals. 0 disables
+     * parallel reading.
+     *
+     * Each signal is still copied by a single thread. Parallel reading is only used with a multi-threaded scheduler
+     * and when more than one signal is read. The default is 0.
+     */
+    virtual ErrCode INTERFACE_FUNC setParallelReadThreshold(SizeT threshold) = 0;
+    /*!
+     * @brief Gets the number of values a single read must copy before the per-signal copy is distributed
+     * across the context scheduler.
+     * @param[out] threshold The minimal product of the number of samples read and the number of signals. 0 if
+     * parallel reading is disabled.
+     */
+    virtual ErrCode INTERFACE_FUNC getParallelReadThreshold(SizeT* threshold) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets the method used to resample all signals to a single output rate.
+     * @param method The resampling method. If "None", signals are read at their own rates.
+     *
+     * When enabled, every read returns the same number of samples for each signal. The output rate is the required
+     * common sample rate, if set, and the highest signal sample rate otherwise; it is returned by `getCommonSampleRate`.
+     * Filter state is carried across reads and reset whenever the reader re-synchronizes. Values and domain must be
+     * read as 32 or 64-bit integer or floating-point types; polyphase filtering is only applied to floating-point
+     * values and domain values are always interpolated linearly. The default is "None".
+     */
+    virtual ErrCode INTERFACE_FUNC setResampleMethod(ResampleMethod method) = 0;
+    /*!
+     * @brief Gets the method used to resample all signals to a single output rate.
+     * @param[out] method The resampling method.
+     */
+    virtual ErrCode INTERFACE_FUNC getResampleMethod(ResampleMethod* method) = 0;
 };
 
 /*!@}*/
@@ -67,6 +67,15 @@ public:
     ErrCode INTERFACE_FUNC setInputPortNotificationMethods(IList* notificationMethods) override;
     ErrCode INTERFACE_FUNC getInputPortNotificationMethods(IList** notificationMethods) override;
 
+    ErrCode INTERFACE_FUNC setInterleavedOutput(Bool interleaved) override;
+    ErrCode INTERFACE_FUNC getInterleavedOutput(Bool* interleaved) override;
+
+    ErrCode INTERFACE_FUNC setParallelReadThreshold(SizeT threshold) override;
+    ErrCode INTERFACE_FUNC getParallelReadThreshold(SizeT* threshold) override;
+
+    ErrCode INTERFACE_FUNC setResampleMethod(ResampleMethod method) override;
+    ErrCode INTERFACE_FUNC getResampleMethod(ResampleMethod* method) override;
+
 private:
     ListPtr<IComponent> sources;
     SampleType valueReadType;
@@ -80,6 +89,9 @@ private:
     Bool allowDifferentRates;
     PacketReadyNotification notificationMethod;
     ListPtr<PacketReadyNotification> notificationMethodsList;
+    Bool interleavedOutput;
+    SizeT parallelReadThreshold;
+    ResampleMethod resampleMethod;
 };
 
 END_NAMESPACE_OPENDAQ
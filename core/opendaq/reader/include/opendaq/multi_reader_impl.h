@@ -20,6 +20,8 @@
 #include <opendaq/signal_reader.h>
 #include <opendaq/multi_reader_builder_ptr.h>
 #include <opendaq/reader_factory.h>
+#include <opendaq/scheduler_ptr.h>
+#include <opendaq/resampler.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -127,6 +129,11 @@ private:
     SyncStatus getSyncStatus() const;
 
     void readSamples(SizeT samples);
+    void readSamplesParallel(SizeT samples, const SchedulerPtr& scheduler);
+    void readSignalSamples(SizeT index, SizeT samples);
+    void resampleSignalSamples(SizeT index, SizeT samples);
+    void resetResamplers();
+    bool isResampling() const;
     void readSamplesAndSetRemainingSamples(SizeT samples);
     NumberPtr calculateOffset() const;
 
@@ -200,6 +207,32 @@ private:
     SizeT minReadCount;
     PacketReadyNotification notificationMethod;
     ListPtr<PacketReadyNotification> notificationMethodsList;
+
+    bool interleavedOutput{false};
+    SizeT parallelReadThreshold{0};
+
+    // Per-signal resampling state. Signal readers run `pendingLookahead` input samples ahead of the
+    // resampler output until the first read after synchronization has filled the filter.
+    struct SignalResampler
+    {
+        std::unique_ptr<ResamplerBase> value;
+        std::unique_ptr<ResamplerBase> domain;
+        std::vector<uint8_t> valueScratch;
+        std::vector<uint8_t> domainScratch;
+        SizeT valueSampleSize{};
+        SizeT domainSampleSize{};
+        SizeT lookahead{};
+        SizeT pendingLookahead{};
+        void* out{};
+        void* domainOut{};
+        SizeT outStride{1};
+    };
+
+    ResampleMethod resampleMethod{ResampleMethod::None};
+    std::int64_t outputSampleRate = -1;
+    // Number of common-rate samples per output sample
+    std::int64_t outputSampleRateDivider = 1;
+    std::vector<SignalResampler> resamplers;
 };
 
 END_NAMESPACE_OPENDAQ
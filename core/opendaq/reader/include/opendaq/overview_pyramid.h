@@ -0,0 +1,280 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*
+ * Aggregate of a contiguous run of samples.
+ */
+struct OverviewBucket
+{
+    Float min;
+    Float max;
+    Float sum;
+    SizeT count;
+    Int domainStart;
+    Int domainEnd;
+
+    static OverviewBucket fromSample(Float value, Int domain)
+    {
+        return {value, value, value, 1, domain, domain};
+    }
+
+    void merge(const OverviewBucket& other)
+    {
+        if (count == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        sum += other.sum;
+        count += other.count;
+        domainStart = std::min(domainStart, other.domainStart);
+        domainEnd = std::max(domainEnd, other.domainEnd);
+    }
+};
+
+/*
+ * Multi-level min/max/mean aggregate of a sample stream with bounded memory.
+ *
+ * Level k is a ring buffer of at most `levelCapacity` buckets, each aggregating 2^k consecutive samples. Every
+ * level therefore covers twice the history of the level below it at half the resolution. Samples are added
+ * in ascending domain order; a bucket is pushed to level k + 1 once two buckets of level k were completed.
+ *
+ * Queries pick the finest level that covers the requested range with no more than two buckets per output
+ * point, so the work done is proportional to the number of output points and not to the number of samples.
+ */
+class OverviewPyramid
+{
+public:
+    OverviewPyramid(SizeT levelCapacity, SizeT levelCount)
+        : levelCapacity(std::max<SizeT>(levelCapacity, 1))
+        , levels(std::max<SizeT>(levelCount, 1))
+    {
+        for (auto& level : levels)
+            level.ring.resize(this->levelCapacity);
+    }
+
+    SizeT getLevelCapacity() const
+    {
+        return levelCapacity;
+    }
+
+    SizeT getLevelCount() const
+    {
+        return levels.size();
+    }
+
+    void clear()
+    {
+        for (auto& level : levels)
+        {
+            level.head = 0;
+            level.size = 0;
+            level.pending = {};
+            level.pendingChildren = 0;
+        }
+    }
+
+    void addSample(Float value, Int domain)
+    {
+        pushBucket(0, OverviewBucket::fromSample(value, domain));
+    }
+
+    // Number of samples aggregated by the coarsest level and by the buckets not yet propagated to it.
+    SizeT getSampleCount() const
+    {
+        const SizeT coarsest = levels.size() - 1;
+        SizeT count = 0;
+        for (SizeT i = 0; i < levels[coarsest].size; ++i)
+            count += at(coarsest, i).count;
+
+        forEachTailBucket(coarsest, [&count](const OverviewBucket& bucket) { count += bucket.count; });
+        return count;
+    }
+
+    /*
+     * Aggregates the history in the domain range [start, end) into at most `pointCount` points of equal
+     * domain width. Points without samples are omitted; the domain of a point is the tick at which it starts.
+     * Returns the number of points written.
+     */
+    SizeT query(Int start, Int end, SizeT pointCount, Float* minValues, Float* maxValues, Float* meanValues, Int* domain) const
+    {
+        if (pointCount == 0 || end <= start)
+            return 0;
+
+        const SizeT level = selectLevel(start, end, pointCount);
+        const double pointWidth = static_cast<double>(end - start) / static_cast<double>(pointCount);
+
+        SizeT written = 0;
+        SizeT currentPoint = 0;
+        OverviewBucket current{};
+
+        const auto flush = [&]
+        {
+            if (current.count == 0)
+                return;
+
+            minValues[written] = current.min;
+            maxValues[written] = current.max;
+            meanValues[written] = current.sum / static_cast<Float>(current.count);
+            domain[written] = start + static_cast<Int>(static_cast<double>(currentPoint) * pointWidth);
+            written++;
+            current = {};
+        };
+
+        const auto addBucket = [&](const OverviewBucket& bucket)
+        {
+            if (bucket.domainEnd < start || bucket.domainStart >= end)
+                return;
+
+            const auto offset = static_cast<double>(std::max(bucket.domainStart, start) - start);
+            const SizeT point = std::min(static_cast<SizeT>(offset / pointWidth), pointCount - 1);
+            if (point != currentPoint)
+            {
+                flush();
+                currentPoint = point;
+            }
+
+            current.merge(bucket);
+        };
+
+        const Level& selected = levels[level];
+        for (SizeT i = lowerBound(level, start); i < selected.size; ++i)
+        {
+            const auto& bucket = at(level, i);
+            if (bucket.domainStart >= end)
+                break;
+            addBucket(bucket);
+        }
+
+        forEachTailBucket(level, addBucket);
+        flush();
+
+        return written;
+    }
+
+private:
+    struct Level
+    {
+        std::vector<OverviewBucket> ring;
+        SizeT head = 0;
+        SizeT size = 0;
+
+        OverviewBucket pending{};
+        SizeT pendingChildren = 0;
+    };
+
+    void pushBucket(SizeT levelIndex, const OverviewBucket& bucket)
+    {
+        Level& level = levels[levelIndex];
+
+        level.ring[level.head] = bucket;
+        level.head = (level.head + 1) % levelCapacity;
+        level.size = std::min(level.size + 1, levelCapacity);
+
+        if (levelIndex + 1 == levels.size())
+            return;
+
+        Level& parent = levels[levelIndex + 1];
+        parent.pending.merge(bucket);
+        if (++parent.pendingChildren == 2)
+        {
+            const OverviewBucket completed = parent.pending;
+            parent.pending = {};
+            parent.pendingChildren = 0;
+            pushBucket(levelIndex + 1, completed);
+        }
+    }
+
+    // Bucket at position `index` of a level, where 0 is the oldest one.
+    const OverviewBucket& at(SizeT levelIndex, SizeT index) const
+    {
+        const Level& level = levels[levelIndex];
+        return level.ring[(level.head + levelCapacity - level.size + index) % levelCapacity];
+    }
+
+    // Position of the first bucket of a level that ends at or after `domain`.
+    SizeT lowerBound(SizeT levelIndex, Int domain) const
+    {
+        SizeT first = 0;
+        SizeT count = levels[levelIndex].size;
+        while (count > 0)
+        {
+            const SizeT step = count / 2;
+            if (at(levelIndex, first + step).domainEnd < domain)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    // Calls the function, oldest first, for the completed buckets of the finer levels that are not yet part of
+    // a bucket of the given level. There is at most one such bucket per finer level.
+    template <typename F>
+    void forEachTailBucket(SizeT levelIndex, F&& function) const
+    {
+        for (SizeT finer = levelIndex; finer-- > 0;)
+        {
+            const Level& parent = levels[finer + 1];
+            if (parent.pendingChildren != 0 && levels[finer].size != 0)
+                function(at(finer, levels[finer].size - 1));
+        }
+    }
+
+    SizeT selectLevel(Int start, Int end, SizeT pointCount) const
+    {
+        for (SizeT level = 0; level + 1 < levels.size(); ++level)
+        {
+            const Level& current = levels[level];
+            if (current.size == 0)
+                return level;
+
+            // the range reaches further back than this level remembers
+            if (current.size == levelCapacity && at(level, 0).domainStart > start)
+                continue;
+
+            const SizeT first = lowerBound(level, start);
+            const SizeT last = lowerBound(level, end);
+            if (last - first <= 2 * pointCount)
+                return level;
+        }
+
+        return levels.size() - 1;
+    }
+
+    SizeT levelCapacity;
+    std::vector<Level> levels;
+};
+
+END_NAMESPACE_OPENDAQ
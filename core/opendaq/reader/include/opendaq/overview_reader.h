@@ -0,0 +1,97 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/sample_reader.h>
+#include <opendaq/signal.h>
+#include <opendaq/input_port_config.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_readers
+ * @addtogroup opendaq_overview_reader Overview reader
+ * @{
+ */
+
+/*#
+ * [include(ISampleType)]
+ * [interfaceSmartPtr(ISampleReader, GenericSampleReaderPtr)]
+ */
+
+/*!
+ * @brief A reader that keeps a min/max/mean overview of the signal history instead of the samples themselves.
+ *
+ * The overview is maintained incrementally as packets arrive. It consists of `levelCount` levels, each holding
+ * at most `levelCapacity` aggregates, where an aggregate of level k covers 2^k consecutive samples. The memory
+ * used is thus bounded, while the covered history grows exponentially with the number of levels. Older data
+ * is only available at a coarser resolution.
+ *
+ * The values are always read as `Float64` and the domain as `Int64`. The overview is cleared when the value
+ * or domain descriptor of the signal changes.
+ */
+DECLARE_OPENDAQ_INTERFACE(IOverviewReader, ISampleReader)
+{
+    // [arrayArg(minValues, count), arrayArg(maxValues, count), arrayArg(meanValues, count), arrayArg(domain, count), arrayArg(count, 1)]
+    /*!
+     * @brief Aggregates the history in the domain range [`start`, `end`) into at most `count` points of equal
+     * domain width, such as one point per pixel of a trend view.
+     * @param[in] minValues The buffer receiving the minimum value of each point.
+     * @param[in] maxValues The buffer receiving the maximum value of each point.
+     * @param[in] meanValues The buffer receiving the mean value of each point.
+     * @param[in] domain The buffer receiving the domain value at which each point starts.
+     * @param[in,out] count The number of points to divide the range into. Points without any samples are omitted,
+     * and the parameter is set to the number of points actually written.
+     * @param start The start of the domain range in ticks of the signal domain (inclusive).
+     * @param end The end of the domain range in ticks of the signal domain (exclusive).
+     *
+     * The buffers must be contiguous memory big enough to receive `count` values of type `Float64` and `Int64`
+     * respectively. The time spent is proportional to the number of points and not to the number of samples
+     * in the range.
+     */
+    virtual ErrCode INTERFACE_FUNC readOverview(void* minValues, void* maxValues, void* meanValues, void* domain, SizeT* count, Int start, Int end) = 0;
+
+    /*!
+     * @brief Gets the maximum number of aggregates kept per level.
+     * @param[out] capacity The level capacity.
+     */
+    virtual ErrCode INTERFACE_FUNC getLevelCapacity(SizeT* capacity) = 0;
+
+    /*!
+     * @brief Gets the number of levels of the overview.
+     * @param[out] count The number of levels.
+     */
+    virtual ErrCode INTERFACE_FUNC getLevelCount(SizeT* count) = 0;
+};
+/*!@}*/
+
+OPENDAQ_DECLARE_CLASS_FACTORY(
+    LIBRARY_FACTORY, OverviewReader,
+    ISignal*, signal,
+    SizeT, levelCapacity,
+    SizeT, levelCount,
+    ReadMode, mode
+)
+
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, OverviewReaderFromPort, IOverviewReader,
+    IInputPortConfig*, port,
+    SizeT, levelCapacity,
+    SizeT, levelCount,
+    ReadMode, mode
+)
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <opendaq/reader_impl.h>
+#include <opendaq/overview_reader.h>
+#include <opendaq/overview_pyramid.h>
+#include <opendaq/data_packet_ptr.h>
+
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+extern template class ReaderImpl<IOverviewReader>;
+
+class OverviewReaderImpl final : public ReaderImpl<IOverviewReader>
+{
+public:
+    using Super = ReaderImpl<IOverviewReader>;
+
+    OverviewReaderImpl(ISignal* signal,
+                       SizeT levelCapacity,
+                       SizeT levelCount,
+                       ReadMode mode);
+
+    OverviewReaderImpl(IInputPortConfig* port,
+                       SizeT levelCapacity,
+                       SizeT levelCount,
+                       ReadMode mode);
+
+    ErrCode INTERFACE_FUNC getAvailableCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getEmpty(Bool* empty) override;
+
+    ErrCode INTERFACE_FUNC readOverview(void* minValues, void* maxValues, void* meanValues, void* domain, SizeT* count, Int start, Int end) override;
+    ErrCode INTERFACE_FUNC getLevelCapacity(SizeT* capacity) override;
+    ErrCode INTERFACE_FUNC getLevelCount(SizeT* count) override;
+
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override;
+
+private:
+    ErrCode addPacket(const DataPacketPtr& dataPacket);
+
+    OverviewPyramid pyramid;
+
+    // index of the next sample, used as the domain of signals without a domain signal
+    Int sampleIndex;
+
+    std::vector<Float> values;
+    std::vector<Int> domainValues;
+};
+
+END_NAMESPACE_OPENDAQ
@@ -36,6 +36,8 @@
 #include <opendaq/tail_reader_builder_ptr.h>
 #include <opendaq/tail_reader_status_ptr.h>
 
+#include <opendaq/overview_reader_ptr.h>
+
 #include <opendaq/packet_reader_ptr.h>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -344,6 +346,34 @@ inline TailReaderPtr TailReaderFromBuilder(const TailReaderBuilderPtr& builder)
     return TailReaderFromBuilder_Create(builder);
 }
 
+/*!
+ * @brief A reader that keeps a min/max/mean overview of the signal history instead of the samples themselves.
+ * @param signal The signal to read the data from.
+ * @param levelCapacity The maximum number of aggregates kept per level.
+ * @param levelCount The number of levels, where an aggregate of level k covers 2^k samples.
+ */
+inline OverviewReaderPtr OverviewReader(SignalPtr signal,
+                                        SizeT levelCapacity = 1024,
+                                        SizeT levelCount = 16,
+                                        ReadMode mode = ReadMode::Scaled)
+{
+    return OverviewReader_Create(signal, levelCapacity, levelCount, mode);
+}
+
+/*!
+ * @brief A reader that keeps a min/max/mean overview of the signal history instead of the samples themselves.
+ * @param port The port to read the data from.
+ * @param levelCapacity The maximum number of aggregates kept per level.
+ * @param levelCount The number of levels, where an aggregate of level k covers 2^k samples.
+ */
+inline OverviewReaderPtr OverviewReaderFromPort(InputPortConfigPtr port,
+                                                SizeT levelCapacity = 1024,
+                                                SizeT levelCount = 16,
+                                                ReadMode mode = ReadMode::Scaled)
+{
+    return OverviewReaderFromPort_Create(port, levelCapacity, levelCount, mode);
+}
+
 inline BlockReaderBuilderPtr BlockReaderBuilder()
 {
     return BlockReaderBuilder_Create();
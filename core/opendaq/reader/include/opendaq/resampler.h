@@ -0,0 +1,331 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/exceptions.h>
+#include <opendaq/multi_reader_builder.h>
+#include <opendaq/sample_type_traits.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Type-erased interface of a streaming rational-rate resampler.
+ *
+ * Input samples are pushed in arbitrarily sized blocks and output samples are pulled on demand.
+ * Output sample `n` corresponds to the input position `n * inputRate / outputRate`, measured from
+ * the first sample pushed after construction or reset(). To compute it, the resampler needs
+ * `getLookahead()` input samples past that position; callers that want outputs aligned with the
+ * input time base push that many samples ahead before pulling.
+ */
+class ResamplerBase
+{
+public:
+    virtual ~ResamplerBase() = default;
+
+    virtual void reset() = 0;
+    virtual void push(const void* input, SizeT count) = 0;
+
+    /*!
+     * @brief Computes up to @p count output samples.
+     * @param output The destination or nullptr to discard the samples.
+     * @param count The maximum number of samples to compute.
+     * @param stride The distance between consecutive output samples, in samples.
+     * @returns The number of samples computed; less than @p count if not enough input was pushed.
+     */
+    virtual SizeT pull(void* output, SizeT count, SizeT stride) = 0;
+
+    [[nodiscard]] virtual SizeT getLookahead() const noexcept = 0;
+    [[nodiscard]] virtual ResampleMethod getMethod() const noexcept = 0;
+};
+
+template <typename T>
+class Resampler final : public ResamplerBase
+{
+public:
+    // Zero crossings of the sinc on each side, in units of the narrower of the two bandwidths
+    static constexpr double ZeroCrossings = 16.0;
+    // Passband edge relative to the Nyquist frequency of the slower rate
+    static constexpr double Rolloff = 0.9;
+    // Larger upsampling factors gain little from a FIR filter and are interpolated linearly
+    static constexpr std::int64_t MaxPolyphaseUpsampling = 64;
+    static constexpr std::int64_t MaxPolyphasePhases = 1024;
+    static constexpr SizeT MaxPolyphaseCoefficients = 1 << 20;
+
+    Resampler(ResampleMethod method, std::int64_t inputRate, std::int64_t outputRate)
+        : method(method)
+    {
+        if (inputRate <= 0 || outputRate <= 0)
+            DAQ_THROW_EXCEPTION(InvalidParameterException, "Resampling rates must be positive.");
+
+        if (method == ResampleMethod::None)
+            DAQ_THROW_EXCEPTION(InvalidParameterException, "A resampling method must be selected.");
+
+        const auto divisor = std::gcd(inputRate, outputRate);
+        up = outputRate / divisor;
+        down = inputRate / divisor;
+
+        if (this->method == ResampleMethod::Polyphase)
+        {
+            const bool slowSignal = up > down * MaxPolyphaseUpsampling;
+            if (!std::is_floating_point_v<T> || slowSignal || up > MaxPolyphasePhases || !designFilter())
+                this->method = ResampleMethod::Linear;
+        }
+
+        switch (this->method)
+        {
+            case ResampleMethod::Polyphase:
+                lookahead = halfLength;
+                break;
+            case ResampleMethod::Linear:
+                lookahead = 1;
+                break;
+            default:
+                lookahead = 0;
+                break;
+        }
+
+        reset();
+    }
+
+    void reset() override
+    {
+        buffer.clear();
+        bufferStart = 0;
+        position = 0;
+        phase = 0;
+        primed = false;
+    }
+
+    void push(const void* input, SizeT count) override
+    {
+        if (count == 0)
+            return;
+
+        const auto samples = static_cast<const T*>(input);
+        if (!primed)
+        {
+            // Extend the signal backwards with its first value so the filter is fully populated from the start
+            if (method == ResampleMethod::Polyphase)
+            {
+                buffer.assign(halfLength, samples[0]);
+                bufferStart = -static_cast<std::int64_t>(halfLength);
+            }
+
+            primed = true;
+        }
+
+        buffer.insert(buffer.end(), samples, samples + count);
+    }
+
+    SizeT pull(void* output, SizeT count, SizeT stride) override
+    {
+        const auto out = static_cast<T*>(output);
+        const auto end = bufferStart + static_cast<std::int64_t>(buffer.size());
+
+        SizeT produced = 0;
+        while (produced < count && position + static_cast<std::int64_t>(lookahead) < end)
+        {
+            const T* x = buffer.data() + (position - bufferStart);
+
+            T value;
+            switch (method)
+            {
+                case ResampleMethod::Polyphase:
+                    value = static_cast<T>(dot(taps.data() + phase * tapCount, x - halfLength, tapCount));
+                    break;
+                case ResampleMethod::Linear:
+                    value = interpolate(x[0], x[1], static_cast<double>(phase) / static_cast<double>(up));
+                    break;
+                default:
+                    value = x[0];
+                    break;
+            }
+
+            if (out != nullptr)
+                out[produced * stride] = value;
+
+            ++produced;
+
+            phase += down;
+            position += phase / up;
+            phase %= up;
+        }
+
+        compact();
+        return produced;
+    }
+
+    [[nodiscard]] SizeT getLookahead() const noexcept override
+    {
+        return lookahead;
+    }
+
+    [[nodiscard]] ResampleMethod getMethod() const noexcept override
+    {
+        return method;
+    }
+
+private:
+    static T interpolate(T a, T b, double fraction)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            return a + (b - a) * static_cast<T>(fraction);
+        }
+        else
+        {
+            // Interpolate the difference so large tick values keep their full integer precision
+            const auto difference = static_cast<std::int64_t>(b - a);
+            return static_cast<T>(a + static_cast<T>(std::llround(static_cast<double>(difference) * fraction)));
+        }
+    }
+
+    // Independent accumulators let the compiler vectorize the loop without reassociating a single sum
+    static double dot(const double* h, const T* x, SizeT count)
+    {
+        double acc0 = 0.0;
+        double acc1 = 0.0;
+        double acc2 = 0.0;
+        double acc3 = 0.0;
+
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            acc0 += h[i] * static_cast<double>(x[i]);
+            acc1 += h[i + 1] * static_cast<double>(x[i + 1]);
+            acc2 += h[i + 2] * static_cast<double>(x[i + 2]);
+            acc3 += h[i + 3] * static_cast<double>(x[i + 3]);
+        }
+
+        for (; i < count; ++i)
+            acc0 += h[i] * static_cast<double>(x[i]);
+
+        return (acc0 + acc1) + (acc2 + acc3);
+    }
+
+    // Builds one set of taps per output phase from a Blackman-windowed sinc. Returns false if the table would be too large.
+    bool designFilter()
+    {
+        constexpr double pi = 3.14159265358979323846;
+
+        const double cutoff = std::min(1.0, static_cast<double>(up) / static_cast<double>(down)) * Rolloff;
+        const double halfWidth = ZeroCrossings / cutoff;
+
+        halfLength = static_cast<SizeT>(std::ceil(halfWidth));
+        tapCount = 2 * halfLength + 1;
+        if (static_cast<SizeT>(up) * tapCount > MaxPolyphaseCoefficients)
+            return false;
+
+        taps.resize(static_cast<SizeT>(up) * tapCount);
+        for (std::int64_t p = 0; p < up; ++p)
+        {
+            double* phaseTaps = taps.data() + p * tapCount;
+
+            double sum = 0.0;
+            for (SizeT t = 0; t < tapCount; ++t)
+            {
+                // Distance between the output position and the input sample the tap is applied to
+                const double distance = static_cast<double>(halfLength) - static_cast<double>(t) + static_cast<double>(p) / static_cast<double>(up);
+
+                double coefficient = 0.0;
+                if (std::abs(distance) < halfWidth)
+                {
+                    const double x = cutoff * distance;
+                    const double sinc = x == 0.0 ? 1.0 : std::sin(pi * x) / (pi * x);
+                    const double u = distance / halfWidth;
+                    const double window = 0.42 + 0.5 * std::cos(pi * u) + 0.08 * std::cos(2.0 * pi * u);
+                    coefficient = cutoff * sinc * window;
+                }
+
+                phaseTaps[t] = coefficient;
+                sum += coefficient;
+            }
+
+            // Unity gain at DC for every phase
+            for (SizeT t = 0; t < tapCount; ++t)
+                phaseTaps[t] /= sum;
+        }
+
+        return true;
+    }
+
+    // Drops input that no future output can reference; amortized by only erasing once half of the buffer is stale
+    void compact()
+    {
+        const std::int64_t keepFrom = position - (method == ResampleMethod::Polyphase ? static_cast<std::int64_t>(halfLength) : 0);
+        const std::int64_t stale = keepFrom - bufferStart;
+        if (stale <= 0 || static_cast<SizeT>(stale) < buffer.size() / 2)
+            return;
+
+        const auto erase = std::min(static_cast<SizeT>(stale), buffer.size());
+        buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(erase));
+        bufferStart += static_cast<std::int64_t>(erase);
+    }
+
+    ResampleMethod method;
+    std::int64_t up{1};
+    std::int64_t down{1};
+
+    SizeT halfLength{0};
+    SizeT tapCount{0};
+    SizeT lookahead{0};
+    std::vector<double> taps;
+
+    std::vector<T> buffer;
+    std::int64_t bufferStart{0};
+    std::int64_t position{0};
+    std::int64_t phase{0};
+    bool primed{false};
+};
+
+/*!
+ * @brief Creates a resampler for samples of type @p sampleType, or nullptr if the type cannot be resampled.
+ *
+ * Polyphase filtering is only applied to floating-point samples; integer samples are interpolated linearly.
+ */
+inline std::unique_ptr<ResamplerBase> createResampler(SampleType sampleType,
+                                                      ResampleMethod method,
+                                                      std::int64_t inputRate,
+                                                      std::int64_t outputRate)
+{
+    switch (sampleType)  // NOLINT(clang-diagnostic-switch-enum)
+    {
+        case SampleType::Float32:
+            return std::make_unique<Resampler<SampleTypeToType<SampleType::Float32>::Type>>(method, inputRate, outputRate);
+        case SampleType::Float64:
+            return std::make_unique<Resampler<SampleTypeToType<SampleType::Float64>::Type>>(method, inputRate, outputRate);
+        case SampleType::Int32:
+            return std::make_unique<Resampler<SampleTypeToType<SampleType::Int32>::Type>>(method, inputRate, outputRate);
+        case SampleType::UInt32:
+            return std::make_unique<Resampler<SampleTypeToType<SampleType::UInt32>::Type>>(method, inputRate, outputRate);
+        case SampleType::Int64:
+            return std::make_unique<Resampler<SampleTypeToType<SampleType::Int64>::Type>>(method, inputRate, outputRate);
+        case SampleType::UInt64:
+            return std::make_unique<Resampler<SampleTypeToType<SampleType::UInt64>::Type>>(method, inputRate, outputRate);
+        default:
+            return nullptr;
+    }
+}
+
+END_NAMESPACE_OPENDAQ
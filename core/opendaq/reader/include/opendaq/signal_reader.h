@@ -124,6 +124,9 @@ struct SignalReader
     std::int64_t commonSampleRate;
     std::int32_t sampleRateDivider;
 
+    // Distance between consecutive output samples when filling an interleaved buffer; 0 for contiguous output
+    SizeT outputStride{0};
+
     bool invalid{false};
     SyncStatus synced{SyncStatus::Unsynchronized};
 
@@ -32,6 +32,13 @@ public:
     virtual ~Reader() = default;
 
     virtual ErrCode readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count) = 0;
+
+    /*!
+     * @brief Same as readData, but places consecutive samples @p stride samples apart in the output. Used to fill
+     * interleaved (frame-major) buffers directly, without a separate transpose pass. After the call,
+     * @p outputBuffer points to the slot of the first sample not written.
+     */
+    virtual ErrCode readDataStrided(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count, SizeT stride) = 0;
     virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) = 0;
     virtual std::unique_ptr<Comparable> readStartLinear(const DataPacketPtr& packet, SizeT offset, const ReaderDomainInfo& domainInfo) = 0;
 
@@ -48,6 +55,7 @@ public:
 
     [[nodiscard]] virtual bool isUndefined() const noexcept;
     [[nodiscard]] virtual SampleType getReadType() const noexcept = 0;
+    [[nodiscard]] virtual SizeT getValuesPerSample() const noexcept;
 
     FunctionPtr getTransformFunction() const;
     void setTransformFunction(FunctionPtr transform);
@@ -71,6 +79,11 @@ public:
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE);
     }
 
+    ErrCode readDataStrided(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count, SizeT stride) override
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE);
+    }
+
     virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) override
     {
         DAQ_THROW_EXCEPTION(InvalidStateException);
@@ -122,6 +135,7 @@ public:
     using Reader::Reader;
 
     virtual ErrCode readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count) override;
+    virtual ErrCode readDataStrided(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count, SizeT stride) override;
     virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) override;
 
     virtual std::unique_ptr<Comparable> readStartLinear(const DataPacketPtr& packet,
@@ -142,10 +156,13 @@ public:
     virtual bool handleDescriptorChanged(DataDescriptorPtr& descriptor, ReadMode mode) override;
 
     virtual SampleType getReadType() const noexcept override;
+    SizeT getValuesPerSample() const noexcept override;
 
 private:
+    ErrCode readDataInternal(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count, SizeT stride);
+
     template <typename TDataType>
-    ErrCode readValues(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const;
+    ErrCode readValues(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead, SizeT stride) const;
 
     template <typename TDataType>
     SizeT getOffsetToData(const ReaderDomainInfo& domainInfo,
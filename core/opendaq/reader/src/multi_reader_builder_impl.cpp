@@ -18,6 +18,9 @@ MultiReaderBuilderImpl::MultiReaderBuilderImpl()
     , allowDifferentRates(true)
     , notificationMethod(PacketReadyNotification::SameThread)
     , notificationMethodsList(List<PacketReadyNotification>())
+    , interleavedOutput(false)
+    , parallelReadThreshold(0)
+    , resampleMethod(ResampleMethod::None)
 {
 }
 
@@ -235,6 +238,48 @@ ErrCode MultiReaderBuilderImpl::getInputPortNotificationMethods(IList** notifica
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode MultiReaderBuilderImpl::setInterleavedOutput(Bool interleaved)
+{
+    this->interleavedOutput = interleaved;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode MultiReaderBuilderImpl::getInterleavedOutput(Bool* interleaved)
+{
+    OPENDAQ_PARAM_NOT_NULL(interleaved);
+
+    *interleaved = this->interleavedOutput;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode MultiReaderBuilderImpl::setParallelReadThreshold(SizeT threshold)
+{
+    this->parallelReadThreshold = threshold;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode MultiReaderBuilderImpl::getParallelReadThreshold(SizeT* threshold)
+{
+    OPENDAQ_PARAM_NOT_NULL(threshold);
+
+    *threshold = this->parallelReadThreshold;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode MultiReaderBuilderImpl::setResampleMethod(ResampleMethod method)
+{
+    this->resampleMethod = method;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode MultiReaderBuilderImpl::getResampleMethod(ResampleMethod* method)
+{
+    OPENDAQ_PARAM_NOT_NULL(method);
+
+    *method = this->resampleMethod;
+    return OPENDAQ_SUCCESS;
+}
+
 /////////////////////
 ////
 //// FACTORIES
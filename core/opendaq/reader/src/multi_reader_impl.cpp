@@ -11,11 +11,15 @@
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/tags_private_ptr.h>
 #include <opendaq/input_port_private_ptr.h>
+#include <opendaq/work_factory.h>
 
 #include <fmt/ostream.h>
 #include <set>
 #include <chrono>
 #include <optional>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
 
 using namespace std::chrono;
 
@@ -28,6 +32,12 @@ struct fmt::formatter<daq::Comparable> : ostream_formatter
 
 BEGIN_NAMESPACE_OPENDAQ
 
+// Returns the address of the first sample of signal `index` in an interleaved `[sample][signal]` buffer
+static void* interleavedSlot(void* buffer, SizeT index, SampleType readType)
+{
+    return static_cast<uint8_t*>(buffer) + index * getSampleSize(readType);
+}
+
 struct MultiReaderImpl::ReferenceDomainBin
 {
     StringPtr id;
@@ -106,6 +116,9 @@ MultiReaderImpl::MultiReaderImpl(MultiReaderImpl* old, SampleType valueReadType,
     allowDifferentRates = old->allowDifferentRates;
     notificationMethod = old->notificationMethod;
     notificationMethodsList = old->notificationMethodsList;
+    interleavedOutput = old->interleavedOutput;
+    parallelReadThreshold = old->parallelReadThreshold;
+    resampleMethod = old->resampleMethod;
     context = old->context;
     portsConnected = old->portsConnected;
     externalListener = old->externalListener;
@@ -138,6 +151,9 @@ MultiReaderImpl::MultiReaderImpl(const MultiReaderBuilderPtr& builder)
     , minReadCount(builder.getMinReadCount())
     , notificationMethod(builder.getInputPortNotificationMethod())
     , notificationMethodsList(builder.getInputPortNotificationMethods())
+    , interleavedOutput(builder.getInterleavedOutput())
+    , parallelReadThreshold(builder.getParallelReadThreshold())
+    , resampleMethod(builder.getResampleMethod())
 {
     internalAddRef();
     try
@@ -448,8 +464,32 @@ void MultiReaderImpl::updateCommonSampleRateAndDividers()
     std::optional<std::int64_t> lastSampleRate = std::nullopt;
 
     sameSampleRates = true;
+    resamplers.clear();
+    outputSampleRate = -1;
+    outputSampleRateDivider = 1;
+
+    if (resampleMethod != ResampleMethod::None)
+    {
+        // Signals are read at the least common multiple of their rates and the output rate and are then
+        // resampled to the output rate, so no signal rate has to divide the common rate.
+        outputSampleRate = requiredCommonSampleRate;
+        if (outputSampleRate <= 0)
+            for (const auto& signal : signals)
+                outputSampleRate = std::max<std::int64_t>(outputSampleRate, signal.sampleRate);
+
+        commonSampleRate = std::max<std::int64_t>(outputSampleRate, 1);
+        for (const auto& signal : signals)
+        {
+            if (signal.sampleRate > 0)
+                commonSampleRate = std::lcm<std::int64_t>(signal.sampleRate, commonSampleRate);
+
+            if (signal.sampleRate != signals[0].sampleRate)
+                sameSampleRates = false;
+        }
 
-    if (requiredCommonSampleRate > 0)
+        outputSampleRateDivider = outputSampleRate > 0 ? commonSampleRate / outputSampleRate : 1;
+    }
+    else if (requiredCommonSampleRate > 0)
     {
         commonSampleRate = requiredCommonSampleRate;
     }
@@ -492,6 +532,20 @@ void MultiReaderImpl::updateCommonSampleRateAndDividers()
             invalid = true;
             return;
         }
+
+        if (interleavedOutput && resampleMethod == ResampleMethod::None && signal.sampleRate > 0 && signal.sampleRateDivider != 1)
+        {
+            LOG_D("Interleaved output requires all signals to be read at the common sample rate.")
+            invalid = true;
+            return;
+        }
+
+        if (interleavedOutput && signal.valueReader->getValuesPerSample() != 1)
+        {
+            LOG_D("Interleaved output does not support signals with array samples.")
+            invalid = true;
+            return;
+        }
     }
 
     sampleRateDividerLcm = 1;
@@ -503,6 +557,56 @@ void MultiReaderImpl::updateCommonSampleRateAndDividers()
         }
         sampleRateDividerLcm = std::lcm(signal.sampleRateDivider, sampleRateDividerLcm);
     }
+
+    if (resampleMethod == ResampleMethod::None)
+        return;
+
+    // Reads must end on an output sample of every signal
+    sampleRateDividerLcm = static_cast<std::int32_t>(std::lcm<std::int64_t>(sampleRateDividerLcm, outputSampleRateDivider));
+
+    std::vector<SignalResampler> newResamplers(signals.size());
+    for (SizeT i = 0; i < signals.size(); ++i)
+    {
+        const auto& signal = signals[i];
+        const auto valueType = signal.valueReader->getReadType();
+        const auto domainType = signal.domainReader->getReadType();
+
+        // The remaining descriptors have not arrived yet; the resamplers are created once they do
+        if (signal.sampleRate <= 0 || valueType == SampleType::Undefined || domainType == SampleType::Undefined)
+            return;
+
+        auto& resampler = newResamplers[i];
+        resampler.value = createResampler(valueType, resampleMethod, signal.sampleRate, outputSampleRate);
+        resampler.domain = createResampler(domainType, ResampleMethod::Linear, signal.sampleRate, outputSampleRate);
+        if (!resampler.value || !resampler.domain)
+        {
+            LOG_D("Resampling requires 32 or 64-bit integer or floating-point value and domain read types.")
+            invalid = true;
+            return;
+        }
+
+        resampler.valueSampleSize = getSampleSize(valueType);
+        resampler.domainSampleSize = getSampleSize(domainType);
+        resampler.lookahead = std::max(resampler.value->getLookahead(), resampler.domain->getLookahead());
+        resampler.pendingLookahead = resampler.lookahead;
+    }
+
+    resamplers = std::move(newResamplers);
+}
+
+bool MultiReaderImpl::isResampling() const
+{
+    return resampleMethod != ResampleMethod::None && !resamplers.empty();
+}
+
+void MultiReaderImpl::resetResamplers()
+{
+    for (auto& resampler : resamplers)
+    {
+        resampler.value->reset();
+        resampler.domain->reset();
+        resampler.pendingLookahead = resampler.lookahead;
+    }
 }
 
 void MultiReaderImpl::setStartInfo()
@@ -571,6 +675,9 @@ ErrCode MultiReaderImpl::setValueTransformFunction(IFunction* transform)
 {
     std::scoped_lock lock(mutex);
 
+    if (interleavedOutput && transform != nullptr)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOT_SUPPORTED, "Transform functions are not supported with interleaved output.");
+
     for (auto& signal : signals)
     {
         signal.valueReader->setTransformFunction(transform);
@@ -583,6 +690,9 @@ ErrCode MultiReaderImpl::setDomainTransformFunction(IFunction* transform)
 {
     std::scoped_lock lock(mutex);
 
+    if (interleavedOutput && transform != nullptr)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOT_SUPPORTED, "Transform functions are not supported with interleaved output.");
+
     for (auto& signal : signals)
     {
         signal.domainReader->setTransformFunction(transform);
@@ -615,7 +725,7 @@ ErrCode MultiReaderImpl::getAvailableCount(SizeT* count)
     SizeT cnt = 0;
     if (syncStatus == SyncStatus::Synchronized)
     {
-        cnt = (min / sampleRateDividerLcm) * sampleRateDividerLcm;
+        cnt = (min / sampleRateDividerLcm) * sampleRateDividerLcm / outputSampleRateDivider;
         if (cnt < minReadCount)
             cnt = 0;
     }
@@ -637,6 +747,9 @@ ErrCode MultiReaderImpl::read(void* samples, SizeT* count, SizeT timeoutMs, IMul
 
     std::scoped_lock lock(mutex);
 
+    if (interleavedOutput && getSampleSize(signals[0].valueReader->getReadType()) == 0)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Interleaved output requires a fixed-size value read type.");
+
     MultiReaderStatusPtr earlyReturnStatus;
     if (nextPacketIsEvent)
     {
@@ -656,7 +769,7 @@ ErrCode MultiReaderImpl::read(void* samples, SizeT* count, SizeT timeoutMs, IMul
         return OPENDAQ_SUCCESS;
     }
 
-    SizeT samplesToRead = (*count / sampleRateDividerLcm) * sampleRateDividerLcm;
+    SizeT samplesToRead = (*count * outputSampleRateDivider / sampleRateDividerLcm) * sampleRateDividerLcm;
     prepare(static_cast<void**>(samples), samplesToRead, milliseconds(timeoutMs));
 
     auto statusPtr = readPackets();
@@ -664,7 +777,7 @@ ErrCode MultiReaderImpl::read(void* samples, SizeT* count, SizeT timeoutMs, IMul
         *status = statusPtr.detach();
 
     SizeT samplesRead = samplesToRead - remainingSamplesToRead;
-    *count = samplesRead;
+    *count = samplesRead / outputSampleRateDivider;
     return OPENDAQ_SUCCESS;
 }
 
@@ -682,6 +795,10 @@ ErrCode MultiReaderImpl::readWithDomain(void* samples, void* domain, SizeT* coun
 
     std::scoped_lock lock(mutex);
 
+    if (interleavedOutput &&
+        (getSampleSize(signals[0].valueReader->getReadType()) == 0 || getSampleSize(signals[0].domainReader->getReadType()) == 0))
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Interleaved output requires fixed-size value and domain read types.");
+
     MultiReaderStatusPtr earlyReturnStatus;
     if (nextPacketIsEvent)
     {
@@ -702,7 +819,7 @@ ErrCode MultiReaderImpl::readWithDomain(void* samples, void* domain, SizeT* coun
         return OPENDAQ_SUCCESS;
     }
 
-    SizeT samplesToRead = (*count / sampleRateDividerLcm) * sampleRateDividerLcm;
+    SizeT samplesToRead = (*count * outputSampleRateDivider / sampleRateDividerLcm) * sampleRateDividerLcm;
     prepareWithDomain((void**) samples, (void**) domain, samplesToRead, milliseconds(timeoutMs));
 
     auto statusPtr = readPackets();
@@ -710,7 +827,7 @@ ErrCode MultiReaderImpl::readWithDomain(void* samples, void* domain, SizeT* coun
         *status = statusPtr.detach();
 
     SizeT samplesRead = samplesToRead - remainingSamplesToRead;
-    *count = samplesRead;
+    *count = samplesRead / outputSampleRateDivider;
 
     return OPENDAQ_SUCCESS;
 }
@@ -732,7 +849,7 @@ ErrCode MultiReaderImpl::skipSamples(SizeT* count, IMultiReaderStatus** status)
     if (minReadCount > *count)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Count parameter has to be larger than minReadCount.");
 
-    const SizeT samplesToRead = *count;
+    const SizeT samplesToRead = *count * outputSampleRateDivider;
     prepare(nullptr, samplesToRead, milliseconds(0));
 
     auto statusPtr = readPackets();
@@ -740,7 +857,7 @@ ErrCode MultiReaderImpl::skipSamples(SizeT* count, IMultiReaderStatus** status)
         *status = statusPtr.detach();
 
     const SizeT samplesRead = samplesToRead - remainingSamplesToRead;
-    *count = samplesRead;
+    *count = samplesRead / outputSampleRateDivider;
 
     return OPENDAQ_SUCCESS;
 }
@@ -755,6 +872,13 @@ SizeT MultiReaderImpl::getMinSamplesAvailable(bool acrossDescriptorChanges) cons
         if (!signal.info.dataPacket.assigned())
              sigSamples = 0;
 
+        // Samples the resampler still has to look ahead by cannot be returned yet
+        if (isResampling())
+        {
+            const SizeT reserved = resamplers[&signal - signals.data()].pendingLookahead * signal.sampleRateDivider;
+            sigSamples = sigSamples > reserved ? sigSamples - reserved : 0;
+        }
+
         if (sigSamples < min)
         {
             min = sigSamples;
@@ -853,7 +977,10 @@ ErrCode MultiReaderImpl::synchronize(SizeT& min, SyncStatus& syncStatus)
 
         syncStatus = getSyncStatus();
         if (syncStatus == SyncStatus::Synchronized)
+        {
+            resetResamplers();
             min = getMinSamplesAvailable();
+        }
         if (syncStatus == SyncStatus::SynchronizationFailed)
             setActiveInternal(false);
     });
@@ -895,7 +1022,13 @@ NumberPtr MultiReaderImpl::calculateOffset() const
     if (domainPacket.assigned() && domainPacket.getOffset().assigned())
     {
         Int delta = signals[0].packetDelta;
-        return domainPacket.getOffset().getIntValue() + (signals[0].info.prevSampleIndex * delta);
+        Int index = static_cast<Int>(signals[0].info.prevSampleIndex);
+
+        // The first signal was read ahead by the samples buffered in its resampler
+        if (isResampling())
+            index -= static_cast<Int>(resamplers[0].lookahead - resamplers[0].pendingLookahead);
+
+        return domainPacket.getOffset().getIntValue() + (index * delta);
     }
 
     return 0;
@@ -991,6 +1124,10 @@ MultiReaderStatusPtr MultiReaderImpl::readPackets()
         offset = calculateOffset();
         SizeT toRead = std::min(remainingSamplesToRead, availableSamples);
 
+        // Resamplers consume whole input and output samples only
+        if (isResampling())
+            toRead = (toRead / sampleRateDividerLcm) * sampleRateDividerLcm;
+
 #if (OPENDAQ_LOG_LEVEL <= OPENDAQ_LOG_LEVEL_TRACE)
         SizeT samplesToRead = remainingSamplesToRead;
         auto start = std::chrono::steady_clock::now();
@@ -1180,7 +1317,22 @@ void MultiReaderImpl::prepare(void** outValues, SizeT count, std::chrono::millis
     const auto signalsNum = signals.size();
     for (SizeT i = 0u; i < signalsNum; ++i)
     {
-        const auto outPtr = outValues != nullptr ? outValues[i] : nullptr;
+        void* outPtr = nullptr;
+        if (outValues != nullptr)
+            outPtr = interleavedOutput ? interleavedSlot(outValues, i, signals[i].valueReader->getReadType()) : outValues[i];
+
+        if (isResampling())
+        {
+            // The signal reader reads into the resampler scratch buffers; resampled samples are written to the output
+            resamplers[i].out = count != 0 ? outPtr : nullptr;
+            resamplers[i].domainOut = nullptr;
+            resamplers[i].outStride = interleavedOutput ? signalsNum : 1;
+            signals[i].outputStride = 0;
+            signals[i].prepare(nullptr, alignedCount);
+            continue;
+        }
+
+        signals[i].outputStride = interleavedOutput ? signalsNum : 0;
         signals[i].prepare(outPtr, alignedCount);
     }
 }
@@ -1200,7 +1352,31 @@ void MultiReaderImpl::prepareWithDomain(void** outValues, void** domain, SizeT c
     auto signalsNum = signals.size();
     for (SizeT i = 0u; i < signalsNum; ++i)
     {
-        signals[i].prepareWithDomain(outValues[i], domain[i], alignedCount);
+        if (isResampling())
+        {
+            resamplers[i].out = nullptr;
+            resamplers[i].domainOut = nullptr;
+            if (count != 0)
+            {
+                resamplers[i].out = interleavedOutput ? interleavedSlot(outValues, i, signals[i].valueReader->getReadType()) : outValues[i];
+                resamplers[i].domainOut = interleavedOutput ? interleavedSlot(domain, i, signals[i].domainReader->getReadType()) : domain[i];
+            }
+            resamplers[i].outStride = interleavedOutput ? signalsNum : 1;
+            signals[i].outputStride = 0;
+            signals[i].prepare(nullptr, alignedCount);
+        }
+        else if (interleavedOutput)
+        {
+            signals[i].outputStride = signalsNum;
+            signals[i].prepareWithDomain(interleavedSlot(outValues, i, signals[i].valueReader->getReadType()),
+                                         interleavedSlot(domain, i, signals[i].domainReader->getReadType()),
+                                         alignedCount);
+        }
+        else
+        {
+            signals[i].outputStride = 0;
+            signals[i].prepareWithDomain(outValues[i], domain[i], alignedCount);
+        }
     }
 }
 
@@ -1212,11 +1388,124 @@ MultiReaderImpl::Duration MultiReaderImpl::durationFromStart() const
 void MultiReaderImpl::readSamples(SizeT samples)
 {
     auto signalsNum = signals.size();
+
+    if (parallelReadThreshold != 0 && signalsNum > 1 && samples * signalsNum >= parallelReadThreshold)
+    {
+        const auto scheduler = context.getScheduler();
+        if (scheduler.assigned() && scheduler.isMultiThreaded())
+        {
+            readSamplesParallel(samples, scheduler);
+            return;
+        }
+    }
+
     for (SizeT i = 0u; i < signalsNum; ++i)
+        readSignalSamples(i, samples);
+}
+
+void MultiReaderImpl::readSignalSamples(SizeT index, SizeT samples)
+{
+    if (isResampling())
+    {
+        resampleSignalSamples(index, samples);
+        return;
+    }
+
+    signals[index].info.remainingToRead = samples / signals[index].sampleRateDivider;
+    signals[index].readPackets();
+}
+
+void MultiReaderImpl::resampleSignalSamples(SizeT index, SizeT samples)
+{
+    auto& signal = signals[index];
+    auto& resampler = resamplers[index];
+
+    // Samples are always read with domain so the domain resampler stays in step with the value resampler
+    const SizeT inputCount = samples / signal.sampleRateDivider + resampler.pendingLookahead;
+    if (resampler.valueScratch.size() < inputCount * resampler.valueSampleSize)
+        resampler.valueScratch.resize(inputCount * resampler.valueSampleSize);
+    if (resampler.domainScratch.size() < inputCount * resampler.domainSampleSize)
+        resampler.domainScratch.resize(inputCount * resampler.domainSampleSize);
+
+    signal.info.values = resampler.valueScratch.data();
+    signal.info.domainValues = resampler.domainScratch.data();
+    signal.info.remainingToRead = inputCount;
+    signal.readPackets();
+
+    const SizeT inputRead = inputCount - signal.info.remainingToRead;
+    resampler.value->push(resampler.valueScratch.data(), inputRead);
+    resampler.domain->push(resampler.domainScratch.data(), inputRead);
+    resampler.pendingLookahead -= std::min(resampler.pendingLookahead, inputRead);
+
+    const SizeT outputCount = samples / static_cast<SizeT>(outputSampleRateDivider);
+    const SizeT valuesOut = resampler.value->pull(resampler.out, outputCount, resampler.outStride);
+    const SizeT domainOut = resampler.domain->pull(resampler.domainOut, outputCount, resampler.outStride);
+
+    if (resampler.out != nullptr)
+        resampler.out = static_cast<uint8_t*>(resampler.out) + valuesOut * resampler.outStride * resampler.valueSampleSize;
+    if (resampler.domainOut != nullptr)
+        resampler.domainOut = static_cast<uint8_t*>(resampler.domainOut) + domainOut * resampler.outStride * resampler.domainSampleSize;
+}
+
+void MultiReaderImpl::readSamplesParallel(SizeT samples, const SchedulerPtr& scheduler)
+{
+    // Signals are claimed one at a time from a shared counter by the calling thread and by the
+    // scheduled helpers. The caller only waits for signals that were actually claimed, so a read
+    // issued from a scheduler worker cannot deadlock when the other workers are busy; helpers that
+    // start after all signals were claimed return without touching the reader.
+    struct ParallelRead
+    {
+        std::atomic<SizeT> next{0};
+        SizeT completed{0};
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    const auto signalsNum = signals.size();
+    const auto state = std::make_shared<ParallelRead>();
+
+    const auto readClaimed = [this, state, signalsNum, samples]
     {
-        signals[i].info.remainingToRead = samples / signals[i].sampleRateDivider;
-        signals[i].readPackets();
+        for (SizeT i = state->next++; i < signalsNum; i = state->next++)
+        {
+            std::exception_ptr error;
+            try
+            {
+                readSignalSamples(i, samples);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::scoped_lock lock(state->mutex);
+            if (error && !state->error)
+                state->error = error;
+            if (++state->completed == signalsNum)
+                state->condition.notify_all();
+        }
+    };
+
+    const SizeT helperCount = std::min<SizeT>(signalsNum, std::max(std::thread::hardware_concurrency(), 2u)) - 1;
+    for (SizeT i = 0; i < helperCount; ++i)
+    {
+        // If the scheduler refuses work (e.g. it was stopped), the calling thread reads the remaining signals
+        const ErrCode errCode = scheduler->scheduleWork(Work([readClaimed] { readClaimed(); }));
+        if (OPENDAQ_FAILED(errCode))
+        {
+            daqClearErrorInfo();
+            break;
+        }
     }
+
+    readClaimed();
+
+    std::unique_lock lock(state->mutex);
+    state->condition.wait(lock, [&state, signalsNum] { return state->completed == signalsNum; });
+
+    if (state->error)
+        std::rethrow_exception(state->error);
 }
 
 void MultiReaderImpl::readSamplesAndSetRemainingSamples(SizeT samples)
@@ -1344,7 +1633,7 @@ ErrCode INTERFACE_FUNC MultiReaderImpl::getCommonSampleRate(Int* commonSampleRat
 {
     OPENDAQ_PARAM_NOT_NULL(commonSampleRate);
 
-    *commonSampleRate = this->commonSampleRate;
+    *commonSampleRate = resampleMethod != ResampleMethod::None ? outputSampleRate : this->commonSampleRate;
 
     return OPENDAQ_SUCCESS;
 }
@@ -0,0 +1,220 @@
+#include <opendaq/reader_errors.h>
+#include <opendaq/overview_reader_impl.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+OverviewReaderImpl::OverviewReaderImpl(ISignal* signal,
+                                       SizeT levelCapacity,
+                                       SizeT levelCount,
+                                       ReadMode mode)
+    : Super(SignalPtr(signal), mode, SampleType::Float64, SampleType::Int64, false)
+    , pyramid(levelCapacity, levelCount)
+    , sampleIndex(0)
+{
+    try
+    {
+        port.setNotificationMethod(PacketReadyNotification::SameThread);
+        packetReceived(port.as<IInputPort>(true));
+    }
+    catch (...)
+    {
+        this->releaseWeakRefOnException();
+        throw;
+    }
+}
+
+OverviewReaderImpl::OverviewReaderImpl(IInputPortConfig* port,
+                                       SizeT levelCapacity,
+                                       SizeT levelCount,
+                                       ReadMode mode)
+    : Super(InputPortConfigPtr(port), mode, SampleType::Float64, SampleType::Int64, false)
+    , pyramid(levelCapacity, levelCount)
+    , sampleIndex(0)
+{
+    try
+    {
+        this->port.setNotificationMethod(PacketReadyNotification::Scheduler);
+        if (connection.assigned())
+            packetReceived(this->port.as<IInputPort>(true));
+    }
+    catch (...)
+    {
+        this->releaseWeakRefOnException();
+        throw;
+    }
+}
+
+ErrCode OverviewReaderImpl::getAvailableCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(mutex);
+
+    *count = pyramid.getSampleCount();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode OverviewReaderImpl::getEmpty(Bool* empty)
+{
+    OPENDAQ_PARAM_NOT_NULL(empty);
+    SizeT count;
+    getAvailableCount(&count);
+    *empty = count == 0;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode OverviewReaderImpl::getLevelCapacity(SizeT* capacity)
+{
+    OPENDAQ_PARAM_NOT_NULL(capacity);
+
+    *capacity = pyramid.getLevelCapacity();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode OverviewReaderImpl::getLevelCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    *count = pyramid.getLevelCount();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode OverviewReaderImpl::readOverview(void* minValues, void* maxValues, void* meanValues, void* domain, SizeT* count, Int start, Int end)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+    if (*count != 0)
+    {
+        OPENDAQ_PARAM_NOT_NULL(minValues);
+        OPENDAQ_PARAM_NOT_NULL(maxValues);
+        OPENDAQ_PARAM_NOT_NULL(meanValues);
+        OPENDAQ_PARAM_NOT_NULL(domain);
+    }
+
+    std::scoped_lock lock(mutex);
+
+    if (invalid)
+    {
+        *count = 0;
+        return OPENDAQ_IGNORED;
+    }
+
+    *count = pyramid.query(start,
+                           end,
+                           *count,
+                           static_cast<Float*>(minValues),
+                           static_cast<Float*>(maxValues),
+                           static_cast<Float*>(meanValues),
+                           static_cast<Int*>(domain));
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode OverviewReaderImpl::addPacket(const DataPacketPtr& dataPacket)
+{
+    const SizeT sampleCount = dataPacket.getSampleCount();
+    if (sampleCount == 0)
+        return OPENDAQ_SUCCESS;
+
+    values.resize(sampleCount);
+    void* valuesOut = values.data();
+    OPENDAQ_RETURN_IF_FAILED(valueReader->readData(getValuePacketData(dataPacket), 0, &valuesOut, sampleCount));
+
+    domainValues.resize(sampleCount);
+    const auto domainPacket = dataPacket.getDomainPacket();
+    if (domainPacket.assigned())
+    {
+        void* domainOut = domainValues.data();
+        ErrCode errCode = domainReader->readData(domainPacket.getData(), 0, &domainOut, sampleCount);
+        if (errCode == OPENDAQ_ERR_INVALIDSTATE)
+        {
+            if (!trySetDomainSampleType(domainPacket))
+                return DAQ_EXTEND_ERROR_INFO(errCode, "Failed to set domain sample type for packet");
+
+            daqClearErrorInfo();
+            domainOut = domainValues.data();
+            errCode = domainReader->readData(domainPacket.getData(), 0, &domainOut, sampleCount);
+        }
+        OPENDAQ_RETURN_IF_FAILED(errCode);
+    }
+    else
+    {
+        for (SizeT i = 0; i < sampleCount; ++i)
+            domainValues[i] = sampleIndex + static_cast<Int>(i);
+    }
+
+    for (SizeT i = 0; i < sampleCount; ++i)
+        pyramid.addSample(values[i], domainValues[i]);
+
+    sampleIndex += static_cast<Int>(sampleCount);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode OverviewReaderImpl::packetReceived(IInputPort* port)
+{
+    std::unique_lock lock(mutex);
+    bool hasPackets = false;
+    ErrCode errCode = OPENDAQ_SUCCESS;
+
+    PacketPtr packet = connection.assigned() ? connection.dequeue() : nullptr;
+    while (packet.assigned())
+    {
+        switch (packet.getType())
+        {
+            case PacketType::Data:
+            {
+                if (!invalid && OPENDAQ_SUCCEEDED(errCode))
+                    errCode = addPacket(packet.asPtr<IDataPacket>(true));
+                break;
+            }
+            case PacketType::Event:
+            {
+                auto eventPacket = packet.asPtr<IEventPacket>(true);
+                if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+                {
+                    handleDescriptorChanged(eventPacket);
+
+                    // aggregates of differently scaled or timed samples cannot be merged
+                    pyramid.clear();
+                    sampleIndex = 0;
+                }
+                break;
+            }
+            case PacketType::None:
+                break;
+        }
+
+        hasPackets = true;
+        packet = connection.dequeue();
+    }
+
+    auto callback = readCallback;
+    lock.unlock();
+
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (callback.assigned() && hasPackets)
+        OPENDAQ_RETURN_IF_FAILED(wrapHandler(callback));
+
+    if (externalListener.assigned() && externalListener.getRef().assigned())
+        return externalListener.getRef()->packetReceived(port);
+
+    return OPENDAQ_SUCCESS;
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY(
+    LIBRARY_FACTORY, OverviewReader,
+    ISignal*, signal,
+    SizeT, levelCapacity,
+    SizeT, levelCount,
+    ReadMode, mode
+)
+
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
+    LIBRARY_FACTORY, OverviewReader,
+    IOverviewReader, createOverviewReaderFromPort,
+    IInputPortConfig*, port,
+    SizeT, levelCapacity,
+    SizeT, levelCount,
+    ReadMode, mode
+)
+
+END_NAMESPACE_OPENDAQ
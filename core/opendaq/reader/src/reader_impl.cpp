@@ -3,10 +3,12 @@
 #include <opendaq/packet_reader.h>
 #include <opendaq/stream_reader.h>
 #include <opendaq/tail_reader.h>
+#include <opendaq/overview_reader.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
 template class ReaderImpl<IBlockReader>;
 template class ReaderImpl<ITailReader>;
+template class ReaderImpl<IOverviewReader>;
 
 END_NAMESPACE_OPENDAQ
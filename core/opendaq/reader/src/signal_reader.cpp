@@ -565,7 +565,9 @@ ErrCode SignalReader::readPacketData()
 
     if (info.values != nullptr)
     {
-        ErrCode errCode = valueReader->readData(getValuePacketData(info.dataPacket), info.prevSampleIndex, &info.values, toRead);
+        ErrCode errCode = outputStride != 0
+            ? valueReader->readDataStrided(getValuePacketData(info.dataPacket), info.prevSampleIndex, &info.values, toRead, outputStride)
+            : valueReader->readData(getValuePacketData(info.dataPacket), info.prevSampleIndex, &info.values, toRead);
         OPENDAQ_RETURN_IF_FAILED(errCode);
     }
 
@@ -580,13 +582,20 @@ ErrCode SignalReader::readPacketData()
         LOG_T("[Reading: {} ", port.getSignal().getLocalId());
 
         auto domainPacket = dataPacket.getDomainPacket();
-        ErrCode errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+        const auto readDomain = [&]
+        {
+            return outputStride != 0
+                ? domainReader->readDataStrided(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead, outputStride)
+                : domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+        };
+
+        ErrCode errCode = readDomain();
         if (errCode == OPENDAQ_ERR_INVALIDSTATE)
         {
             if (!trySetDomainSampleType(domainPacket))
                 return DAQ_EXTEND_ERROR_INFO(errCode, "Failed to set domain sample type for packet");
             daqClearErrorInfo();
-            errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+            errCode = readDomain();
         }
 
         LOG_T("]");
@@ -202,40 +202,55 @@ std::unique_ptr<Comparable> TypedReader<ReadType>::readStartLinear(const DataPac
 
 template <typename ReadType>
 ErrCode TypedReader<ReadType>::readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count)
+{
+    return readDataInternal(inputBuffer, offset, outputBuffer, count, 0);
+}
+
+template <typename ReadType>
+ErrCode TypedReader<ReadType>::readDataStrided(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count, SizeT stride)
+{
+    if (stride == 0)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Output stride must be greater than 0.");
+
+    return readDataInternal(inputBuffer, offset, outputBuffer, count, stride);
+}
+
+template <typename ReadType>
+ErrCode TypedReader<ReadType>::readDataInternal(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count, SizeT stride)
 {
     switch (dataSampleType)
     {
         case SampleType::Float32:
-            return readValues<SampleTypeToType<SampleType::Float32>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::Float32>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::Float64:
-            return readValues<SampleTypeToType<SampleType::Float64>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::Float64>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::UInt8:
-            return readValues<SampleTypeToType<SampleType::UInt8>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::UInt8>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::Int8:
-            return readValues<SampleTypeToType<SampleType::Int8>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::Int8>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::Int16:
-            return readValues<SampleTypeToType<SampleType::Int16>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::Int16>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::UInt16:
-            return readValues<SampleTypeToType<SampleType::UInt16>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::UInt16>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::Int32:
-            return readValues<SampleTypeToType<SampleType::Int32>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::Int32>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::UInt32:
-            return readValues<SampleTypeToType<SampleType::UInt32>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::UInt32>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::Int64:
-            return readValues<SampleTypeToType<SampleType::Int64>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::Int64>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::UInt64:
-            return readValues<SampleTypeToType<SampleType::UInt64>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::UInt64>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::RangeInt64:
-            return readValues<SampleTypeToType<SampleType::RangeInt64>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::RangeInt64>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::ComplexFloat32:
-            return readValues<SampleTypeToType<SampleType::ComplexFloat32>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::ComplexFloat32>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::ComplexFloat64:
-            return readValues<SampleTypeToType<SampleType::ComplexFloat64>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::ComplexFloat64>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::Binary:
         case SampleType::String:
-            return readValues<SampleTypeToType<SampleType::String>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::String>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::Struct:
-            return readValues<SampleTypeToType<SampleType::Struct>::Type>(inputBuffer, offset, outputBuffer, count);
+            return readValues<SampleTypeToType<SampleType::Struct>::Type>(inputBuffer, offset, outputBuffer, count, stride);
         case SampleType::Invalid:
             return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Unknown raw data-type, conversion not possible.");
         case SampleType::Null:
@@ -605,7 +620,7 @@ ErrCode TypedReader<ReadType>::convertDeltaStart(const daq::DictPtr<daq::IString
 
 template <typename TReadType>
 template <typename TDataType>
-ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const
+ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead, SizeT stride) const
 {
     OPENDAQ_PARAM_NOT_NULL(inputBuffer);
     OPENDAQ_PARAM_NOT_NULL(outputBuffer);
@@ -615,11 +630,22 @@ ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void
         if (!ignoreTransform && transformFunction.assigned())
             return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOT_SUPPORTED, "Transform function for void reader not supported.");
 
-        const auto dataStart = static_cast<void*>(static_cast<uint8_t*>(inputBuffer) + offset * rawSampleSize);
-        const auto toReadInBytes = rawSampleSize * toRead;
-        const auto dataOut = *outputBuffer;
-        std::memcpy(dataOut, dataStart, toReadInBytes);
-        *outputBuffer = static_cast<void*>(static_cast<uint8_t*>(dataOut) + toReadInBytes);
+        const auto dataStart = static_cast<uint8_t*>(inputBuffer) + offset * rawSampleSize;
+        const auto dataOut = static_cast<uint8_t*>(*outputBuffer);
+
+        if (stride == 0)
+        {
+            const auto toReadInBytes = rawSampleSize * toRead;
+            std::memcpy(dataOut, dataStart, toReadInBytes);
+            *outputBuffer = static_cast<void*>(dataOut + toReadInBytes);
+            return OPENDAQ_SUCCESS;
+        }
+
+        const auto strideInBytes = rawSampleSize * stride;
+        for (std::size_t i = 0; i < toRead; ++i)
+            std::memcpy(dataOut + i * strideInBytes, dataStart + i * rawSampleSize, rawSampleSize);
+
+        *outputBuffer = static_cast<void*>(dataOut + toRead * strideInBytes);
         return OPENDAQ_SUCCESS;
     }
     else if constexpr (std::is_convertible_v<TDataType, TReadType>)
@@ -627,6 +653,23 @@ ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void
         auto dataStart = static_cast<TDataType*>(inputBuffer) + (offset * valuesPerSample);
         auto dataOut = static_cast<TReadType*>(*outputBuffer);
 
+        if (stride != 0)
+        {
+            if (!ignoreTransform && transformFunction.assigned())
+                return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOT_SUPPORTED, "Transform functions are not supported with strided output.");
+
+            // Convert directly into the interleaved slots; each sample keeps its values contiguous
+            const auto strideInValues = stride * valuesPerSample;
+            for (std::size_t i = 0; i < toRead; ++i)
+            {
+                for (std::size_t j = 0; j < valuesPerSample; ++j)
+                    dataOut[i * strideInValues + j] = static_cast<TReadType>(dataStart[i * valuesPerSample + j]);  // C4244 - possible data loss due to conversion
+            }
+
+            *outputBuffer = dataOut + toRead * strideInValues;
+            return OPENDAQ_SUCCESS;
+        }
+
         if (!ignoreTransform && transformFunction.assigned())
         {
             transformFunction.call((Int) dataStart, (Int) dataOut, toRead, dataDescriptor);
@@ -667,11 +710,27 @@ ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void
 
 template <>
 template <>
-ErrCode TypedReader<ClockTick>::readValues<ClockRange>(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const
+ErrCode TypedReader<ClockTick>::readValues<ClockRange>(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead, SizeT stride) const
 {
     auto dataStart = static_cast<ClockRange*>(inputBuffer) + (offset * valuesPerSample);
     auto dataOut = static_cast<ClockTick*>(*outputBuffer);
 
+    if (stride != 0)
+    {
+        if (!ignoreTransform && transformFunction.assigned())
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOT_SUPPORTED, "Transform functions are not supported with strided output.");
+
+        const auto strideInValues = stride * valuesPerSample;
+        for (std::size_t i = 0; i < toRead; ++i)
+        {
+            for (std::size_t j = 0; j < valuesPerSample; ++j)
+                dataOut[i * strideInValues + j] = dataStart[i * valuesPerSample + j].start;
+        }
+
+        *outputBuffer = dataOut + toRead * strideInValues;
+        return OPENDAQ_SUCCESS;
+    }
+
     if (!ignoreTransform && transformFunction.assigned())
     {
         transformFunction.call((Int) dataStart, (Int) dataOut, toRead, dataDescriptor);
@@ -727,6 +786,10 @@ bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descripto
         {
             valuesPerSample = dimensions[0].getSize();
         }
+        else
+        {
+            valuesPerSample = 1;
+        }
 
         dataDescriptor = descriptor;
     }
@@ -740,6 +803,12 @@ SampleType TypedReader<ReadType>::getReadType() const noexcept
     return SampleTypeFromType<ReadType>::SampleType;
 }
 
+template <typename ReadType>
+SizeT TypedReader<ReadType>::getValuesPerSample() const noexcept
+{
+    return valuesPerSample;
+}
+
 ////
 // Reader
 ////
@@ -755,6 +824,11 @@ bool Reader::isUndefined() const noexcept
     return false;
 }
 
+SizeT Reader::getValuesPerSample() const noexcept
+{
+    return 1;
+}
+
 FunctionPtr Reader::getTransformFunction() const
 {
     return transformFunction;
@@ -1,4 +1,5 @@
 #include <opendaq/custom_log.h>
+#include <opendaq/dimension_factory.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/input_port_factory.h>
 #include <opendaq/reader_exceptions.h>
@@ -4953,3 +4954,179 @@ TEST_F(MultiReaderTest, BuilderNotificationMethodsOverride)
     for (const auto& port : reader.getInputPorts())
         ASSERT_EQ(port.getNotificationMethod(), PacketReadyNotification::Scheduler);
 }
+
+TEST_F(MultiReaderTest, InterleavedOutput)
+{
+    constexpr const auto NUM_SIGNALS = 3;
+    readSignals.reserve(NUM_SIGNALS);
+
+    for (auto i = 0; i < NUM_SIGNALS; ++i)
+        addSignal(0, 100, createDomainSignal("2022-09-27T00:02:03+00:00"));
+
+    auto multi = MultiReaderBuilder()
+                     .setInputPortNotificationMethod(PacketReadyNotification::SameThread)
+                     .setInterleavedOutput(true)
+                     .addSignals(signalsToList())
+                     .build();
+
+    {
+        SizeT count{0};
+        auto status = multi.read(nullptr, &count);
+        ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+        ASSERT_TRUE(status.getValid());
+    }
+
+    sendPackets(0);
+    sendPackets(1);
+
+    constexpr const SizeT SAMPLES = 150u;
+
+    std::array<double, SAMPLES * NUM_SIGNALS> values{};
+    std::array<ClockTick, SAMPLES * NUM_SIGNALS> domain{};
+
+    SizeT count{SAMPLES};
+    multi.readWithDomain(values.data(), domain.data(), &count);
+    ASSERT_EQ(count, SAMPLES);
+
+    for (SizeT frame = 0; frame < SAMPLES; ++frame)
+    {
+        for (SizeT sig = 0; sig < NUM_SIGNALS; ++sig)
+        {
+            ASSERT_EQ(values[frame * NUM_SIGNALS + sig], static_cast<double>(frame));
+            ASSERT_EQ(domain[frame * NUM_SIGNALS + sig], static_cast<ClockTick>(frame));
+        }
+    }
+}
+
+TEST_F(MultiReaderTest, InterleavedOutputRequiresCommonRate)
+{
+    readSignals.reserve(2);
+
+    addSignal(0, 100, createDomainSignal("2022-09-27T00:02:03+00:00", nullptr, LinearDataRule(1, 0)));
+    addSignal(0, 100, createDomainSignal("2022-09-27T00:02:03+00:00", nullptr, LinearDataRule(2, 0)));
+
+    auto multi = MultiReaderBuilder()
+                     .setInputPortNotificationMethod(PacketReadyNotification::SameThread)
+                     .setInterleavedOutput(true)
+                     .addSignals(signalsToList())
+                     .build();
+
+    SizeT count{0};
+    auto status = multi.read(nullptr, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_FALSE(status.getValid());
+}
+
+TEST_F(MultiReaderTest, InterleavedOutputRejectsArraySignals)
+{
+    readSignals.reserve(2);
+
+    addSignal(0, 100, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    auto& arraySignal = addSignal(0, 100, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    arraySignal.signal.setDescriptor(setupConfigurableDescriptor(SampleType::Float64)
+                                         .setDimensions(List<IDimension>(DimensionBuilder().setRule(LinearDimensionRule(0, 1, 4)).build()))
+                                         .build());
+
+    auto multi = MultiReaderBuilder()
+                     .setInputPortNotificationMethod(PacketReadyNotification::SameThread)
+                     .setInterleavedOutput(true)
+                     .addSignals(signalsToList())
+                     .build();
+
+    SizeT count{0};
+    auto status = multi.read(nullptr, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_FALSE(status.getValid());
+}
+
+TEST_F(MultiReaderTest, ParallelRead)
+{
+    constexpr const auto NUM_SIGNALS = 8;
+    readSignals.reserve(NUM_SIGNALS);
+
+    context = Context(Scheduler(logger, 4), logger, nullptr, nullptr, nullptr);
+
+    for (auto i = 0; i < NUM_SIGNALS; ++i)
+        addSignal(0, 1000, createDomainSignal("2022-09-27T00:02:03+00:00"));
+
+    auto multi = MultiReaderBuilder()
+                     .setInputPortNotificationMethod(PacketReadyNotification::SameThread)
+                     .setParallelReadThreshold(1)
+                     .addSignals(signalsToList())
+                     .build();
+
+    {
+        SizeT count{0};
+        auto status = multi.read(nullptr, &count);
+        ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    }
+
+    sendPackets(0);
+    sendPackets(1);
+
+    constexpr const SizeT SAMPLES = 1500u;
+
+    std::vector<std::vector<double>> values(NUM_SIGNALS, std::vector<double>(SAMPLES));
+    std::vector<void*> valuesPerSignal;
+    for (auto& signalValues : values)
+        valuesPerSignal.push_back(signalValues.data());
+
+    SizeT count{SAMPLES};
+    multi.read(valuesPerSignal.data(), &count);
+    ASSERT_EQ(count, SAMPLES);
+
+    for (const auto& signalValues : values)
+        for (SizeT i = 0; i < SAMPLES; ++i)
+            ASSERT_EQ(signalValues[i], static_cast<double>(i));
+}
+
+TEST_F(MultiReaderTest, ResampleLinear)
+{
+    readSignals.reserve(2);
+
+    auto& sig0 = addSignal(0, 100, createDomainSignal("2022-09-27T00:02:03+00:00", nullptr, LinearDataRule(1, 0)));
+    auto& sig1 = addSignal(0, 100, createDomainSignal("2022-09-27T00:02:03+00:00", nullptr, LinearDataRule(2, 0)));
+
+    auto multi = MultiReaderBuilder()
+                     .setInputPortNotificationMethod(PacketReadyNotification::SameThread)
+                     .setResampleMethod(ResampleMethod::Linear)
+                     .addSignals(signalsToList())
+                     .build();
+
+    {
+        SizeT count{0};
+        auto status = multi.read(nullptr, &count);
+        ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+        ASSERT_TRUE(status.getValid());
+    }
+
+    ASSERT_EQ(multi.getCommonSampleRate(), 1000);
+
+    sig0.createAndSendPacket(0);
+    sig0.createAndSendPacket(1);
+    sig0.createAndSendPacket(2);
+    sig1.createAndSendPacket(0);
+    sig1.createAndSendPacket(1);
+
+    // One input sample per signal is held back to interpolate the next read; reads end on a sample of the slower signal
+    ASSERT_EQ(multi.getAvailableCount(), 298u);
+
+    constexpr const SizeT SAMPLES = 150u;
+
+    std::array<std::array<double, SAMPLES>, 2> values{};
+    std::array<std::array<ClockTick, SAMPLES>, 2> domain{};
+    void* valuesPerSignal[2]{values[0].data(), values[1].data()};
+    void* domainPerSignal[2]{domain[0].data(), domain[1].data()};
+
+    SizeT count{SAMPLES};
+    multi.readWithDomain(valuesPerSignal, domainPerSignal, &count);
+    ASSERT_EQ(count, SAMPLES);
+
+    for (SizeT i = 0; i < SAMPLES; ++i)
+    {
+        ASSERT_EQ(domain[0][i], static_cast<ClockTick>(i));
+        ASSERT_EQ(domain[1][i], static_cast<ClockTick>(i));
+        ASSERT_DOUBLE_EQ(values[0][i], static_cast<double>(i));
+        ASSERT_DOUBLE_EQ(values[1][i], static_cast<double>(i) / 2.0);
+    }
+}
@@ -0,0 +1,157 @@
+#include <opendaq/reader_factory.h>
+#include <testutils/testutils.h>
+#include "reader_common.h"
+
+using namespace daq;
+
+using OverviewReaderTest = ReaderTest<>;
+
+TEST_F(OverviewReaderTest, Create)
+{
+    ASSERT_NO_THROW(OverviewReader(signal, 16, 4));
+}
+
+TEST_F(OverviewReaderTest, CreateNullThrows)
+{
+    ASSERT_THROW_MSG(OverviewReader(nullptr), ArgumentNullException, "Signal must not be null")
+}
+
+TEST_F(OverviewReaderTest, IsSampleReader)
+{
+    auto reader = OverviewReader(this->signal);
+    ASSERT_NO_THROW(reader.asPtr<ISampleReader>());
+    ASSERT_NO_THROW(reader.asPtr<IOverviewReader>());
+}
+
+TEST_F(OverviewReaderTest, GetReadTypes)
+{
+    auto reader = OverviewReader(this->signal, 16, 4);
+    ASSERT_EQ(reader.getValueReadType(), SampleType::Float64);
+    ASSERT_EQ(reader.getDomainReadType(), SampleType::Int64);
+    ASSERT_EQ(reader.getLevelCapacity(), 16u);
+    ASSERT_EQ(reader.getLevelCount(), 4u);
+}
+
+TEST_F(OverviewReaderTest, EmptyOverview)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+    auto reader = OverviewReader(this->signal, 16, 4);
+
+    ASSERT_TRUE(reader.getEmpty());
+
+    SizeT count = 4;
+    double minValues[4], maxValues[4], meanValues[4];
+    Int domain[4];
+    reader.readOverview(minValues, maxValues, meanValues, domain, &count, 0, 100);
+    ASSERT_EQ(count, 0u);
+}
+
+TEST_F(OverviewReaderTest, ReadOverviewWithoutDomain)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
+    auto reader = OverviewReader(this->signal, 256, 4);
+
+    constexpr SizeT SampleCount = 64;
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), SampleCount);
+    auto data = static_cast<int32_t*>(dataPacket.getData());
+    for (SizeT i = 0; i < SampleCount; ++i)
+        data[i] = static_cast<int32_t>(i);
+
+    this->sendPacket(dataPacket);
+    ASSERT_EQ(reader.getAvailableCount(), SampleCount);
+
+    // eight points of eight samples each, indexed by the sample position
+    constexpr SizeT PointCount = 8;
+    SizeT count = PointCount;
+    double minValues[PointCount], maxValues[PointCount], meanValues[PointCount];
+    Int domain[PointCount];
+    reader.readOverview(minValues, maxValues, meanValues, domain, &count, 0, SampleCount);
+
+    ASSERT_EQ(count, PointCount);
+    for (SizeT i = 0; i < PointCount; ++i)
+    {
+        ASSERT_EQ(domain[i], static_cast<Int>(i * 8));
+        ASSERT_DOUBLE_EQ(minValues[i], i * 8.0);
+        ASSERT_DOUBLE_EQ(maxValues[i], i * 8.0 + 7);
+        ASSERT_DOUBLE_EQ(meanValues[i], i * 8.0 + 3.5);
+    }
+}
+
+TEST_F(OverviewReaderTest, ReadOverviewWithDomain)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+    auto domainSignal = Signal(context, nullptr, "time");
+    domainSignal.setDescriptor(createDomainDescriptor("", nullptr, LinearDataRule(10, 0)));
+    this->signal.setDomainSignal(domainSignal);
+
+    auto reader = OverviewReader(this->signal, 256, 4);
+
+    constexpr SizeT SampleCount = 100;
+    auto domainPacket = DataPacket(domainSignal.getDescriptor(), SampleCount, 1000);
+    auto dataPacket = DataPacketWithDomain(domainPacket, this->signal.getDescriptor(), SampleCount);
+    auto data = static_cast<double*>(dataPacket.getData());
+    for (SizeT i = 0; i < SampleCount; ++i)
+        data[i] = i % 2 == 0 ? 1.0 : -1.0;
+
+    this->sendPacket(dataPacket);
+
+    // only the range between ticks 1200 and 1400 is requested
+    SizeT count = 2;
+    double minValues[2], maxValues[2], meanValues[2];
+    Int domain[2];
+    reader.readOverview(minValues, maxValues, meanValues, domain, &count, 1200, 1400);
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(domain[0], 1200);
+    ASSERT_EQ(domain[1], 1300);
+    for (SizeT i = 0; i < count; ++i)
+    {
+        ASSERT_DOUBLE_EQ(minValues[i], -1.0);
+        ASSERT_DOUBLE_EQ(maxValues[i], 1.0);
+        ASSERT_DOUBLE_EQ(meanValues[i], 0.0);
+    }
+}
+
+TEST_F(OverviewReaderTest, MemoryIsBounded)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+    auto reader = OverviewReader(this->signal, 8, 3);
+
+    // the coarsest level holds 8 aggregates of 4 samples
+    constexpr SizeT PacketSamples = 10;
+    for (int packet = 0; packet < 10; ++packet)
+    {
+        auto dataPacket = DataPacket(this->signal.getDescriptor(), PacketSamples);
+        auto data = static_cast<double*>(dataPacket.getData());
+        for (SizeT i = 0; i < PacketSamples; ++i)
+            data[i] = packet;
+
+        this->sendPacket(dataPacket);
+    }
+
+    ASSERT_EQ(reader.getAvailableCount(), 32u);
+
+    // the oldest samples were dropped, the newest are always kept
+    SizeT count = 1;
+    double minValue, maxValue, meanValue;
+    Int domain;
+    reader.readOverview(&minValue, &maxValue, &meanValue, &domain, &count, 0, 100);
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_DOUBLE_EQ(minValue, 6.0);
+    ASSERT_DOUBLE_EQ(maxValue, 9.0);
+}
+
+TEST_F(OverviewReaderTest, DescriptorChangeClearsOverview)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+    auto reader = OverviewReader(this->signal, 16, 4);
+
+    this->sendPacket(DataPacket(this->signal.getDescriptor(), 10));
+    ASSERT_EQ(reader.getAvailableCount(), 10u);
+
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
+    this->sendPacket(DataPacket(this->signal.getDescriptor(), 5));
+
+    ASSERT_EQ(reader.getAvailableCount(), 5u);
+}
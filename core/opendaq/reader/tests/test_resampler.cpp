@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <opendaq/resampler.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace daq;
+
+using ResamplerTest = testing::Test;
+
+template <typename T>
+static std::vector<T> pullAll(ResamplerBase& resampler, SizeT count)
+{
+    std::vector<T> out(count);
+    out.resize(resampler.pull(out.data(), count, 1));
+    return out;
+}
+
+TEST_F(ResamplerTest, HoldUpsampling)
+{
+    Resampler<double> resampler(ResampleMethod::Hold, 500, 1000);
+    ASSERT_EQ(resampler.getLookahead(), 0u);
+
+    const std::vector<double> input{0.0, 1.0, 2.0, 3.0};
+    resampler.push(input.data(), input.size());
+
+    const auto out = pullAll<double>(resampler, 16);
+    ASSERT_EQ(out, (std::vector<double>{0.0, 0.0, 1.0, 1.0, 2.0, 2.0, 3.0, 3.0}));
+}
+
+TEST_F(ResamplerTest, LinearUpsampling)
+{
+    Resampler<double> resampler(ResampleMethod::Linear, 500, 1000);
+    ASSERT_EQ(resampler.getLookahead(), 1u);
+
+    const std::vector<double> input{0.0, 2.0, 4.0, 6.0};
+    resampler.push(input.data(), input.size());
+
+    // The last input sample is only used as lookahead
+    const auto out = pullAll<double>(resampler, 16);
+    ASSERT_EQ(out, (std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0, 5.0}));
+}
+
+TEST_F(ResamplerTest, LinearIntegerKeepsPrecision)
+{
+    Resampler<int64_t> resampler(ResampleMethod::Linear, 1, 2);
+
+    const std::vector<int64_t> input{(int64_t{1} << 60), (int64_t{1} << 60) + 2};
+    resampler.push(input.data(), input.size());
+
+    const auto out = pullAll<int64_t>(resampler, 4);
+    ASSERT_EQ(out, (std::vector<int64_t>{(int64_t{1} << 60), (int64_t{1} << 60) + 1}));
+}
+
+TEST_F(ResamplerTest, StridedOutput)
+{
+    Resampler<float> resampler(ResampleMethod::Hold, 1000, 1000);
+
+    const std::vector<float> input{1.0f, 2.0f, 3.0f};
+    resampler.push(input.data(), input.size());
+
+    std::vector<float> out(6, 0.0f);
+    ASSERT_EQ(resampler.pull(out.data(), 3, 2), 3u);
+    ASSERT_EQ(out, (std::vector<float>{1.0f, 0.0f, 2.0f, 0.0f, 3.0f, 0.0f}));
+}
+
+TEST_F(ResamplerTest, PolyphaseUnityGain)
+{
+    Resampler<double> resampler(ResampleMethod::Polyphase, 3000, 2000);
+    ASSERT_EQ(resampler.getMethod(), ResampleMethod::Polyphase);
+
+    const std::vector<double> input(3000, 5.0);
+    resampler.push(input.data(), input.size());
+
+    const auto out = pullAll<double>(resampler, 2000);
+    ASSERT_GT(out.size(), 1900u);
+    for (const auto value : out)
+        ASSERT_NEAR(value, 5.0, 1e-9);
+}
+
+TEST_F(ResamplerTest, PolyphaseSine)
+{
+    constexpr double pi = 3.14159265358979323846;
+    constexpr double frequency = 50.0;
+    constexpr int64_t inputRate = 3000;
+    constexpr int64_t outputRate = 2000;
+
+    Resampler<double> resampler(ResampleMethod::Polyphase, inputRate, outputRate);
+
+    std::vector<double> input(6000);
+    for (size_t i = 0; i < input.size(); ++i)
+        input[i] = std::sin(2.0 * pi * frequency * static_cast<double>(i) / inputRate);
+
+    resampler.push(input.data(), input.size());
+    const auto out = pullAll<double>(resampler, 4000);
+    ASSERT_GT(out.size(), 3900u);
+
+    // Skip the start, where the filter sees the extended first sample
+    for (size_t n = 100; n < out.size(); ++n)
+        ASSERT_NEAR(out[n], std::sin(2.0 * pi * frequency * static_cast<double>(n) / outputRate), 1e-3);
+}
+
+TEST_F(ResamplerTest, ChunkedInputMatchesSingleBlock)
+{
+    Resampler<double> single(ResampleMethod::Polyphase, 48000, 44100);
+    Resampler<double> chunked(ResampleMethod::Polyphase, 48000, 44100);
+
+    std::vector<double> input(4800);
+    for (size_t i = 0; i < input.size(); ++i)
+        input[i] = std::cos(static_cast<double>(i) * 0.01) + static_cast<double>(i % 7);
+
+    single.push(input.data(), input.size());
+    const auto expected = pullAll<double>(single, input.size());
+
+    std::vector<double> actual;
+    for (size_t i = 0; i < input.size(); i += 37)
+    {
+        chunked.push(input.data() + i, std::min<size_t>(37, input.size() - i));
+        const auto out = pullAll<double>(chunked, 11);
+        actual.insert(actual.end(), out.begin(), out.end());
+    }
+
+    const auto rest = pullAll<double>(chunked, input.size());
+    actual.insert(actual.end(), rest.begin(), rest.end());
+
+    ASSERT_EQ(actual, expected);
+}
+
+TEST_F(ResamplerTest, Reset)
+{
+    Resampler<double> resampler(ResampleMethod::Linear, 1000, 2000);
+
+    const std::vector<double> first{10.0, 20.0};
+    resampler.push(first.data(), first.size());
+    ASSERT_EQ(pullAll<double>(resampler, 8).size(), 2u);
+
+    resampler.reset();
+
+    const std::vector<double> second{0.0, 4.0};
+    resampler.push(second.data(), second.size());
+    ASSERT_EQ(pullAll<double>(resampler, 8), (std::vector<double>{0.0, 2.0}));
+}
+
+TEST_F(ResamplerTest, Factory)
+{
+    ASSERT_EQ(createResampler(SampleType::Float32, ResampleMethod::Polyphase, 3, 2)->getMethod(), ResampleMethod::Polyphase);
+    ASSERT_EQ(createResampler(SampleType::Int64, ResampleMethod::Polyphase, 3, 2)->getMethod(), ResampleMethod::Linear);
+    ASSERT_EQ(createResampler(SampleType::Float64, ResampleMethod::Polyphase, 1, 1000)->getMethod(), ResampleMethod::Linear);
+    ASSERT_EQ(createResampler(SampleType::Int16, ResampleMethod::Linear, 3, 2), nullptr);
+    ASSERT_EQ(createResampler(SampleType::ComplexFloat64, ResampleMethod::Hold, 3, 2), nullptr);
+    ASSERT_THROW(createResampler(SampleType::Float64, ResampleMethod::None, 3, 2), InvalidParameterException);
+}
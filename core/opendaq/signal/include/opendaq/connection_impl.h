@@ -17,6 +17,8 @@
 #pragma once
 #include <opendaq/connection.h>
 #include <opendaq/connection_internal.h>
+#include <opendaq/connection_statistics.h>
+#include <opendaq/connection_statistics_counters.h>
 #include <opendaq/input_port_config_ptr.h>
 #include <opendaq/context_ptr.h>
 #include <coretypes/intfs.h>
@@ -31,10 +33,10 @@
 #include <queue>
 
 BEGIN_NAMESPACE_OPENDAQ
-class ConnectionImpl : public ImplementationOfWeak<IConnection, IConnectionInternal>
+class ConnectionImpl : public ImplementationOfWeak<IConnection, IConnectionInternal, IConnectionStatistics>
 {
 public:
-    using Super = ImplementationOfWeak<IConnection, IConnectionInternal>;
+    using Super = ImplementationOfWeak<IConnection, IConnectionInternal, IConnectionStatistics>;
 
     explicit ConnectionImpl(
         const InputPortPtr& port,
@@ -69,6 +71,12 @@ public:
     // IConnectionInternal
     ErrCode INTERFACE_FUNC enqueueLastDescriptor() override;
 
+    // IConnectionStatistics
+    ErrCode INTERFACE_FUNC setStatisticsEnabled(Bool enabled) override;
+    ErrCode INTERFACE_FUNC getStatisticsEnabled(Bool* enabled) override;
+    ErrCode INTERFACE_FUNC getStatistics(IDict** statistics) override;
+    ErrCode INTERFACE_FUNC resetStatistics() override;
+
     [[nodiscard]] const std::deque<PacketPtr>& getPackets() const noexcept;
 
 #ifdef OPENDAQ_THREAD_SAFE
@@ -108,6 +116,9 @@ private:
     DataDescriptorPtr valueDataDescriptor;
     DataDescriptorPtr domainDataDescriptor;
 
+    bool statisticsEnabled;
+    ConnectionStatisticsCounters statistics;
+
 #ifdef OPENDAQ_THREAD_SAFE
     mutable std::mutex mutex;
 #endif
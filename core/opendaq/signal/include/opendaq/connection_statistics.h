@@ -0,0 +1,79 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <coretypes/baseobject.h>
+#include <coretypes/dictobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_signal_path
+ * @addtogroup opendaq_connection ConnectionStatistics
+ * @{
+ */
+
+/*!
+ * @brief Queue statistics of a connection, used to find the bottleneck of a backed up signal path.
+ *
+ * Statistics are disabled by default, in which case the connection does no additional work. They are
+ * enabled for all connections of a context through the `Diagnostics.ConnectionStatistics` context option,
+ * or per connection via `setStatisticsEnabled`.
+ *
+ * The statistics dictionary contains the following entries:
+ * - `QueuedPackets`, `QueuedSamples`, `QueuedBytes`: The current depth of the queue.
+ * - `HighWatermarkPackets`, `HighWatermarkSamples`, `HighWatermarkBytes`: The largest depth since the statistics
+ *   were enabled or reset.
+ * - `EnqueuedPackets`, `DequeuedPackets`: The total number of packets that passed through the queue.
+ * - `EnqueueRate`, `DequeueRate`: The number of samples per second entering and leaving the queue, averaged
+ *   over the last completed interval of at least one second.
+ * - `OldestPacketAge`: The time in microseconds the packet at the front of the queue has been waiting.
+ * - `MaxLatency`: The longest time in microseconds between enqueuing and dequeuing a packet.
+ * - `LatencyHistogram`: A list of packet counts where entry `i` counts packets dequeued after
+ *   [2^i, 2^(i+1)) microseconds. The first entry also counts faster packets and the last one slower ones.
+ *
+ * Queued bytes are the sizes of the raw data buffers of data packets.
+ */
+DECLARE_OPENDAQ_INTERFACE(IConnectionStatistics, IBaseObject)
+{
+    /*!
+     * @brief Enables or disables the collection of statistics. Enabling the statistics resets them.
+     * @param enabled True to collect statistics.
+     */
+    virtual ErrCode INTERFACE_FUNC setStatisticsEnabled(Bool enabled) = 0;
+
+    /*!
+     * @brief Gets whether statistics are collected.
+     * @param[out] enabled True if statistics are collected.
+     */
+    virtual ErrCode INTERFACE_FUNC getStatisticsEnabled(Bool* enabled) = 0;
+
+    // [elementType(statistics, IString, IBaseObject)]
+    /*!
+     * @brief Gets a snapshot of the statistics.
+     * @param[out] statistics The dictionary of statistics values keyed by name. Empty if statistics are disabled.
+     */
+    virtual ErrCode INTERFACE_FUNC getStatistics(IDict** statistics) = 0;
+
+    /*!
+     * @brief Resets the high watermarks, totals, rates and latencies. The queue depth is kept.
+     */
+    virtual ErrCode INTERFACE_FUNC resetStatistics() = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,227 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/packet_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+#include <coretypes/dictobject_factory.h>
+#include <coretypes/listobject_factory.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*
+ * Queue statistics of a connection. Not thread-safe; the connection updates and reads it under its queue lock.
+ *
+ * The enqueue time of every queued packet is kept in a queue parallel to the packet queue, so the connection
+ * must report every packet it adds to or removes from its queue.
+ */
+class ConnectionStatisticsCounters
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr SizeT LatencyBucketCount = 24;
+
+    // Restarts the statistics with the packets currently in the queue, taking now as their enqueue time.
+    template <typename Packets>
+    void reset(const Packets& queued)
+    {
+        const auto now = Clock::now();
+
+        enqueueTimes.clear();
+        queuedSamples = 0;
+        queuedBytes = 0;
+        for (const auto& packet : queued)
+            packetEnqueued(packet, now, false);
+
+        resetTotals(now);
+    }
+
+    void resetTotals()
+    {
+        resetTotals(Clock::now());
+    }
+
+    void packetEnqueued(const PacketPtr& packet, bool atFront = false)
+    {
+        const auto now = Clock::now();
+        packetEnqueued(packet, now, atFront);
+
+        enqueuedPackets++;
+        enqueueRate.add(samplesOf(packet), now);
+    }
+
+    void packetDequeued(const PacketPtr& packet)
+    {
+        if (enqueueTimes.empty())
+            return;
+
+        const auto now = Clock::now();
+        recordLatency(now - enqueueTimes.front());
+        enqueueTimes.pop_front();
+
+        const SizeT samples = samplesOf(packet);
+        queuedSamples -= std::min(queuedSamples, samples);
+        queuedBytes -= std::min(queuedBytes, bytesOf(packet));
+
+        dequeuedPackets++;
+        dequeueRate.add(samples, now);
+    }
+
+    DictPtr<IString, IBaseObject> getStatistics()
+    {
+        const auto now = Clock::now();
+        enqueueRate.update(now);
+        dequeueRate.update(now);
+
+        const Int oldestPacketAge = enqueueTimes.empty() ? 0 : toMicroseconds(now - enqueueTimes.front());
+
+        auto histogram = List<IInteger>();
+        for (const auto count : latencyHistogram)
+            histogram.pushBack(static_cast<Int>(count));
+
+        auto statistics = Dict<IString, IBaseObject>();
+        statistics.set("QueuedPackets", static_cast<Int>(enqueueTimes.size()));
+        statistics.set("QueuedSamples", static_cast<Int>(queuedSamples));
+        statistics.set("QueuedBytes", static_cast<Int>(queuedBytes));
+        statistics.set("HighWatermarkPackets", static_cast<Int>(highWatermarkPackets));
+        statistics.set("HighWatermarkSamples", static_cast<Int>(highWatermarkSamples));
+        statistics.set("HighWatermarkBytes", static_cast<Int>(highWatermarkBytes));
+        statistics.set("EnqueuedPackets", static_cast<Int>(enqueuedPackets));
+        statistics.set("DequeuedPackets", static_cast<Int>(dequeuedPackets));
+        statistics.set("EnqueueRate", enqueueRate.rate);
+        statistics.set("DequeueRate", dequeueRate.rate);
+        statistics.set("OldestPacketAge", oldestPacketAge);
+        statistics.set("MaxLatency", maxLatency);
+        statistics.set("LatencyHistogram", histogram);
+        return statistics;
+    }
+
+private:
+    // Samples per second over the last completed interval of at least one second.
+    struct RateMeter
+    {
+        Clock::time_point intervalStart;
+        SizeT intervalSamples = 0;
+        Float rate = 0.0;
+
+        void reset(Clock::time_point now)
+        {
+            intervalStart = now;
+            intervalSamples = 0;
+            rate = 0.0;
+        }
+
+        void add(SizeT samples, Clock::time_point now)
+        {
+            intervalSamples += samples;
+            update(now);
+        }
+
+        void update(Clock::time_point now)
+        {
+            const std::chrono::duration<Float> elapsed = now - intervalStart;
+            if (elapsed.count() < 1.0)
+                return;
+
+            rate = static_cast<Float>(intervalSamples) / elapsed.count();
+            intervalSamples = 0;
+            intervalStart = now;
+        }
+    };
+
+    static SizeT samplesOf(const PacketPtr& packet)
+    {
+        if (packet.getType() != PacketType::Data)
+            return 0;
+        return packet.asPtr<IDataPacket>(true).getSampleCount();
+    }
+
+    static SizeT bytesOf(const PacketPtr& packet)
+    {
+        if (packet.getType() != PacketType::Data)
+            return 0;
+        return packet.asPtr<IDataPacket>(true).getRawDataSize();
+    }
+
+    static Int toMicroseconds(Clock::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    }
+
+    void packetEnqueued(const PacketPtr& packet, Clock::time_point now, bool atFront)
+    {
+        if (atFront)
+            enqueueTimes.push_front(now);
+        else
+            enqueueTimes.push_back(now);
+
+        queuedSamples += samplesOf(packet);
+        queuedBytes += bytesOf(packet);
+
+        highWatermarkPackets = std::max(highWatermarkPackets, enqueueTimes.size());
+        highWatermarkSamples = std::max(highWatermarkSamples, queuedSamples);
+        highWatermarkBytes = std::max(highWatermarkBytes, queuedBytes);
+    }
+
+    void resetTotals(Clock::time_point now)
+    {
+        highWatermarkPackets = enqueueTimes.size();
+        highWatermarkSamples = queuedSamples;
+        highWatermarkBytes = queuedBytes;
+        enqueuedPackets = 0;
+        dequeuedPackets = 0;
+        maxLatency = 0;
+        latencyHistogram.fill(0);
+        enqueueRate.reset(now);
+        dequeueRate.reset(now);
+    }
+
+    void recordLatency(Clock::duration latency)
+    {
+        const Int microseconds = toMicroseconds(latency);
+        maxLatency = std::max(maxLatency, microseconds);
+
+        SizeT bucket = 0;
+        for (auto remaining = static_cast<uint64_t>(std::max<Int>(microseconds, 0)) >> 1; remaining != 0; remaining >>= 1)
+            bucket++;
+
+        latencyHistogram[std::min(bucket, LatencyBucketCount - 1)]++;
+    }
+
+    std::deque<Clock::time_point> enqueueTimes;
+    SizeT queuedSamples = 0;
+    SizeT queuedBytes = 0;
+
+    SizeT highWatermarkPackets = 0;
+    SizeT highWatermarkSamples = 0;
+    SizeT highWatermarkBytes = 0;
+
+    SizeT enqueuedPackets = 0;
+    SizeT dequeuedPackets = 0;
+    RateMeter enqueueRate;
+    RateMeter dequeueRate;
+
+    Int maxLatency = 0;
+    std::array<SizeT, LatencyBucketCount> latencyHistogram{};
+};
+
+END_NAMESPACE_OPENDAQ
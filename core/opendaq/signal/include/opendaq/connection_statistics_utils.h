@@ -0,0 +1,152 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/connection_statistics.h>
+#include <opendaq/connection_ptr.h>
+#include <opendaq/input_port_ptr.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_value_event_args_ptr.h>
+#include <coretypes/listobject_factory.h>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace connection_statistics
+{
+
+using StatisticsGetter = std::function<DictPtr<IString, IBaseObject>()>;
+
+static constexpr const char* SumEntries[] = {"QueuedPackets", "QueuedSamples", "QueuedBytes", "EnqueuedPackets", "DequeuedPackets"};
+static constexpr const char* MaxEntries[] = {"HighWatermarkPackets", "HighWatermarkSamples", "HighWatermarkBytes", "OldestPacketAge", "MaxLatency"};
+static constexpr const char* RateEntries[] = {"EnqueueRate", "DequeueRate"};
+static constexpr const char* HistogramEntry = "LatencyHistogram";
+static constexpr const char* BottleneckEntry = "BottleneckInputPort";
+
+inline DictPtr<IString, IBaseObject> getStatistics(const ConnectionPtr& connection)
+{
+    if (!connection.assigned())
+        return nullptr;
+
+    const auto statistics = connection.asPtrOrNull<IConnectionStatistics>(true);
+    if (!statistics.assigned())
+        return nullptr;
+
+    DictPtr<IString, IBaseObject> values;
+    checkErrorInfo(statistics->getStatistics(&values));
+    return values;
+}
+
+/*
+ * Sums up the queue depths, totals, rates and latency histograms of the connections of the input ports, and
+ * takes the maximum of the high watermarks and latencies. The input port whose oldest packet waited the longest
+ * is reported as the bottleneck.
+ */
+inline DictPtr<IString, IBaseObject> aggregate(const ListPtr<IInputPort>& inputPorts)
+{
+    std::unordered_map<std::string, Int> integers;
+    std::unordered_map<std::string, Float> rates;
+    std::vector<Int> histogram;
+
+    StringPtr bottleneck = "";
+    Int longestWait = -1;
+
+    for (const auto& inputPort : inputPorts)
+    {
+        const auto statistics = getStatistics(inputPort.getConnection());
+        if (!statistics.assigned() || statistics.getCount() == 0)
+            continue;
+
+        for (const auto name : SumEntries)
+            integers[name] += static_cast<Int>(statistics.get(name));
+        for (const auto name : MaxEntries)
+            integers[name] = std::max(integers[name], static_cast<Int>(statistics.get(name)));
+        for (const auto name : RateEntries)
+            rates[name] += static_cast<Float>(statistics.get(name));
+
+        const ListPtr<IInteger> portHistogram = statistics.get(HistogramEntry);
+        histogram.resize(std::max<SizeT>(histogram.size(), portHistogram.getCount()));
+        for (SizeT i = 0; i < portHistogram.getCount(); ++i)
+            histogram[i] += static_cast<Int>(portHistogram.getItemAt(i));
+
+        const Int wait = statistics.get("OldestPacketAge");
+        if (wait > longestWait)
+        {
+            longestWait = wait;
+            bottleneck = inputPort.getGlobalId();
+        }
+    }
+
+    auto histogramList = List<IInteger>();
+    for (const auto count : histogram)
+        histogramList.pushBack(count);
+
+    auto result = Dict<IString, IBaseObject>();
+    for (const auto name : SumEntries)
+        result.set(name, integers[name]);
+    for (const auto name : MaxEntries)
+        result.set(name, integers[name]);
+    for (const auto name : RateEntries)
+        result.set(name, rates[name]);
+    result.set(HistogramEntry, histogramList);
+    result.set(BottleneckEntry, bottleneck);
+    return result;
+}
+
+/*
+ * Creates a property object with a read-only property per statistics entry. Every read of a property
+ * takes a fresh snapshot through the getter, so the values are also current when polled by a remote client.
+ */
+inline PropertyObjectPtr createStatisticsObject(bool aggregated)
+{
+    auto obj = PropertyObject();
+
+    for (const auto name : SumEntries)
+        obj.addProperty(IntPropertyBuilder(name, 0).setReadOnly(true).build());
+    for (const auto name : MaxEntries)
+        obj.addProperty(IntPropertyBuilder(name, 0).setReadOnly(true).build());
+    for (const auto name : RateEntries)
+        obj.addProperty(FloatPropertyBuilder(name, 0.0).setReadOnly(true).build());
+    obj.addProperty(ListPropertyBuilder(HistogramEntry, List<IInteger>()).setReadOnly(true).build());
+
+    if (aggregated)
+        obj.addProperty(StringPropertyBuilder(BottleneckEntry, "").setReadOnly(true).build());
+
+    return obj;
+}
+
+inline void bindStatisticsObject(const PropertyObjectPtr& obj, const StatisticsGetter& getter)
+{
+    for (const auto& prop : obj.getAllProperties())
+    {
+        obj.getOnPropertyValueRead(prop.getName()) +=
+            [getter, name = prop.getName()](const PropertyObjectPtr&, const PropertyValueEventArgsPtr& args)
+            {
+                const auto statistics = getter();
+                if (statistics.assigned() && statistics.hasKey(name))
+                    args.setValue(statistics.get(name));
+            };
+    }
+}
+
+}
+
+END_NAMESPACE_OPENDAQ
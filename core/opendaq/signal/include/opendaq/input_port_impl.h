@@ -31,6 +31,8 @@
 #include <opendaq/work_factory.h>
 #include <opendaq/scheduler_errors.h>
 #include <opendaq/component_update_context_ptr.h>
+#include <opendaq/connection_statistics_utils.h>
+#include <opendaq/option_helpers.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 template <typename TInterface, typename...  Interfaces>
@@ -124,6 +126,7 @@ private:
     void notifyPacketEnqueuedSameThread();
     void notifyPacketEnqueuedScheduler();
     void finishUpdate();
+    void addStatisticsProperty();
 
     SignalPtr getSignalNoLock();
 };
@@ -143,6 +146,31 @@ GenericInputPortImpl<TInterface, Interfaces...>::GenericInputPortImpl(const Cont
     loggerComponent = context.getLogger().getOrAddComponent("InputPort");
     if (context.assigned())
         scheduler = context.getScheduler();
+
+    // mirrored input ports receive the statistics of the remote port when they are deserialized
+    if constexpr (std::is_same_v<TInterface, IInputPortConfig>)
+    {
+        if (context.assigned() && getConnectionStatisticsEnabled(context.getOptions()))
+            addStatisticsProperty();
+    }
+}
+
+template <typename TInterface, typename...  Interfaces>
+void GenericInputPortImpl<TInterface, Interfaces...>::addStatisticsProperty()
+{
+    Super::addProperty(ObjectPropertyBuilder("Statistics", connection_statistics::createStatisticsObject(false)).setReadOnly(true).build());
+
+    const PropertyObjectPtr statistics = this->objPtr.getPropertyValue("Statistics");
+    connection_statistics::bindStatisticsObject(
+        statistics,
+        [portRef = this->template getWeakRefInternal<IInputPort>()]() -> DictPtr<IString, IBaseObject>
+        {
+            const auto port = portRef.getRef();
+            if (!port.assigned())
+                return nullptr;
+
+            return connection_statistics::getStatistics(port.getConnection());
+        });
 }
 
 template <typename TInterface, typename...  Interfaces>
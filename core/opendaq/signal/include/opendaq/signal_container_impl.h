@@ -25,6 +25,7 @@
 #include <opendaq/custom_log.h>
 #include <opendaq/module_manager.h>
 #include <opendaq/module_manager_utils.h>
+#include <opendaq/parallel_update_utils.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 template <class Intf = IComponent, class ... Intfs>
@@ -101,6 +102,15 @@ protected:
     template <class F>
     void updateFolder(const SerializedObjectPtr& obj, const std::string& folderType, const std::string& itemType, F&& f);
 
+    // Same as updateFolder, but updates the items already present in the folder concurrently if a parallel update was requested.
+    template <class F>
+    void updateFolderItems(const SerializedObjectPtr& obj,
+                           const std::string& folderType,
+                           const std::string& itemType,
+                           const FolderPtr& folder,
+                           const BaseObjectPtr& context,
+                           F&& f);
+
     void updateObject(const SerializedObjectPtr& obj, const BaseObjectPtr& context) override;
     void onUpdatableUpdateEnd(const BaseObjectPtr& context) override;
 
@@ -440,6 +450,7 @@ FolderConfigPtr GenericSignalContainerImpl<Intf, Intfs...>::addFolder(const std:
             folder.template asPtr<IPropertyObjectInternal>().setLockingStrategy(lockingStrategy);
 
         this->components.push_back(folder);
+        this->notifyTreeChanged();
 
         if (!this->coreEventMuted && this->coreEvent.assigned())
         {
@@ -478,6 +489,7 @@ ComponentPtr GenericSignalContainerImpl<Intf, Intfs...>::addComponent(const std:
             component.template asPtr<IPropertyObjectInternal>().setLockingStrategy(lockingStrategy);
 
         this->components.push_back(component);
+        this->notifyTreeChanged();
 
         if (!this->coreEventMuted && this->coreEvent.assigned())
         {
@@ -510,6 +522,7 @@ ComponentPtr GenericSignalContainerImpl<Intf, Intfs...>::addExistingComponent(co
             validateComponentIsDefault(component.getLocalId());
 
         this->components.push_back(component);
+        this->notifyTreeChanged();
 
         if (!this->coreEventMuted && this->coreEvent.assigned())
         {
@@ -537,6 +550,7 @@ void GenericSignalContainerImpl<Intf, Intfs...>::removeComponentById(const std::
         (*it).template asPtr<IPropertyObjectInternal>().disableCoreEventTrigger();
         (*it).remove();
         this->components.erase(it);
+        this->notifyTreeChanged();
 
         if (!this->coreEventMuted && this->coreEvent.assigned())
         {
@@ -687,13 +701,15 @@ void GenericSignalContainerImpl<Intf, Intfs...>::updateObject(const SerializedOb
         const auto fbFolder = obj.readSerializedObject("FB");
         fbFolder.checkObjectType("Folder");
 
-        updateFolder(fbFolder,
-                     "Folder",
-                     "FunctionBlock",
-                     [this, &context](const std::string& localId, const SerializedObjectPtr& obj)
-                     {
-                         updateFunctionBlock(localId, obj, context);
-                     });
+        updateFolderItems(fbFolder,
+                          "Folder",
+                          "FunctionBlock",
+                          functionBlocks,
+                          context,
+                          [this, &context](const std::string& localId, const SerializedObjectPtr& obj)
+                          {
+                              updateFunctionBlock(localId, obj, context);
+                          });
     }
 
     if (obj.hasKey("Sig"))
@@ -829,6 +845,44 @@ void GenericSignalContainerImpl<Intf, Intfs...>::updateFolder(const SerializedOb
     }
 }
 
+template <class Intf, class... Intfs>
+template <class F>
+void GenericSignalContainerImpl<Intf, Intfs...>::updateFolderItems(const SerializedObjectPtr& obj,
+                                                                   const std::string& folderType,
+                                                                   const std::string& itemType,
+                                                                   const FolderPtr& folder,
+                                                                   const BaseObjectPtr& context,
+                                                                   F&& f)
+{
+    if (!parallel_update::isEnabled(this->context, context))
+    {
+        updateFolder(obj, folderType, itemType, std::forward<F>(f));
+        return;
+    }
+
+    obj.checkObjectType(folderType);
+
+    // Items missing from the folder are added on the calling thread, as adding them modifies the folder.
+    std::vector<parallel_update::SubtreeUpdate> updates;
+    for (const auto& serializedItem : this->getSerializedItems(obj))
+    {
+        serializedItem.second.checkObjectType(itemType);
+        if (folder.hasItem(serializedItem.first))
+            updates.emplace_back(serializedItem.first, [&f, serializedItem] { f(serializedItem.first, serializedItem.second); });
+        else
+            f(serializedItem.first, serializedItem.second);
+    }
+
+    if (updates.size() < 2)
+    {
+        for (const auto& update : updates)
+            update.second();
+        return;
+    }
+
+    parallel_update::run(this->context, signalContainerLoggerComponent, this->globalId, updates);
+}
+
 template <class Intf, class... Intfs>
 void GenericSignalContainerImpl<Intf, Intfs...>::updateFunctionBlock(const std::string& fbId,
                                                                      const SerializedObjectPtr& serializedFunctionBlock,
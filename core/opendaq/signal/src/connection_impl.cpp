@@ -6,6 +6,7 @@
 #include <opendaq/event_packet_params.h>
 #include <opendaq/event_packet_utils.h>
 #include <opendaq/custom_log.h>
+#include <opendaq/option_helpers.h>
 
 #include "opendaq/data_descriptor_factory.h"
 #include "opendaq/packet_factory.h"
@@ -18,7 +19,11 @@ ConnectionImpl::ConnectionImpl(const InputPortPtr& port, const SignalPtr& signal
     , context(std::move(context))
     , queueEmpty(true)
     , loggerComponent(this->context.getLogger().getOrAddComponent("daq_connection"))
+    , statisticsEnabled(getConnectionStatisticsEnabled(this->context.getOptions()))
 {
+    if (statisticsEnabled)
+        statistics.reset(packets);
+
     const auto portConfig = port.asPtrOrNull<IInputPortConfig>(true);
     if (portConfig.assigned() && portConfig.getGapCheckingEnabled())
     {
@@ -257,6 +262,8 @@ ErrCode INTERFACE_FUNC ConnectionImpl::dequeueAll(IList** packets)
         {
             for (const auto& packet : this->packets)
             {
+                if (statisticsEnabled)
+                    statistics.packetDequeued(packet);
                 packetsPtr.pushBack(packet);
             }
             samplesCnt = 0;
@@ -511,6 +518,8 @@ ErrCode ConnectionImpl::dequeueUpTo(IPacket** packetPtr, SizeT* count)
             *count = std::min(*count, packets.size());
             for (size_t i = 0; i < *count; ++i)
             {
+                if (statisticsEnabled)
+                    statistics.packetDequeued(packets.front());
                 *ptr = packets.front().detach();
                 ptr++;
                 packets.pop_front();
@@ -573,6 +582,8 @@ void ConnectionImpl::enqueueGapPacket(const DomainValue& diff)
 
     const auto gapPacket = ImplicitDomainGapDetectedEventPacket(diffNumber);
     gapPacketsCnt += 1;
+    if (statisticsEnabled)
+        statistics.packetEnqueued(gapPacket);
     packets.emplace_back(gapPacket);
     LOGP_T("Gap packet enqueued.")
 }
@@ -709,6 +720,9 @@ void ConnectionImpl::countPackets()
 
 void ConnectionImpl::onPacketEnqueued(const PacketPtr& packet)
 {
+    if (statisticsEnabled)
+        statistics.packetEnqueued(packet);
+
     if (packet.getType() == PacketType::Data)
     {
         auto dataPacket = packet.asPtr<IDataPacket>(true);
@@ -739,6 +753,9 @@ void ConnectionImpl::onPacketEnqueued(const PacketPtr& packet)
 
 void ConnectionImpl::onPacketDequeued(const PacketPtr& packet)
 {
+    if (statisticsEnabled)
+        statistics.packetDequeued(packet);
+
     if (packet.getType() == PacketType::Data)
     {
         auto dataPacket = packet.asPtrOrNull<IDataPacket>(true);
@@ -769,12 +786,75 @@ ErrCode ConnectionImpl::enqueueLastDescriptor()
         {
             eventPacketsCnt++;
             const auto dataDescriptorEventPacket = DataDescriptorChangedEventPacket(valueDataDescriptor, domainDataDescriptor);
+            if (statisticsEnabled)
+                statistics.packetEnqueued(dataDescriptorEventPacket, true);
             packets.emplace_front(dataDescriptorEventPacket);
         }
         return OPENDAQ_SUCCESS;
     });
 }
 
+ErrCode ConnectionImpl::setStatisticsEnabled(Bool enabled)
+{
+    return withLock([enabled, this]
+    {
+        if (static_cast<bool>(enabled) == statisticsEnabled)
+            return OPENDAQ_IGNORED;
+
+        statisticsEnabled = enabled;
+        if (statisticsEnabled)
+        {
+            statistics.reset(packets);
+            LOGP_D("Statistics enabled.")
+        }
+        else
+        {
+            LOGP_D("Statistics disabled.")
+        }
+
+        return OPENDAQ_SUCCESS;
+    });
+}
+
+ErrCode ConnectionImpl::getStatisticsEnabled(Bool* enabled)
+{
+    OPENDAQ_PARAM_NOT_NULL(enabled);
+
+    return withLock([enabled, this]
+    {
+        *enabled = statisticsEnabled;
+        return OPENDAQ_SUCCESS;
+    });
+}
+
+ErrCode ConnectionImpl::getStatistics(IDict** statistics)
+{
+    OPENDAQ_PARAM_NOT_NULL(statistics);
+
+    const ErrCode errCode = daqTry([statistics, this]
+    {
+        DictPtr<IString, IBaseObject> statisticsPtr = withLock([this]
+        {
+            return statisticsEnabled ? this->statistics.getStatistics() : Dict<IString, IBaseObject>();
+        });
+
+        *statistics = statisticsPtr.detach();
+        return OPENDAQ_SUCCESS;
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+ErrCode ConnectionImpl::resetStatistics()
+{
+    return withLock([this]
+    {
+        if (statisticsEnabled)
+            statistics.resetTotals();
+        return OPENDAQ_SUCCESS;
+    });
+}
+
 ConnectionImpl::DomainValue ConnectionImpl::numberToDomainValue(const NumberPtr& number)
 {
     DomainValue dv;
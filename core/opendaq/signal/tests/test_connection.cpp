@@ -3,6 +3,8 @@
 #include <coretypes/objectptr.h>
 #include <gtest/gtest.h>
 #include <opendaq/connection_internal.h>
+#include <opendaq/connection_statistics_ptr.h>
+#include <opendaq/connection_statistics_utils.h>
 
 #include "opendaq/context_factory.h"
 #include "opendaq/signal_factory.h"
@@ -332,3 +334,118 @@ TEST_F(ConnectionTest, DequeueUpTo2)
     for (SizeT i = 0; i < count; ++i)
         PacketPtr pkt = std::move(buf[i]);
 }
+
+TEST_F(ConnectionTest, StatisticsDisabledByDefault)
+{
+    EXPECT_CALL(inputPort.mock(), getGapCheckingEnabled(testing::_)).WillOnce(GetBool(False));
+    const ConnectionStatisticsPtr connection = Connection(inputPort->asPtr<IInputPort>(), signal, context);
+
+    ASSERT_FALSE(connection.getStatisticsEnabled());
+    ASSERT_EQ(connection.getStatistics().getCount(), 0u);
+}
+
+static ContextPtr createStatisticsContext()
+{
+    auto options = Dict<IString, IBaseObject>({{"Diagnostics", Dict<IString, IBaseObject>({{"ConnectionStatistics", true}})}});
+
+    auto logger = Logger();
+    return Context(Scheduler(logger, 1), logger, nullptr, nullptr, nullptr, options);
+}
+
+TEST_F(ConnectionTest, StatisticsQueueDepth)
+{
+    auto context = createStatisticsContext();
+    auto signal = Signal(context, nullptr, "sig");
+    signal.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).build());
+
+    auto ip = InputPort(context, nullptr, "ip");
+    ip.connect(signal);
+
+    for (int i = 0; i < 3; ++i)
+        signal.sendPacket(DataPacket(signal.getDescriptor(), 10));
+    context.getScheduler().waitAll();
+
+    const ConnectionStatisticsPtr statistics = ip.getConnection();
+    ASSERT_TRUE(statistics.getStatisticsEnabled());
+
+    // the descriptor changed event packet is queued as well
+    auto values = statistics.getStatistics();
+    ASSERT_EQ(values.get("QueuedPackets"), 4);
+    ASSERT_EQ(values.get("QueuedSamples"), 30);
+    ASSERT_EQ(values.get("QueuedBytes"), 30 * static_cast<Int>(sizeof(double)));
+    ASSERT_EQ(values.get("EnqueuedPackets"), 4);
+    ASSERT_EQ(values.get("DequeuedPackets"), 0);
+
+    const auto connection = ip.getConnection();
+    while (connection.dequeue().assigned())
+        ;
+
+    values = statistics.getStatistics();
+    ASSERT_EQ(values.get("QueuedPackets"), 0);
+    ASSERT_EQ(values.get("QueuedSamples"), 0);
+    ASSERT_EQ(values.get("QueuedBytes"), 0);
+    ASSERT_EQ(values.get("HighWatermarkPackets"), 4);
+    ASSERT_EQ(values.get("HighWatermarkSamples"), 30);
+    ASSERT_EQ(values.get("DequeuedPackets"), 4);
+    ASSERT_EQ(values.get("OldestPacketAge"), 0);
+
+    Int latencies = 0;
+    for (const auto& count : ListPtr<IInteger>(values.get("LatencyHistogram")))
+        latencies += static_cast<Int>(count);
+    ASSERT_EQ(latencies, 4);
+
+    statistics.resetStatistics();
+    values = statistics.getStatistics();
+    ASSERT_EQ(values.get("HighWatermarkPackets"), 0);
+    ASSERT_EQ(values.get("EnqueuedPackets"), 0);
+}
+
+TEST_F(ConnectionTest, StatisticsEnabledWithQueuedPackets)
+{
+    auto logger = Logger();
+    auto context = Context(Scheduler(logger, 1), logger, nullptr, nullptr, nullptr);
+    auto signal = Signal(context, nullptr, "sig");
+    signal.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).build());
+
+    auto ip = InputPort(context, nullptr, "ip");
+    ip.connect(signal);
+    signal.sendPacket(DataPacket(signal.getDescriptor(), 5));
+    context.getScheduler().waitAll();
+
+    const ConnectionStatisticsPtr statistics = ip.getConnection();
+    ASSERT_FALSE(statistics.getStatisticsEnabled());
+
+    statistics.setStatisticsEnabled(true);
+    const auto values = statistics.getStatistics();
+    ASSERT_EQ(values.get("QueuedPackets"), 2);
+    ASSERT_EQ(values.get("QueuedSamples"), 5);
+    ASSERT_EQ(values.get("EnqueuedPackets"), 0);
+}
+
+TEST_F(ConnectionTest, InputPortStatisticsProperties)
+{
+    auto context = createStatisticsContext();
+    auto signal = Signal(context, nullptr, "sig");
+    signal.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).build());
+
+    auto ip1 = InputPort(context, nullptr, "ip1");
+    auto ip2 = InputPort(context, nullptr, "ip2");
+    ASSERT_EQ(ip1.getPropertyValue("Statistics.QueuedPackets"), 0);
+
+    ip1.connect(signal);
+    ip2.connect(signal);
+    signal.sendPacket(DataPacket(signal.getDescriptor(), 10));
+    context.getScheduler().waitAll();
+
+    ASSERT_EQ(ip1.getPropertyValue("Statistics.QueuedPackets"), 2);
+    ASSERT_EQ(ip1.getPropertyValue("Statistics.QueuedSamples"), 10);
+
+    while (ip2.getConnection().dequeue().assigned())
+        ;
+
+    const auto aggregated = connection_statistics::aggregate(List<IInputPort>(ip1, ip2));
+    ASSERT_EQ(aggregated.get("QueuedPackets"), 2);
+    ASSERT_EQ(aggregated.get("EnqueuedPackets"), 4);
+    ASSERT_EQ(aggregated.get("DequeuedPackets"), 2);
+    ASSERT_EQ(aggregated.get("BottleneckInputPort"), ip1.getGlobalId());
+}
@@ -44,7 +44,7 @@ public:
 private:
     void coreEventCallback(ComponentPtr& sender, CoreEventArgsPtr& eventArgs);
 
-    void componentAdded(const ComponentPtr& sender, const CoreEventArgsPtr& eventArgs);
+    void componentAdded(const ComponentPtr& addedComponent);
     void componentUpdated(const ComponentPtr& sender, const CoreEventArgsPtr& eventArgs);
 
     void enableStreamingForAddedComponent(const ComponentPtr& addedComponent);
@@ -100,7 +100,11 @@ inline void StreamingSourceManager::coreEventCallback(ComponentPtr& sender, Core
     switch (static_cast<CoreEventId>(eventArgs.getEventId()))
     {
         case CoreEventId::ComponentAdded:
-            componentAdded(sender, eventArgs);
+            componentAdded(eventArgs.getParameters().get("Component"));
+            break;
+        case CoreEventId::ComponentsAdded:
+            for (const auto& addedComponent : ListPtr<IComponent>(eventArgs.getParameters().get("Components")))
+                componentAdded(addedComponent);
             break;
         case CoreEventId::ComponentUpdateEnd:
             componentUpdated(sender, eventArgs);
@@ -110,12 +114,11 @@ inline void StreamingSourceManager::coreEventCallback(ComponentPtr& sender, Core
     }
 }
 
-inline void StreamingSourceManager::componentAdded(const ComponentPtr& sender, const CoreEventArgsPtr& eventArgs)
+inline void StreamingSourceManager::componentAdded(const ComponentPtr& addedComponent)
 {
     auto ownerDevice = ownerDeviceRef.assigned() ? ownerDeviceRef.getRef() : nullptr;
     if (!ownerDevice.assigned())
         return;
-    ComponentPtr addedComponent = eventArgs.getParameters().get("Component");
 
     auto ownerDeviceGlobalId = ownerDevice.getGlobalId().toStdString();
     auto addedComponentGlobalId = addedComponent.getGlobalId().toStdString();
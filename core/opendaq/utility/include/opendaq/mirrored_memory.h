@@ -0,0 +1,76 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <cstddef>
+#include <cstdint>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief A block of memory that is mapped twice at consecutive virtual addresses.
+ *
+ * Byte `i` and byte `i + getSize()` alias the same physical memory, so any range of at most
+ * `getSize()` bytes starting inside the first mapping is contiguous, even if it wraps around the
+ * end of the block. Used as the backing store of ring buffers that must never split an allocation.
+ *
+ * Only supported on Linux, where the block is a memfd mapped twice into a reserved address range.
+ * The size is rounded up to the page size (or the huge page size if huge pages are used).
+ */
+class MirroredMemory
+{
+public:
+    MirroredMemory() = default;
+    ~MirroredMemory();
+
+    MirroredMemory(const MirroredMemory&) = delete;
+    MirroredMemory& operator=(const MirroredMemory&) = delete;
+
+    /*!
+     * @brief Maps at least @p size bytes. Any previous mapping is released first.
+     * @param size The minimum size of the block in bytes.
+     * @param hugePages If true, tries to back the block with huge pages and falls back to regular pages
+     * if none are available.
+     * @returns False if mirrored mappings are not supported or the mapping failed.
+     */
+    bool map(size_t size, bool hugePages);
+    void unmap();
+
+    static bool IsSupported();
+
+    uint8_t* getData() const
+    {
+        return data;
+    }
+
+    size_t getSize() const
+    {
+        return size;
+    }
+
+    bool getUsesHugePages() const
+    {
+        return hugePages;
+    }
+
+private:
+    uint8_t* data{};
+    size_t size{};
+    bool hugePages{};
+};
+
+END_NAMESPACE_OPENDAQ
@@ -35,6 +35,21 @@ inline bool getPrettyPrintOnSaveConfig(const DictObjectPtr<IDict, IString, IBase
     return false;
 }
 
+inline bool getConnectionStatisticsEnabled(const DictObjectPtr<IDict, IString, IBaseObject>& options)
+{
+    if (!options.assigned() || !options.hasKey("Diagnostics"))
+        return false;
+
+    const auto diagnosticsOptions = options.get("Diagnostics").template asPtrOrNull<IDict, DictObjectPtr<IDict, IString, IBaseObject>>(true);
+    if (!diagnosticsOptions.assigned())
+        return false;
+
+    if (diagnosticsOptions.hasKey("ConnectionStatistics"))
+        return diagnosticsOptions.get("ConnectionStatistics");
+
+    return false;
+}
+
 
 END_NAMESPACE_OPENDAQ
 
@@ -62,6 +62,40 @@ DECLARE_OPENDAQ_INTERFACE(IPacketBufferBuilder, IBaseObject)
      * @param[out] buffer Returns the newly created buffer
      */
     virtual ErrCode INTERFACE_FUNC build(IPacketBuffer** buffer) = 0;
+
+    /*!
+     * @brief Gets whether the buffer memory is mapped twice back-to-back.
+     * @param[out] mirrored True if mirrored mapping is requested.
+     */
+    virtual ErrCode INTERFACE_FUNC getMirroredMapping(Bool* mirrored) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets whether the buffer memory is mapped twice back-to-back.
+     * @param mirrored True to request mirrored mapping.
+     *
+     * With a mirrored mapping, packets never have to be placed around the end of the buffer, so every free byte is
+     * usable, and packets are created and released without taking a lock in the common case. The buffer size is
+     * rounded up to the page size. Only supported on Linux; elsewhere, or if the mapping fails, the regular buffer
+     * is used. Disabled by default.
+     */
+    virtual ErrCode INTERFACE_FUNC setMirroredMapping(Bool mirrored) = 0;
+
+    /*!
+     * @brief Gets whether the buffer should be backed by huge pages.
+     * @param[out] hugePages True if huge pages are requested.
+     */
+    virtual ErrCode INTERFACE_FUNC getHugePages(Bool* hugePages) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets whether the buffer should be backed by huge pages.
+     * @param hugePages True to request huge pages.
+     *
+     * Only applies to mirrored buffers. If no huge pages are reserved on the system, regular pages are used. When
+     * huge pages are used, the buffer size is rounded up to a multiple of the huge page size. Disabled by default.
+     */
+    virtual ErrCode INTERFACE_FUNC setHugePages(Bool hugePages) = 0;
 };
 
 /*!@}*/
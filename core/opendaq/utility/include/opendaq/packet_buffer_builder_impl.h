@@ -35,10 +35,18 @@ public:
 
     ErrCode INTERFACE_FUNC build(IPacketBuffer** buffer) override;
 
+    ErrCode INTERFACE_FUNC getMirroredMapping(Bool* mirrored) override;
+    ErrCode INTERFACE_FUNC setMirroredMapping(Bool mirrored) override;
+
+    ErrCode INTERFACE_FUNC getHugePages(Bool* hugePages) override;
+    ErrCode INTERFACE_FUNC setHugePages(Bool hugePages) override;
+
 private:
 
     SizeT sizeInBytes;
     ContextPtr context;
+    Bool mirroredMapping;
+    Bool hugePages;
 };
 
 END_NAMESPACE_OPENDAQ
@@ -27,6 +27,8 @@
 #include <opendaq/packet_buffer_builder_ptr.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/deleter_factory.h>
+#include <opendaq/mirrored_memory.h>
+#include <atomic>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -50,11 +52,28 @@ protected:
 
     ErrCode CleanOosPackets();
 
+    // Mirrored buffer: positions are monotonic byte counters; a packet at position `p` starts at `p % capacity`
+    ErrCode WriteMirrored(size_t sizeOfPackets, uint64_t* position);
+    void ReadMirrored(uint64_t position, size_t sizeOfPackets);
+    void CleanMirroredOosPackets();
+    bool mapMirrored(size_t size);
+
     std::vector<uint8_t> data;
     void* readPos;
     void* writePos;
     bool isFull;
-    bool underReset;
+    std::atomic<bool> underReset;
+
+    bool mirroredRequested;
+    bool hugePagesRequested;
+    bool mirrored;
+    MirroredMemory mirroredMemory;
+    std::atomic<uint64_t> mirroredHead;
+    std::atomic<uint64_t> mirroredTail;
+    std::atomic<size_t> mirroredOosCount;
+    std::atomic<size_t> activeWriters;
+    std::priority_queue<std::pair<uint64_t, size_t>, std::vector<std::pair<uint64_t, size_t>>, std::greater<std::pair<uint64_t, size_t>>>
+        mirroredOosPackets;
 
     size_t sizeInBytes;
 
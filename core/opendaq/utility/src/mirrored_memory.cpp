@@ -0,0 +1,132 @@
+#include <opendaq/mirrored_memory.h>
+
+#ifdef __linux__
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <linux/memfd.h>
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+#ifdef __linux__
+
+namespace
+{
+    constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+    size_t roundUp(size_t value, size_t multiple)
+    {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    // memfd_create is only exposed by glibc 2.27 and newer
+    int createMemFd(unsigned int flags)
+    {
+        return static_cast<int>(syscall(SYS_memfd_create, "opendaq_packet_buffer", flags | MFD_CLOEXEC));
+    }
+
+    uint8_t* mapTwice(int fd, size_t size)
+    {
+        // Reserve the whole range first so nothing else can be mapped between the two views
+        void* reserved = mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (reserved == MAP_FAILED)
+            return nullptr;
+
+        auto base = static_cast<uint8_t*>(reserved);
+        if (mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+            mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+        {
+            munmap(reserved, 2 * size);
+            return nullptr;
+        }
+
+        return base;
+    }
+}
+
+MirroredMemory::~MirroredMemory()
+{
+    unmap();
+}
+
+bool MirroredMemory::map(size_t size, bool hugePages)
+{
+    unmap();
+
+    if (size == 0)
+        return false;
+
+    if (hugePages)
+    {
+        const int fd = createMemFd(MFD_HUGETLB);
+        if (fd >= 0)
+        {
+            const size_t hugeSize = roundUp(size, HugePageSize);
+            uint8_t* base = ftruncate(fd, static_cast<off_t>(hugeSize)) == 0 ? mapTwice(fd, hugeSize) : nullptr;
+            close(fd);
+
+            if (base != nullptr)
+            {
+                this->data = base;
+                this->size = hugeSize;
+                this->hugePages = true;
+                return true;
+            }
+        }
+    }
+
+    const int fd = createMemFd(0);
+    if (fd < 0)
+        return false;
+
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t pagedSize = roundUp(size, pageSize);
+    uint8_t* base = ftruncate(fd, static_cast<off_t>(pagedSize)) == 0 ? mapTwice(fd, pagedSize) : nullptr;
+    close(fd);
+
+    if (base == nullptr)
+        return false;
+
+    this->data = base;
+    this->size = pagedSize;
+    this->hugePages = false;
+    return true;
+}
+
+void MirroredMemory::unmap()
+{
+    if (data != nullptr)
+        munmap(data, 2 * size);
+
+    data = nullptr;
+    size = 0;
+    hugePages = false;
+}
+
+bool MirroredMemory::IsSupported()
+{
+    return true;
+}
+
+#else
+
+MirroredMemory::~MirroredMemory() = default;
+
+bool MirroredMemory::map(size_t, bool)
+{
+    return false;
+}
+
+void MirroredMemory::unmap()
+{
+}
+
+bool MirroredMemory::IsSupported()
+{
+    return false;
+}
+
+#endif
+
+END_NAMESPACE_OPENDAQ
@@ -5,6 +5,8 @@ BEGIN_NAMESPACE_OPENDAQ
 
 PacketBufferBuilderImpl::PacketBufferBuilderImpl()
     : sizeInBytes(0)
+    , mirroredMapping(false)
+    , hugePages(false)
 {
 }
 
@@ -52,6 +54,34 @@ ErrCode PacketBufferBuilderImpl::build(IPacketBuffer** buffer)
         });
 }
 
+ErrCode PacketBufferBuilderImpl::getMirroredMapping(Bool* mirrored)
+{
+    OPENDAQ_PARAM_NOT_NULL(mirrored);
+
+    *mirrored = this->mirroredMapping;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PacketBufferBuilderImpl::setMirroredMapping(Bool mirrored)
+{
+    this->mirroredMapping = mirrored;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PacketBufferBuilderImpl::getHugePages(Bool* hugePages)
+{
+    OPENDAQ_PARAM_NOT_NULL(hugePages);
+
+    *hugePages = this->hugePages;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PacketBufferBuilderImpl::setHugePages(Bool hugePages)
+{
+    this->hugePages = hugePages;
+    return OPENDAQ_SUCCESS;
+}
+
 OPENDAQ_DEFINE_CLASS_FACTORY(LIBRARY_FACTORY, PacketBufferBuilder)
 
 END_NAMESPACE_OPENDAQ
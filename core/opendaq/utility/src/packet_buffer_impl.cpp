@@ -5,20 +5,101 @@
 BEGIN_NAMESPACE_OPENDAQ
 
 PacketBufferImpl::PacketBufferImpl(const PacketBufferBuilderPtr& builder)
+    : underReset(false)
+    , mirrored(false)
+    , mirroredHead(0)
+    , mirroredTail(0)
+    , mirroredOosCount(0)
+    , activeWriters(0)
 {
     // Here comes the init of the buffer (that means the fresh std::vector gets called here)
     // also looks into the builder for the class
     sizeInBytes = builder.getSizeInBytes();
     context = builder.getContext();
+    mirroredRequested = builder.getMirroredMapping();
+    hugePagesRequested = builder.getHugePages();
+
+    if (mirroredRequested && mapMirrored(sizeInBytes))
+        sizeInBytes = mirroredMemory.getSize();
+    else
+        data = std::vector<uint8_t>(sizeInBytes);
 
-    data = std::vector<uint8_t>(sizeInBytes);
     readPos = data.data();
     writePos = data.data();
     isFull = false;
-    underReset = false;
     endPos = static_cast<uint8_t*>(data.data()) + sizeInBytes;
 }
 
+bool PacketBufferImpl::mapMirrored(size_t size)
+{
+    mirrored = mirroredMemory.map(size, hugePagesRequested);
+    mirroredHead = 0;
+    mirroredTail = 0;
+    return mirrored;
+}
+
+ErrCode PacketBufferImpl::WriteMirrored(size_t sizeOfPackets, uint64_t* position)
+{
+    if (sizeOfPackets > sizeInBytes)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "The requested packet size is not available.");
+
+    // Any free range is contiguous in the mirrored mapping, so claiming space only moves the head
+    uint64_t head = mirroredHead.load(std::memory_order_relaxed);
+    do
+    {
+        const uint64_t used = head - mirroredTail.load(std::memory_order_acquire);
+        if (used == sizeInBytes && sizeOfPackets > 0)
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_BUFFERFULL, "The packet buffer is full");
+        if (used + sizeOfPackets > sizeInBytes)
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "The requested packet size is not available.");
+    }
+    while (!mirroredHead.compare_exchange_weak(head, head + sizeOfPackets, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    *position = head;
+    return OPENDAQ_SUCCESS;
+}
+
+void PacketBufferImpl::ReadMirrored(uint64_t position, size_t sizeOfPackets)
+{
+    if (sizeOfPackets == 0)
+        return;
+
+    // Packets released in allocation order only move the tail. Packets released early are parked
+    // in the out-of-sequence queue until the tail reaches them.
+    uint64_t expected = position;
+    if (mirroredTail.compare_exchange_strong(expected, position + sizeOfPackets))
+    {
+        if (mirroredOosCount == 0 && !underReset)
+            return;
+
+        std::lock_guard<std::mutex> lock(readWriteMutex);
+        CleanMirroredOosPackets();
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(readWriteMutex);
+        mirroredOosPackets.emplace(position, sizeOfPackets);
+        ++mirroredOosCount;
+        CleanMirroredOosPackets();
+    }
+
+    resizeSync.notify_all();
+}
+
+void PacketBufferImpl::CleanMirroredOosPackets()
+{
+    while (!mirroredOosPackets.empty())
+    {
+        const auto [position, size] = mirroredOosPackets.top();
+        uint64_t expected = position;
+        if (!mirroredTail.compare_exchange_strong(expected, position + size))
+            break;
+
+        mirroredOosPackets.pop();
+        --mirroredOosCount;
+    }
+}
+
 ErrCode PacketBufferImpl::CleanOosPackets()
 {
     while (!oosPackets.empty())
@@ -135,6 +216,37 @@ ErrCode PacketBufferImpl::createPacket(SizeT sampleCount, IDataDescriptor* desc,
     if (type != daq::DataRuleType::Explicit)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Packet Buffer supports only Explicit Rule Type packets.");
 
+    if (mirrored)
+    {
+        size_t rawSampleSize;
+        err = desc->getRawSampleSize(&rawSampleSize);
+        OPENDAQ_RETURN_IF_FAILED(err);
+
+        const SizeT packetSize = sampleCount * rawSampleSize;
+
+        // The writer count lets resize wait for allocations that passed the reset check
+        ++activeWriters;
+        if (underReset)
+        {
+            --activeWriters;
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Trying to create packets while the reset procedure is underway.");
+        }
+
+        uint64_t position = 0;
+        const ErrCode errCode = WriteMirrored(packetSize, &position);
+        void* startMemPos = mirroredMemory.getData() + position % sizeInBytes;
+        --activeWriters;
+        OPENDAQ_RETURN_IF_FAILED(errCode);
+
+        DeleterPtr deleter = daq::Deleter([this, packetSize, position] (void*)
+        {
+            ReadMirrored(position, packetSize);
+        });
+        *packet = daq::DataPacketWithExternalMemory(domainPacket, desc, sampleCount, startMemPos, deleter).detach();
+
+        return OPENDAQ_SUCCESS;
+    }
+
     std::lock_guard<std::mutex> lock(readWriteMutex);
     if (underReset)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Trying to create packets while the reset procedure is underway.");
@@ -163,6 +275,24 @@ ErrCode PacketBufferImpl::resize(SizeT sizeInBytes)
     std::unique_lock<std::mutex> lock(readWriteMutex);
     underReset = true;
 
+    if (mirrored)
+    {
+        while (activeWriters != 0 || mirroredHead != mirroredTail)
+            resizeSync.wait_for(lock, std::chrono::milliseconds(20));
+
+        if (mapMirrored(sizeInBytes))
+        {
+            this->sizeInBytes = mirroredMemory.getSize();
+            underReset = false;
+            return OPENDAQ_SUCCESS;
+        }
+
+        // Continue with the regular buffer if the new size cannot be mapped
+        readPos = data.data();
+        writePos = data.data();
+        isFull = false;
+    }
+
     this->resizeSync.wait(lock, [this]
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(20));
@@ -186,13 +316,19 @@ ErrCode PacketBufferImpl::getMaxAvailableContinousSampleCount(IDataDescriptor* d
     OPENDAQ_PARAM_NOT_NULL(desc);
     OPENDAQ_PARAM_NOT_NULL(count);
 
-    auto fromEndToPos = static_cast<uint8_t*>(endPos) - static_cast<uint8_t*>(writePos);
-    auto fromStartToPos = static_cast<uint8_t*>(readPos) - static_cast<uint8_t*>(data.data());
-
     SizeT rawSampleSize;
     ErrCode err = desc->getRawSampleSize(&rawSampleSize);
     OPENDAQ_RETURN_IF_FAILED(err);
 
+    if (mirrored)
+    {
+        *count = (sizeInBytes - static_cast<size_t>(mirroredHead - mirroredTail)) / rawSampleSize;
+        return OPENDAQ_SUCCESS;
+    }
+
+    auto fromEndToPos = static_cast<uint8_t*>(endPos) - static_cast<uint8_t*>(writePos);
+    auto fromStartToPos = static_cast<uint8_t*>(readPos) - static_cast<uint8_t*>(data.data());
+
     *count = (fromStartToPos <= fromEndToPos) ? (fromEndToPos/rawSampleSize) : (fromStartToPos/rawSampleSize);
 
     if (writePos == readPos && isFull)
@@ -213,6 +349,12 @@ ErrCode PacketBufferImpl::getAvailableSampleCount(IDataDescriptor* desc, SizeT*
     ErrCode err = desc->getRawSampleSize(&rawSampleSize);
     OPENDAQ_RETURN_IF_FAILED(err);
 
+    if (mirrored)
+    {
+        *count = (sizeInBytes - static_cast<size_t>(mirroredHead - mirroredTail)) / rawSampleSize;
+        return OPENDAQ_SUCCESS;
+    }
+
     auto fromEndToPos = static_cast<uint8_t*>(endPos) - static_cast<uint8_t*>(readPos);
 
     *count = fromEndToPos/rawSampleSize;
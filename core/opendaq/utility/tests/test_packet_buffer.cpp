@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <thread>
 #include <opendaq/packet_buffer_factory.h>
+#include <opendaq/mirrored_memory.h>
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/data_rule_factory.h>
 #include <opendaq/dimension_factory.h>
@@ -365,3 +366,133 @@ TEST_F(PacketBufferTest, FullDynamicFunctionallityWorkflow)
 
     ASSERT_EQ(buffer.getMaxAvailableContinousSampleCount(desc), 80u);
 }
+
+TEST_F(PacketBufferTest, MirroredMemoryAliases)
+{
+    if (!MirroredMemory::IsSupported())
+        GTEST_SKIP() << "Mirrored mappings are not supported on this platform";
+
+    MirroredMemory memory;
+    ASSERT_TRUE(memory.map(100, false));
+    ASSERT_GE(memory.getSize(), 100u);
+
+    memory.getData()[memory.getSize() - 1] = 42;
+    memory.getData()[memory.getSize()] = 7;
+    ASSERT_EQ(memory.getData()[0], 7);
+    ASSERT_EQ(memory.getData()[2 * memory.getSize() - 1], 42);
+}
+
+TEST_F(PacketBufferTest, MirroredPacketsWrapWithoutSplitting)
+{
+    if (!MirroredMemory::IsSupported())
+        GTEST_SKIP() << "Mirrored mappings are not supported on this platform";
+
+    auto buffer = PacketBufferBuilder().setSizeInBytes(800).setMirroredMapping(true).build();
+    auto [desc, domain] = generateBuildingBlocks();
+
+    // The size is rounded up to the page size
+    const SizeT capacity = buffer.getAvailableSampleCount(desc);
+    ASSERT_GE(capacity, 80u);
+    ASSERT_EQ(buffer.getMaxAvailableContinousSampleCount(desc), capacity);
+
+    // Move the write position close to the end of the buffer
+    buffer.createPacket(capacity - 5, desc, domain);
+    ASSERT_EQ(buffer.getAvailableSampleCount(desc), capacity);
+
+    // A packet that crosses the end of the buffer is still contiguous
+    auto packet = buffer.createPacket(10, desc, domain);
+    auto data = static_cast<uint8_t*>(packet.getRawData());
+    for (int i = 0; i < 100; ++i)
+        data[i] = static_cast<uint8_t>(i);
+    for (int i = 0; i < 100; ++i)
+        ASSERT_EQ(data[i], static_cast<uint8_t>(i));
+
+    ASSERT_EQ(buffer.getAvailableSampleCount(desc), capacity - 10);
+}
+
+TEST_F(PacketBufferTest, MirroredOutOfOrderRelease)
+{
+    if (!MirroredMemory::IsSupported())
+        GTEST_SKIP() << "Mirrored mappings are not supported on this platform";
+
+    auto buffer = PacketBufferBuilder().setSizeInBytes(800).setMirroredMapping(true).build();
+    auto [desc, domain] = generateBuildingBlocks();
+    const SizeT capacity = buffer.getAvailableSampleCount(desc);
+
+    auto first = buffer.createPacket(10, desc, domain);
+    auto second = buffer.createPacket(10, desc, domain);
+    auto third = buffer.createPacket(10, desc, domain);
+
+    second.release();
+    third.release();
+    ASSERT_EQ(buffer.getAvailableSampleCount(desc), capacity - 30);
+
+    first.release();
+    ASSERT_EQ(buffer.getAvailableSampleCount(desc), capacity);
+}
+
+TEST_F(PacketBufferTest, MirroredFull)
+{
+    if (!MirroredMemory::IsSupported())
+        GTEST_SKIP() << "Mirrored mappings are not supported on this platform";
+
+    auto buffer = PacketBufferBuilder().setSizeInBytes(4000).setMirroredMapping(true).build();
+    auto [desc, domain] = generateBuildingBlocks();
+    const SizeT capacity = buffer.getAvailableSampleCount(desc);
+
+    auto packet = buffer.createPacket(capacity, desc, domain);
+    ASSERT_THROW(buffer.createPacket(capacity, desc, domain), InvalidParameterException);
+}
+
+TEST_F(PacketBufferTest, MirroredMultithreaded)
+{
+    if (!MirroredMemory::IsSupported())
+        GTEST_SKIP() << "Mirrored mappings are not supported on this platform";
+
+    auto buffer = PacketBufferBuilder().setSizeInBytes(8000).setMirroredMapping(true).build();
+    auto [desc, domain] = generateBuildingBlocks();
+    const SizeT capacity = buffer.getAvailableSampleCount(desc);
+
+    auto produce = [buffer = buffer, desc = desc, domain = domain]
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            DataPacketPtr packet;
+            while (OPENDAQ_FAILED(buffer->createPacket(1 + i % 7, desc, domain, &packet)))
+            {
+                daqClearErrorInfo();
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    std::thread t1(produce);
+    std::thread t2(produce);
+    std::thread t3(produce);
+    t1.join();
+    t2.join();
+    t3.join();
+
+    ASSERT_EQ(buffer.getAvailableSampleCount(desc), capacity);
+}
+
+TEST_F(PacketBufferTest, MirroredResize)
+{
+    if (!MirroredMemory::IsSupported())
+        GTEST_SKIP() << "Mirrored mappings are not supported on this platform";
+
+    auto buffer = PacketBufferBuilder().setSizeInBytes(800).setMirroredMapping(true).build();
+    auto [desc, domain] = generateBuildingBlocks();
+
+    auto packet = buffer.createPacket(20, desc, domain);
+    auto thread_ = std::thread([&buffer] { buffer.resize(100000); });
+
+    using namespace std::chrono_literals;
+    std::this_thread::sleep_for(200ms);
+    ASSERT_THROW(buffer.createPacket(20, desc, domain), InvalidStateException);
+
+    packet.release();
+    thread_.join();
+
+    ASSERT_GE(buffer.getAvailableSampleCount(desc), 10000u);
+}
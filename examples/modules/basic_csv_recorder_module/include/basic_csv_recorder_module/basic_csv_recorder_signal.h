@@ -58,6 +58,17 @@ class BasicCsvRecorderSignal
          */
         void onPacketReceived(const PacketPtr& packet);
 
+        /*!
+         * @brief Writes any buffered data lines to the CSV file.
+         *
+         * Data lines are buffered in memory and written in large blocks. The caller should
+         * invoke this function when no further packets are immediately pending.
+         *
+         * @throws std::ios_base::failure The buffered lines could not be written to the CSV file
+         *     due to an I/O error.
+         */
+        void flush();
+
     private:
 
         /*!
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+#include <basic_csv_recorder_module/common.h>
+
+BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
+
+/*!
+ * @brief Selects how floating-point values are formatted in CSV output.
+ */
+enum class CsvFloatFormat
+{
+    Default = 0,    ///< Six significant digits; identical to the default std::ostream output.
+    RoundTrip,      ///< Shortest decimal representation that parses back to the exact same value.
+    HexFloat        ///< Hexadecimal floating-point (e.g. "0x1.8p+1"); exact and cheapest to parse.
+};
+
+/*!
+ * @brief A header-only formatting buffer for writing CSV text to an output stream.
+ *
+ * Values are formatted with fmt into a reusable in-memory buffer, bypassing the locale-aware
+ * std::ostream insertion operators. The buffer is handed to the underlying stream in large
+ * blocks: automatically when a completed line pushes its size past the flush threshold, and
+ * explicitly when the owner calls flush() (for example, when its input queue runs empty).
+ *
+ * Integral values are written in decimal. Character types are promoted to integers, matching
+ * the `+value` convention used by the stream-based writers.
+ */
+class CsvOutputBuffer
+{
+    public:
+
+        static constexpr std::size_t DefaultFlushThreshold = 1 << 20;
+
+        /*!
+         * @brief Creates a buffer writing to the specified stream.
+         *
+         * @param stream The stream to write to. It must outlive the buffer.
+         * @param floatFormat The formatting used for floating-point values.
+         * @param flushThreshold The buffered size (in bytes) after which a completed line
+         *     triggers a write to @p stream.
+         */
+        explicit CsvOutputBuffer(
+            std::ostream& stream,
+            CsvFloatFormat floatFormat = CsvFloatFormat::Default,
+            std::size_t flushThreshold = DefaultFlushThreshold)
+            : stream(stream)
+            , floatFormat(floatFormat)
+            , flushThreshold(flushThreshold)
+        {
+        }
+
+        /*!
+         * @brief Appends a numeric value.
+         *
+         * @tparam T An arithmetic type.
+         * @param value The value to append.
+         */
+        template <typename T>
+        void value(T value)
+        {
+            static_assert(std::is_arithmetic_v<T>, "CSV values must be arithmetic");
+
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                switch (floatFormat)
+                {
+                    case CsvFloatFormat::RoundTrip: fmt::format_to(std::back_inserter(buffer), "{}", value); return;
+                    case CsvFloatFormat::HexFloat:  fmt::format_to(std::back_inserter(buffer), "{:a}", value); return;
+                    default:                        fmt::format_to(std::back_inserter(buffer), "{:g}", value); return;
+                }
+            }
+            else
+            {
+                // invoking operator+() promotes character types to numerically-printable types
+                fmt::format_to(std::back_inserter(buffer), "{}", +value);
+            }
+        }
+
+        /*!
+         * @brief Appends a single character (typically a separator).
+         */
+        void put(char ch)
+        {
+            buffer.push_back(ch);
+        }
+
+        /*!
+         * @brief Appends a string verbatim.
+         */
+        void text(std::string_view str)
+        {
+            buffer.append(str.data(), str.data() + str.size());
+        }
+
+        /*!
+         * @brief Terminates the current line, writing the buffer to the stream if it has grown
+         *     past the flush threshold.
+         *
+         * @throws std::ios_base::failure The stream has exceptions enabled and the write failed.
+         */
+        void endLine()
+        {
+            buffer.push_back('\n');
+            if (buffer.size() >= flushThreshold)
+                flush();
+        }
+
+        /*!
+         * @brief Writes all buffered text to the stream and flushes the stream.
+         *
+         * @throws std::ios_base::failure The stream has exceptions enabled and the write failed.
+         */
+        void flush()
+        {
+            if (buffer.size() > 0)
+            {
+                stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+
+            stream.flush();
+        }
+
+        /*!
+         * @brief Gets the number of bytes currently held in the buffer.
+         */
+        std::size_t size() const
+        {
+            return buffer.size();
+        }
+
+    private:
+
+        std::ostream& stream;
+        CsvFloatFormat floatFormat;
+        std::size_t flushThreshold;
+        fmt::memory_buffer buffer;
+};
+
+END_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
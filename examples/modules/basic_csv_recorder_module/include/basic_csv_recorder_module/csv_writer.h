@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <exception>
 #include <fstream>
 #include <sstream>
 
@@ -24,6 +25,7 @@
 #include <opendaq/opendaq.h>
 
 #include <basic_csv_recorder_module/common.h>
+#include <basic_csv_recorder_module/csv_output_buffer.h>
 
 BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
 
@@ -33,11 +35,10 @@ BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
  * Writer objects own a std::ofstream handle, and the class provides templated functions for
  * writing data lines to the file as well as a function to write a header line.
  *
- * @remarks Platform-standard buffering and line endings from the C++ ostream library are used.
- *     Output is not explicitly flushed.
+ * @remarks Data lines are formatted into a CsvOutputBuffer and written to the file in large
+ *     blocks. Buffered lines are written when the buffer grows past its threshold, when flush()
+ *     is called, and when the writer is destroyed.
  *
- * @todo In the future, it may be desirable to add some control over the output formatting: for
- *     example, specifying the level of precision for floating-point values.
  * @todo Optimizations could be provided for signals with linear-rule domains.
  */
 class CsvWriter
@@ -50,10 +51,12 @@ class CsvWriter
          * @param filename The path and filename (including extension) of the file to open.
          *     Relative paths are interpreted relative to the current working directory. If the
          *     file already exists, it is replaced by a new empty file.
+         * @param floatFormat The formatting used for floating-point values.
          *
          * @throws std::ios_base::failure The file could not be opened.
          */
-        CsvWriter(const fs::path& filename)
+        CsvWriter(const fs::path& filename, CsvFloatFormat floatFormat = CsvFloatFormat::Default)
+            : output(file, floatFormat)
         {
             if (filename.has_parent_path())
             fs::create_directories(filename.parent_path());
@@ -62,6 +65,26 @@ class CsvWriter
             file.open(filename);
         }
 
+        /*!
+         * @brief Writes any buffered lines and closes the file.
+         *
+         * I/O errors are swallowed, as destructors must not throw. Callers that need to observe
+         * write failures should call flush() first.
+         */
+        ~CsvWriter()
+        {
+            try
+            {
+                output.flush();
+            }
+            catch (const std::exception&)
+            {
+            }
+        }
+
+        CsvWriter(const CsvWriter&) = delete;
+        CsvWriter& operator=(const CsvWriter&) = delete;
+
         /*!
          * @brief Writes a header line to the CSV file.
          *
@@ -87,19 +110,26 @@ class CsvWriter
             const char *auxDomainName = nullptr,
             const char *auxValueName = nullptr)
         {
-            file << quoteHeader(domainName) << ',' << quoteHeader(valueName) << '\n';
+            output.text(quoteHeader(domainName));
+            output.put(',');
+            output.text(quoteHeader(valueName));
+            output.endLine();
 
             if (auxDomainName || auxValueName)
-                file << quoteHeader(auxDomainName ? auxDomainName : "") << ','
-                    << quoteHeader(auxValueName ? auxValueName : "") << '\n';
+            {
+                output.text(quoteHeader(auxDomainName ? auxDomainName : ""));
+                output.put(',');
+                output.text(quoteHeader(auxValueName ? auxValueName : ""));
+                output.endLine();
+            }
         }
 
         /*!
          * @brief Writes a data line to the CSV file.
          *
-         * Standard output conversions are used for the specified data types. Generally this means
-         * decimal values for integer types, and scientific-notation values for floating-point
-         * types.
+         * Integer types are written in decimal. Floating-point types are written according to the
+         * CsvFloatFormat the writer was constructed with. The line may remain buffered in memory
+         * until the buffer threshold is reached or flush() is called.
          *
          * @tparam Domain The type of the @p domainValue argument.
          * @tparam Sample The type of the @p sample argument.
@@ -113,8 +143,21 @@ class CsvWriter
         template <typename Domain, typename Sample>
         void write(Domain domainValue, Sample sample)
         {
-            // invoking operator+() promotes character types to numerically-printable types
-            file << +domainValue << ',' << +sample << '\n';
+            output.value(domainValue);
+            output.put(',');
+            output.value(sample);
+            output.endLine();
+        }
+
+        /*!
+         * @brief Writes all buffered lines to the file.
+         *
+         * @throws std::ios_base::failure The buffered lines could not be written to the file due
+         *     to an I/O error.
+         */
+        void flush()
+        {
+            output.flush();
         }
 
     private:
@@ -142,6 +185,7 @@ class CsvWriter
         }
 
         std::ofstream file;
+        CsvOutputBuffer output;
 };
 
 END_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
@@ -51,6 +51,7 @@ public:
         static constexpr const char* BASENAME = "Basename";
         static constexpr const char* FILE_TIMESTAMP_ENABLED = "FileTimestampEnabled";
         static constexpr const char* WRITE_DOMAIN = "WriteDomain";
+        static constexpr const char* FLOAT_FORMAT = "FloatFormat";
     };
 
     /*!
@@ -120,6 +121,7 @@ private:
     std::string fileBasename;
     bool timestampEnabled;
     bool writeDomain;
+    CsvFloatFormat floatFormat = CsvFloatFormat::Default;
 
     std::optional<MultiCsvWriter> writer = std::nullopt;
 };
@@ -25,6 +25,7 @@
 #include <opendaq/opendaq.h>
 
 #include <basic_csv_recorder_module/common.h>
+#include <basic_csv_recorder_module/csv_output_buffer.h>
 #include <condition_variable>
 
 BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
@@ -45,7 +46,7 @@ public:
         bool operator==(const DomainMetadata& rhs);
     };
 
-    MultiCsvWriter(const fs::path& file);
+    MultiCsvWriter(const fs::path& file, CsvFloatFormat floatFormat = CsvFloatFormat::Default);
     ~MultiCsvWriter();
 
     void setHeaderInformation(const DataDescriptorPtr& domainDescriptor,
@@ -82,6 +83,7 @@ private:
     bool writeDomainColumn;
     fs::path filepath;
     std::ofstream outFile;
+    CsvOutputBuffer output;
 
     std::string domainName;
     std::vector<std::string> valueNames;
@@ -164,6 +164,11 @@ void BasicCsvRecorderSignal::onPacketReceived(const PacketPtr& packet)
     }
 }
 
+void BasicCsvRecorderSignal::flush()
+{
+    writer.flush();
+}
+
 /**
  * Records the values in the specified data packet to the CSV file.
  *
@@ -55,6 +55,14 @@ void BasicCsvRecorderThread::threadMain()
         try
         {
             recorderSignal->onPacketReceived(packet);
+
+            // write buffered lines to the file whenever the queue runs dry
+            lock.lock();
+            bool idle = queue.empty();
+            lock.unlock();
+
+            if (idle)
+                recorderSignal->flush();
         }
 
         catch (const std::exception& ex)
@@ -181,6 +181,9 @@ void MultiCsvRecorderImpl::initProperties()
 
     objPtr.addProperty(BoolProperty(Props::WRITE_DOMAIN, False));
     objPtr.getOnPropertyValueWrite(Props::WRITE_DOMAIN) += std::bind(&MultiCsvRecorderImpl::onPropertiesChanged, this);
+
+    objPtr.addProperty(SelectionProperty(Props::FLOAT_FORMAT, List<IString>("Default", "RoundTrip", "HexFloat"), 0));
+    objPtr.getOnPropertyValueWrite(Props::FLOAT_FORMAT) += std::bind(&MultiCsvRecorderImpl::onPropertiesChanged, this);
 }
 
 std::string MultiCsvRecorderImpl::getNextPortID() const
@@ -303,7 +306,7 @@ void MultiCsvRecorderImpl::configureWriter(const DataDescriptorPtr& domainDescri
         fs::path outputFile = getNextCsvFilename(filePath.value(), fileBasename, timestampEnabled);
 
         // Replace the csv writer (can it ever survive a reconfigure?)
-        writer.emplace(outputFile);
+        writer.emplace(outputFile, floatFormat);
         writer.value().setHeaderInformation(recorderDomainDataDescriptor, valueDescriptors, signalNames, writeDomain);
 
         // Auto resume recording if recording was stopped internally.
@@ -339,6 +342,7 @@ void MultiCsvRecorderImpl::onPropertiesChanged()
     fileBasename = static_cast<std::string>(objPtr.getPropertyValue(Props::BASENAME));
     timestampEnabled = static_cast<bool>(objPtr.getPropertyValue(Props::FILE_TIMESTAMP_ENABLED));
     writeDomain = static_cast<bool>(objPtr.getPropertyValue(Props::WRITE_DOMAIN));
+    floatFormat = static_cast<CsvFloatFormat>(static_cast<Int>(objPtr.getPropertyValue(Props::FLOAT_FORMAT)));
 
     reconfigureWriter();
 }
@@ -2,8 +2,6 @@
 #include <opendaq/custom_log.h>
 #include <boost/algorithm/string.hpp>
 
-#include <iostream>
-
 BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
 
 namespace
@@ -51,10 +49,11 @@ bool MultiCsvWriter::DomainMetadata::operator==(const DomainMetadata& rhs)
            referenceDomainTimeProtocol == rhs.referenceDomainTimeProtocol;
 }
 
-MultiCsvWriter::MultiCsvWriter(const fs::path& file)
+MultiCsvWriter::MultiCsvWriter(const fs::path& file, CsvFloatFormat floatFormat)
     : exitFlag(false)
     , headersWritten(false)
     , filepath(file)
+    , output(outFile, floatFormat)
     , writerThread([this]() { this->threadLoop(); })
 {
     if (filepath.has_parent_path())
@@ -131,6 +130,10 @@ void MultiCsvWriter::threadLoop()
 
         if (exitFlag)
         {
+            if (headersWritten)
+            {
+                output.flush();
+            }
             return;
         }
 
@@ -144,24 +147,33 @@ void MultiCsvWriter::threadLoop()
         }
 
         const size_t signalNum = samples.buffers.size();
-        // Write to file
+        // Format into the output buffer; it is written to the file in large blocks
         for (size_t i = 0; i < samples.count; ++i)
         {
             if (writeDomainColumn)
             {
-                outFile << (samples.packetOffset + i * metadata.ruleDelta) << ",";
+                output.value(samples.packetOffset + static_cast<Int>(i) * metadata.ruleDelta);
+                output.put(',');
             }
             for (size_t signal = 0; signal < signalNum; ++signal)
             {
-                double* signalSamplesPtr = samples.buffers[signal].get();
-                outFile << signalSamplesPtr[i];
+                output.value(samples.buffers[signal][i]);
 
                 if (signal != signalNum - 1)
                 {
-                    outFile << ",";
+                    output.put(',');
                 }
             }
-            outFile << "\n";
+            output.endLine();
+        }
+
+        lock.lock();
+        const bool idle = queue.empty();
+        lock.unlock();
+
+        if (idle)
+        {
+            output.flush();
         }
     }
 }
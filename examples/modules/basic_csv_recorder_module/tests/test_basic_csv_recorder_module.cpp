@@ -7,6 +7,11 @@
 #include <coretypes/common.h>
 #include <opendaq/context_factory.h>
 #include <opendaq/scheduler_factory.h>
+#include <basic_csv_recorder_module/csv_output_buffer.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
 
 using BasicCsvRecorderModuleTest = testing::Test;
 using namespace daq;
@@ -49,3 +54,62 @@ TEST_F(BasicCsvRecorderModuleTest, VersionCorrect)
     ASSERT_EQ(version.getMinor(), BASIC_CSV_RECORDER_MODULE_MINOR_VERSION);
     ASSERT_EQ(version.getPatch(), BASIC_CSV_RECORDER_MODULE_PATCH_VERSION);
 }
+
+TEST_F(BasicCsvRecorderModuleTest, OutputBufferDefaultMatchesStream)
+{
+    using namespace daq::modules::basic_csv_recorder_module;
+
+    std::ostringstream expected;
+    std::ostringstream actual;
+    CsvOutputBuffer output(actual);
+
+    const double doubles[] = {-0.13, 0.87, 1.0 / 3.0, 1e-7, 123456789.0, 0.0};
+    for (double value : doubles)
+    {
+        expected << value << ',' << +static_cast<std::int8_t>(-5) << '\n';
+        output.value(value);
+        output.put(',');
+        output.value(static_cast<std::int8_t>(-5));
+        output.endLine();
+    }
+
+    ASSERT_TRUE(actual.str().empty());
+    output.flush();
+    ASSERT_EQ(actual.str(), expected.str());
+}
+
+TEST_F(BasicCsvRecorderModuleTest, OutputBufferRoundTrip)
+{
+    using namespace daq::modules::basic_csv_recorder_module;
+
+    std::ostringstream roundTrip;
+    std::ostringstream hexFloat;
+    CsvOutputBuffer roundTripOutput(roundTrip, CsvFloatFormat::RoundTrip);
+    CsvOutputBuffer hexFloatOutput(hexFloat, CsvFloatFormat::HexFloat);
+
+    const double value = 1.0 / 3.0;
+    roundTripOutput.value(value);
+    roundTripOutput.flush();
+    hexFloatOutput.value(value);
+    hexFloatOutput.flush();
+
+    ASSERT_EQ(std::stod(roundTrip.str()), value);
+    ASSERT_EQ(std::strtod(hexFloat.str().c_str(), nullptr), value);
+}
+
+TEST_F(BasicCsvRecorderModuleTest, OutputBufferFlushThreshold)
+{
+    using namespace daq::modules::basic_csv_recorder_module;
+
+    std::ostringstream stream;
+    CsvOutputBuffer output(stream, CsvFloatFormat::Default, 16);
+
+    output.value(1234567);
+    output.endLine();
+    ASSERT_TRUE(stream.str().empty());
+
+    output.value(1234567);
+    output.endLine();
+    ASSERT_EQ(stream.str(), "1234567\n1234567\n");
+    ASSERT_EQ(output.size(), 0u);
+}
@@ -64,6 +64,32 @@ struct Props
      * This property can be set to `true` to stop recording and `false` to keep it active.
      */
     static constexpr const char* StopRecording = "StopRecording";
+    /*!
+     * @brief The number of rows buffered per signal before they are written as one Parquet row group.
+     */
+    static constexpr const char* RowGroupSize = "RowGroupSize";
+    /*!
+     * @brief The maximum time in milliseconds that buffered rows are kept before being written as a
+     *     (possibly smaller) row group.
+     */
+    static constexpr const char* FlushInterval = "FlushInterval";
+    /*!
+     * @brief The compression codec used for newly opened files (None, Snappy or Zstd).
+     */
+    static constexpr const char* Compression = "Compression";
+    /*!
+     * @brief Whether dictionary encoding is enabled for newly opened files.
+     */
+    static constexpr const char* EnableDictionary = "EnableDictionary";
+    /*!
+     * @brief Whether column statistics are written to newly opened files.
+     */
+    static constexpr const char* EnableStatistics = "EnableStatistics";
+    /*!
+     * @brief The number of packets that can be queued per signal before the packet-delivering
+     *     thread is blocked until the writer thread catches up.
+     */
+    static constexpr const char* MaxQueuedPackets = "MaxQueuedPackets";
 };
 
 END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
@@ -24,11 +24,10 @@
 #include <opendaq/opendaq.h>
 
 #include <parquet_recorder_module/common.h>
+#include <parquet_recorder_module/parquet_writer.h>
 
 BEGIN_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
 
-class ParquetWriter;
-
 /*!
  * @brief A function block recording data from its input signals into a Parquet
  *     file.
@@ -37,7 +36,10 @@ class ParquetWriter;
  * via a property. Recording can be started and stopped by calling member functions or by setting
  * a property. Signals can be dynamically connected and disconnected.
  *
- * Packet handling takes place in scheduled tasks.
+ * Packet handling takes place on a dedicated writer thread per signal. Samples are batched into
+ * row groups whose size, flush interval and encoding are configured via properties. Changes are
+ * picked up by each writer when it opens its next file, i.e. on the first packet after recording
+ * starts or when the signal's descriptor changes.
  */
 class ParquetRecorderImpl final : public FunctionBlockImpl<IFunctionBlock, IRecorder>
 {
@@ -112,9 +114,10 @@ private:
     void reconfigure();
     void clearWriters();
     std::shared_ptr<ParquetWriter> findWriterForSignal(IInputPort* port);
+    ParquetWriterOptions getWriterOptions();
+    void updateWriterOptions();
 
     std::unordered_map<IInputPort*, std::shared_ptr<ParquetWriter>> writers;
-    SchedulerPtr scheduler;
     std::atomic_uint32_t portCount = 0;
     std::atomic_bool recording = false;
 };
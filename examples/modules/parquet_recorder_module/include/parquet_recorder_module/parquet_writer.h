@@ -17,6 +17,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 #include <opendaq/opendaq.h>
 #include <coretypes/filesystem.h>
@@ -33,6 +38,7 @@ namespace parquet
 
 namespace arrow
 {
+    class ArrayBuilder;
     class Schema;
     namespace io
     {
@@ -42,47 +48,84 @@ namespace arrow
 
 BEGIN_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
 
+enum class ParquetCompression
+{
+    None = 0,
+    Snappy,
+    Zstd
+};
+
+/*!
+ * @brief Controls how a ParquetWriter batches samples into row groups and encodes them.
+ */
+struct ParquetWriterOptions
+{
+    size_t rowGroupSize = 65536;
+    std::chrono::milliseconds flushInterval{1000};
+    size_t maxQueuedPackets = 1024;
+    ParquetCompression compression = ParquetCompression::None;
+    bool enableDictionary = true;
+    bool enableStatistics = true;
+};
+
+/*!
+ * @brief Writes the packets of a single signal into a Parquet file.
+ *
+ * Packets are queued by the caller and processed on a dedicated writer thread. Samples are
+ * accumulated in reusable Arrow builders and written as one row group once `rowGroupSize`
+ * rows are buffered or `flushInterval` has elapsed since the last row group. When more than
+ * `maxQueuedPackets` packets are pending, enqueueing blocks until the writer catches up.
+ * Options passed to `setOptions` take effect when the writer opens its next file.
+ */
 class ParquetWriter
 {
 public:
-    static constexpr const size_t PACKET_BUFFER_SIZE_TO_WRITE = 10;
-
-    ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, daq::SchedulerPtr scheduler);
+    ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, ParquetWriterOptions options = {});
     ~ParquetWriter();
 
     void enqueuePacketList(ListPtr<IPacket>& packets);
+    void setOptions(ParquetWriterOptions options);
 
 private:
     fs::path path;
     SignalPtr signal;
     daq::LoggerComponentPtr loggerComponent;
-    daq::SchedulerPtr scheduler;
+    ParquetWriterOptions options;
+    std::optional<ParquetWriterOptions> pendingOptions;
     std::string filename;
 
-    std::mutex mutex;
     std::shared_ptr<arrow::Schema> schema;
     std::shared_ptr<arrow::io::FileOutputStream> outfile;
     std::unique_ptr<parquet::arrow::FileWriter> writer;
+    std::unique_ptr<arrow::ArrayBuilder> dataBuilder;
+    std::unique_ptr<arrow::ArrayBuilder> domainBuilder;
+    size_t bufferedRows = 0;
+    std::chrono::steady_clock::time_point lastRowGroupTime;
     DataDescriptorPtr currentDataDescriptor;
     DataDescriptorPtr currentDomainDescriptor;
 
-    std::vector<PacketPtr> packetBuffer;
-    std::mutex packetBufferMutex;
-
-    std::atomic_bool isClosing = false;
+    std::vector<PacketPtr> packetQueue;
+    std::mutex queueMutex;
+    std::condition_variable queueCv;
+    std::condition_variable spaceCv;
+    bool exitFlag = false;
+    std::thread writerThread;
 
-    std::vector<PacketPtr> dequeuePacketList();
+    void threadLoop();
     void processPacketList(const std::vector<PacketPtr>& packets);
 
     void onPacket(const PacketPtr& packet);
     void onDataPacket(const DataPacketPtr& packet);
     void onEventPacket(const EventPacketPtr& packet);
 
+    void applyPendingOptions();
     void configure(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor);
     void reconfigure(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor);
     void generateMetadata(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor);
+    void createBuilders();
     void openFile();
     void closeFile();
+    void flushRowGroup();
 
     template <typename TDataType, typename TDomainType>
     void writePackets(const DataPacketPtr& data, const DataPacketPtr& domain);
@@ -91,4 +134,4 @@ private:
     void writePackets(const DataPacketPtr& data, const DataPacketPtr& domain);
 };
 
-END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
\ No newline at end of file
+END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
@@ -4,6 +4,8 @@
 #include <string>
 
 #include <coreobjects/callable_info_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/unit_factory.h>
 
 #include <parquet_recorder_module/common.h>
 #include <parquet_recorder_module/parquet_writer.h>
@@ -22,16 +24,10 @@ ParquetRecorderImpl::ParquetRecorderImpl(const ContextPtr& context,
     : FunctionBlockImpl<IFunctionBlock, IRecorder>(createType(), context, parent, localId, nullptr)
 {
     tags.add(Tags::Recorder);
-    scheduler = context.getScheduler();
 
     if (loggerComponent.assigned())
         loggerComponent.setLevel(LogLevel::Trace);
 
-    if (!scheduler.assigned())
-    {
-        throw InvalidParameterException("ParquetRecorderImpl: Scheduler must be assigned for recording to work");
-    }
-
     addInputPort();
     addProperties();
 }
@@ -133,6 +129,41 @@ void ParquetRecorderImpl::addProperties()
     const auto stopRecordingProp = FunctionProperty(Props::StopRecording, ProcedureInfo());
     objPtr.addProperty(stopRecordingProp);
     objPtr.setPropertyValue(Props::StopRecording, Procedure([this] { this->stopRecording(); }));
+
+    objPtr.addProperty(IntPropertyBuilder(Props::RowGroupSize, 65536).setMinValue(1).build());
+    objPtr.addProperty(IntPropertyBuilder(Props::FlushInterval, 1000).setUnit(Unit("ms")).setMinValue(1).build());
+    objPtr.addProperty(SelectionProperty(Props::Compression, List<IString>("None", "Snappy", "Zstd"), 0));
+    objPtr.addProperty(BoolProperty(Props::EnableDictionary, True));
+    objPtr.addProperty(BoolProperty(Props::EnableStatistics, True));
+    objPtr.addProperty(IntPropertyBuilder(Props::MaxQueuedPackets, 1024).setMinValue(1).build());
+
+    for (const auto& name : {Props::RowGroupSize,
+                             Props::FlushInterval,
+                             Props::Compression,
+                             Props::EnableDictionary,
+                             Props::EnableStatistics,
+                             Props::MaxQueuedPackets})
+        objPtr.getOnPropertyValueWrite(name) += std::bind(&ParquetRecorderImpl::updateWriterOptions, this);
+}
+
+ParquetWriterOptions ParquetRecorderImpl::getWriterOptions()
+{
+    ParquetWriterOptions options;
+    options.rowGroupSize = static_cast<size_t>(static_cast<Int>(objPtr.getPropertyValue(Props::RowGroupSize)));
+    options.flushInterval = std::chrono::milliseconds(static_cast<Int>(objPtr.getPropertyValue(Props::FlushInterval)));
+    options.compression = static_cast<ParquetCompression>(static_cast<Int>(objPtr.getPropertyValue(Props::Compression)));
+    options.enableDictionary = objPtr.getPropertyValue(Props::EnableDictionary);
+    options.enableStatistics = objPtr.getPropertyValue(Props::EnableStatistics);
+    options.maxQueuedPackets = static_cast<size_t>(static_cast<Int>(objPtr.getPropertyValue(Props::MaxQueuedPackets)));
+    return options;
+}
+
+void ParquetRecorderImpl::updateWriterOptions()
+{
+    auto lock = getRecursiveConfigLock();
+    const auto options = getWriterOptions();
+    for (const auto& [port, writer] : writers)
+        writer->setOptions(options);
 }
 
 void ParquetRecorderImpl::addInputPort()
@@ -147,6 +178,7 @@ void ParquetRecorderImpl::reconfigure()
     LOG_D("ParquetRecorderImpl::reconfigure: Reconfiguring ParquetRecorder...");
     auto lock = getRecursiveConfigLock();
     fs::path path = static_cast<std::string>(objPtr.getPropertyValue(Props::Path));
+    const auto options = getWriterOptions();
 
     std::unordered_set<IInputPort*> ports;
 
@@ -162,7 +194,7 @@ void ParquetRecorderImpl::reconfigure()
             if (writers.find(inputPort.getObject()) == writers.end())
             {
                 writers.emplace(inputPort.getObject(),
-                                std::make_shared<ParquetWriter>(path, signal, loggerComponent, context.getScheduler()));
+                                std::make_shared<ParquetWriter>(path, signal, loggerComponent, options));
             }
         }
     }
@@ -4,10 +4,11 @@
 
 #include <opendaq/custom_log.h>
 #include <opendaq/event_packet_params.h>
-#include <opendaq/work_factory.h>
+#include <opendaq/thread_name.h>
 
 #include <arrow/api.h>
 #include <arrow/io/file.h>
+#include <arrow/util/compression.h>
 #include <parquet/arrow/writer.h>
 
 #include <parquet_recorder_module/type_resolver.h>
@@ -48,23 +49,115 @@ static std::string getFilename(const fs::path& path, const SignalPtr& signal)
     return retPath.string();
 }
 
-ParquetWriter::ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, daq::SchedulerPtr scheduler)
+static arrow::Compression::type toArrowCompression(ParquetCompression compression)
+{
+    switch (compression)
+    {
+        case ParquetCompression::Snappy:
+            return arrow::Compression::SNAPPY;
+        case ParquetCompression::Zstd:
+            return arrow::Compression::ZSTD;
+        case ParquetCompression::None:
+        default:
+            return arrow::Compression::UNCOMPRESSED;
+    }
+}
+
+static ParquetWriterOptions normalizeOptions(ParquetWriterOptions options)
+{
+    if (options.rowGroupSize == 0)
+        options.rowGroupSize = 1;
+    if (options.maxQueuedPackets == 0)
+        options.maxQueuedPackets = 1;
+    return options;
+}
+
+ParquetWriter::ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, ParquetWriterOptions options)
     : path(std::move(path))
     , signal(std::move(signal))
     , loggerComponent(std::move(logger_component))
-    , scheduler(std::move(scheduler))
+    , options(normalizeOptions(std::move(options)))
     , filename(getFilename(this->path, this->signal))
+    , lastRowGroupTime(std::chrono::steady_clock::now())
 {
-    packetBuffer.reserve(PACKET_BUFFER_SIZE_TO_WRITE);
+    writerThread = std::thread(&ParquetWriter::threadLoop, this);
 }
 
 ParquetWriter::~ParquetWriter()
 {
-    isClosing = true;
-    scheduler.waitAll();
-    std::lock_guard bufferLock(packetBufferMutex);
-    std::lock_guard lock(mutex);
-    closeFile();
+    {
+        std::lock_guard lock(queueMutex);
+        exitFlag = true;
+    }
+    queueCv.notify_one();
+    spaceCv.notify_all();
+
+    if (writerThread.joinable())
+        writerThread.join();
+}
+
+void ParquetWriter::setOptions(ParquetWriterOptions options)
+{
+    std::lock_guard lock(queueMutex);
+    pendingOptions = normalizeOptions(std::move(options));
+}
+
+void ParquetWriter::applyPendingOptions()
+{
+    {
+        std::lock_guard lock(queueMutex);
+        if (!pendingOptions.has_value())
+            return;
+
+        options = std::move(pendingOptions.value());
+        pendingOptions.reset();
+    }
+    spaceCv.notify_all();
+}
+
+void ParquetWriter::threadLoop()
+{
+    daqNameThread("ParquetWriter");
+
+    std::unique_lock lock(queueMutex);
+    while (true)
+    {
+        queueCv.wait_for(lock, options.flushInterval, [this] { return exitFlag || !packetQueue.empty(); });
+
+        std::vector<PacketPtr> packets;
+        std::swap(packets, packetQueue);
+        const bool exiting = exitFlag;
+        lock.unlock();
+        spaceCv.notify_all();
+
+        try
+        {
+            processPacketList(packets);
+
+            if (std::chrono::steady_clock::now() - lastRowGroupTime >= options.flushInterval)
+                flushRowGroup();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_E("ParquetWriter::threadLoop: Exception while processing packet list: {}", e.what());
+        }
+
+        packets.clear();
+        lock.lock();
+
+        if (exiting && packetQueue.empty())
+            break;
+    }
+    lock.unlock();
+
+    try
+    {
+        closeFile();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_E("ParquetWriter::threadLoop: Exception while closing file: {}", e.what());
+    }
 }
 
 void ParquetWriter::onPacket(const PacketPtr& packet)
@@ -207,34 +300,16 @@ void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr&
 template <typename TDataType, typename TDomainType>
 void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr& domain)
 {
-    typename ArrowTypeResolver<TDataType>::BuilderType sampleBuilder;
-    typename ArrowTypeResolver<TDomainType>::BuilderType domainBuilder;
-
     if (!data.assigned())
     {
         LOG_E("Data packet is null, cannot write samples");
         return;
     }
 
-    auto status = sampleBuilder.AppendValues(static_cast<TDataType*>(data.getData()), data.getSampleCount());
-    if(!status.ok()) {
-        LOG_E("Failed to append sample values: {}", status.ToString());
-        return;
-    }
-
-    if (domain.assigned())
+    if (!dataBuilder || !domainBuilder)
     {
-        status = domainBuilder.AppendValues(static_cast<TDomainType*>(domain.getData()), domain.getSampleCount());
-        if(!status.ok()) {
-            LOG_E("Failed to append domain values: {}", status.ToString());
-            return;
-        }
-    } else {
-        status = domainBuilder.AppendNulls(data.getSampleCount());
-        if(!status.ok()) {
-            LOG_E("Failed to append null domain values: {}", status.ToString());
-            return;
-        }
+        LOG_E("Builders for {} are not initialized", filename);
+        return;
     }
 
     const auto sampleCount = data.getSampleCount();
@@ -246,44 +321,93 @@ void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr&
         return;
     }
 
-    auto samples = sampleBuilder.Finish().ValueOr(nullptr);
-    auto domains = domainBuilder.Finish().ValueOr(nullptr);
+    auto& sampleBuilder = static_cast<typename ArrowTypeResolver<TDataType>::BuilderType&>(*dataBuilder);
+    auto& domainValuesBuilder = static_cast<typename ArrowTypeResolver<TDomainType>::BuilderType&>(*domainBuilder);
 
-    if (!domains)
+    auto status = sampleBuilder.AppendValues(static_cast<TDataType*>(data.getData()), sampleCount);
+    if (!status.ok())
     {
-        LOG_E("Failed to finish domain values");
+        LOG_E("Failed to append sample values: {}", status.ToString());
+        dataBuilder->Reset();
+        domainBuilder->Reset();
+        bufferedRows = 0;
         return;
     }
-    if (!samples)
+
+    if (domain.assigned())
+        status = domainValuesBuilder.AppendValues(static_cast<TDomainType*>(domain.getData()), domainCount);
+    else
+        status = domainValuesBuilder.AppendNulls(sampleCount);
+
+    if (!status.ok())
     {
-        LOG_E("Failed to finish sample values");
+        LOG_E("Failed to append domain values: {}", status.ToString());
+        dataBuilder->Reset();
+        domainBuilder->Reset();
+        bufferedRows = 0;
         return;
     }
 
-    auto batch = arrow::RecordBatch::Make(schema, sampleCount, {domains, samples});
+    bufferedRows += sampleCount;
+    LOG_T("ParquetWriter::writePackets: Buffered packet with ID: {} and sample count: {}", data.getPacketId(), sampleCount);
 
-    if (!batch)
+    if (bufferedRows >= options.rowGroupSize)
+        flushRowGroup();
+}
+
+void ParquetWriter::flushRowGroup()
+{
+    lastRowGroupTime = std::chrono::steady_clock::now();
+
+    if (bufferedRows == 0 || !dataBuilder || !domainBuilder)
+        return;
+
+    const auto rowCount = bufferedRows;
+    bufferedRows = 0;
+
+    std::shared_ptr<arrow::Array> samples;
+    std::shared_ptr<arrow::Array> domains;
+
+    auto status = dataBuilder->Finish(&samples);
+    if (!status.ok())
     {
-        LOG_E("Failed to create RecordBatch for Parquet file");
+        LOG_E("Failed to finish sample values: {}", status.ToString());
+        domainBuilder->Reset();
         return;
     }
 
-    if (writer)
+    status = domainBuilder->Finish(&domains);
+    if (!status.ok())
     {
-        status = writer->WriteRecordBatch(*batch);
-        if (!status.ok())
-        {
-            LOG_E("Failed to write record batch to Parquet file: {}", status.ToString());
-        }
-        else
-        {
-            LOG_D("ParquetWriter::writePackets: Successfully wrote record batch with ID: {} and sample count: {}", data.getPacketId(), sampleCount);
-        }
+        LOG_E("Failed to finish domain values: {}", status.ToString());
+        return;
     }
-    else
+
+    // Builders are reset by Finish; reserve the same capacity so the next row group does not regrow them
+    (void) dataBuilder->Reserve(static_cast<int64_t>(rowCount));
+    (void) domainBuilder->Reserve(static_cast<int64_t>(rowCount));
+
+    auto batch = arrow::RecordBatch::Make(schema, static_cast<int64_t>(rowCount), {domains, samples});
+    if (!batch)
+    {
+        LOG_E("Failed to create RecordBatch for Parquet file");
+        return;
+    }
+
+    if (!writer)
     {
         LOG_E("Writer for {} is not initialized", filename);
+        return;
     }
+
+    status = writer->NewBufferedRowGroup();
+    if (status.ok())
+        status = writer->WriteRecordBatch(*batch);
+
+    if (!status.ok())
+        LOG_E("Failed to write row group to Parquet file: {}", status.ToString());
+    else
+        LOG_D("ParquetWriter::flushRowGroup: Wrote row group with {} rows to {}", rowCount, filename);
 }
 
 void ParquetWriter::onEventPacket(const EventPacketPtr& packet)
@@ -333,6 +457,7 @@ void ParquetWriter::generateMetadata(const DataDescriptorPtr& dataDescriptor, co
 
     currentDataDescriptor = dataDescriptor;
     currentDomainDescriptor = domainDescriptor;
+    bufferedRows = 0;
 
     schema = arrow::schema(
         {arrow::field(domainName, arrow_type_from_sample_type(domainType), true, arrow::key_value_metadata({{"metadata", domainMetadata}})),
@@ -352,6 +477,28 @@ void ParquetWriter::generateMetadata(const DataDescriptorPtr& dataDescriptor, co
     }
 }
 
+void ParquetWriter::createBuilders()
+{
+    dataBuilder.reset();
+    domainBuilder.reset();
+
+    if (!schema)
+        return;
+
+    dataBuilder = arrow::MakeBuilder(schema->field(1)->type()).ValueOr(nullptr);
+    domainBuilder = arrow::MakeBuilder(schema->field(0)->type()).ValueOr(nullptr);
+
+    if (!dataBuilder || !domainBuilder)
+    {
+        LOG_E("Failed to create Arrow builders for {}", filename);
+        return;
+    }
+
+    const auto initialCapacity = static_cast<int64_t>(std::min<size_t>(options.rowGroupSize, 65536));
+    (void) dataBuilder->Reserve(initialCapacity);
+    (void) domainBuilder->Reserve(initialCapacity);
+}
+
 void ParquetWriter::openFile()
 {
     LOG_D("ParquetWriter::openFile: Opening Parquet file for writing at path: {}", path.string());
@@ -364,7 +511,26 @@ void ParquetWriter::openFile()
         auto arrowPropertiesBuilder = parquet::ArrowWriterProperties::Builder();
         arrowPropertiesBuilder.store_schema();
 
+        auto compression = toArrowCompression(options.compression);
+        if (!arrow::util::Codec::IsAvailable(compression))
+        {
+            LOG_W("Compression codec {} is not available, writing {} uncompressed", arrow::util::Codec::GetCodecAsString(compression), filename);
+            compression = arrow::Compression::UNCOMPRESSED;
+        }
+
         auto writerPropertiesBuilder = parquet::WriterProperties::Builder();
+        writerPropertiesBuilder.max_row_group_length(static_cast<int64_t>(options.rowGroupSize));
+        writerPropertiesBuilder.compression(compression);
+
+        if (options.enableDictionary)
+            writerPropertiesBuilder.enable_dictionary();
+        else
+            writerPropertiesBuilder.disable_dictionary();
+
+        if (options.enableStatistics)
+            writerPropertiesBuilder.enable_statistics();
+        else
+            writerPropertiesBuilder.disable_statistics();
 
         // Create Parquet FileWriter
         writer = parquet::arrow::FileWriter::Open(
@@ -379,6 +545,8 @@ void ParquetWriter::openFile()
 void ParquetWriter::closeFile()
 {
     LOG_D("ParquetWriter::closeFile: Closing Parquet file and writer");
+    flushRowGroup();
+
     if (writer)
     {
         auto status = writer->Close();
@@ -402,7 +570,9 @@ void ParquetWriter::closeFile()
 void ParquetWriter::configure(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor)
 {
     LOG_D("ParquetWriter::configure: Configuring ParquetWriter with data and domain descriptors");
+    applyPendingOptions();
     generateMetadata(dataDescriptor, domainDescriptor);
+    createBuilders();
     openFile();
 }
 
@@ -427,39 +597,17 @@ void ParquetWriter::reconfigure(const DataDescriptorPtr& dataDescriptor, const D
 
 void ParquetWriter::enqueuePacketList(ListPtr<IPacket>& packets)
 {
-    std::lock_guard lock(packetBufferMutex);
-    if (isClosing && packetBuffer.empty()) return;
-
-    for (auto&& packet : packets)
     {
-        packetBuffer.push_back(packet);
-    }
+        std::unique_lock lock(queueMutex);
+        spaceCv.wait(lock, [this] { return exitFlag || packetQueue.size() < options.maxQueuedPackets; });
+        if (exitFlag)
+            return;
 
-    if (packetBuffer.size() >= PACKET_BUFFER_SIZE_TO_WRITE)
-    {
-        scheduler.scheduleWork(Work(  // main processing task
-            [this]()
-            {
-                std::lock_guard lock(mutex);
-                try
-                {
-                    auto packets = dequeuePacketList();
-                    processPacketList(packets);
-                }
-                catch (const std::exception& e)
-                {
-                    LOG_E("ParquetWriter::enqueuePacketList: Exception while processing packet list: {}", e.what());
-                }
-            }));
+        for (auto&& packet : packets)
+            packetQueue.push_back(packet);
     }
-}
 
-std::vector<PacketPtr> ParquetWriter::dequeuePacketList()
-{
-    std::lock_guard lock(packetBufferMutex);
-    std::vector<PacketPtr> packets;
-    std::swap(packetBuffer, packets);
-    return packets;
+    queueCv.notify_one();
 }
 
 void ParquetWriter::processPacketList(const std::vector<PacketPtr>& packets)
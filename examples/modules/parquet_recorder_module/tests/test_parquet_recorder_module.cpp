@@ -154,3 +154,119 @@ TEST_F(ParquetRecorderModuleTest, WriteReadCompare)
             ASSERT_EQ(value, expectedValue++);
     }
 }
+
+TEST_F(ParquetRecorderModuleTest, WriteRowGroups)
+{
+    const auto outputPath = fs::current_path() / "parquet_row_groups";
+    fs::remove_all(outputPath);
+    fs::create_directories(outputPath);
+
+    auto module = CreateModuleWithScheduler();
+    auto fb = module.createFunctionBlock("ParquetRecorder", nullptr, "fb");
+    ASSERT_TRUE(fb.assigned());
+
+    fb.setPropertyValue("Path", outputPath.string());
+    fb.setPropertyValue("RowGroupSize", 10'000);
+    fb.setPropertyValue("FlushInterval", 60'000);
+    fb.setPropertyValue("Compression", 2);
+
+    auto context = fb.getContext();
+    auto recorder = fb.asPtr<daq::IRecorder>(true);
+    auto inputPort = fb.getInputPorts().getItemAt(0);
+    auto signal = CreateSignal(context);
+    inputPort.connect(signal);
+
+    recorder->startRecording();
+
+    for (auto i = 0; i < 100'000; i += 100)
+    {
+        auto domain = DataPacket(signal.getDomainSignal().getDescriptor(), 100);
+        auto data = DataPacketWithDomain(domain, signal.getDescriptor(), 100);
+        std::iota(static_cast<double*>(data.getData()), static_cast<double*>(data.getData()) + 100, i);
+        signal.sendPacket(data);
+    }
+
+    recorder->stopRecording();
+    fb = nullptr;
+
+    auto dir = fs::directory_iterator(outputPath);
+    auto parquetItem =
+        std::find_if(fs::begin(dir),
+                     fs::end(dir),
+                     [](const fs::directory_entry& item) { return item.is_regular_file() && item.path().extension() == ".parquet"; });
+    ASSERT_NE(parquetItem, fs::end(dir));
+
+    {
+        std::shared_ptr<arrow::io::ReadableFile> input = arrow::io::ReadableFile::Open(parquetItem->path().string()).ValueOrDie();
+        std::unique_ptr<parquet::arrow::FileReader> arrowReader = parquet::arrow::OpenFile(input, arrow::default_memory_pool()).ValueOrDie();
+
+        ASSERT_EQ(arrowReader->num_row_groups(), 10);
+
+        std::shared_ptr<arrow::Table> table;
+        ASSERT_TRUE(arrowReader->ReadTable(&table).ok());
+        ASSERT_EQ(table->num_rows(), 100'000);
+
+        double expectedValue = 0;
+        for (const auto& chunk : table->column(1)->chunks())
+        {
+            auto array = std::static_pointer_cast<arrow::DoubleArray>(chunk);
+            for (const auto& value : *array)
+                ASSERT_EQ(value, expectedValue++);
+        }
+    }
+
+    fs::remove_all(outputPath);
+}
+
+TEST_F(ParquetRecorderModuleTest, OptionsChangedAfterConnect)
+{
+    const auto outputPath = fs::current_path() / "parquet_options_changed";
+    fs::remove_all(outputPath);
+    fs::create_directories(outputPath);
+
+    auto module = CreateModuleWithScheduler();
+    auto fb = module.createFunctionBlock("ParquetRecorder", nullptr, "fb");
+    ASSERT_TRUE(fb.assigned());
+
+    fb.setPropertyValue("Path", outputPath.string());
+    fb.setPropertyValue("FlushInterval", 60'000);
+
+    auto context = fb.getContext();
+    auto recorder = fb.asPtr<daq::IRecorder>(true);
+    auto inputPort = fb.getInputPorts().getItemAt(0);
+    auto signal = CreateSignal(context);
+    inputPort.connect(signal);
+
+    // the writer already exists; the new row group size must apply to the file it opens next
+    fb.setPropertyValue("RowGroupSize", 10'000);
+
+    recorder->startRecording();
+
+    for (auto i = 0; i < 100'000; i += 100)
+    {
+        auto domain = DataPacket(signal.getDomainSignal().getDescriptor(), 100);
+        auto data = DataPacketWithDomain(domain, signal.getDescriptor(), 100);
+        std::iota(static_cast<double*>(data.getData()), static_cast<double*>(data.getData()) + 100, i);
+        signal.sendPacket(data);
+    }
+
+    recorder->stopRecording();
+    fb = nullptr;
+
+    auto dir = fs::directory_iterator(outputPath);
+    auto parquetItem =
+        std::find_if(fs::begin(dir),
+                     fs::end(dir),
+                     [](const fs::directory_entry& item) { return item.is_regular_file() && item.path().extension() == ".parquet"; });
+    ASSERT_NE(parquetItem, fs::end(dir));
+
+    {
+        std::shared_ptr<arrow::io::ReadableFile> input = arrow::io::ReadableFile::Open(parquetItem->path().string()).ValueOrDie();
+        std::unique_ptr<parquet::arrow::FileReader> arrowReader = parquet::arrow::OpenFile(input, arrow::default_memory_pool()).ValueOrDie();
+
+        ASSERT_EQ(arrowReader->num_row_groups(), 10);
+        ASSERT_EQ(arrowReader->parquet_reader()->metadata()->num_rows(), 100'000);
+    }
+
+    fs::remove_all(outputPath);
+}
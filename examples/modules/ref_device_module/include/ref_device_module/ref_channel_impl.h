@@ -22,13 +22,13 @@
 #include <opendaq/packet_buffer_builder_ptr.h>
 
 #include <opendaq/ids_parser.h>
+#include <signal_generator/waveform_kernels.h>
 
 #include <optional>
-#include <random>
 
 BEGIN_NAMESPACE_REF_DEVICE_MODULE
 
-enum class WaveformType { Sine, Rect, None, Counter, ConstantValue };
+enum class WaveformType { Sine, Rect, None, Counter, ConstantValue, Triangle, Sawtooth };
 
 DECLARE_OPENDAQ_INTERFACE(IRefChannel, IBaseObject)
 {
@@ -44,6 +44,7 @@ struct RefChannelInit
     std::chrono::microseconds microSecondsFromEpochToStartTime;
     StringPtr referenceDomainId;
     bool usePacketBuffer;
+    bool mirroredPacketBuffer;
 };
 
 class RefChannelImpl final : public ChannelImpl<IRefChannel>
@@ -83,8 +84,7 @@ private:
     std::chrono::microseconds microSecondsFromEpochToStartTime;
     std::chrono::microseconds lastCollectTime;
     uint64_t samplesGenerated;
-    std::default_random_engine re;
-    std::normal_distribution<double> dist;
+    waveform::NoiseGenerator noise;
     SignalConfigPtr valueSignal;
     SignalConfigPtr timeSignal;
     bool needsSignalTypeChanged;
@@ -92,6 +92,7 @@ private:
     uint64_t packetSize;
     StringPtr referenceDomainId;
     PacketBufferPtr packetBuffer;
+    bool mirroredPacketBuffer;
     bool acqActive;
 
     void packetBufferSetup();
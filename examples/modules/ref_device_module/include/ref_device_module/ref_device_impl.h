@@ -74,10 +74,12 @@ private:
     uint64_t getSamplesSinceStart(std::chrono::microseconds time) const;
     void updateSamplesGenerated();
     void acqLoop();
+    void collectChannelSamples(std::chrono::microseconds curTime);
     void updateNumberOfChannels();
     void enableCANChannel();
     void enableProtectedChannel();
     void updateAcqLoopTime();
+    void updateAcqWorkerCount();
     void configureTimeSignal();
     void updateGlobalSampleRate();
     void enableLogging();
@@ -87,6 +89,7 @@ private:
     size_t id;
     StringPtr serialNumber;
     bool usePacketBuffer;
+    bool mirroredPacketBuffer;
 
     std::thread acqThread;
     std::condition_variable cv;
@@ -100,6 +103,7 @@ private:
     ChannelPtr canChannel;
     ChannelPtr protectedChannel;
     size_t acqLoopTime;
+    size_t acqWorkerCount;
     bool stopAcq;
 
     FolderConfigPtr aiFolder;
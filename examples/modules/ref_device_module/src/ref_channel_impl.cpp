@@ -15,8 +15,7 @@
 #include <opendaq/packet_buffer_factory.h>
 #include <ref_device_module/ref_channel_impl.h>
 #include <date/date.h>
-
-#define PI 3.141592653589793
+#include <random>
 
 BEGIN_NAMESPACE_REF_DEVICE_MODULE
 
@@ -39,9 +38,10 @@ RefChannelImpl::RefChannelImpl(const ContextPtr& context,
     , microSecondsFromEpochToStartTime(init.microSecondsFromEpochToStartTime)
     , lastCollectTime(0)
     , samplesGenerated(0)
-    , re(std::random_device()())
+    , noise(std::random_device()())
     , needsSignalTypeChanged(false)
     , referenceDomainId(init.referenceDomainId)
+    , mirroredPacketBuffer(init.mirroredPacketBuffer)
     , acqActive(true)
 {
     objPtr.asPtr<IPropertyObjectInternal>().setLockingStrategy(LockingStrategy::InheritLock);
@@ -62,7 +62,7 @@ void RefChannelImpl::packetBufferSetup()
 {
     auto size = valueSignal.getDescriptor().getRawSampleSize() * 2 * sampleRate;
     if (!packetBuffer.assigned())
-        packetBuffer = PacketBufferBuilder().setSizeInBytes(size).setContext(this->context).build();
+        packetBuffer = PacketBufferBuilder().setSizeInBytes(size).setMirroredMapping(mirroredPacketBuffer).setContext(this->context).build();
     else
         packetBuffer.resize(size);
 }
@@ -77,14 +77,14 @@ void RefChannelImpl::signalTypeChangedIfNotUpdating(const PropertyValueEventArgs
 
 void RefChannelImpl::initProperties()
 {
-    const auto waveformProp = SelectionProperty("Waveform", List<IString>("Sine", "Rect", "None", "Counter", "Constant"), 0);
+    const auto waveformProp = SelectionProperty("Waveform", List<IString>("Sine", "Rect", "None", "Counter", "Constant", "Triangle", "Sawtooth"), 0);
     
     objPtr.addProperty(waveformProp);
     objPtr.getOnPropertyValueWrite("Waveform") +=
         [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { signalTypeChangedIfNotUpdating(args); };
 
     const auto freqProp = FloatPropertyBuilder("Frequency", 10.0)
-                              .setVisible(EvalValue("$Waveform < 2"))
+                              .setVisible(EvalValue("$Waveform < 2 || $Waveform > 4"))
                               .setUnit(Unit("Hz"))
                               .setMinValue(0.1)
                               .setMaxValue(10000.0)
@@ -95,14 +95,14 @@ void RefChannelImpl::initProperties()
         [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { waveformChanged(); };
 
     const auto dcProp =
-        FloatPropertyBuilder("DC", 0.0).setVisible(EvalValue("$Waveform < 3")).setUnit(Unit("V")).setMaxValue(10.0).setMinValue(-10.0).build();
+        FloatPropertyBuilder("DC", 0.0).setVisible(EvalValue("$Waveform < 3 || $Waveform > 4")).setUnit(Unit("V")).setMaxValue(10.0).setMinValue(-10.0).build();
     
 
     objPtr.addProperty(dcProp);
     objPtr.getOnPropertyValueWrite("DC") += [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { waveformChanged(); };
 
     const auto amplProp =
-        FloatPropertyBuilder("Amplitude", 5.0).setVisible(EvalValue("$Waveform < 2")).setUnit(Unit("V")).setMaxValue(10.0).setMinValue(0.0).build();
+        FloatPropertyBuilder("Amplitude", 5.0).setVisible(EvalValue("$Waveform < 2 || $Waveform > 4")).setUnit(Unit("V")).setMaxValue(10.0).setMinValue(0.0).build();
 
     objPtr.addProperty(amplProp);
     objPtr.getOnPropertyValueWrite("Amplitude") +=
@@ -110,7 +110,7 @@ void RefChannelImpl::initProperties()
 
     const auto noiseAmplProp = FloatPropertyBuilder("NoiseAmplitude", 0.0)
                                    .setUnit(Unit("V"))
-                                   .setVisible(EvalValue("$Waveform < 3"))
+                                   .setVisible(EvalValue("$Waveform < 3 || $Waveform > 4"))
                                    .setMinValue(0.0)
                                    .setMaxValue(10.0)
                                    .build();
@@ -396,40 +396,36 @@ std::tuple<PacketPtr, PacketPtr> RefChannelImpl::generateSamples(int64_t curTime
         else
             buffer = static_cast<double*>(dataPacket.getRawData());
 
+        const double phase = waveform::phaseAt(samplesGenerated, freq, sampleRate);
+        const double phaseIncrement = freq / sampleRate;
+
         switch(waveformType)
         {
             case WaveformType::Counter:
-            {
-                for (uint64_t i = 0; i < newSamples; i++)
-                    buffer[i] = static_cast<double>(counter++) / sampleRate;
+                counter = waveform::counter(buffer, newSamples, counter, sampleRate);
                 break;
-            }
             case WaveformType::Sine:
-            {
-                for (uint64_t i = 0; i < newSamples; i++)
-                    buffer[i] = std::sin(2.0 * PI * freq / sampleRate * static_cast<double>((samplesGenerated + i))) * ampl + dc + noiseAmpl * dist(re);
+                waveform::sine(buffer, newSamples, phase, phaseIncrement, ampl, dc);
                 break;
-            }
             case WaveformType::Rect:
-            {
-                for (uint64_t i = 0; i < newSamples; i++)
-                {
-                    double val = std::sin(2.0 * PI * freq / sampleRate * static_cast<double>((samplesGenerated + i)));
-                    val = val > 0 ? 1.0 : -1.0;
-                    buffer[i] = val * ampl + dc + noiseAmpl * dist(re);
-                }
+                waveform::square(buffer, newSamples, phase, phaseIncrement, ampl, dc);
+                break;
+            case WaveformType::Triangle:
+                waveform::triangle(buffer, newSamples, phase, phaseIncrement, ampl, dc);
+                break;
+            case WaveformType::Sawtooth:
+                waveform::sawtooth(buffer, newSamples, phase, phaseIncrement, ampl, dc);
                 break;
-            }
             case WaveformType::None:
-            {
-                for (uint64_t i = 0; i < newSamples; i++)
-                    buffer[i] = dc + noiseAmpl * dist(re);
+                waveform::constant(buffer, newSamples, dc);
                 break;
-            }
             case WaveformType::ConstantValue:
                 break;
         }
 
+        if (waveformType != WaveformType::Counter && noiseAmpl != 0.0)
+            noise.add(buffer, newSamples, noiseAmpl);
+
         if (clientSideScaling)
         {
             double f = std::pow(2, 24);
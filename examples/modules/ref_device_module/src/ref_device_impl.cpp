@@ -20,6 +20,8 @@
 #include <utility>
 #include <opendaq/thread_name.h>
 #include <opendaq/component_type_private.h>
+#include <opendaq/awaitable_ptr.h>
+#include <algorithm>
 
 #ifdef DAQMODULES_REF_DEVICE_MODULE_SIMULATOR_ENABLED
 #ifdef __linux__
@@ -43,8 +45,10 @@ RefDeviceImpl::RefDeviceImpl(const ModuleInfoPtr& moduleInfo,
     , id(id)
     , serialNumber(fmt::format("DevSer{}", id))
     , usePacketBuffer(false)
+    , mirroredPacketBuffer(false)
     , microSecondsFromEpochToDeviceStart(0)
     , acqLoopTime(0)
+    , acqWorkerCount(1)
     , stopAcq(false)
     , moduleInfo(moduleInfo)
     , logger(ctx.getLogger())
@@ -62,6 +66,9 @@ RefDeviceImpl::RefDeviceImpl(const ModuleInfoPtr& moduleInfo,
     if (config.assigned() && config.hasProperty("UsePacketBuffer"))
         usePacketBuffer = config.getPropertyValue("UsePacketBuffer");
 
+    if (config.assigned() && config.hasProperty("MirroredPacketBuffer"))
+        mirroredPacketBuffer = config.getPropertyValue("MirroredPacketBuffer");
+
     if (const auto options = this->context.getModuleOptions(REF_MODULE_NAME); options.assigned())
     {
         const StringPtr serialTemp = options.getOrDefault("SerialNumber");
@@ -79,6 +86,7 @@ RefDeviceImpl::RefDeviceImpl(const ModuleInfoPtr& moduleInfo,
     enableCANChannel();
     enableProtectedChannel();
     updateAcqLoopTime();
+    updateAcqWorkerCount();
     enableLogging();
 
     acqThread = std::thread{ &RefDeviceImpl::acqLoop, this };
@@ -122,6 +130,7 @@ DeviceTypePtr RefDeviceImpl::CreateType(const ModuleInfoPtr& moduleInfo)
     defaultConfig.addProperty(StringProperty("LoggingPath", "ref_device_simulator.log"));
     defaultConfig.addProperty(StringProperty("Name", ""));
     defaultConfig.addProperty(BoolProperty("UsePacketBuffer", False));
+    defaultConfig.addProperty(BoolProperty("MirroredPacketBuffer", False));
 
     auto deviceType = DeviceType("daqref",
                                  "Reference device",
@@ -260,26 +269,68 @@ void RefDeviceImpl::acqLoop()
             const auto curTime = getMicroSecondsSinceDeviceStart();
 
             collectTimeSignalSamples(curTime);
+            collectChannelSamples(curTime);
 
-            for (auto& ch : channels)
-            {
-                auto chPrivate = ch.asPtr<IRefChannel>();
-                chPrivate->collectSamples(curTime);
-            }
+            lastCollectTime = curTime;
+        }
+    }
+}
 
-            if (canChannel.assigned())
-            {
-                auto chPrivate = canChannel.asPtr<IRefChannel>();
-                chPrivate->collectSamples(curTime);
-            }
+void RefDeviceImpl::collectChannelSamples(std::chrono::microseconds curTime)
+{
+    std::vector<IRefChannel*> refChannels;
+    refChannels.reserve(channels.size() + 2);
+
+    for (auto& ch : channels)
+        refChannels.push_back(ch.asPtr<IRefChannel>());
 
-            if (protectedChannel.assigned())
+    if (canChannel.assigned())
+        refChannels.push_back(canChannel.asPtr<IRefChannel>());
+
+    if (protectedChannel.assigned())
+        refChannels.push_back(protectedChannel.asPtr<IRefChannel>());
+
+    const auto scheduler = this->context.getScheduler();
+    const size_t workerCount = std::min(acqWorkerCount, refChannels.size());
+
+    if (workerCount <= 1 || !scheduler.assigned())
+    {
+        for (const auto& ch : refChannels)
+            ch->collectSamples(curTime);
+        return;
+    }
+
+    // Channels are split into contiguous groups; the first group is processed on the acquisition
+    // thread, the rest on the context scheduler. All groups use the same curTime and the loop waits
+    // for every group to finish before the next iteration, so packet timestamps stay deterministic.
+    const size_t groupSize = (refChannels.size() + workerCount - 1) / workerCount;
+    std::vector<AwaitablePtr> awaitables;
+    awaitables.reserve(workerCount - 1);
+
+    for (size_t begin = groupSize; begin < refChannels.size(); begin += groupSize)
+    {
+        const size_t end = std::min(begin + groupSize, refChannels.size());
+        awaitables.push_back(scheduler.scheduleFunction(
+            [&refChannels, begin, end, curTime]() -> BaseObjectPtr
             {
-                auto chPrivate = protectedChannel.asPtr<IRefChannel>();
-                chPrivate->collectSamples(curTime);
-            }
+                for (size_t i = begin; i < end; ++i)
+                    refChannels[i]->collectSamples(curTime);
+                return nullptr;
+            }));
+    }
 
-            lastCollectTime = curTime;
+    for (size_t i = 0; i < groupSize; ++i)
+        refChannels[i]->collectSamples(curTime);
+
+    for (const auto& awaitable : awaitables)
+    {
+        try
+        {
+            awaitable.wait();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_W("Parallel sample collection failed: {}", e.what());
         }
     }
 }
@@ -341,6 +392,13 @@ void RefDeviceImpl::initProperties(const PropertyObjectPtr& config)
     objPtr.getOnPropertyValueWrite("AcquisitionLoopTime") +=
         [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { updateAcqLoopTime(); };
 
+    const auto acqWorkerCountPropInfo =
+        IntPropertyBuilder("AcquisitionWorkerCount", 1).setMinValue(1).setMaxValue(64).build();
+
+    objPtr.addProperty(acqWorkerCountPropInfo);
+    objPtr.getOnPropertyValueWrite("AcquisitionWorkerCount") +=
+        [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { updateAcqWorkerCount(); };
+
     objPtr.addProperty(BoolProperty("EnableCANChannel", enableCANChannel));
     objPtr.getOnPropertyValueWrite("EnableCANChannel") +=
         [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { this->enableCANChannel(); };
@@ -388,23 +446,34 @@ void RefDeviceImpl::updateNumberOfChannels()
     std::size_t num = objPtr.getPropertyValue("NumberOfChannels");
     LOG_I("Properties: NumberOfChannels {}", num);
 
-    if (num < channels.size())
+    // channels are reported to clients with a single core event
+    beginBulkConstruction();
+    try
     {
-        std::for_each(std::next(channels.begin(), num), channels.end(), [this](const ChannelPtr& ch)
-            {
-                removeChannel(nullptr, ch);
-            });
-        channels.erase(std::next(channels.begin(), num), channels.end());
-    }
+        if (num < channels.size())
+        {
+            std::for_each(std::next(channels.begin(), num), channels.end(), [this](const ChannelPtr& ch)
+                {
+                    removeChannel(nullptr, ch);
+                });
+            channels.erase(std::next(channels.begin(), num), channels.end());
+        }
 
-    auto microSecondsSinceDeviceStart = getMicroSecondsSinceDeviceStart();
-    for (auto i = channels.size(); i < num; i++)
+        auto microSecondsSinceDeviceStart = getMicroSecondsSinceDeviceStart();
+        for (auto i = channels.size(); i < num; i++)
+        {
+            RefChannelInit init{i, globalSampleRate, microSecondsSinceDeviceStart, microSecondsFromEpochToDeviceStart, localId, usePacketBuffer, mirroredPacketBuffer};
+            auto chLocalId = fmt::format("RefCh{}", i);
+            auto ch = createAndAddChannel<RefChannelImpl>(aiFolder, chLocalId, init);
+            channels.push_back(std::move(ch));
+        }
+    }
+    catch (...)
     {
-        RefChannelInit init{i, globalSampleRate, microSecondsSinceDeviceStart, microSecondsFromEpochToDeviceStart, localId, usePacketBuffer};
-        auto chLocalId = fmt::format("RefCh{}", i);
-        auto ch = createAndAddChannel<RefChannelImpl>(aiFolder, chLocalId, init);
-        channels.push_back(std::move(ch));
+        endBulkConstruction();
+        throw;
     }
+    endBulkConstruction();
 }
 
 void RefDeviceImpl::enableCANChannel()
@@ -443,7 +512,7 @@ void RefDeviceImpl::enableProtectedChannel()
         auto microSecondsSinceDeviceStart = getMicroSecondsSinceDeviceStart();
         size_t index = channels.size();
 
-        RefChannelInit init{index, globalSampleRate, microSecondsSinceDeviceStart, microSecondsFromEpochToDeviceStart, localId, usePacketBuffer};
+        RefChannelInit init{index, globalSampleRate, microSecondsSinceDeviceStart, microSecondsFromEpochToDeviceStart, localId, usePacketBuffer, mirroredPacketBuffer};
         const auto channelLocalId = "ProtectedChannel";
 
         auto permissions = PermissionsBuilder()
@@ -478,6 +547,14 @@ void RefDeviceImpl::updateAcqLoopTime()
     this->acqLoopTime = static_cast<size_t>(loopTime);
 }
 
+void RefDeviceImpl::updateAcqWorkerCount()
+{
+    Int workerCount = objPtr.getPropertyValue("AcquisitionWorkerCount");
+    LOG_I("Properties: AcquisitionWorkerCount {}", workerCount);
+
+    this->acqWorkerCount = static_cast<size_t>(workerCount);
+}
+
 void RefDeviceImpl::configureTimeSignal()
 {
     globalSampleRate = objPtr.getPropertyValue("GlobalSampleRate");
@@ -13,6 +13,7 @@
 #include <opendaq/reader_factory.h>
 #include <opendaq/removable_ptr.h>
 #include <opendaq/search_filter_factory.h>
+#include <opendaq/scheduler_factory.h>
 #include <ref_device_module/module_dll.h>
 #include <ref_device_module/version.h>
 #include <testutils/testutils.h>
@@ -296,6 +297,15 @@ TEST_F(RefDeviceModuleTest, GetAvailableComponentTypes)
     }
 }
 
+TEST_F(RefDeviceModuleTest, PacketBufferDefaultConfig)
+{
+    const auto module = CreateModule();
+
+    const auto config = module.getAvailableDeviceTypes().get("daqref").createDefaultConfig();
+    ASSERT_FALSE(config.getPropertyValue("UsePacketBuffer"));
+    ASSERT_FALSE(config.getPropertyValue("MirroredPacketBuffer"));
+}
+
 TEST_F(RefDeviceModuleTest, CreateFunctionBlockIdNull)
 {
     auto module = CreateModule();
@@ -351,6 +361,55 @@ TEST_F(RefDeviceModuleTest, DeviceChangeAcqLoopTime)
     ASSERT_EQ(acqLoopTime, 100);
 }
 
+TEST_F(RefDeviceModuleTest, DeviceChangeAcqWorkerCount)
+{
+    auto module = CreateModule();
+
+    auto device = module.createDevice("daqref://device1", nullptr);
+
+    Int acqWorkerCount = device.getPropertyValue("AcquisitionWorkerCount");
+    ASSERT_EQ(acqWorkerCount, 1);
+
+    device.setPropertyValue("AcquisitionWorkerCount", 4);
+    acqWorkerCount = device.getPropertyValue("AcquisitionWorkerCount");
+    ASSERT_EQ(acqWorkerCount, 4);
+}
+
+TEST_F(RefDeviceModuleTest, ReadChannelsWithParallelAcquisition)
+{
+    const auto logger = Logger();
+    const auto context = Context(Scheduler(logger, 4), logger, TypeManager(), nullptr);
+
+    ModulePtr module;
+    createModule(&module, context);
+
+    const auto device = module.createDevice("daqref://device1", nullptr);
+    device.setPropertyValue("NumberOfChannels", 8);
+    device.setPropertyValue("AcquisitionWorkerCount", 4);
+
+    std::vector<PacketReaderPtr> readers;
+    for (const auto& channel : device.getChannels())
+        readers.push_back(PacketReader(channel.getSignals()[0]));
+
+    ASSERT_EQ(readers.size(), 8u);
+
+    for (const auto& reader : readers)
+    {
+        DataPacketPtr dataPacket;
+        while (!dataPacket.assigned())
+        {
+            const auto packet = reader.read();
+            if (packet.assigned() && packet.getType() == PacketType::Data)
+                dataPacket = packet;
+            else
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        ASSERT_GT(dataPacket.getSampleCount(), 0u);
+        ASSERT_TRUE(dataPacket.getDomainPacket().assigned());
+    }
+}
+
 TEST_F(RefDeviceModuleTest, DeviceGlobalSampleRate)
 {
     auto module = CreateModule();
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <ref_fb_module/common.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+/*
+ * Headless, display-independent building blocks for reducing dense signals to a number of
+ * points proportional to the output resolution. Used by the renderer to bound the number of
+ * vertices it draws per frame and by the decimation function block to publish min/max envelopes.
+ */
+namespace Decimation
+{
+
+/*!
+ * @brief Min/max envelope of a contiguous block of samples.
+ */
+struct MinMaxBucket
+{
+    double min{std::numeric_limits<double>::max()};
+    double max{std::numeric_limits<double>::lowest()};
+    size_t count{};
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    void add(double value)
+    {
+        min = std::min(min, value);
+        max = std::max(max, value);
+        ++count;
+    }
+};
+
+/*!
+ * @brief Streaming per-pixel-column reduction of a polyline.
+ *
+ * Points are added in drawing order. All points that fall into the same integer x column are
+ * reduced to at most four: the first, the minimum and maximum (in the order they occurred) and
+ * the last. The reduced points are passed to a sink callable `sink(float x, float y)` whenever
+ * the column changes and on flush(). The visual result is identical to drawing every point,
+ * while the number of vertices is bounded by four times the width of the plot.
+ */
+class ColumnReducer
+{
+public:
+    template <typename Sink>
+    void add(float x, float y, Sink&& sink)
+    {
+        const auto col = static_cast<int64_t>(std::floor(x));
+        if (count > 0 && col != column)
+            emit(sink);
+
+        if (count == 0)
+        {
+            column = col;
+            first = {x, y, 0};
+            min = first;
+            max = first;
+        }
+        else
+        {
+            if (y < min.y)
+                min = {x, y, count};
+            if (y > max.y)
+                max = {x, y, count};
+        }
+
+        last = {x, y, count};
+        ++count;
+    }
+
+    template <typename Sink>
+    void flush(Sink&& sink)
+    {
+        if (count > 0)
+            emit(sink);
+    }
+
+    void reset()
+    {
+        count = 0;
+    }
+
+private:
+    struct Point
+    {
+        float x;
+        float y;
+        size_t seq;
+    };
+
+    template <typename Sink>
+    void emit(Sink& sink)
+    {
+        const Point& early = min.seq <= max.seq ? min : max;
+        const Point& late = min.seq <= max.seq ? max : min;
+
+        sink(first.x, first.y);
+        if (early.seq != first.seq && early.seq != last.seq)
+            sink(early.x, early.y);
+        if (late.seq != first.seq && late.seq != last.seq && late.seq != early.seq)
+            sink(late.x, late.y);
+        if (last.seq != first.seq)
+            sink(last.x, last.y);
+
+        count = 0;
+    }
+
+    int64_t column{};
+    size_t count{};
+    Point first{};
+    Point min{};
+    Point max{};
+    Point last{};
+};
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
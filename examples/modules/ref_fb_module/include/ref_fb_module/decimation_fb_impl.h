@@ -0,0 +1,89 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <ref_fb_module/common.h>
+#include <ref_fb_module/decimation.h>
+#include <opendaq/function_block_ptr.h>
+#include <opendaq/function_block_type_factory.h>
+#include <opendaq/function_block_impl.h>
+#include <opendaq/signal_config_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+#include <opendaq/event_packet_ptr.h>
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace Decimation
+{
+
+/*!
+ * @brief Reduces a signal to its min/max envelope.
+ *
+ * Every `BlockSize` consecutive input samples produce one sample on the "Min" and one on the
+ * "Max" output signal. The outputs share an implicit domain signal whose rate is the input rate
+ * divided by the block size, so the envelope of a fast signal can be streamed to and drawn by
+ * remote clients at a fraction of the bandwidth.
+ */
+class DecimationFbImpl final : public FunctionBlock
+{
+public:
+    explicit DecimationFbImpl(const ModuleInfoPtr& moduleInfo, const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId);
+    ~DecimationFbImpl() override = default;
+
+    static FunctionBlockTypePtr CreateType(const ModuleInfoPtr& moduleInfo);
+
+private:
+    InputPortPtr inputPort;
+
+    DataDescriptorPtr inputDataDescriptor;
+    DataDescriptorPtr inputDomainDataDescriptor;
+
+    DataDescriptorPtr outputMinDataDescriptor;
+    DataDescriptorPtr outputMaxDataDescriptor;
+    DataDescriptorPtr outputDomainDataDescriptor;
+
+    SignalConfigPtr minSignal;
+    SignalConfigPtr maxSignal;
+    SignalConfigPtr domainSignal;
+
+    SampleType inputSampleType;
+    Int inputDeltaTicks;
+    size_t blockSize;
+    bool valid;
+
+    MinMaxBucket pending;
+    Int pendingStart;
+    Int nextExpectedDomainValue;
+
+    void createInputPorts();
+    void createSignals();
+
+    template <SampleType InputSampleType>
+    void processDataPacket(const DataPacketPtr& packet);
+
+    void processEventPacket(const EventPacketPtr& packet);
+    void onPacketReceived(const InputPortPtr& port) override;
+
+    void configure();
+
+    void initProperties();
+    void propertyChanged();
+    void readProperties();
+};
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
@@ -22,6 +22,7 @@
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/sample_type_traits.h>
 #include <ref_fb_module/polyline.h>
+#include <ref_fb_module/decimation.h>
 
 #if defined(_MSC_VER)
     #pragma warning(push)
@@ -116,6 +117,9 @@ struct SignalContext
 
     bool lastValueSet;
     Float lastValue;
+
+    // reduces the points of each pixel column to first/min/max/last before they reach the polyline
+    Decimation::ColumnReducer columnReducer;
 };
 
 class RendererFbImpl final : public FunctionBlock
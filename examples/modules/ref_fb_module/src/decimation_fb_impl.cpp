@@ -0,0 +1,258 @@
+#include <ref_fb_module/decimation_fb_impl.h>
+#include <ref_fb_module/dispatch.h>
+#include <opendaq/input_port_factory.h>
+#include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/signal_factory.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/sample_type_traits.h>
+#include <opendaq/component_type_private.h>
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace Decimation
+{
+
+DecimationFbImpl::DecimationFbImpl(const ModuleInfoPtr& moduleInfo, const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId)
+    : FunctionBlock(CreateType(moduleInfo), ctx, parent, localId)
+    , inputSampleType(SampleType::Undefined)
+    , inputDeltaTicks(1)
+    , blockSize(1)
+    , valid(false)
+    , pendingStart(0)
+    , nextExpectedDomainValue(0)
+{
+    initComponentStatus();
+    createInputPorts();
+    createSignals();
+    initProperties();
+}
+
+FunctionBlockTypePtr DecimationFbImpl::CreateType(const ModuleInfoPtr& moduleInfo)
+{
+    auto fbType = FunctionBlockType("RefFBModuleDecimation", "Decimation", "Min/max envelope decimation");
+    checkErrorInfo(fbType.asPtr<IComponentTypePrivate>(true)->setModuleInfo(moduleInfo));
+    return fbType;
+}
+
+void DecimationFbImpl::initProperties()
+{
+    const auto blockSizeProp = IntPropertyBuilder("BlockSize", 1000).setMinValue(1).setMaxValue(10000000).build();
+    objPtr.addProperty(blockSizeProp);
+    objPtr.getOnPropertyValueWrite("BlockSize") +=
+        [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { propertyChanged(); };
+
+    readProperties();
+}
+
+void DecimationFbImpl::propertyChanged()
+{
+    readProperties();
+    configure();
+}
+
+void DecimationFbImpl::readProperties()
+{
+    blockSize = static_cast<size_t>(static_cast<Int>(objPtr.getPropertyValue("BlockSize")));
+}
+
+void DecimationFbImpl::configure()
+{
+    valid = false;
+    pending = {};
+
+    if (!inputDataDescriptor.assigned() || !inputDomainDataDescriptor.assigned())
+    {
+        setComponentStatusWithMessage(ComponentStatus::Warning, "Incomplete input signal descriptors");
+        return;
+    }
+
+    const auto domainSampleType = inputDomainDataDescriptor.getSampleType();
+    if (domainSampleType != SampleType::Int64 && domainSampleType != SampleType::UInt64)
+    {
+        setComponentStatusWithMessage(ComponentStatus::Warning,
+                                      fmt::format("Incompatible domain data sample type {}", convertSampleTypeToString(domainSampleType)));
+        return;
+    }
+
+    const auto domainRule = inputDomainDataDescriptor.getRule();
+    if (domainRule.getType() != DataRuleType::Linear)
+    {
+        setComponentStatusWithMessage(ComponentStatus::Warning, "Domain rule type is not Linear");
+        return;
+    }
+
+    if (inputDataDescriptor.getDimensions().getCount() > 0)
+    {
+        setComponentStatusWithMessage(ComponentStatus::Warning, "Arrays not supported");
+        return;
+    }
+
+    inputSampleType = inputDataDescriptor.getSampleType();
+    switch (inputSampleType)  // NOLINT(clang-diagnostic-switch-enum)
+    {
+        case SampleType::Float32:
+        case SampleType::Float64:
+        case SampleType::UInt8:
+        case SampleType::Int8:
+        case SampleType::UInt16:
+        case SampleType::Int16:
+        case SampleType::UInt32:
+        case SampleType::Int32:
+        case SampleType::UInt64:
+        case SampleType::Int64:
+            break;
+        default:
+            setComponentStatusWithMessage(ComponentStatus::Warning,
+                                          fmt::format("Incompatible input data sample type {}", convertSampleTypeToString(inputSampleType)));
+            return;
+    }
+
+    const auto domainRuleParams = domainRule.getParameters();
+    const Int start = domainRuleParams.get("start");
+    inputDeltaTicks = domainRuleParams.get("delta");
+
+    outputDomainDataDescriptor = DataDescriptorBuilderCopy(inputDomainDataDescriptor)
+                                     .setName("DecimationDomain")
+                                     .setRule(LinearDataRule(inputDeltaTicks * static_cast<Int>(blockSize), start))
+                                     .build();
+
+    const auto name = inputDataDescriptor.getName().assigned() ? inputDataDescriptor.getName().toStdString() : std::string("Value");
+    const auto outputBuilder = DataDescriptorBuilder().setSampleType(SampleType::Float64).setUnit(inputDataDescriptor.getUnit());
+    if (!inputDataDescriptor.getPostScaling().assigned())
+        outputBuilder.setValueRange(inputDataDescriptor.getValueRange());
+
+    outputMinDataDescriptor = outputBuilder.setName(name + "/Min").build();
+    outputMaxDataDescriptor = outputBuilder.setName(name + "/Max").build();
+
+    domainSignal.setDescriptor(outputDomainDataDescriptor);
+    minSignal.setDescriptor(outputMinDataDescriptor);
+    maxSignal.setDescriptor(outputMaxDataDescriptor);
+
+    valid = true;
+    setComponentStatus(ComponentStatus::Ok);
+}
+
+void DecimationFbImpl::onPacketReceived(const InputPortPtr& port)
+{
+    auto lock = this->getAcquisitionLock();
+
+    const auto connection = inputPort.getConnection();
+    if (!connection.assigned())
+        return;
+
+    PacketPtr packet = connection.dequeue();
+    while (packet.assigned())
+    {
+        switch (packet.getType())
+        {
+            case PacketType::Event:
+                processEventPacket(packet);
+                break;
+
+            case PacketType::Data:
+                if (valid)
+                    SAMPLE_TYPE_DISPATCH(inputSampleType, processDataPacket, packet);
+                break;
+
+            default:
+                break;
+        }
+
+        packet = connection.dequeue();
+    }
+}
+
+void DecimationFbImpl::processEventPacket(const EventPacketPtr& packet)
+{
+    if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+    {
+        const DataDescriptorPtr valueDescriptor = packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR);
+        const DataDescriptorPtr domainDescriptor = packet.getParameters().get(event_packet_param::DOMAIN_DATA_DESCRIPTOR);
+
+        if (valueDescriptor.assigned())
+            inputDataDescriptor = valueDescriptor;
+        if (domainDescriptor.assigned())
+            inputDomainDataDescriptor = domainDescriptor;
+
+        configure();
+    }
+}
+
+template <SampleType InputSampleType>
+void DecimationFbImpl::processDataPacket(const DataPacketPtr& packet)
+{
+    using InputType = typename SampleTypeToType<InputSampleType>::Type;
+
+    const auto domainPacket = packet.getDomainPacket();
+    if (!domainPacket.assigned())
+        return;
+
+    const auto sampleCount = packet.getSampleCount();
+    if (sampleCount == 0)
+        return;
+
+    const Int packetStart = domainPacket.getOffset();
+
+    // drop the partial block on a gap in the input domain
+    if (!pending.empty() && packetStart != nextExpectedDomainValue)
+        pending = {};
+
+    if (pending.empty())
+        pendingStart = packetStart;
+
+    nextExpectedDomainValue = packetStart + static_cast<Int>(sampleCount) * inputDeltaTicks;
+
+    const auto outSampleCount = (pending.count + sampleCount) / blockSize;
+    const auto data = static_cast<const InputType*>(packet.getData());
+
+    if (outSampleCount == 0)
+    {
+        for (size_t i = 0; i < sampleCount; ++i)
+            pending.add(static_cast<double>(data[i]));
+        return;
+    }
+
+    const auto outDomainPacket = DataPacket(outputDomainDataDescriptor, outSampleCount, pendingStart);
+    const auto minPacket = DataPacketWithDomain(outDomainPacket, outputMinDataDescriptor, outSampleCount);
+    const auto maxPacket = DataPacketWithDomain(outDomainPacket, outputMaxDataDescriptor, outSampleCount);
+    auto minData = static_cast<Float*>(minPacket.getRawData());
+    auto maxData = static_cast<Float*>(maxPacket.getRawData());
+
+    for (size_t i = 0; i < sampleCount; ++i)
+    {
+        pending.add(static_cast<double>(data[i]));
+        if (pending.count == blockSize)
+        {
+            *minData++ = pending.min;
+            *maxData++ = pending.max;
+            pending = {};
+        }
+    }
+
+    pendingStart = packetStart + static_cast<Int>(sampleCount - pending.count) * inputDeltaTicks;
+
+    domainSignal.sendPacket(outDomainPacket);
+    minSignal.sendPacket(minPacket);
+    maxSignal.sendPacket(maxPacket);
+}
+
+void DecimationFbImpl::createInputPorts()
+{
+    inputPort = createAndAddInputPort("Input", PacketReadyNotification::SchedulerQueueWasEmpty);
+}
+
+void DecimationFbImpl::createSignals()
+{
+    minSignal = createAndAddSignal("Min");
+    maxSignal = createAndAddSignal("Max");
+    domainSignal = createAndAddSignal("MinMaxDomain", nullptr, false);
+    minSignal.setDomainSignal(domainSignal);
+    maxSignal.setDomainSignal(domainSignal);
+}
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
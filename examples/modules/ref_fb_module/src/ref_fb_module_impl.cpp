@@ -16,6 +16,7 @@
 #include <ref_fb_module/struct_decoder_fb_impl.h>
 #include <ref_fb_module/time_delay_fb_impl.h>
 #include <ref_fb_module/sum_reader_fb_impl.h>
+#include <ref_fb_module/decimation_fb_impl.h>
 
 BEGIN_NAMESPACE_REF_FB_MODULE
 
@@ -77,6 +78,9 @@ DictPtr<IString, IFunctionBlockType> RefFBModule::onGetAvailableFunctionBlockTyp
     const auto timeScaler = TimeDelay::TimeDelayFbImpl::CreateType();
     types.set(timeScaler.getId(), timeScaler);
 
+    const auto typeDecimation = Decimation::DecimationFbImpl::CreateType(moduleInfo);
+    types.set(typeDecimation.getId(), typeDecimation);
+
     return types;
 }
 
@@ -147,6 +151,11 @@ FunctionBlockPtr RefFBModule::onCreateFunctionBlock(const StringPtr& id,
         FunctionBlockPtr fb = createWithImplementation<IFunctionBlock, TimeDelay::TimeDelayFbImpl>(context, parent, localId, config);
         return fb;
     }
+    if (id == Decimation::DecimationFbImpl::CreateType(moduleInfo).getId())
+    {
+        FunctionBlockPtr fb = createWithImplementation<IFunctionBlock, Decimation::DecimationFbImpl>(moduleInfo, context, parent, localId);
+        return fb;
+    }
 
     LOG_W("Function block \"{}\" not found", id);
     DAQ_THROW_EXCEPTION(NotFoundException, "Function block not found");
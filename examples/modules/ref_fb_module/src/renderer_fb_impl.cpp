@@ -388,6 +388,7 @@ void RendererFbImpl::renderPacketImplicitAndExplicit(
 
     if (gap)
     {
+        signalContext.columnReducer.flush([&line](float x, float y) { line->addPoint(x, y); });
         renderTarget.draw(*line);
         line = std::make_unique<Polyline>(lineThickness, LineStyle::solid);
         line->setColor(getColor(signalContext));
@@ -458,7 +459,7 @@ void RendererFbImpl::renderPacketImplicitAndExplicit(
         else if (yPos > signalContext.bottomRight.y)
             yPos = signalContext.bottomRight.y;
 
-        line->addPoint(xPos, yPos);
+        signalContext.columnReducer.add(xPos, yPos, [&line](float x, float y) { line->addPoint(x, y); });
         if (domainRuleType == DataRuleType::Linear)
             curDomainPacketValue -= delta;
         else
@@ -564,7 +565,7 @@ void RendererFbImpl::renderArrayPacketImplicitAndExplicit(
         else if (yPos > signalContext.bottomRight.y)
             yPos = signalContext.bottomRight.y;
 
-        line->addPoint(xPos, yPos);
+        signalContext.columnReducer.add(xPos, yPos, [&line](float x, float y) { line->addPoint(x, y); });
     }
 }
 
@@ -579,6 +580,7 @@ void RendererFbImpl::renderSignal(SignalContext& signalContext, sf::RenderTarget
 
     auto line = std::make_unique<Polyline>(lineThickness, LineStyle::solid);
     line->setColor(color);
+    signalContext.columnReducer.reset();
 
     typename SampleTypeToType<DomainTypeCast<DST>::DomainSampleType>::Type nextExpectedDomainPacketValue{};
     bool havePrevPacket = false;
@@ -601,6 +603,7 @@ void RendererFbImpl::renderSignal(SignalContext& signalContext, sf::RenderTarget
 
     signalContext.dataPackets.erase(packetIt, signalContext.dataPackets.end());
 
+    signalContext.columnReducer.flush([&line](float x, float y) { line->addPoint(x, y); });
     renderTarget.draw(*line);
 
     if (signalContext.lastValueSet && showLastValue)
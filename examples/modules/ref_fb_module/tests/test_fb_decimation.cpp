@@ -0,0 +1,136 @@
+#include <opendaq/context_factory.h>
+#include <ref_fb_module/module_dll.h>
+#include <ref_fb_module/decimation.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/signal_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/input_port_factory.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <testutils/memcheck_listener.h>
+
+using namespace daq;
+using namespace daq::modules::ref_fb_module;
+
+using DecimationFbTest = testing::Test;
+
+static ModulePtr createModule(const ContextPtr& context)
+{
+    ModulePtr module;
+    createModule(&module, context);
+    return module;
+}
+
+static DataDescriptorPtr CreateTimeDescriptor()
+{
+    return DataDescriptorBuilder().setSampleType(SampleType::Int64)
+                                  .setRule(LinearDataRule(1, 0))
+                                  .setTickResolution(Ratio(1, 1000))
+                                  .setUnit(Unit("s", -1, "seconds", "time"))
+                                  .setOrigin("1970-01-01T00:00:00")
+                                  .build();
+}
+
+static DataPacketPtr DequeueDataPacket(const ConnectionPtr& connection)
+{
+    DataPacketPtr outputPacket;
+    int timeout = 100;
+    while (timeout-- && !outputPacket.assigned())
+    {
+        const auto packet = connection.dequeue();
+        if (!packet.assigned())
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        else
+            outputPacket = packet.asPtrOrNull<IDataPacket>();
+    }
+    return outputPacket;
+}
+
+TEST_F(DecimationFbTest, Create)
+{
+    const auto module = createModule(NullContext());
+
+    FunctionBlockPtr fb;
+    ASSERT_NO_THROW(fb = module.createFunctionBlock("RefFBModuleDecimation", nullptr, "id"));
+    ASSERT_TRUE(fb.assigned());
+
+    ASSERT_EQ(fb.getPropertyValue("BlockSize"), 1000);
+    ASSERT_EQ(fb.getInputPorts().getCount(), 1u);
+    ASSERT_EQ(fb.getSignals().getCount(), 2u);
+}
+
+TEST_F(DecimationFbTest, MinMaxEnvelope)
+{
+    const auto ctx = NullContext();
+    const auto module = createModule(ctx);
+
+    auto fb = module.createFunctionBlock("RefFBModuleDecimation", nullptr, "id");
+    fb.setPropertyValue("BlockSize", 4);
+
+    const auto dataSignal = SignalWithDescriptor(ctx, DataDescriptorBuilder().setSampleType(SampleType::Float64).build(), nullptr, "signal");
+    const auto domainSignal = SignalWithDescriptor(ctx, CreateTimeDescriptor(), nullptr, "time");
+    dataSignal.setDomainSignal(domainSignal);
+    fb.getInputPorts()[0].connect(dataSignal);
+
+    const auto minPort = InputPort(ctx, nullptr, "min");
+    const auto maxPort = InputPort(ctx, nullptr, "max");
+    minPort.connect(fb.getSignals()[0]);
+    maxPort.connect(fb.getSignals()[1]);
+
+    const auto sendPacket = [&](size_t sampleCount, Int offset)
+    {
+        const auto domainPacket = DataPacket(domainSignal.getDescriptor(), sampleCount, offset);
+        const auto dataPacket = DataPacketWithDomain(domainPacket, dataSignal.getDescriptor(), sampleCount);
+        auto data = static_cast<double*>(dataPacket.getRawData());
+        for (size_t i = 0; i < sampleCount; ++i)
+            data[i] = static_cast<double>(offset + static_cast<Int>(i)) * (i % 2 ? -1.0 : 1.0);
+
+        domainSignal.sendPacket(domainPacket);
+        dataSignal.sendPacket(dataPacket);
+    };
+
+    sendPacket(10, 0);
+
+    auto minPacket = DequeueDataPacket(minPort.getConnection());
+    auto maxPacket = DequeueDataPacket(maxPort.getConnection());
+    ASSERT_TRUE(minPacket.assigned());
+    ASSERT_TRUE(maxPacket.assigned());
+    ASSERT_EQ(minPacket.getSampleCount(), 2u);
+    ASSERT_EQ(minPacket.getDomainPacket().getOffset(), 0);
+    ASSERT_EQ(minPacket.getDomainPacket().getDataDescriptor().getRule().getParameters().get("delta"), 4);
+
+    // 0, -1, 2, -3 | 4, -5, 6, -7 | 8, -9
+    auto minData = static_cast<double*>(minPacket.getData());
+    auto maxData = static_cast<double*>(maxPacket.getData());
+    ASSERT_DOUBLE_EQ(minData[0], -3.0);
+    ASSERT_DOUBLE_EQ(maxData[0], 2.0);
+    ASSERT_DOUBLE_EQ(minData[1], -7.0);
+    ASSERT_DOUBLE_EQ(maxData[1], 6.0);
+
+    // 8, -9, 10, -11 completes the pending block
+    sendPacket(4, 10);
+
+    minPacket = DequeueDataPacket(minPort.getConnection());
+    maxPacket = DequeueDataPacket(maxPort.getConnection());
+    ASSERT_TRUE(minPacket.assigned());
+    ASSERT_EQ(minPacket.getSampleCount(), 1u);
+    ASSERT_EQ(minPacket.getDomainPacket().getOffset(), 8);
+    ASSERT_DOUBLE_EQ(static_cast<double*>(minPacket.getData())[0], -11.0);
+    ASSERT_DOUBLE_EQ(static_cast<double*>(maxPacket.getData())[0], 10.0);
+}
+
+TEST_F(DecimationFbTest, ColumnReducerBoundsPoints)
+{
+    std::vector<std::pair<float, float>> points;
+    const auto sink = [&points](float x, float y) { points.emplace_back(x, y); };
+
+    Decimation::ColumnReducer reducer;
+    for (int i = 0; i < 10000; ++i)
+        reducer.add(static_cast<float>(i) / 1000.0f, i == 4321 ? 100.0f : static_cast<float>(i % 3), sink);
+    reducer.flush(sink);
+
+    ASSERT_LE(points.size(), 40u);
+    ASSERT_NE(std::find(points.begin(), points.end(), std::make_pair(4.321f, 100.0f)), points.end());
+}
@@ -155,7 +155,7 @@ TEST_F(RefFbModuleTest, GetAvailableComponentTypes)
     ASSERT_NO_THROW(functionBlockTypes = module.getAvailableFunctionBlockTypes());
     ASSERT_TRUE(functionBlockTypes.assigned());
 
-    ASSERT_EQ(functionBlockTypes.getCount(), 12u);
+    ASSERT_EQ(functionBlockTypes.getCount(), 13u);
 
     ASSERT_TRUE(functionBlockTypes.hasKey("RefFBModuleRenderer"));
     ASSERT_EQ("RefFBModuleRenderer", functionBlockTypes.get("RefFBModuleRenderer").getId());
@@ -190,6 +190,9 @@ TEST_F(RefFbModuleTest, GetAvailableComponentTypes)
     ASSERT_TRUE(functionBlockTypes.hasKey("RefFBModuleTimeDelay"));
     ASSERT_EQ("RefFBModuleTimeDelay", functionBlockTypes.get("RefFBModuleTimeDelay").getId());
 
+    ASSERT_TRUE(functionBlockTypes.hasKey("RefFBModuleDecimation"));
+    ASSERT_EQ("RefFBModuleDecimation", functionBlockTypes.get("RefFBModuleDecimation").getId());
+
     // Check module info for module
     ModuleInfoPtr moduleInfo;
     ASSERT_NO_THROW(moduleInfo = module.getModuleInfo());
@@ -46,6 +46,7 @@ private:
     DeviceTypePtr createPseudoDeviceType();
     DeviceTypePtr createDeviceType();
     StreamingTypePtr createStreamingType();
+    StreamingTypePtr createSharedMemoryStreamingType();
 
     static bool ConnectionStringHasPrefix(const StringPtr& connectionString, const char* prefix);
     static bool ValidateConnectionString(const StringPtr& connectionString);
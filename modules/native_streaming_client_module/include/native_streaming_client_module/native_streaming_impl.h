@@ -25,6 +25,8 @@ BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_CLIENT_MODULE
 
 static const char* NativeStreamingPrefix = "daq.ns";
 static const char* NativeStreamingID = "OpenDAQNativeStreaming";
+static const char* NativeStreamingSharedMemoryPrefix = "daq.shm";
+static const char* NativeStreamingSharedMemoryTypeId = "OpenDAQNativeStreamingSharedMemory";
 
 DECLARE_OPENDAQ_INTERFACE(INativeStreamingPrivate, IBaseObject)
 {
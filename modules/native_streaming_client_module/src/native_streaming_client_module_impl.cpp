@@ -41,6 +41,7 @@ NativeStreamingClientModule::NativeStreamingClientModule(ContextPtr context)
     transportClientUuidBase = boost::uuids::to_string(uuidBoost);
 
     discoveryClient.initMdnsClient(List<IString>("_opendaq-streaming-native._tcp.local."));
+    discoveryClient.setDiscoveryCache(this->context.getDiscoveryCache());
 }
 
 NativeStreamingClientModule::~NativeStreamingClientModule()
@@ -143,6 +144,9 @@ DictPtr<IString, IStreamingType> NativeStreamingClientModule::onGetAvailableStre
     auto streamingType = createStreamingType();
     result.set(streamingType.getId(), streamingType);
 
+    auto sharedMemoryStreamingType = createSharedMemoryStreamingType();
+    result.set(sharedMemoryStreamingType.getId(), sharedMemoryStreamingType);
+
     return result;
 }
 
@@ -427,6 +431,8 @@ PropertyObjectPtr NativeStreamingClientModule::createTransportLayerDefaultConfig
     transportLayerConfig.addProperty(daq::IntProperty("ConnectionTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("StreamingInitTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("ReconnectionPeriod", 1000));
+    transportLayerConfig.addProperty(daq::BoolProperty("SharedMemoryEnabled", daq::False));
+    transportLayerConfig.addProperty(daq::BoolProperty("PayloadCompressionEnabled", daq::False));
 
     daq::ClientTypeTools::DefineConfigProperties(transportLayerConfig);
 
@@ -486,7 +492,9 @@ bool NativeStreamingClientModule::acceptsStreamingConnectionParameters(const Str
 {
     if (connectionString.assigned() && connectionString != "")
     {
-        return ConnectionStringHasPrefix(connectionString, NativeStreamingPrefix) && ValidateConnectionString(connectionString);
+        return (ConnectionStringHasPrefix(connectionString, NativeStreamingPrefix) ||
+                ConnectionStringHasPrefix(connectionString, NativeStreamingSharedMemoryPrefix)) &&
+               ValidateConnectionString(connectionString);
     }
     return false;
 }
@@ -618,6 +626,10 @@ StreamingPtr NativeStreamingClientModule::onCreateStreaming(const StringPtr& con
     PropertyObjectPtr transportLayerConfig = parsedConfig.getPropertyValue("TransportLayerConfig");
     Int initTimeout = transportLayerConfig.getPropertyValue("StreamingInitTimeout");
 
+    // the connection itself stays on TCP; data packet payloads move to shared memory if the server is on this host
+    if (ConnectionStringHasPrefix(connectionString, NativeStreamingSharedMemoryPrefix))
+        transportLayerConfig.setPropertyValue("SharedMemoryEnabled", True);
+
     auto transportClient = createAndConnectTransportClient(host, port, path, parsedConfig);
     return createNativeStreaming(connectionString, transportClient, initTimeout);
 }
@@ -731,6 +743,17 @@ StreamingTypePtr NativeStreamingClientModule::createStreamingType()
         .build();
 }
 
+StreamingTypePtr NativeStreamingClientModule::createSharedMemoryStreamingType()
+{
+    return StreamingTypeBuilder()
+        .setId(NativeStreamingSharedMemoryTypeId)
+        .setName("NativeStreamingSharedMemory")
+        .setDescription("openDAQ native streaming protocol client exchanging data through shared memory with a server on the same host")
+        .setConnectionStringPrefix(NativeStreamingSharedMemoryPrefix)
+        .setDefaultConfig(NativeStreamingClientModule::createConnectionDefaultConfig(NativeType::streaming))
+        .build();
+}
+
 bool NativeStreamingClientModule::validateTransportLayerConfig(const PropertyObjectPtr& config)
 {
     return config.hasProperty("MonitoringEnabled") &&
@@ -77,6 +77,13 @@ TEST_F(NativeStreamingClientModuleTest, CreateDeviceConnectionFailed)
     ASSERT_THROW(module.createDevice("daq.nd://127.0.0.1", nullptr), NotFoundException);
 }
 
+TEST_F(NativeStreamingClientModuleTest, CreateSharedMemoryStreamingConnectionFailed)
+{
+    auto module = CreateModule();
+
+    ASSERT_THROW(module.createStreaming("daq.shm://127.0.0.1", nullptr), NotFoundException);
+}
+
 TEST_F(NativeStreamingClientModuleTest, CreateStreamingWithNullArguments)
 {
     auto module = CreateModule();
@@ -245,6 +252,7 @@ INSTANTIATE_TEST_SUITE_P(
         "daq.opcua://devicett3axxr1"
         "daq.ns://",
         "daq.ns:///",
+        "daq.shm://",
         "daq.opcua://[::1]"
     )
 );
@@ -22,6 +22,7 @@
 #include <opendaq/server_impl.h>
 #include <coretypes/intfs.h>
 #include <native_streaming_protocol/native_streaming_server_handler.h>
+#include <config_protocol/config_server_signal_overviews.h>
 #include <opendaq/connection_internal.h>
 #include <tsl/ordered_map.h>
 
@@ -45,6 +46,8 @@ protected:
     void prepareServerHandler();
 
     std::shared_ptr<opendaq_native_streaming_protocol::NativeStreamingServerHandler> serverHandler;
+    // shared by the configuration connections so the overview history survives reconnections
+    config_protocol::ConfigServerSignalOverviewsPtr signalOverviews;
 
     void startReading();
     void stopReading();
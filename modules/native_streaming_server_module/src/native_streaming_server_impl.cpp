@@ -26,6 +26,7 @@ using namespace config_protocol;
 
 static constexpr size_t DEFAULT_MAX_PACKET_READ_COUNT = 5000;
 static constexpr size_t DEFAULT_POLLING_PERIOD = 20;
+static constexpr size_t DEFAULT_MAX_SIGNAL_OVERVIEWS = ConfigServerSignalOverviews::DefaultMaxReaders;
 
 NativeStreamingServerImpl::NativeStreamingServerImpl(const DevicePtr& rootDevice,
                                                      const PropertyObjectPtr& config,
@@ -116,14 +117,21 @@ void NativeStreamingServerImpl::addSignalsOfComponent(ComponentPtr& component)
 
 void NativeStreamingServerImpl::componentAdded(ComponentPtr& /*sender*/, CoreEventArgsPtr& eventArgs)
 {
-    ComponentPtr addedComponent = eventArgs.getParameters().get("Component");
+    ListPtr<IComponent> addedComponents;
+    if (eventArgs.getEventId() == static_cast<Int>(CoreEventId::ComponentsAdded))
+        addedComponents = eventArgs.getParameters().get("Components");
+    else
+        addedComponents = List<IComponent>(ComponentPtr(eventArgs.getParameters().get("Component")));
 
-    auto addedComponentGlobalId = addedComponent.getGlobalId().toStdString();
-    if (addedComponentGlobalId.find(rootDeviceGlobalId) != 0)
-        return;
+    for (ComponentPtr addedComponent : addedComponents)
+    {
+        auto addedComponentGlobalId = addedComponent.getGlobalId().toStdString();
+        if (addedComponentGlobalId.find(rootDeviceGlobalId) != 0)
+            continue;
 
-    LOG_I("Added Component: {};", addedComponentGlobalId);
-    addSignalsOfComponent(addedComponent);
+        LOG_I("Added Component: {};", addedComponentGlobalId);
+        addSignalsOfComponent(addedComponent);
+    }
 }
 
 void NativeStreamingServerImpl::componentRemoved(ComponentPtr& sender, CoreEventArgsPtr& eventArgs)
@@ -137,6 +145,7 @@ void NativeStreamingServerImpl::componentRemoved(ComponentPtr& sender, CoreEvent
 
     LOG_I("Component: {}; is removed", removedComponentGlobalId);
     serverHandler->removeComponentSignals(removedComponentGlobalId);
+    signalOverviews->removeComponentSignals(removedComponentGlobalId);
 }
 
 void NativeStreamingServerImpl::componentUpdated(ComponentPtr& updatedComponent)
@@ -149,6 +158,7 @@ void NativeStreamingServerImpl::componentUpdated(ComponentPtr& updatedComponent)
 
     // remove all registered signal of updated component since those might be modified or removed
     serverHandler->removeComponentSignals(updatedComponentGlobalId);
+    signalOverviews->removeComponentSignals(updatedComponentGlobalId);
 
     // add updated versions of signals
     addSignalsOfComponent(updatedComponent);
@@ -159,6 +169,7 @@ void NativeStreamingServerImpl::coreEventCallback(ComponentPtr& sender, CoreEven
     switch (static_cast<CoreEventId>(eventArgs.getEventId()))
     {
         case CoreEventId::ComponentAdded:
+        case CoreEventId::ComponentsAdded:
             componentAdded(sender, eventArgs);
             break;
         case CoreEventId::ComponentRemoved:
@@ -299,7 +310,7 @@ void NativeStreamingServerImpl::prepareServerHandler()
 
         if (const DevicePtr rootDevice = this->rootDeviceRef.assigned() ? this->rootDeviceRef.getRef() : nullptr; rootDevice.assigned())
         {
-            auto configServer = std::make_shared<ConfigProtocolServer>(rootDevice, sendConfigPacketCb, user, connectionType, this->signals);
+            auto configServer = std::make_shared<ConfigProtocolServer>(rootDevice, sendConfigPacketCb, user, connectionType, this->signals, signalOverviews);
             processConfigRequestCb =
                 [this, configServer, sendConfigPacketCb](PacketBuffer&& packetBuffer)
             {
@@ -353,6 +364,8 @@ void NativeStreamingServerImpl::prepareServerHandler()
     if (const DevicePtr rootDevice = this->rootDeviceRef.assigned() ? this->rootDeviceRef.getRef() : nullptr; rootDevice.assigned())
         rootDeviceSignals = rootDevice.getSignals(search::Recursive(search::Any()));
 
+    signalOverviews = std::make_shared<ConfigServerSignalOverviews>(static_cast<SizeT>(config.getPropertyValue("MaxSignalOverviews")));
+
     auto clientConnectedHandler = [this](const std::string& clientId, const std::string& address, bool isStreamingConnection, ClientType clientType, const std::string& hostName)
     {
         SizeT clientNumber = 0;
@@ -441,6 +454,16 @@ PropertyObjectPtr NativeStreamingServerImpl::createDefaultConfig(const ContextPt
                                                 .build();
     defaultConfig.addProperty(maxPacketReadCountProp);
 
+    const auto maxSignalOverviewsProp = IntPropertyBuilder("MaxSignalOverviews", DEFAULT_MAX_SIGNAL_OVERVIEWS)
+                                            .setMinValue(0)
+                                            .setDescription("Maximum number of signals for which min/max/mean overviews "
+                                                            "are kept for configuration clients. The history of a signal is "
+                                                            "recorded from the first overview request for it; when the limit "
+                                                            "is reached, the signal requested least recently is dropped. "
+                                                            "Overviews are disabled if set to 0.")
+                                            .build();
+    defaultConfig.addProperty(maxSignalOverviewsProp);
+
     populateDefaultConfigFromProvider(context, defaultConfig);
     return defaultConfig;
 }
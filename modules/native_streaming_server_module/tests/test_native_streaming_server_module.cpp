@@ -164,6 +164,15 @@ TEST_F(NativeStreamingServerModuleTest, ServerConfig)
 
     ASSERT_TRUE(config.hasProperty("StreamingPacketReleaseThreshold"));
     ASSERT_EQ(config.getPropertyValue("StreamingPacketReleaseThreshold"), 10);
+
+    ASSERT_TRUE(config.hasProperty("StreamingFlowControlQueueSize"));
+    ASSERT_EQ(config.getPropertyValue("StreamingFlowControlQueueSize"), 0);
+
+    ASSERT_TRUE(config.hasProperty("StreamingFlowControlDecimation"));
+    ASSERT_EQ(config.getPropertyValue("StreamingFlowControlDecimation"), 10);
+
+    ASSERT_TRUE(config.hasProperty("MaxSignalOverviews"));
+    ASSERT_EQ(config.getPropertyValue("MaxSignalOverviews"), 16);
 }
 
 TEST_F(NativeStreamingServerModuleTest, CreateServer)
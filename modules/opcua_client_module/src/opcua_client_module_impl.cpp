@@ -36,6 +36,7 @@ OpcUaClientModule::OpcUaClientModule(ContextPtr context)
 {
     loggerComponent = this->context.getLogger().getOrAddComponent("OPCUAClient");
     discoveryClient.initMdnsClient(List<IString>("_opcua-tcp._tcp.local."));
+    discoveryClient.setDiscoveryCache(this->context.getDiscoveryCache());
 }
 
 ListPtr<IDeviceInfo> OpcUaClientModule::onGetAvailableDevices()
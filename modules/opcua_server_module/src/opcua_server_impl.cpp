@@ -21,6 +21,14 @@ OpcUaServerImpl::OpcUaServerImpl(const DevicePtr& rootDevice,
 
     server.setOpcUaPort(port);
     server.setOpcUaPath(config.getPropertyValue("Path"));
+
+    tms::TmsServerHistoryConfig historyConfig;
+    if (config.hasProperty("HistoryDepth"))
+        historyConfig.depth = static_cast<Int>(config.getPropertyValue("HistoryDepth"));
+    if (config.hasProperty("HistoryDecimation"))
+        historyConfig.decimation = static_cast<Int>(config.getPropertyValue("HistoryDecimation"));
+    server.setHistoryConfig(historyConfig);
+
     server.start();
 }
 
@@ -60,6 +68,17 @@ PropertyObjectPtr OpcUaServerImpl::createDefaultConfig(const ContextPtr& context
 
     defaultConfig.addProperty(StringProperty("Path", "/"));
 
+    // Number of samples of every numeric signal kept for OPC UA history reads; 0 disables the history.
+    const auto historyDepthProp = IntPropertyBuilder("HistoryDepth", 0)
+        .setMinValue(0)
+        .build();
+    defaultConfig.addProperty(historyDepthProp);
+
+    const auto historyDecimationProp = IntPropertyBuilder("HistoryDecimation", 1)
+        .setMinValue(1)
+        .build();
+    defaultConfig.addProperty(historyDecimationProp);
+
     populateDefaultConfigFromProvider(context, defaultConfig);
     return defaultConfig;
 }
@@ -158,6 +158,11 @@ TEST_F(OpcUaServerModuleTest, ServerConfig)
 
     ASSERT_TRUE(config.hasProperty("Port"));
     ASSERT_EQ(config.getPropertyValue("Port"), 4840);
+
+    ASSERT_TRUE(config.hasProperty("HistoryDepth"));
+    ASSERT_EQ(config.getPropertyValue("HistoryDepth"), 0);
+    ASSERT_TRUE(config.hasProperty("HistoryDecimation"));
+    ASSERT_EQ(config.getPropertyValue("HistoryDecimation"), 1);
 }
 
 TEST_F(OpcUaServerModuleTest, CreateServer)
@@ -33,6 +33,7 @@ WebsocketStreamingClientModule::WebsocketStreamingClientModule(ContextPtr contex
     )
 {
     discoveryClient.initMdnsClient(List<IString>("_streaming-lt._tcp.local.", "_streaming-ws._tcp.local."));
+    discoveryClient.setDiscoveryCache(this->context.getDiscoveryCache());
     loggerComponent = this->context.getLogger().getOrAddComponent("StreamingLTClient");
 }
 
@@ -18,6 +18,7 @@
 #include <config_protocol/config_client_property_object_impl.h>
 #include <opendaq/component_impl.h>
 #include <opendaq/component_status_container_private_ptr.h>
+#include <opendaq/core_opendaq_event_args_factory.h>
 #include <config_protocol/config_protocol_deserialize_context.h>
 
 namespace daq::config_protocol
@@ -64,6 +65,7 @@ private:
     void attributeChanged(const CoreEventArgsPtr& args);
     void tagsChanged(const CoreEventArgsPtr& args);
     void statusChanged(const CoreEventArgsPtr& args);
+    void componentsAdded(const CoreEventArgsPtr& args);
 };
 
 template <class Impl>
@@ -212,6 +214,9 @@ void ConfigClientComponentBaseImpl<Impl>::handleRemoteCoreObjectInternal(const C
         case CoreEventId::StatusChanged:
             statusChanged(args);
             break;
+        case CoreEventId::ComponentsAdded:
+            componentsAdded(args);
+            break;
         case CoreEventId::PropertyValueChanged:
         case CoreEventId::PropertyObjectUpdateEnd:
         case CoreEventId::PropertyAdded:
@@ -373,4 +378,20 @@ void ConfigClientComponentBaseImpl<Impl>::statusChanged(const CoreEventArgsPtr&
     }
 }
 
+template <class Impl>
+void ConfigClientComponentBaseImpl<Impl>::componentsAdded(const CoreEventArgsPtr& args)
+{
+    // Each added component is handled by its parent as if it was added separately
+    const ListPtr<IComponent> components = args.getParameters().get("Components");
+    for (const auto& comp : components)
+    {
+        const auto parent = comp.getParent();
+        if (!parent.assigned())
+            continue;
+
+        const auto componentAddedArgs = CoreEventArgsComponentAdded(comp);
+        parent.template asPtr<IConfigClientObject>(true)->handleRemoteCoreEvent(parent, componentAddedArgs);
+    }
+}
+
 }
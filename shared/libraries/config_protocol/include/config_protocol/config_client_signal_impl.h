@@ -24,6 +24,11 @@ namespace daq::config_protocol
 DECLARE_OPENDAQ_INTERFACE(IConfigClientSignalPrivate, IBaseObject)
 {
     virtual void INTERFACE_FUNC assignDomainSignal(const SignalPtr& domainSignal) = 0;
+
+    // Gets the min/max/mean overview of the signal history in the domain range [start, end), divided into at most
+    // `count` points. The dictionary holds the lists under the "Min", "Max", "Mean" and "Domain" keys. The server
+    // records the history of a signal from the first overview request for it, so the first call returns no points.
+    virtual ErrCode INTERFACE_FUNC getOverview(Int start, Int end, SizeT count, IDict** overview) = 0;
 };
 
 class ConfigClientSignalImpl : public ConfigClientComponentBaseImpl<MirroredSignalBase<IConfigClientObject, IConfigClientSignalPrivate>>
@@ -40,6 +45,7 @@ public:
 
     // IConfigClientSignalPrivate
     void INTERFACE_FUNC assignDomainSignal(const SignalPtr& domainSignal) override;
+    ErrCode INTERFACE_FUNC getOverview(Int start, Int end, SizeT count, IDict** overview) override;
     ErrCode INTERFACE_FUNC getLastValue(IBaseObject** value) override;
 
     StringPtr onGetRemoteId() const override;
@@ -185,6 +191,18 @@ inline ErrCode ConfigClientSignalImpl::getLastValue(IBaseObject** value)
     return errCode;
 }
 
+inline ErrCode ConfigClientSignalImpl::getOverview(Int start, Int end, SizeT count, IDict** overview)
+{
+    OPENDAQ_PARAM_NOT_NULL(overview);
+
+    const ErrCode errCode = daqTry([&]()
+    {
+        *overview = this->clientComm->getSignalOverview(this->remoteGlobalId, start, end, count).detach();
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode, "Failed to get overview for signal with remote ID: %s", this->remoteGlobalId.c_str());
+    return errCode;
+}
+
 inline void ConfigClientSignalImpl::attributeChanged(const CoreEventArgsPtr& args)
 {
     const std::string attrName = args.getParameters().get("AttributeName");
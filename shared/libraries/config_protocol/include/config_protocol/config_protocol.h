@@ -22,6 +22,8 @@
 #include <coretypes/string_ptr.h>
 #include <coretypes/dictobject_factory.h>
 #include <coretypes/baseobject_factory.h>
+#include <coretypes/serializer_sink.h>
+#include <coretypes/intfs.h>
 #include <coreobjects/user_ptr.h>
 #include <opendaq/client_type.h>
 #include <set>
@@ -70,8 +72,9 @@ using DeleterCallback = std::function<void(void*)>;
 
 class PacketBuffer
 {
-    static constexpr size_t MAX_PACKET_BUFFER_SIZE = 0x0FFFFFFF; // limitation of transport layer
 public:
+    static constexpr size_t MAX_PACKET_BUFFER_SIZE = 0x0FFFFFFF; // limitation of transport layer
+
     PacketBuffer();
     PacketBuffer(const PacketBuffer&) = delete;
     PacketBuffer(PacketBuffer&& packetBuffer) noexcept;
@@ -91,6 +94,7 @@ public:
     void reset();
 
     static PacketHeader* allocateHeaderAndPayload(size_t payloadSize);
+    static PacketHeader* reallocateHeaderAndPayload(PacketHeader* mem, size_t payloadSize);
     static void deallocateMem(void* mem);
 
     void* getBuffer() const;
@@ -142,6 +146,30 @@ private:
     DeleterCallback deleterCallback;
 };
 
+// Serializer sink that writes the payload of a packet directly into a growable packet buffer, so a serialized
+// reply is not held in a separate string before being copied into the packet.
+class PacketBufferSinkImpl : public ImplementationOf<ISerializerSink>
+{
+public:
+    static constexpr size_t MAX_PAYLOAD_SIZE = PacketBuffer::MAX_PACKET_BUFFER_SIZE - sizeof(PacketHeader);
+
+    PacketBufferSinkImpl();
+    ~PacketBufferSinkImpl() override;
+
+    ErrCode INTERFACE_FUNC write(ConstCharPtr data, SizeT length) override;
+    ErrCode INTERFACE_FUNC flush() override;
+
+    // Hands the payload written so far over to a packet buffer and leaves the sink empty.
+    PacketBuffer detachPacketBuffer(PacketType packetType, uint64_t id);
+
+private:
+    static constexpr size_t INITIAL_PAYLOAD_CAPACITY = 4096;
+
+    PacketHeader* buffer;
+    size_t payloadSize;
+    size_t payloadCapacity;
+};
+
 class ConfigProtocolException : public std::runtime_error
 {
 public:
@@ -188,12 +216,12 @@ inline std::set<uint16_t> createListOfSupportedVersions(uint16_t maxVersion)
 
 inline std::set<uint16_t> GetSupportedConfigProtocolVersions()
 {
-    return createListOfSupportedVersions(18);
+    return createListOfSupportedVersions(20);
 }
 
 inline constexpr uint16_t GetLatestConfigProtocolVersion()
 {
-    return 18;
+    return 20;
 }
 
 }
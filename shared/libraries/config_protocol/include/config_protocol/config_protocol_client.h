@@ -81,6 +81,7 @@ public:
     BaseObjectPtr callProperty(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& params);
     void setAttributeValue(const std::string& globalId, const std::string& attributeName, const BaseObjectPtr& attributeValue);
     BaseObjectPtr getLastValue(const std::string& globalId);
+    DictPtr<IString, IBaseObject> getSignalOverview(const std::string& globalId, Int start, Int end, SizeT count);
     void lock(const std::string& globalId);
     void unlock(const std::string& globalId);
     void forceUnlock(const std::string& globalId);
@@ -607,6 +608,16 @@ CoreEventArgsPtr ConfigProtocolClient<TRootDeviceImpl>::unpackCoreEvents(const C
         dict.set("Component", comp);
     }
 
+    if (dict.hasKey("Components"))
+    {
+        auto components = List<IComponent>();
+        const ListPtr<IComponentHolder> compHolders = dict.get("Components");
+        for (const auto& compHolder : compHolders)
+            components.pushBack(compHolder.getComponent());
+
+        dict.set("Components", components);
+    }
+
     return CoreEventArgs(static_cast<CoreEventId>(args.getEventId()), args.getEventName(), dict);
 }
 
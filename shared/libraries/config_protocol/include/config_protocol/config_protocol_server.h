@@ -22,6 +22,7 @@
 
 #include <opendaq/component_holder_ptr.h>
 #include <opendaq/client_type.h>
+#include <config_protocol/config_server_signal_overviews.h>
 
 namespace daq::config_protocol
 {
@@ -53,7 +54,8 @@ public:
                          NotificationReadyCallback notificationReadyCallback,
                          const UserPtr& user,
                          ClientType connectionType,
-                         const FolderConfigPtr& externalSignalsFolder);
+                         const FolderConfigPtr& externalSignalsFolder,
+                         const ConfigServerSignalOverviewsPtr& signalOverviews = nullptr);
     ~ConfigProtocolServer();
 
     void buildRpcDispatchStructure();
@@ -104,10 +106,16 @@ private:
     const std::set<uint16_t> supportedServerVersions;
     ConfigProtocolStreamingConsumer streamingConsumer;
 
+    // shared with the other connections of the server if provided, otherwise attached to the signals of the root device on construction
+    ConfigServerSignalOverviewsPtr signalOverviews;
+    bool ownsSignalOverviews;
+
     PacketBuffer processPacketAndGetReply(const PacketBuffer& packetBuffer);
     void processNoReplyPacket(const PacketBuffer& packetBuffer);
-    StringPtr processRpcAndGetReply(const StringPtr& jsonStr);
+    PacketBuffer processRpcAndGetReply(uint64_t requestId, const StringPtr& jsonStr);
+    PacketBuffer serializeRpcReply(uint64_t requestId, const BaseObjectPtr& reply) const;
     void processNoReplyRpc(const StringPtr& jsonStr);
+    static DictPtr<IString, IBaseObject> createErrorResponse(Int errorCode, const StringPtr& message);
     static StringPtr prepareErrorResponse(Int errorCode, const StringPtr& message, const SerializerPtr& serializer);
 
     BaseObjectPtr callRpc(const StringPtr& name, const ParamsDictPtr& params);
@@ -121,12 +129,14 @@ private:
     BaseObjectPtr changeInputPortStreamingSource(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
     BaseObjectPtr removeExternalSignals(const ParamsDictPtr& params);
     BaseObjectPtr acceptsSignal(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
+    BaseObjectPtr getSignalOverview(const RpcContext& context, const SignalPtr& signal, const ParamsDictPtr& params);
 
     template <class SmartPtr>
     void addHandler(const std::string& name, const RpcHandlerFunction<SmartPtr>& handler);
     
     void coreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs);
     bool isForwardedCoreEvent(ComponentPtr& component, CoreEventArgsPtr& eventArgs);
+    void updateSignalOverviews(const ComponentPtr& component, const CoreEventArgsPtr& eventArgs);
     
     ListPtr<IBaseObject> packCoreEvent(const ComponentPtr& component, const CoreEventArgsPtr& args);
     CoreEventArgsPtr processCoreEventArgs(const CoreEventArgsPtr& args);
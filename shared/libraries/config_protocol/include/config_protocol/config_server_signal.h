@@ -17,6 +17,8 @@
 #pragma once
 #include <opendaq/device_ptr.h>
 #include <opendaq/signal_ptr.h>
+#include <opendaq/reader_factory.h>
+#include <coretypes/listobject_factory.h>
 
 namespace daq::config_protocol
 {
@@ -25,6 +27,10 @@ class ConfigServerSignal
 {
 public:
     static BaseObjectPtr getLastValue(const RpcContext& context, const SignalPtr& signal, const ParamsDictPtr& params);
+
+    static BaseObjectPtr readOverview(const OverviewReaderPtr& reader, const ParamsDictPtr& params);
+
+    static constexpr SizeT MaxOverviewPoints = 65536;
 };
 
 inline BaseObjectPtr ConfigServerSignal::getLastValue(const RpcContext& context, const SignalPtr& signal, const ParamsDictPtr& /*params*/)
@@ -34,4 +40,38 @@ inline BaseObjectPtr ConfigServerSignal::getLastValue(const RpcContext& context,
     const auto value = signal.getLastValue();
     return value;
 }
+
+inline BaseObjectPtr ConfigServerSignal::readOverview(const OverviewReaderPtr& reader, const ParamsDictPtr& params)
+{
+    const Int start = params.get("Start");
+    const Int end = params.get("End");
+    SizeT count = static_cast<Int>(params.get("Count"));
+    if (count > MaxOverviewPoints)
+        DAQ_THROW_EXCEPTION(InvalidParameterException, "At most {} overview points can be requested", MaxOverviewPoints);
+
+    std::vector<Float> minValues(count);
+    std::vector<Float> maxValues(count);
+    std::vector<Float> meanValues(count);
+    std::vector<Int> domain(count);
+    reader.readOverview(minValues.data(), maxValues.data(), meanValues.data(), domain.data(), &count, start, end);
+
+    auto minList = List<IFloat>();
+    auto maxList = List<IFloat>();
+    auto meanList = List<IFloat>();
+    auto domainList = List<IInteger>();
+    for (SizeT i = 0; i < count; ++i)
+    {
+        minList.pushBack(minValues[i]);
+        maxList.pushBack(maxValues[i]);
+        meanList.pushBack(meanValues[i]);
+        domainList.pushBack(domain[i]);
+    }
+
+    auto overview = Dict<IString, IBaseObject>();
+    overview.set("Min", minList);
+    overview.set("Max", maxList);
+    overview.set("Mean", meanList);
+    overview.set("Domain", domainList);
+    return overview;
+}
 }
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/overview_reader_ptr.h>
+#include <opendaq/reader_factory.h>
+#include <opendaq/signal_ptr.h>
+#include <opendaq/ids_parser.h>
+#include <coretypes/weakrefptr.h>
+#include <coretypes/exceptions.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace daq::config_protocol
+{
+
+/*
+ * Overview readers of the signals of a device. A reader is attached to a signal on the first overview request
+ * for it, so signals nobody asks about are not read. At most maxReaders readers are kept; when another one is
+ * needed, the reader of the signal requested least recently is dropped. A server shares one instance among all
+ * its connections, so the history of a signal is kept when clients reconnect.
+ */
+class ConfigServerSignalOverviews
+{
+public:
+    // 1024 aggregates on each of 16 levels cover 2^25 samples of history in less than 1 MB per signal
+    static constexpr SizeT OverviewLevelCapacity = 1024;
+    static constexpr SizeT OverviewLevelCount = 16;
+    static constexpr SizeT DefaultMaxReaders = 16;
+
+    // Overviews are disabled if maxReaders is 0
+    explicit ConfigServerSignalOverviews(SizeT maxReaders = DefaultMaxReaders);
+
+    void removeComponentSignals(const std::string& componentGlobalId);
+
+    // Returns the reader of the signal, attaching one if the signal was not requested before
+    OverviewReaderPtr getReader(const SignalPtr& signal);
+
+private:
+    struct SignalOverview
+    {
+        WeakRefPtr<ISignal> signal;
+        OverviewReaderPtr reader;
+        uint64_t lastRequest;
+    };
+
+    void removeStaleReadersNoLock();
+    void removeLeastRecentReaderNoLock();
+
+    std::mutex sync;
+    SizeT maxReaders;
+    uint64_t requestCounter = 0;
+    std::unordered_map<std::string, SignalOverview> overviews;
+};
+
+using ConfigServerSignalOverviewsPtr = std::shared_ptr<ConfigServerSignalOverviews>;
+
+inline ConfigServerSignalOverviews::ConfigServerSignalOverviews(SizeT maxReaders)
+    : maxReaders(maxReaders)
+{
+}
+
+inline void ConfigServerSignalOverviews::removeComponentSignals(const std::string& componentGlobalId)
+{
+    std::scoped_lock lock(sync);
+
+    for (auto it = overviews.begin(); it != overviews.end();)
+    {
+        if (it->first == componentGlobalId || IdsParser::isNestedComponentId(componentGlobalId, it->first))
+            it = overviews.erase(it);
+        else
+            ++it;
+    }
+}
+
+inline OverviewReaderPtr ConfigServerSignalOverviews::getReader(const SignalPtr& signal)
+{
+    if (maxReaders == 0)
+        DAQ_THROW_EXCEPTION(NotSupportedException, "Signal overviews are disabled");
+
+    std::scoped_lock lock(sync);
+
+    const std::string globalId = signal.getGlobalId();
+    if (const auto it = overviews.find(globalId); it != overviews.end())
+    {
+        it->second.lastRequest = ++requestCounter;
+        return it->second.reader;
+    }
+
+    removeStaleReadersNoLock();
+    while (overviews.size() >= maxReaders)
+        removeLeastRecentReaderNoLock();
+
+    auto reader = OverviewReader(signal, OverviewLevelCapacity, OverviewLevelCount);
+    overviews.emplace(globalId, SignalOverview{signal, reader, ++requestCounter});
+    return reader;
+}
+
+inline void ConfigServerSignalOverviews::removeStaleReadersNoLock()
+{
+    for (auto it = overviews.begin(); it != overviews.end();)
+    {
+        const auto overviewSignal = it->second.signal.getRef();
+        if (!overviewSignal.assigned() || overviewSignal.isRemoved())
+            it = overviews.erase(it);
+        else
+            ++it;
+    }
+}
+
+inline void ConfigServerSignalOverviews::removeLeastRecentReaderNoLock()
+{
+    const auto leastRecent = std::min_element(overviews.begin(),
+                                              overviews.end(),
+                                              [](const auto& a, const auto& b) { return a.second.lastRequest < b.second.lastRequest; });
+    overviews.erase(leastRecent);
+}
+
+}
@@ -1,5 +1,7 @@
 #include <config_protocol/config_protocol.h>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <coretypes/stringobject_factory.h>
 
 namespace daq::config_protocol
@@ -115,6 +117,21 @@ PacketHeader* PacketBuffer::allocateHeaderAndPayload(size_t payloadSize)
     return ptr;
 }
 
+PacketHeader* PacketBuffer::reallocateHeaderAndPayload(PacketHeader* mem, size_t payloadSize)
+{
+    const auto packetBufferSize = sizeof(PacketHeader) + payloadSize;
+
+    if (packetBufferSize > MAX_PACKET_BUFFER_SIZE)
+        throw ConfigProtocolException("Configuration protocol packet buffer size exceeds limit");
+
+    const auto ptr = static_cast<PacketHeader*>(std::realloc(mem, packetBufferSize));
+    if (ptr == nullptr)
+        throw ConfigProtocolException("Out of memory");
+    ptr->headerSize = sizeof(PacketHeader);
+    ptr->payloadSize = static_cast<uint32_t>(payloadSize);
+    return ptr;
+}
+
 void PacketBuffer::deallocateMem(void* mem)
 {
     std::free(mem);
@@ -356,6 +373,66 @@ StringPtr PacketBuffer::parseConnectionRejectedReply() const
     return jsonStr;
 }
 
+PacketBufferSinkImpl::PacketBufferSinkImpl()
+    : buffer(nullptr)
+    , payloadSize(0)
+    , payloadCapacity(0)
+{
+}
+
+PacketBufferSinkImpl::~PacketBufferSinkImpl()
+{
+    if (buffer != nullptr)
+        PacketBuffer::deallocateMem(buffer);
+}
+
+ErrCode PacketBufferSinkImpl::write(ConstCharPtr data, SizeT length)
+{
+    if (length == 0)
+        return OPENDAQ_SUCCESS;
+
+    OPENDAQ_PARAM_NOT_NULL(data);
+
+    const ErrCode errCode = daqTry([&]
+    {
+        if (payloadSize + length > MAX_PAYLOAD_SIZE)
+            throw ConfigProtocolException("Configuration protocol packet buffer size exceeds limit");
+
+        if (payloadSize + length > payloadCapacity)
+        {
+            // the capacity doubles up to the packet size limit, which the payload itself may still reach
+            const size_t newCapacity =
+                std::min(std::max({payloadSize + length, payloadCapacity * 2, INITIAL_PAYLOAD_CAPACITY}), MAX_PAYLOAD_SIZE);
+            buffer = PacketBuffer::reallocateHeaderAndPayload(buffer, newCapacity);
+            payloadCapacity = newCapacity;
+        }
+
+        std::memcpy(reinterpret_cast<char*>(buffer + 1) + payloadSize, data, length);
+        payloadSize += length;
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+ErrCode PacketBufferSinkImpl::flush()
+{
+    return OPENDAQ_SUCCESS;
+}
+
+PacketBuffer PacketBufferSinkImpl::detachPacketBuffer(PacketType packetType, uint64_t id)
+{
+    // shrinks the buffer to the payload; also allocates the header if nothing was written
+    const auto mem = PacketBuffer::reallocateHeaderAndPayload(buffer, payloadSize);
+    mem->type = packetType;
+    mem->id = id;
+
+    buffer = nullptr;
+    payloadSize = 0;
+    payloadCapacity = 0;
+
+    return PacketBuffer(mem, std::bind(&PacketBuffer::deallocateMem, std::placeholders::_1));
+}
+
 ConfigProtocolException::ConfigProtocolException(const std::string& msg)
     : runtime_error(msg)
 {
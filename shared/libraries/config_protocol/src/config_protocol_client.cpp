@@ -389,6 +389,16 @@ BaseObjectPtr ConfigProtocolClientComm::getLastValue(const std::string& globalId
     return parseRpcOrRejectReply(getPropertyValueRpcReplyPacketBuffer.parseRpcRequestOrReply(), deserializeContext);
 }
 
+DictPtr<IString, IBaseObject> ConfigProtocolClientComm::getSignalOverview(const std::string& globalId, Int start, Int end, SizeT count)
+{
+    auto params = Dict<IString, IBaseObject>();
+    params.set("Start", start);
+    params.set("End", end);
+    params.set("Count", count);
+
+    return sendComponentCommand(globalId, ClientCommand("GetSignalOverview", 19), params);
+}
+
 void ConfigProtocolClientComm::lock(const std::string& globalId)
 {
     auto params = Dict<IString, IBaseObject>();
@@ -11,6 +11,7 @@
 #include <opendaq/custom_log.h>
 #include <config_protocol/config_server_recorder.h>
 #include <config_protocol/config_mirrored_ext_sig_impl.h>
+#include <opendaq/core_opendaq_event_args_factory.h>
 
 namespace daq::config_protocol
 {
@@ -76,7 +77,8 @@ ConfigProtocolServer::ConfigProtocolServer(DevicePtr rootDevice,
                                            NotificationReadyCallback notificationReadyCallback,
                                            const UserPtr& user,
                                            ClientType connectionType,
-                                           const FolderConfigPtr& externalSignalsFolder)
+                                           const FolderConfigPtr& externalSignalsFolder,
+                                           const ConfigServerSignalOverviewsPtr& signalOverviews)
     : rootDevice(std::move(rootDevice))
     , daqContext(this->rootDevice.getContext())
     , notificationReadyCallback(std::move(notificationReadyCallback))
@@ -87,13 +89,18 @@ ConfigProtocolServer::ConfigProtocolServer(DevicePtr rootDevice,
     , user(user)
     , connectionType(connectionType)
     , protocolVersion(0)
-    , supportedServerVersions(std::set<uint16_t>({17, 18}))
+    , supportedServerVersions(std::set<uint16_t>({17, 18, 19, 20}))
     , streamingConsumer(this->daqContext, externalSignalsFolder)
+    , signalOverviews(signalOverviews)
+    , ownsSignalOverviews(!signalOverviews)
 {
     assert(user.assigned());
     serializer.setUser(user);
     notificationSerializer.setUser(user);
 
+    if (ownsSignalOverviews)
+        this->signalOverviews = std::make_shared<ConfigServerSignalOverviews>();
+
     buildRpcDispatchStructure();
 
     if (daqContext.assigned())
@@ -176,6 +183,7 @@ void ConfigProtocolServer::buildRpcDispatchStructure()
     addHandler<DevicePtr>("GetOperationMode", &ConfigServerDevice::getOperationMode);
 
     addHandler<SignalPtr>("GetLastValue", &ConfigServerSignal::getLastValue);
+    addHandler<SignalPtr>("GetSignalOverview", std::bind(&ConfigProtocolServer::getSignalOverview, this, _1, _2, _3));
 
     addHandler<InputPortPtr>("ConnectSignal", std::bind(&ConfigProtocolServer::connectSignal, this, _1, _2, _3));
     addHandler<InputPortPtr>("ConnectExternalSignal", std::bind(&ConfigProtocolServer::connectExternalSignal, this, _1, _2, _3));
@@ -284,11 +292,10 @@ PacketBuffer ConfigProtocolServer::processPacketAndGetReply(const PacketBuffer&
         case PacketType::Rpc:
             {
                 const auto jsonRequest = packetBuffer.parseRpcRequestOrReply();
-                const auto jsonReply = processRpcAndGetReply(jsonRequest);
 
                 try
                 {
-                    auto reply = PacketBuffer::createRpcRequestOrReply(requestId, jsonReply.getCharPtr(), jsonReply.getLength());
+                    auto reply = processRpcAndGetReply(requestId, jsonRequest);
                     return reply;
                 }
                 catch (const std::exception& e)
@@ -309,7 +316,7 @@ void ConfigProtocolServer::processNoReplyPacket(const PacketBuffer& packetBuffer
     processNoReplyRpc(jsonRequest);
 }
 
-StringPtr ConfigProtocolServer::processRpcAndGetReply(const StringPtr& jsonStr)
+PacketBuffer ConfigProtocolServer::processRpcAndGetReply(uint64_t requestId, const StringPtr& jsonStr)
 {
     try
     {
@@ -327,27 +334,44 @@ StringPtr ConfigProtocolServer::processRpcAndGetReply(const StringPtr& jsonStr)
         if (retValue.assigned())
             retObj.set("ReturnValue", retValue);
 
-        serializer.reset();
-        retObj.serialize(serializer);
-        return serializer.getOutput();
+        return serializeRpcReply(requestId, retObj);
     }
     catch (const daq::DaqException& e)
     {
-        return prepareErrorResponse(e.getErrCode(), e.what(), this->serializer);
+        return serializeRpcReply(requestId, createErrorResponse(e.getErrCode(), e.what()));
     }
     catch (const std::exception& e)
     {
-        return prepareErrorResponse(OPENDAQ_ERR_GENERALERROR, e.what(), this->serializer);
+        return serializeRpcReply(requestId, createErrorResponse(OPENDAQ_ERR_GENERALERROR, e.what()));
     }
 
-    return prepareErrorResponse(OPENDAQ_ERR_GENERALERROR, "General error during serialization", this->serializer);
+    return serializeRpcReply(requestId, createErrorResponse(OPENDAQ_ERR_GENERALERROR, "General error during serialization"));
 }
 
-StringPtr ConfigProtocolServer::prepareErrorResponse(Int errorCode, const StringPtr& message, const SerializerPtr& serializer)
+PacketBuffer ConfigProtocolServer::serializeRpcReply(uint64_t requestId, const BaseObjectPtr& reply) const
+{
+    // the reply is serialized straight into the payload of the packet
+    const SerializerSinkPtr sink = createWithImplementation<ISerializerSink, PacketBufferSinkImpl>();
+    auto* packetSink = static_cast<PacketBufferSinkImpl*>(sink.getObject());  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+
+    const auto replySerializer = JsonSerializerWithSinkAndVersion(sink, serializer.getVersion());
+    replySerializer.setUser(user);
+    reply.serialize(replySerializer);
+
+    return packetSink->detachPacketBuffer(PacketType::Rpc, requestId);
+}
+
+DictPtr<IString, IBaseObject> ConfigProtocolServer::createErrorResponse(Int errorCode, const StringPtr& message)
 {
     auto errorObject = Dict<IString, IBaseObject>();
     errorObject.set("ErrorCode", errorCode);
     errorObject.set("ErrorMessage", message);
+    return errorObject;
+}
+
+StringPtr ConfigProtocolServer::prepareErrorResponse(Int errorCode, const StringPtr& message, const SerializerPtr& serializer)
+{
+    const auto errorObject = createErrorResponse(errorCode, message);
 
     serializer.reset();
     errorObject.serialize(serializer);
@@ -409,6 +433,8 @@ BaseObjectPtr ConfigProtocolServer::getSerializedRootDevice(const ParamsDictPtr&
 {
     ConfigServerAccessControl::protectObject(rootDevice, user, Permission::Read);
 
+    // Clients expect the tree as a JSON string in the return value and deserialize it separately, so it cannot
+    // be streamed into the reply packet without changing the protocol. Only the reply itself is streamed.
     serializer.reset();
     rootDevice.serialize(serializer);
 
@@ -522,13 +548,42 @@ BaseObjectPtr ConfigProtocolServer::acceptsSignal(const RpcContext& context, con
     return ConfigServerInputPort::accepts(context, inputPort, signal, user);
 }
 
+BaseObjectPtr ConfigProtocolServer::getSignalOverview(const RpcContext& context, const SignalPtr& signal, const ParamsDictPtr& params)
+{
+    ConfigServerAccessControl::protectObject(signal, context.user, Permission::Read);
+
+    const auto reader = signalOverviews->getReader(signal);
+    return ConfigServerSignal::readOverview(reader, params);
+}
+
 void ConfigProtocolServer::coreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs)
 {
-    if (isForwardedCoreEvent(component, eventArgs))
+    if (ownsSignalOverviews)
+        updateSignalOverviews(component, eventArgs);
+
+    if (!isForwardedCoreEvent(component, eventArgs))
+        return;
+
+    if (eventArgs.getEventId() == static_cast<Int>(CoreEventId::ComponentsAdded) && protocolVersion < 20)
     {
-        const auto packed = packCoreEvent(component, eventArgs);
-        sendNotification(packed);
+        // clients prior to version 20 are notified of each added subtree separately
+        const ListPtr<IComponent> components = eventArgs.getParameters().get("Components");
+        for (const auto& added : components)
+            sendNotification(packCoreEvent(added.getParent(), CoreEventArgsComponentAdded(added)));
+        return;
     }
+
+    const auto packed = packCoreEvent(component, eventArgs);
+    sendNotification(packed);
+}
+
+void ConfigProtocolServer::updateSignalOverviews(const ComponentPtr& component, const CoreEventArgsPtr& eventArgs)
+{
+    if (eventArgs.getEventId() != static_cast<Int>(CoreEventId::ComponentRemoved))
+        return;
+
+    const StringPtr removedId = eventArgs.getParameters().get("Id");
+    signalOverviews->removeComponentSignals(component.getGlobalId().toStdString() + "/" + removedId.toStdString());
 }
 
 bool ConfigProtocolServer::isForwardedCoreEvent(ComponentPtr& component, CoreEventArgsPtr& eventArgs)
@@ -565,6 +620,7 @@ ListPtr<IBaseObject> ConfigProtocolServer::packCoreEvent(const ComponentPtr& com
         case CoreEventId::PropertyRemoved:
         case CoreEventId::SignalConnected:
         case CoreEventId::ComponentAdded:
+        case CoreEventId::ComponentsAdded:
         case CoreEventId::AttributeChanged:
         case CoreEventId::PropertyOrderChanged:
             packedEvent.pushBack(processCoreEventArgs(args));
@@ -624,6 +680,15 @@ CoreEventArgsPtr ConfigProtocolServer::processCoreEventArgs(const CoreEventArgsP
         dict.set("Component", ComponentHolder(comp));
     }
 
+    if (dict.hasKey("Components"))
+    {
+        auto holders = List<IComponentHolder>();
+        const ListPtr<IComponent> components = dict.get("Components");
+        for (const auto& comp : components)
+            holders.pushBack(ComponentHolder(comp));
+        dict.set("Components", holders);
+    }
+
     return CoreEventArgs(static_cast<CoreEventId>(args.getEventId()), args.getEventName(), cloned);
 }
 
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <config_protocol/config_protocol.h>
+#include <coretypes/serializer_sink_factory.h>
 
 using namespace daq;
 using namespace config_protocol;
@@ -196,3 +197,56 @@ TEST_F(ConfigPacketTest, ConnectionRejectedReply)
 
     ASSERT_EQ(json1, json);
 }
+
+TEST_F(ConfigPacketTest, RpcReplyFromSink)
+{
+    const SerializerSinkPtr sink = createWithImplementation<ISerializerSink, PacketBufferSinkImpl>();
+    auto* packetSink = static_cast<PacketBufferSinkImpl*>(sink.getObject());  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+
+    const std::string json(10000, 'x');
+    for (size_t i = 0; i < json.size(); i += 1000)
+        ASSERT_EQ(sink->write(json.data() + i, 1000), OPENDAQ_SUCCESS);
+
+    const auto packetBufferSource = packetSink->detachPacketBuffer(PacketType::Rpc, 1);
+
+    const PacketBuffer packetBuffer(packetBufferSource.getBuffer(), false);
+
+    ASSERT_EQ(packetBuffer.getId(), 1u);
+    const auto json1 = packetBuffer.parseRpcRequestOrReply();
+
+    ASSERT_EQ(json1, json);
+}
+
+TEST_F(ConfigPacketTest, SinkNearSizeLimit)
+{
+    const SerializerSinkPtr sink = createWithImplementation<ISerializerSink, PacketBufferSinkImpl>();
+    auto* packetSink = static_cast<PacketBufferSinkImpl*>(sink.getObject());  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+
+    // doubling the capacity past half of the limit must not fail while the payload itself fits
+    const std::string chunk(1024 * 1024, 'x');
+    SizeT written = 0;
+    while (written + chunk.size() <= PacketBufferSinkImpl::MAX_PAYLOAD_SIZE)
+    {
+        ASSERT_EQ(sink->write(chunk.data(), chunk.size()), OPENDAQ_SUCCESS);
+        written += chunk.size();
+    }
+
+    ASSERT_EQ(sink->write(chunk.data(), PacketBufferSinkImpl::MAX_PAYLOAD_SIZE - written), OPENDAQ_SUCCESS);
+    ASSERT_NE(sink->write(chunk.data(), 1), OPENDAQ_SUCCESS);
+    daqClearErrorInfo();
+
+    const auto packetBuffer = packetSink->detachPacketBuffer(PacketType::Rpc, 3);
+    ASSERT_EQ(packetBuffer.getPayloadSize(), PacketBufferSinkImpl::MAX_PAYLOAD_SIZE);
+}
+
+TEST_F(ConfigPacketTest, EmptySink)
+{
+    const SerializerSinkPtr sink = createWithImplementation<ISerializerSink, PacketBufferSinkImpl>();
+    auto* packetSink = static_cast<PacketBufferSinkImpl*>(sink.getObject());  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+
+    const auto packetBuffer = packetSink->detachPacketBuffer(PacketType::Rpc, 2);
+
+    ASSERT_EQ(packetBuffer.getPacketType(), PacketType::Rpc);
+    ASSERT_EQ(packetBuffer.getId(), 2u);
+    ASSERT_EQ(packetBuffer.getPayloadSize(), 0u);
+}
@@ -12,10 +12,13 @@
 #include <opendaq/context_factory.h>
 #include <config_protocol/config_client_device_impl.h>
 #include <opendaq/packet_factory.h>
+#include <opendaq/signal_factory.h>
+#include <opendaq/data_descriptor_factory.h>
 #include <coreobjects/user_factory.h>
 #include <config_protocol/exceptions.h>
 #include <testutils/testutils.h>
 #include <opendaq/recorder_ptr.h>
+#include <config_protocol/config_client_signal_impl.h>
 
 using namespace daq;
 using namespace config_protocol;
@@ -623,6 +626,95 @@ TEST_F(ConfigProtocolIntegrationTest, TestGetLastValue)
     ASSERT_EQ(integerPtr2, 7);
 }
 
+TEST_F(ConfigProtocolIntegrationTest, TestGetSignalOverview)
+{
+    const SignalConfigPtr serverSignal = serverDevice.getSignals()[0];
+    const auto clientSignal = clientDevice.getSignals()[0].asPtr<IConfigClientSignalPrivate>();
+
+    // the overview reader is attached on the first request, so the history starts there
+    DictPtr<IString, IBaseObject> overview;
+    ASSERT_EQ(clientSignal->getOverview(0, 8, 2, &overview), OPENDAQ_SUCCESS);
+    ASSERT_EQ(ListPtr<IFloat>(overview.get("Min")).getCount(), 0u);
+
+    auto dataPacket = DataPacket(serverSignal.getDescriptor(), 8);
+    int64_t* data = static_cast<int64_t*>(dataPacket.getData());
+    for (int64_t i = 0; i < 8; ++i)
+        data[i] = i;
+    serverSignal.sendPacket(dataPacket);
+
+    ASSERT_EQ(clientSignal->getOverview(0, 8, 2, &overview), OPENDAQ_SUCCESS);
+
+    const ListPtr<IFloat> minValues = overview.get("Min");
+    const ListPtr<IFloat> maxValues = overview.get("Max");
+    const ListPtr<IFloat> meanValues = overview.get("Mean");
+    const ListPtr<IInteger> domain = overview.get("Domain");
+    ASSERT_EQ(minValues.getCount(), 2u);
+    ASSERT_EQ(minValues[0], 0.0);
+    ASSERT_EQ(maxValues[0], 3.0);
+    ASSERT_EQ(meanValues[1], 5.5);
+    ASSERT_EQ(domain[1], 4);
+}
+
+TEST_F(ConfigProtocolIntegrationTest, SignalOverviewsSharedByServers)
+{
+    const SignalConfigPtr serverSignal = serverDevice.getSignals()[0];
+
+    const auto signalOverviews = std::make_shared<ConfigServerSignalOverviews>();
+    const auto reader = signalOverviews->getReader(serverSignal);
+
+    auto otherServer = std::make_unique<ConfigProtocolServer>(serverDevice,
+                                                              [](const PacketBuffer&) {},
+                                                              User("", ""),
+                                                              ClientType::Control,
+                                                              test_utils::dummyExtSigFolder(serverDevice.getContext()),
+                                                              signalOverviews);
+
+    auto dataPacket = DataPacket(serverSignal.getDescriptor(), 8);
+    int64_t* data = static_cast<int64_t*>(dataPacket.getData());
+    for (int64_t i = 0; i < 8; ++i)
+        data[i] = i;
+    serverSignal.sendPacket(dataPacket);
+
+    // the history outlives the server, as it does when a client reconnects
+    otherServer.reset();
+
+    Float minValue, maxValue, meanValue;
+    Int domain;
+    SizeT count = 1;
+    ASSERT_EQ(signalOverviews->getReader(serverSignal), reader);
+    reader.readOverview(&minValue, &maxValue, &meanValue, &domain, &count, 0, 8);
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(minValue, 0.0);
+    ASSERT_EQ(maxValue, 7.0);
+}
+
+TEST_F(ConfigProtocolIntegrationTest, SignalOverviewsLimit)
+{
+    std::vector<SignalConfigPtr> signals;
+    for (int i = 0; i < 3; ++i)
+    {
+        signals.push_back(Signal(serverDevice.getContext(), nullptr, "sig" + std::to_string(i)));
+        signals.back().setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).build());
+    }
+
+    ConfigServerSignalOverviews signalOverviews(2);
+    const auto reader0 = signalOverviews.getReader(signals[0]);
+    const auto reader1 = signalOverviews.getReader(signals[1]);
+
+    // requesting the first signal again makes the second one the least recently requested
+    ASSERT_EQ(signalOverviews.getReader(signals[0]), reader0);
+    signalOverviews.getReader(signals[2]);
+
+    ASSERT_EQ(signalOverviews.getReader(signals[0]), reader0);
+    ASSERT_NE(signalOverviews.getReader(signals[1]), reader1);
+}
+
+TEST_F(ConfigProtocolIntegrationTest, SignalOverviewsDisabled)
+{
+    ConfigServerSignalOverviews signalOverviews(0);
+    ASSERT_THROW(signalOverviews.getReader(serverDevice.getSignals()[0]), NotSupportedException);
+}
+
 TEST_F(ConfigProtocolIntegrationTest, DeviceInfoChanges)
 {
     const auto serverSubDevice = serverDevice.getDevices()[1];
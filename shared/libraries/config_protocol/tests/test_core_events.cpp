@@ -22,6 +22,8 @@
 #include "config_protocol/config_client_device_impl.h"
 #include <coreobjects/user_factory.h>
 #include <opendaq/mock/mock_streaming_factory.h>
+#include <memory>
+#include <set>
 
 using namespace daq;
 using namespace daq::config_protocol;
@@ -41,6 +43,25 @@ public:
                                                    ClientType::Control,
                                                    test_utils::dummyExtSigFolder(serverDevice.getContext()));
 
+        connectClient(getClientProtocolVersion());
+    }
+
+protected:
+    DevicePtr serverDevice;
+    DevicePtr clientDevice;
+    std::unique_ptr<ConfigProtocolServer> server;
+    std::unique_ptr<ConfigProtocolClient<ConfigClientDeviceImpl>> client;
+    ContextPtr clientContext;
+    BaseObjectPtr notificationObj;
+    mutable size_t notificationCount = 0;
+
+    virtual uint16_t getClientProtocolVersion() const
+    {
+        return GetLatestConfigProtocolVersion();
+    }
+
+    void connectClient(uint16_t protocolVersion)
+    {
         clientContext = NullContext();
         client =
             std::make_unique<ConfigProtocolClient<ConfigClientDeviceImpl>>(
@@ -52,21 +73,59 @@ public:
                 nullptr
             );
 
-        clientDevice = client->connect();
+        clientDevice = client->connect(nullptr, protocolVersion);
         clientDevice.asPtr<IPropertyObjectInternal>().enableCoreEventTrigger();
     }
 
-protected:
-    DevicePtr serverDevice;
-    DevicePtr clientDevice;
-    std::unique_ptr<ConfigProtocolServer> server;
-    std::unique_ptr<ConfigProtocolClient<ConfigClientDeviceImpl>> client;
-    ContextPtr clientContext;
-    BaseObjectPtr notificationObj;
+    static std::set<std::string> getRelativeIds(const DevicePtr& device)
+    {
+        const auto rootId = device.getGlobalId().toStdString();
+
+        std::set<std::string> ids;
+        for (const auto& comp : device.getItems(search::Recursive(search::Any())))
+            ids.insert(comp.getGlobalId().toStdString().substr(rootId.size()));
+        return ids;
+    }
+
+    // Adds two function blocks and a custom component within a bulk construction scope of the server device
+    void addComponentsInBulk(size_t expectedNotificationCount)
+    {
+        const auto mock = dynamic_cast<test_utils::MockDevice2Impl*>(serverDevice.getObject());
+        const FolderConfigPtr serverFolder = serverDevice.getItem("FB");
+        const FolderConfigPtr clientFolder = clientDevice.getItem("FB");
+
+        // the client reports each added subtree separately regardless of the protocol version
+        auto addCount = std::make_shared<int>(0);
+        clientContext.getOnCoreEvent() +=
+            [addCount](const ComponentPtr& /*comp*/, const CoreEventArgsPtr& args)
+            {
+                if (args.getEventId() == static_cast<Int>(CoreEventId::ComponentAdded))
+                    (*addCount)++;
+            };
+
+        mock->beginBulkConstructionHelper();
+        serverFolder.addItem(
+            createWithImplementation<IFunctionBlock, test_utils::MockFb1Impl>(serverDevice.getContext(), serverFolder, "newFb1"));
+        serverFolder.addItem(
+            createWithImplementation<IFunctionBlock, test_utils::MockFb1Impl>(serverDevice.getContext(), serverFolder, "newFb2"));
+        mock->addComponentHelper(Component(serverDevice.getContext(), serverDevice, "comp1"));
+
+        notificationCount = 0;
+        mock->endBulkConstructionHelper();
+
+        ASSERT_EQ(notificationCount, expectedNotificationCount);
+        ASSERT_EQ(*addCount, 3);
+
+        ASSERT_TRUE(clientFolder.getItem("newFb1").assigned());
+        ASSERT_TRUE(clientFolder.getItem("newFb2").assigned());
+        ASSERT_TRUE(clientDevice.getItem("comp1").assigned());
+        ASSERT_EQ(getRelativeIds(clientDevice), getRelativeIds(serverDevice));
+    }
 
     // server handling
     void serverNotificationReady(const PacketBuffer& notificationPacket) const
     {
+        notificationCount++;
         client->triggerNotificationPacket(notificationPacket);
     }
 
@@ -479,6 +538,31 @@ TEST_F(ConfigCoreEventTest, CustomComponentAdded)
     ASSERT_EQ(addCount, 3);
 }
 
+TEST_F(ConfigCoreEventTest, ComponentsAddedInBulk)
+{
+    ASSERT_EQ(client->getProtocolVersion(), GetLatestConfigProtocolVersion());
+
+    // one notification lists all added subtrees
+    addComponentsInBulk(1);
+}
+
+class ConfigCoreEventProtocolVersion19Test : public ConfigCoreEventTest
+{
+protected:
+    uint16_t getClientProtocolVersion() const override
+    {
+        return 19;
+    }
+};
+
+TEST_F(ConfigCoreEventProtocolVersion19Test, ComponentsAddedInBulk)
+{
+    ASSERT_EQ(client->getProtocolVersion(), 19u);
+
+    // a notification for each added subtree
+    addComponentsInBulk(3);
+}
+
 TEST_F(ConfigCoreEventTest, ComponentRemoved)
 {
     int removeCount = 0;
@@ -17,6 +17,7 @@
 #pragma once
 #include <coreobjects/property_object_ptr.h>
 #include <daq_discovery/mdnsdiscovery_client.h>
+#include <daq_discovery/mdns_discovery_cache.h>
 
 BEGIN_NAMESPACE_DISCOVERY
 
@@ -26,6 +27,8 @@ public:
     explicit DiscoveryClient(std::unordered_set<std::string> requiredCaps = {});
     
     void initMdnsClient(const ListPtr<IString>& serviceNames, std::chrono::milliseconds discoveryDuration = 500ms);
+    // Reads the discovered devices from the context-wide discovery cache instead of querying on every call
+    void setDiscoveryCache(const BaseObjectPtr& discoveryCache);
     std::vector<MdnsDiscoveredDevice> discoverMdnsDevices() const;
 
     static void populateDiscoveredInfoProperties(PropertyObjectPtr& info,
@@ -47,6 +50,8 @@ protected:
     static void populateConnectedClientsInfo(PropertyObjectPtr& info, const MdnsDiscoveredDevice& device);
 
     std::shared_ptr<MDNSDiscoveryClient> mdnsClient;
+    ListPtr<IString> serviceNames;
+    ObjectPtr<IMdnsDiscoveryCache> discoveryCache;
     std::unordered_set<std::string> requiredCaps;
 };
 
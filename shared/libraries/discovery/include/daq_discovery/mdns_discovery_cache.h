@@ -0,0 +1,58 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <daq_discovery/mdnsdiscovery_client.h>
+#include <coretypes/event.h>
+#include <coretypes/dictobject_factory.h>
+
+BEGIN_NAMESPACE_DISCOVERY
+
+/*
+ * Context-wide cache of mDNS discovery results, shared by all client modules of an openDAQ instance.
+ *
+ * Each module registers the service types it is interested in. A single passive listener keeps the
+ * devices of all registered service types up to date, so the modules can list the available devices
+ * without sending a query and waiting for the responses on every call. The listener is started on the
+ * first call of getDevices or when one of the events is retrieved.
+ *
+ * Devices are exchanged as dictionaries; use MdnsDiscoveredDeviceToDict and MdnsDiscoveredDeviceFromDict
+ * to convert them.
+ */
+DECLARE_OPENDAQ_INTERFACE(IMdnsDiscoveryCache, IBaseObject)
+{
+    // [elementType(serviceNames, IString)]
+    virtual ErrCode INTERFACE_FUNC addServiceNames(IList* serviceNames) = 0;
+
+    // [elementType(devices, IDict)]
+    // Waits for the initial discovery window if the service was just added or the listener was just started.
+    virtual ErrCode INTERFACE_FUNC getDevices(IString* serviceName, IList** devices) = 0;
+
+    // [templateType(event, IDict, IEventArgs)]
+    // Triggered with the device dictionary as the sender whenever a device appears or its records change.
+    virtual ErrCode INTERFACE_FUNC getOnDeviceAdded(IEvent** event) = 0;
+
+    // [templateType(event, IDict, IEventArgs)]
+    // Triggered with the device dictionary as the sender whenever a device disappears or its records change.
+    virtual ErrCode INTERFACE_FUNC getOnDeviceRemoved(IEvent** event) = 0;
+};
+
+ObjectPtr<IMdnsDiscoveryCache> MdnsDiscoveryCache(std::chrono::milliseconds initialDiscoveryDuration = 500ms);
+
+DictPtr<IString, IBaseObject> MdnsDiscoveredDeviceToDict(const MdnsDiscoveredDevice& device);
+MdnsDiscoveredDevice MdnsDiscoveredDeviceFromDict(const DictPtr<IString, IBaseObject>& dict);
+
+END_NAMESPACE_DISCOVERY
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <daq_discovery/mdns_discovery_cache.h>
+#include <daq_discovery/mdnsdiscovery_listener.h>
+#include <coretypes/intfs.h>
+#include <coretypes/event_emitter.h>
+#include <coretypes/event_args_ptr.h>
+
+BEGIN_NAMESPACE_DISCOVERY
+
+class MdnsDiscoveryCacheImpl : public ImplementationOf<IMdnsDiscoveryCache>
+{
+public:
+    explicit MdnsDiscoveryCacheImpl(std::chrono::milliseconds initialDiscoveryDuration);
+
+    ErrCode INTERFACE_FUNC addServiceNames(IList* serviceNames) override;
+    ErrCode INTERFACE_FUNC getDevices(IString* serviceName, IList** devices) override;
+    ErrCode INTERFACE_FUNC getOnDeviceAdded(IEvent** event) override;
+    ErrCode INTERFACE_FUNC getOnDeviceRemoved(IEvent** event) override;
+
+    // Gives access to the listener, e.g. for tests to inject records
+    MDNSDiscoveryListener& getListener();
+
+private:
+    void onDevicesChanged(const std::vector<MdnsDiscoveredDevice>& added, const std::vector<MdnsDiscoveredDevice>& removed);
+
+    EventEmitter<DictPtr<IString, IBaseObject>, EventArgsPtr<>> deviceAddedEvent;
+    EventEmitter<DictPtr<IString, IBaseObject>, EventArgsPtr<>> deviceRemovedEvent;
+
+    // declared last, so the listener thread is stopped before the events are destroyed
+    MDNSDiscoveryListener listener;
+};
+
+END_NAMESPACE_DISCOVERY
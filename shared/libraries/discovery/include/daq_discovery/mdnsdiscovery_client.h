@@ -99,6 +99,12 @@ public:
                                           const discovery_common::TxtProperties& reqProps,
                                           discovery_common::TxtProperties& resProps);
 
+    // Socket and address helpers, also used by MDNSDiscoveryListener
+    static void openClientSockets(std::vector<std::pair<int, unsigned int>>& sockets);
+    static std::string ipv4AddressToString(const sockaddr_in* addr, size_t addrlen);
+    static std::string ipv6AddressToString(const sockaddr_in6* addr, size_t addrlen, const sockaddr_in6* from);
+    static std::string getIpv6NetworkInterface(const struct sockaddr_in6* from, size_t addrlen);
+
 protected:
     typedef struct
     {
@@ -169,7 +175,6 @@ private:
                                    const discovery_common::TxtProperties& props,
                                    std::vector<mdns_record_t>& records);
     void setupDiscoveryQuery();
-    void openClientSockets(std::vector<std::pair<int, unsigned int>>& sockets);
     std::vector<MdnsDiscoveredDevice> createDevices();
     void sendDiscoveryQuery();
 
@@ -236,10 +241,6 @@ private:
                                      std::string& rpcErrorMessage,
                                      discovery_common::TxtProperties& resProps);
 
-    std::string ipv4AddressToString(const sockaddr_in* addr, size_t addrlen);
-    std::string ipv6AddressToString(const sockaddr_in6* addr, size_t addrlen, const sockaddr_in6* from);
-    std::string getIpv6NetworkInterface(const struct sockaddr_in6* from, size_t addrlen);
-
     std::vector<mdns_query_t> discoveryQueries;
     std::vector<std::string> serviceNames;
     std::thread discoveryThread;
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <daq_discovery/mdnsdiscovery_client.h>
+#include <algorithm>
+#include <functional>
+
+BEGIN_NAMESPACE_DISCOVERY
+
+/*
+ * Passive mDNS browser that keeps a TTL-aware cache of the devices of a set of service types.
+ *
+ * A single background thread listens on the mDNS port for announcements, goodbyes and responses to
+ * any query on the network. It only sends its own queries when a service type is added, when cached
+ * records reach 80% of their TTL, on explicit request and periodically with an increasing interval.
+ * Devices are built from the cached PTR, SRV, TXT, A and AAAA records the same way as in
+ * MDNSDiscoveryClient, and the changes are reported through the devices changed callback.
+ */
+class MDNSDiscoveryListener
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using DevicesChangedCallback = std::function<void(const std::vector<MdnsDiscoveredDevice>& added,
+                                                      const std::vector<MdnsDiscoveredDevice>& removed)>;
+
+    explicit MDNSDiscoveryListener(std::chrono::milliseconds initialDiscoveryDuration = 500ms);
+    ~MDNSDiscoveryListener();
+
+    MDNSDiscoveryListener(const MDNSDiscoveryListener&) = delete;
+    MDNSDiscoveryListener& operator=(const MDNSDiscoveryListener&) = delete;
+
+    // Must be set before the listener is started; changed devices are reported as removed and added
+    void setDevicesChangedCallback(DevicesChangedCallback callback);
+
+    void addServiceNames(const std::vector<std::string>& serviceNames);
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    // Starts the listener if needed and waits until the initial discovery window of the service has passed
+    std::vector<MdnsDiscoveredDevice> getDevices(const std::string& serviceName);
+    // Returns the devices of the service known at the moment, without starting the listener or waiting
+    std::vector<MdnsDiscoveredDevice> getCachedDevices(const std::string& serviceName) const;
+    // Sends a query on the next iteration of the listener thread, rate limited to one per second
+    void requestQuery();
+
+    // Store a received record; called by the listener thread, and by tests to inject records without a network.
+    // A TTL of zero marks a goodbye, which removes the record one second after `now`.
+    void addPtrRecord(std::string serviceName, std::string serviceInstance, uint32_t ttl, Clock::time_point now);
+    void addSrvRecord(std::string serviceInstance,
+                      std::string serviceQualified,
+                      uint16_t priority,
+                      uint16_t weight,
+                      uint16_t port,
+                      uint32_t ttl,
+                      Clock::time_point now);
+    void addAddressRecord(const std::string& address, bool ipv6, std::string serviceQualified, uint32_t ttl, Clock::time_point now);
+    void addTxtRecord(std::string serviceInstance, discovery_common::TxtProperties properties, uint32_t ttl, Clock::time_point now);
+
+    // Removes the records expired at `now` and reports the resulting device changes
+    void processRecords(Clock::time_point now);
+
+private:
+
+    struct PtrRecord
+    {
+        std::string serviceName;
+        Clock::time_point expires;
+        Clock::time_point refreshAt;
+        bool refreshQueried;
+    };
+
+    struct SrvRecord
+    {
+        std::string serviceQualified;
+        uint16_t priority;
+        uint16_t weight;
+        uint16_t port;
+        Clock::time_point expires;
+    };
+
+    struct AddressRecord
+    {
+        std::string serviceQualified;
+        Clock::time_point expires;
+    };
+
+    struct TxtRecord
+    {
+        discovery_common::TxtProperties properties;
+        Clock::time_point expires;
+    };
+
+    static int recordCallback(int sock,
+                              const sockaddr* from,
+                              size_t addrlen,
+                              mdns_entry_type_t entry,
+                              uint16_t query_id,
+                              uint16_t rtype,
+                              uint16_t rclass,
+                              uint32_t ttl,
+                              const void* buffer,
+                              size_t size,
+                              size_t rname_offset,
+                              size_t rname_length,
+                              size_t rdata_offset,
+                              size_t rdata_length,
+                              void* user_data,
+                              uint8_t opcode);
+
+    void handleRecord(const sockaddr* from,
+                      uint16_t rtype,
+                      uint32_t ttl,
+                      const void* buffer,
+                      size_t size,
+                      size_t rname_offset,
+                      size_t rdata_offset,
+                      size_t rdata_length);
+
+    void run();
+    void openSockets();
+    void closeSockets();
+    void receive(int socket);
+    void sendQuery();
+    bool refreshRecords(Clock::time_point now);
+    bool removeExpiredRecords(Clock::time_point now);
+    void updateDevices();
+    std::vector<MdnsDiscoveredDevice> buildDevices() const;
+
+    template <typename TRecord>
+    static void setExpiry(TRecord& record, uint32_t ttl, Clock::time_point now);
+
+    static bool equalDevices(const MdnsDiscoveredDevice& lhs, const MdnsDiscoveredDevice& rhs);
+
+    const std::chrono::milliseconds initialDiscoveryDuration;
+    DevicesChangedCallback devicesChangedCallback;
+
+    // guards the service names, records and devices
+    mutable std::mutex sync;
+    std::vector<std::string> serviceNames;
+    std::unordered_map<std::string, Clock::time_point> serviceReadyAt;
+
+    // Key is serviceInstance
+    std::unordered_map<std::string, PtrRecord> ptrRecords;
+    // Key is serviceInstance
+    std::unordered_map<std::string, SrvRecord> srvRecords;
+    // Key is IPv4 address
+    std::unordered_map<std::string, AddressRecord> aRecords;
+    // Key is IPv6 address
+    std::unordered_map<std::string, AddressRecord> aaaaRecords;
+    // Key is serviceInstance
+    std::unordered_map<std::string, TxtRecord> txtRecords;
+    bool recordsChanged = false;
+
+    // Key is serviceInstance
+    std::unordered_map<std::string, MdnsDiscoveredDevice> devices;
+
+    std::thread listenerThread;
+    std::atomic_bool running;
+    std::atomic_bool queryRequested;
+    std::atomic_bool serviceNamesAdded;
+
+    // listener thread state
+    std::vector<std::pair<int, unsigned int>> sockets;
+    Clock::time_point lastQuery;
+    Clock::time_point nextQuery;
+    std::chrono::milliseconds queryInterval;
+};
+
+END_NAMESPACE_DISCOVERY
@@ -12,8 +12,20 @@ DiscoveryClient::DiscoveryClient(std::unordered_set<std::string> requiredCaps)
 
 void DiscoveryClient::initMdnsClient(const ListPtr<IString>& serviceNames, std::chrono::milliseconds discoveryDuration)
 {
+    this->serviceNames = serviceNames;
     mdnsClient = std::make_shared<MDNSDiscoveryClient>(serviceNames);
     mdnsClient->setDiscoveryDuration(discoveryDuration);
+
+    if (discoveryCache.assigned())
+        checkErrorInfo(discoveryCache->addServiceNames(serviceNames));
+}
+
+void DiscoveryClient::setDiscoveryCache(const BaseObjectPtr& discoveryCache)
+{
+    this->discoveryCache = discoveryCache.assigned() ? discoveryCache.asPtrOrNull<IMdnsDiscoveryCache>(true) : nullptr;
+
+    if (this->discoveryCache.assigned() && serviceNames.assigned())
+        checkErrorInfo(this->discoveryCache->addServiceNames(serviceNames));
 }
 
 std::vector<MdnsDiscoveredDevice> DiscoveryClient::discoverMdnsDevices() const
@@ -22,7 +34,21 @@ std::vector<MdnsDiscoveredDevice> DiscoveryClient::discoverMdnsDevices() const
     if (mdnsClient == nullptr)
         return discovered;
 
-    auto mdnsDevices = mdnsClient->getAvailableDevices();
+    std::vector<MdnsDiscoveredDevice> mdnsDevices;
+    if (discoveryCache.assigned())
+    {
+        for (const auto& serviceName : serviceNames)
+        {
+            ListPtr<IDict> cachedDevices;
+            checkErrorInfo(discoveryCache->getDevices(serviceName, &cachedDevices));
+            for (const auto& device : cachedDevices)
+                mdnsDevices.push_back(MdnsDiscoveredDeviceFromDict(device));
+        }
+    }
+    else
+    {
+        mdnsDevices = mdnsClient->getAvailableDevices();
+    }
 
     for (auto& device : mdnsDevices)
     {
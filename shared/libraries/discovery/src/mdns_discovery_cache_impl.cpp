@@ -0,0 +1,161 @@
+#include <daq_discovery/mdns_discovery_cache_impl.h>
+#include <coretypes/event_args_factory.h>
+#include <coretypes/validation.h>
+#include <coretypes/integer_factory.h>
+#include <coretypes/stringobject_factory.h>
+
+BEGIN_NAMESPACE_DISCOVERY
+
+MdnsDiscoveryCacheImpl::MdnsDiscoveryCacheImpl(std::chrono::milliseconds initialDiscoveryDuration)
+    : listener(initialDiscoveryDuration)
+{
+    listener.setDevicesChangedCallback(
+        [this](const std::vector<MdnsDiscoveredDevice>& added, const std::vector<MdnsDiscoveredDevice>& removed)
+        {
+            onDevicesChanged(added, removed);
+        });
+}
+
+ErrCode MdnsDiscoveryCacheImpl::addServiceNames(IList* serviceNames)
+{
+    OPENDAQ_PARAM_NOT_NULL(serviceNames);
+
+    return daqTry([&]
+    {
+        std::vector<std::string> names;
+        for (const auto& name : ListPtr<IString>::Borrow(serviceNames))
+            names.push_back(name.toStdString());
+
+        listener.addServiceNames(names);
+    });
+}
+
+ErrCode MdnsDiscoveryCacheImpl::getDevices(IString* serviceName, IList** devices)
+{
+    OPENDAQ_PARAM_NOT_NULL(serviceName);
+    OPENDAQ_PARAM_NOT_NULL(devices);
+
+    return daqTry([&]
+    {
+        auto devicesList = List<IDict>();
+        for (const auto& device : listener.getDevices(StringPtr::Borrow(serviceName).toStdString()))
+            devicesList.pushBack(MdnsDiscoveredDeviceToDict(device));
+
+        *devices = devicesList.detach();
+    });
+}
+
+ErrCode MdnsDiscoveryCacheImpl::getOnDeviceAdded(IEvent** event)
+{
+    OPENDAQ_PARAM_NOT_NULL(event);
+
+    listener.start();
+    *event = deviceAddedEvent.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode MdnsDiscoveryCacheImpl::getOnDeviceRemoved(IEvent** event)
+{
+    OPENDAQ_PARAM_NOT_NULL(event);
+
+    listener.start();
+    *event = deviceRemovedEvent.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
+MDNSDiscoveryListener& MdnsDiscoveryCacheImpl::getListener()
+{
+    return listener;
+}
+
+void MdnsDiscoveryCacheImpl::onDevicesChanged(const std::vector<MdnsDiscoveredDevice>& added,
+                                              const std::vector<MdnsDiscoveredDevice>& removed)
+{
+    try
+    {
+        if (deviceRemovedEvent.hasListeners())
+        {
+            for (const auto& device : removed)
+            {
+                auto deviceDict = MdnsDiscoveredDeviceToDict(device);
+                deviceRemovedEvent(deviceDict, EventArgs(1, "DeviceRemoved"));
+            }
+        }
+
+        if (deviceAddedEvent.hasListeners())
+        {
+            for (const auto& device : added)
+            {
+                auto deviceDict = MdnsDiscoveredDeviceToDict(device);
+                deviceAddedEvent(deviceDict, EventArgs(0, "DeviceAdded"));
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        printf("MdnsDiscoveryCache: device event handler failed with the error %s\n", e.what());
+    }
+}
+
+ObjectPtr<IMdnsDiscoveryCache> MdnsDiscoveryCache(std::chrono::milliseconds initialDiscoveryDuration)
+{
+    return ObjectPtr<IMdnsDiscoveryCache>(createWithImplementation<IMdnsDiscoveryCache, MdnsDiscoveryCacheImpl>(initialDiscoveryDuration));
+}
+
+DictPtr<IString, IBaseObject> MdnsDiscoveredDeviceToDict(const MdnsDiscoveredDevice& device)
+{
+    auto ipv4Addresses = List<IString>();
+    for (const auto& address : device.ipv4Addresses)
+        ipv4Addresses.pushBack(address);
+
+    auto ipv6Addresses = List<IString>();
+    for (const auto& address : device.ipv6Addresses)
+        ipv6Addresses.pushBack(address);
+
+    auto properties = Dict<IString, IString>();
+    for (const auto& [key, value] : device.properties)
+        properties.set(key, value);
+
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("canonicalName", String(device.canonicalName));
+    dict.set("serviceName", String(device.serviceName));
+    dict.set("serviceInstance", String(device.serviceInstance));
+    dict.set("servicePriority", Integer(device.servicePriority));
+    dict.set("serviceWeight", Integer(device.serviceWeight));
+    dict.set("servicePort", Integer(device.servicePort));
+    dict.set("ipv4Addresses", ipv4Addresses);
+    dict.set("ipv6Addresses", ipv6Addresses);
+    dict.set("properties", properties);
+    return dict;
+}
+
+MdnsDiscoveredDevice MdnsDiscoveredDeviceFromDict(const DictPtr<IString, IBaseObject>& dict)
+{
+    MdnsDiscoveredDevice device{};
+    device.canonicalName = StringPtr(dict.get("canonicalName")).toStdString();
+    device.serviceName = StringPtr(dict.get("serviceName")).toStdString();
+    device.serviceInstance = StringPtr(dict.get("serviceInstance")).toStdString();
+    device.servicePriority = static_cast<uint32_t>(static_cast<Int>(dict.get("servicePriority")));
+    device.serviceWeight = static_cast<uint32_t>(static_cast<Int>(dict.get("serviceWeight")));
+    device.servicePort = static_cast<uint32_t>(static_cast<Int>(dict.get("servicePort")));
+
+    for (const auto& address : ListPtr<IString>(dict.get("ipv4Addresses")))
+        device.ipv4Addresses.insert(address.toStdString());
+
+    for (const auto& address : ListPtr<IString>(dict.get("ipv6Addresses")))
+        device.ipv6Addresses.insert(address.toStdString());
+
+    for (const auto& [key, value] : DictPtr<IString, IString>(dict.get("properties")))
+        device.properties.emplace(key.toStdString(), value.toStdString());
+
+    // Kept to maintain API compatibility
+    if (!device.ipv4Addresses.empty())
+        device.ipv4Address = *device.ipv4Addresses.begin();
+
+    if (!device.ipv6Addresses.empty())
+        device.ipv6Address = *device.ipv6Addresses.begin();
+
+    return device;
+}
+
+END_NAMESPACE_DISCOVERY
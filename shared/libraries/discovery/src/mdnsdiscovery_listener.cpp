@@ -0,0 +1,651 @@
+#include <daq_discovery/mdnsdiscovery_listener.h>
+
+BEGIN_NAMESPACE_DISCOVERY
+
+namespace
+{
+    constexpr std::chrono::milliseconds MinQueryInterval = 1s;
+    constexpr std::chrono::milliseconds MaxQueryInterval = 60s;
+    // upper bound of a single wait on the sockets, so that stop() does not block for long
+    constexpr std::chrono::milliseconds PollInterval = 100ms;
+    // RFC 6762, 10.1: records with a TTL of zero are removed one second later
+    constexpr std::chrono::milliseconds GoodbyeDelay = 1s;
+}
+
+MDNSDiscoveryListener::MDNSDiscoveryListener(std::chrono::milliseconds initialDiscoveryDuration)
+    : initialDiscoveryDuration(initialDiscoveryDuration)
+    , running(false)
+    , queryRequested(false)
+    , serviceNamesAdded(false)
+    , queryInterval(MinQueryInterval)
+{
+#ifdef _WIN32
+    WORD versionWanted = MAKEWORD(1, 1);
+    WSADATA wsaData;
+    if (WSAStartup(versionWanted, &wsaData))
+        throw std::runtime_error("MDNSDiscoveryListener::Failed to initialize WinSock");
+#endif
+}
+
+MDNSDiscoveryListener::~MDNSDiscoveryListener()
+{
+    stop();
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+void MDNSDiscoveryListener::setDevicesChangedCallback(DevicesChangedCallback callback)
+{
+    devicesChangedCallback = std::move(callback);
+}
+
+void MDNSDiscoveryListener::addServiceNames(const std::vector<std::string>& names)
+{
+    std::scoped_lock lock(sync);
+
+    bool added = false;
+    for (auto name : names)
+    {
+        coretype_utils::toLowerCase(name);
+        if (std::find(serviceNames.begin(), serviceNames.end(), name) != serviceNames.end())
+            continue;
+
+        if (running)
+            serviceReadyAt[name] = Clock::now() + initialDiscoveryDuration;
+        serviceNames.push_back(std::move(name));
+        added = true;
+    }
+
+    if (added)
+        serviceNamesAdded = true;
+}
+
+void MDNSDiscoveryListener::start()
+{
+    std::scoped_lock lock(sync);
+    if (running)
+        return;
+
+    const auto readyAt = Clock::now() + initialDiscoveryDuration;
+    for (const auto& name : serviceNames)
+        serviceReadyAt[name] = readyAt;
+
+    running = true;
+    listenerThread = std::thread(&MDNSDiscoveryListener::run, this);
+}
+
+void MDNSDiscoveryListener::stop()
+{
+    {
+        std::scoped_lock lock(sync);
+        if (!running)
+            return;
+        running = false;
+    }
+
+    if (listenerThread.joinable())
+        listenerThread.join();
+}
+
+bool MDNSDiscoveryListener::isRunning() const
+{
+    return running;
+}
+
+std::vector<MdnsDiscoveredDevice> MDNSDiscoveryListener::getDevices(const std::string& serviceName)
+{
+    start();
+
+    auto name = serviceName;
+    coretype_utils::toLowerCase(name);
+
+    Clock::time_point readyAt;
+    {
+        std::scoped_lock lock(sync);
+        const auto it = serviceReadyAt.find(name);
+        if (it == serviceReadyAt.end())
+            return {};
+        readyAt = it->second;
+    }
+
+    if (Clock::now() < readyAt)
+        std::this_thread::sleep_until(readyAt);
+    else
+        requestQuery();
+
+    return getCachedDevices(name);
+}
+
+std::vector<MdnsDiscoveredDevice> MDNSDiscoveryListener::getCachedDevices(const std::string& serviceName) const
+{
+    auto name = serviceName;
+    coretype_utils::toLowerCase(name);
+
+    std::vector<MdnsDiscoveredDevice> result;
+    std::scoped_lock lock(sync);
+    for (const auto& [_, device] : devices)
+    {
+        if (device.serviceName == name)
+            result.push_back(device);
+    }
+
+    return result;
+}
+
+void MDNSDiscoveryListener::requestQuery()
+{
+    queryRequested = true;
+}
+
+int MDNSDiscoveryListener::recordCallback(int sock,
+                                          const sockaddr* from,
+                                          size_t addrlen,
+                                          mdns_entry_type_t entry,
+                                          uint16_t query_id,
+                                          uint16_t rtype,
+                                          uint16_t rclass,
+                                          uint32_t ttl,
+                                          const void* buffer,
+                                          size_t size,
+                                          size_t rname_offset,
+                                          size_t rname_length,
+                                          size_t rdata_offset,
+                                          size_t rdata_length,
+                                          void* user_data,
+                                          uint8_t opcode)
+{
+    // ignore non-discovery responses
+    if (opcode)
+        return 0;
+
+    if (entry == MDNS_ENTRYTYPE_QUESTION)
+        return 0;
+
+    static_cast<MDNSDiscoveryListener*>(user_data)->handleRecord(from, rtype, ttl, buffer, size, rname_offset, rdata_offset, rdata_length);
+    return 0;
+}
+
+template <typename TRecord>
+void MDNSDiscoveryListener::setExpiry(TRecord& record, uint32_t ttl, Clock::time_point now)
+{
+    record.expires = now + (ttl ? std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(ttl)) : GoodbyeDelay);
+}
+
+void MDNSDiscoveryListener::handleRecord(const sockaddr* from,
+                                         uint16_t rtype,
+                                         uint32_t ttl,
+                                         const void* buffer,
+                                         size_t size,
+                                         size_t rname_offset,
+                                         size_t rdata_offset,
+                                         size_t rdata_length)
+{
+    std::string recordName = discovery_common::DiscoveryUtils::extractRecordName(buffer, rname_offset, size);
+    coretype_utils::toLowerCase(recordName);
+
+    const auto now = Clock::now();
+
+    if (rtype == MDNS_RECORDTYPE_PTR)
+    {
+        char tempBuffer[1024];
+        mdns_string_t ptr = mdns_record_parse_ptr(buffer, size, rdata_offset, rdata_length, tempBuffer, sizeof(tempBuffer));
+        addPtrRecord(recordName, std::string(ptr.str, ptr.length), ttl, now);
+    }
+    else if (rtype == MDNS_RECORDTYPE_SRV)
+    {
+        char tempBuffer[1024];
+        mdns_record_srv_t srv = mdns_record_parse_srv(buffer, size, rdata_offset, rdata_length, tempBuffer, sizeof(tempBuffer));
+        addSrvRecord(recordName, std::string(srv.name.str, srv.name.length), srv.priority, srv.weight, srv.port, ttl, now);
+    }
+    else if (rtype == MDNS_RECORDTYPE_A)
+    {
+        sockaddr_in addr;
+        mdns_record_parse_a(buffer, size, rdata_offset, rdata_length, &addr);
+        addAddressRecord(MDNSDiscoveryClient::ipv4AddressToString(&addr, sizeof(addr)), false, recordName, ttl, now);
+    }
+    else if (rtype == MDNS_RECORDTYPE_AAAA)
+    {
+        sockaddr_in6 addr;
+        mdns_record_parse_aaaa(buffer, size, rdata_offset, rdata_length, &addr);
+
+        const sockaddr_in6* fromIpv6 = nullptr;
+        if (from->sa_family == AF_INET6)
+            fromIpv6 = reinterpret_cast<const sockaddr_in6*>(from);
+
+        addAddressRecord(MDNSDiscoveryClient::ipv6AddressToString(&addr, sizeof(addr), fromIpv6), true, recordName, ttl, now);
+    }
+    else if (rtype == MDNS_RECORDTYPE_TXT)
+    {
+        addTxtRecord(recordName, discovery_common::DiscoveryUtils::readTxtRecord(size, buffer, rdata_offset, rdata_length), ttl, now);
+    }
+}
+
+void MDNSDiscoveryListener::addPtrRecord(std::string serviceName, std::string serviceInstance, uint32_t ttl, Clock::time_point now)
+{
+    coretype_utils::toLowerCase(serviceName);
+    coretype_utils::toLowerCase(serviceInstance);
+
+    std::scoped_lock lock(sync);
+
+    if (std::find(serviceNames.begin(), serviceNames.end(), serviceName) == serviceNames.end())
+        return;
+
+    if (ttl == 0 && !ptrRecords.count(serviceInstance))
+        return;
+
+    auto [it, inserted] = ptrRecords.try_emplace(serviceInstance);
+    auto& record = it->second;
+    if (inserted || record.serviceName != serviceName)
+    {
+        record.serviceName = serviceName;
+        recordsChanged = true;
+    }
+
+    setExpiry(record, ttl, now);
+    // RFC 6762, 5.2: query for the record again when 80% of its TTL has passed
+    record.refreshAt = now + std::chrono::duration_cast<Clock::duration>(std::chrono::milliseconds(ttl) * 800);
+    record.refreshQueried = ttl == 0;
+}
+
+void MDNSDiscoveryListener::addSrvRecord(std::string serviceInstance,
+                                         std::string serviceQualified,
+                                         uint16_t priority,
+                                         uint16_t weight,
+                                         uint16_t port,
+                                         uint32_t ttl,
+                                         Clock::time_point now)
+{
+    coretype_utils::toLowerCase(serviceInstance);
+    coretype_utils::toLowerCase(serviceQualified);
+
+    std::scoped_lock lock(sync);
+
+    if (ttl == 0 && !srvRecords.count(serviceInstance))
+        return;
+
+    auto [it, inserted] = srvRecords.try_emplace(serviceInstance);
+    auto& record = it->second;
+    if (inserted || record.serviceQualified != serviceQualified || record.priority != priority ||
+        record.weight != weight || record.port != port)
+    {
+        record.serviceQualified = serviceQualified;
+        record.priority = priority;
+        record.weight = weight;
+        record.port = port;
+        recordsChanged = true;
+    }
+
+    setExpiry(record, ttl, now);
+}
+
+void MDNSDiscoveryListener::addAddressRecord(const std::string& address,
+                                             bool ipv6,
+                                             std::string serviceQualified,
+                                             uint32_t ttl,
+                                             Clock::time_point now)
+{
+    if (address.empty())
+        return;
+
+    coretype_utils::toLowerCase(serviceQualified);
+
+    std::scoped_lock lock(sync);
+
+    auto& records = ipv6 ? aaaaRecords : aRecords;
+    if (ttl == 0 && !records.count(address))
+        return;
+
+    auto [it, inserted] = records.try_emplace(address);
+    auto& record = it->second;
+    if (inserted || record.serviceQualified != serviceQualified)
+    {
+        record.serviceQualified = serviceQualified;
+        recordsChanged = true;
+    }
+
+    setExpiry(record, ttl, now);
+}
+
+void MDNSDiscoveryListener::addTxtRecord(std::string serviceInstance,
+                                         discovery_common::TxtProperties properties,
+                                         uint32_t ttl,
+                                         Clock::time_point now)
+{
+    coretype_utils::toLowerCase(serviceInstance);
+
+    std::scoped_lock lock(sync);
+
+    if (ttl == 0 && !txtRecords.count(serviceInstance))
+        return;
+
+    auto [it, inserted] = txtRecords.try_emplace(serviceInstance);
+    auto& record = it->second;
+    if (inserted || record.properties != properties)
+    {
+        record.properties = std::move(properties);
+        recordsChanged = true;
+    }
+
+    setExpiry(record, ttl, now);
+}
+
+void MDNSDiscoveryListener::processRecords(Clock::time_point now)
+{
+    bool changed;
+    {
+        std::scoped_lock lock(sync);
+        changed = removeExpiredRecords(now);
+        changed |= recordsChanged;
+        recordsChanged = false;
+    }
+
+    if (changed)
+        updateDevices();
+}
+
+void MDNSDiscoveryListener::run()
+{
+    openSockets();
+
+    lastQuery = Clock::time_point{};
+    nextQuery = Clock::now();
+    queryInterval = MinQueryInterval;
+
+    while (running)
+    {
+        auto now = Clock::now();
+
+        if (serviceNamesAdded.exchange(false))
+        {
+            queryInterval = MinQueryInterval;
+            nextQuery = now;
+        }
+
+        if (queryRequested.exchange(false))
+            nextQuery = std::min(nextQuery, std::max(now, lastQuery + MinQueryInterval));
+
+        const bool scheduledQuery = now >= nextQuery;
+        if (scheduledQuery || refreshRecords(now))
+        {
+            if (sockets.empty())
+                openSockets();
+
+            sendQuery();
+            lastQuery = now;
+
+            if (scheduledQuery)
+            {
+                nextQuery = now + queryInterval;
+                queryInterval = std::min(queryInterval * 2, MaxQueryInterval);
+            }
+        }
+
+        if (sockets.empty())
+        {
+            std::this_thread::sleep_for(PollInterval);
+            continue;
+        }
+
+        const auto untilQuery = std::chrono::duration_cast<std::chrono::microseconds>(nextQuery - now);
+        const auto timeoutDuration = std::clamp(untilQuery, std::chrono::microseconds(0), std::chrono::microseconds(PollInterval));
+
+        timeval timeout;
+        timeout.tv_sec = 0;
+        timeout.tv_usec = static_cast<decltype(timeout.tv_usec)>(timeoutDuration.count());
+
+        int nfds = 0;
+        fd_set readfs;
+        FD_ZERO(&readfs);
+        for (auto [socket, _] : sockets)
+        {
+            if (socket >= nfds)
+                nfds = socket + 1;
+            FD_SET((u_int) socket, &readfs);
+        }
+
+        if (select(nfds, &readfs, 0, 0, &timeout) > 0)
+        {
+            for (auto [socket, _] : sockets)
+            {
+                if (FD_ISSET(socket, &readfs))
+                    receive(socket);
+            }
+        }
+
+        processRecords(Clock::now());
+    }
+
+    closeSockets();
+}
+
+void MDNSDiscoveryListener::openSockets()
+{
+    try
+    {
+        MDNSDiscoveryClient::openClientSockets(sockets);
+    }
+    catch (const std::exception& e)
+    {
+        printf("MDNSDiscoveryListener: opening client sockets failed with the error %s\n", e.what());
+    }
+
+    {
+        struct sockaddr_in sock_addr;
+        memset(&sock_addr, 0, sizeof(struct sockaddr_in));
+        sock_addr.sin_family = AF_INET;
+#if defined(_WIN32) && !defined(__MINGW32__)
+        sock_addr.sin_addr = in4addr_any;
+#else
+        sock_addr.sin_addr.s_addr = INADDR_ANY;
+#endif
+        sock_addr.sin_port = htons(MDNS_PORT);
+#ifdef __APPLE__
+        sock_addr.sin_len = sizeof(struct sockaddr_in);
+#endif
+        int sock = mdns_socket_open_ipv4(&sock_addr);
+        if (sock >= 0)
+            sockets.emplace_back(sock, 0);
+    }
+
+    {
+        struct sockaddr_in6 sock_addr;
+        memset(&sock_addr, 0, sizeof(struct sockaddr_in6));
+        sock_addr.sin6_family = AF_INET6;
+        sock_addr.sin6_addr = in6addr_any;
+        sock_addr.sin6_port = htons(MDNS_PORT);
+#ifdef __APPLE__
+        sock_addr.sin6_len = sizeof(struct sockaddr_in6);
+#endif
+        int sock = mdns_socket_open_ipv6(&sock_addr, 0);
+        if (sock >= 0)
+            sockets.emplace_back(sock, 0);
+    }
+}
+
+void MDNSDiscoveryListener::closeSockets()
+{
+    for (auto [socket, _] : sockets)
+        mdns_socket_close(socket);
+    sockets.clear();
+}
+
+void MDNSDiscoveryListener::receive(int socket)
+{
+    try
+    {
+        auto availableData = getAvailableData(socket);
+        std::vector<char> buffer(availableData);
+        mdns_query_recv(socket, buffer.data(), availableData, recordCallback, this, 0);
+    }
+    catch (const std::exception& e)
+    {
+        printf("MDNSDiscoveryListener: receiving mDNS records failed with the error %s\n", e.what());
+    }
+}
+
+void MDNSDiscoveryListener::sendQuery()
+{
+    std::vector<std::string> names;
+    {
+        std::scoped_lock lock(sync);
+        names = serviceNames;
+    }
+
+    if (names.empty())
+        return;
+
+    std::vector<mdns_query_t> queries(names.size());
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        queries[i].name = names[i].c_str();
+        queries[i].name_length = names[i].size();
+        queries[i].type = MDNS_RECORDTYPE_PTR;
+    }
+
+    constexpr size_t capacity = 2048;
+    std::vector<char> buffer(capacity);
+    for (auto [socket, ifindex] : sockets)
+        mdns_multiquery_send(socket, queries.data(), queries.size(), buffer.data(), buffer.size(), 0, ifindex);
+}
+
+bool MDNSDiscoveryListener::refreshRecords(Clock::time_point now)
+{
+    std::scoped_lock lock(sync);
+
+    bool refresh = false;
+    for (auto& [_, record] : ptrRecords)
+    {
+        if (!record.refreshQueried && record.refreshAt <= now)
+        {
+            record.refreshQueried = true;
+            refresh = true;
+        }
+    }
+
+    return refresh;
+}
+
+bool MDNSDiscoveryListener::removeExpiredRecords(Clock::time_point now)
+{
+    bool removed = false;
+    const auto removeExpired = [&](auto& records)
+    {
+        for (auto it = records.begin(); it != records.end();)
+        {
+            if (it->second.expires <= now)
+            {
+                it = records.erase(it);
+                removed = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    };
+
+    removeExpired(ptrRecords);
+    removeExpired(srvRecords);
+    removeExpired(aRecords);
+    removeExpired(aaaaRecords);
+    removeExpired(txtRecords);
+    return removed;
+}
+
+void MDNSDiscoveryListener::updateDevices()
+{
+    std::vector<MdnsDiscoveredDevice> added;
+    std::vector<MdnsDiscoveredDevice> removed;
+
+    {
+        std::scoped_lock lock(sync);
+
+        std::unordered_map<std::string, MdnsDiscoveredDevice> current;
+        for (auto& device : buildDevices())
+            current.emplace(device.serviceInstance, std::move(device));
+
+        for (const auto& [serviceInstance, device] : devices)
+        {
+            const auto it = current.find(serviceInstance);
+            if (it == current.end() || !equalDevices(device, it->second))
+                removed.push_back(device);
+        }
+
+        for (const auto& [serviceInstance, device] : current)
+        {
+            const auto it = devices.find(serviceInstance);
+            if (it == devices.end() || !equalDevices(device, it->second))
+                added.push_back(device);
+        }
+
+        devices = std::move(current);
+    }
+
+    if (devicesChangedCallback && (!added.empty() || !removed.empty()))
+        devicesChangedCallback(added, removed);
+}
+
+std::vector<MdnsDiscoveredDevice> MDNSDiscoveryListener::buildDevices() const
+{
+    std::vector<MdnsDiscoveredDevice> result;
+
+    for (const auto& [serviceInstance, ptr] : ptrRecords)
+    {
+        const auto srvIt = srvRecords.find(serviceInstance);
+        if (srvIt == srvRecords.end())
+            continue;
+
+        const auto& srv = srvIt->second;
+
+        auto device = MdnsDiscoveredDevice{};
+        device.serviceName = ptr.serviceName;
+        device.serviceInstance = serviceInstance;
+        device.canonicalName = srv.serviceQualified;
+        device.servicePriority = srv.priority;
+        device.serviceWeight = srv.weight;
+        device.servicePort = srv.port;
+
+        for (const auto& [ipv4, a] : aRecords)
+        {
+            if (a.serviceQualified == srv.serviceQualified)
+                device.ipv4Addresses.insert(ipv4);
+        }
+
+        for (const auto& [ipv6, aaaa] : aaaaRecords)
+        {
+            if (aaaa.serviceQualified == srv.serviceQualified)
+                device.ipv6Addresses.insert(ipv6);
+        }
+
+        if (const auto txtIt = txtRecords.find(serviceInstance); txtIt != txtRecords.end())
+            device.properties = txtIt->second.properties;
+
+        // Kept to maintain API compatibility
+        if (!device.ipv4Addresses.empty())
+            device.ipv4Address = *device.ipv4Addresses.begin();
+
+        if (!device.ipv6Addresses.empty())
+            device.ipv6Address = *device.ipv6Addresses.begin();
+
+        if (!device.ipv4Addresses.empty() || !device.ipv6Addresses.empty())
+            result.push_back(std::move(device));
+    }
+
+    return result;
+}
+
+bool MDNSDiscoveryListener::equalDevices(const MdnsDiscoveredDevice& lhs, const MdnsDiscoveredDevice& rhs)
+{
+    return lhs.serviceName == rhs.serviceName &&
+           lhs.canonicalName == rhs.canonicalName &&
+           lhs.servicePriority == rhs.servicePriority &&
+           lhs.serviceWeight == rhs.serviceWeight &&
+           lhs.servicePort == rhs.servicePort &&
+           lhs.ipv4Addresses == rhs.ipv4Addresses &&
+           lhs.ipv6Addresses == rhs.ipv6Addresses &&
+           lhs.properties == rhs.properties;
+}
+
+END_NAMESPACE_DISCOVERY
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+#include <daq_discovery/mdnsdiscovery_listener.h>
+#include <daq_discovery/mdns_discovery_cache_impl.h>
+#include <coretypes/event_wrapper.h>
+#include <coretypes/listobject_factory.h>
+#include <coretypes/stringobject_factory.h>
+#include <future>
+
+using namespace daq;
+using namespace daq::discovery;
+using namespace std::chrono_literals;
+
+using Clock = MDNSDiscoveryListener::Clock;
+using DeviceDict = DictPtr<IString, IBaseObject>;
+
+static const std::string ServiceName = "_opendaq-test._tcp.local.";
+static const std::string ServiceInstance = "device1._opendaq-test._tcp.local.";
+static const std::string ServiceQualified = "device1.local.";
+
+class MdnsDiscoveryCacheTest : public testing::Test
+{
+protected:
+    static void addDeviceRecords(MDNSDiscoveryListener& listener, uint32_t ttl, Clock::time_point now)
+    {
+        listener.addPtrRecord(ServiceName, ServiceInstance, ttl, now);
+        listener.addSrvRecord(ServiceInstance, ServiceQualified, 1, 2, 7420, ttl, now);
+        listener.addAddressRecord("192.168.1.10", false, ServiceQualified, ttl, now);
+        listener.addAddressRecord("fe80::1", true, ServiceQualified, ttl, now);
+        listener.addTxtRecord(ServiceInstance, {{"model", "test"}}, ttl, now);
+    }
+};
+
+TEST_F(MdnsDiscoveryCacheTest, DevicesBuiltFromRecords)
+{
+    MDNSDiscoveryListener listener;
+    listener.addServiceNames({ServiceName});
+
+    const auto now = Clock::now();
+    addDeviceRecords(listener, 120, now);
+    // records of services that were not added are ignored
+    listener.addPtrRecord("_other._tcp.local.", "device2._other._tcp.local.", 120, now);
+    listener.processRecords(now);
+
+    const auto devices = listener.getCachedDevices(ServiceName);
+    ASSERT_EQ(devices.size(), 1u);
+
+    const auto& device = devices[0];
+    ASSERT_EQ(device.serviceName, ServiceName);
+    ASSERT_EQ(device.serviceInstance, ServiceInstance);
+    ASSERT_EQ(device.canonicalName, ServiceQualified);
+    ASSERT_EQ(device.servicePriority, 1u);
+    ASSERT_EQ(device.serviceWeight, 2u);
+    ASSERT_EQ(device.servicePort, 7420u);
+    ASSERT_EQ(device.ipv4Addresses, std::unordered_set<std::string>({"192.168.1.10"}));
+    ASSERT_EQ(device.ipv6Addresses, std::unordered_set<std::string>({"fe80::1"}));
+    ASSERT_EQ(device.getPropertyOrDefault("model"), "test");
+
+    ASSERT_TRUE(listener.getCachedDevices("_other._tcp.local.").empty());
+}
+
+TEST_F(MdnsDiscoveryCacheTest, DeviceWithoutAddressNotListed)
+{
+    MDNSDiscoveryListener listener;
+    listener.addServiceNames({ServiceName});
+
+    const auto now = Clock::now();
+    listener.addPtrRecord(ServiceName, ServiceInstance, 120, now);
+    listener.addSrvRecord(ServiceInstance, ServiceQualified, 0, 0, 7420, 120, now);
+    listener.processRecords(now);
+    ASSERT_TRUE(listener.getCachedDevices(ServiceName).empty());
+
+    listener.addAddressRecord("192.168.1.10", false, ServiceQualified, 120, now);
+    listener.processRecords(now);
+    ASSERT_EQ(listener.getCachedDevices(ServiceName).size(), 1u);
+}
+
+TEST_F(MdnsDiscoveryCacheTest, RecordsExpireAfterTtl)
+{
+    MDNSDiscoveryListener listener;
+    listener.addServiceNames({ServiceName});
+
+    std::vector<MdnsDiscoveredDevice> removedDevices;
+    listener.setDevicesChangedCallback(
+        [&removedDevices](const std::vector<MdnsDiscoveredDevice>&, const std::vector<MdnsDiscoveredDevice>& removed)
+        {
+            removedDevices.insert(removedDevices.end(), removed.begin(), removed.end());
+        });
+
+    const auto now = Clock::now();
+    addDeviceRecords(listener, 120, now);
+    listener.processRecords(now);
+
+    listener.processRecords(now + 119s);
+    ASSERT_EQ(listener.getCachedDevices(ServiceName).size(), 1u);
+    ASSERT_TRUE(removedDevices.empty());
+
+    listener.processRecords(now + 120s);
+    ASSERT_TRUE(listener.getCachedDevices(ServiceName).empty());
+    ASSERT_EQ(removedDevices.size(), 1u);
+    ASSERT_EQ(removedDevices[0].serviceInstance, ServiceInstance);
+}
+
+TEST_F(MdnsDiscoveryCacheTest, RefreshedRecordsDoNotExpire)
+{
+    MDNSDiscoveryListener listener;
+    listener.addServiceNames({ServiceName});
+
+    const auto now = Clock::now();
+    addDeviceRecords(listener, 120, now);
+    listener.processRecords(now);
+
+    addDeviceRecords(listener, 120, now + 100s);
+    listener.processRecords(now + 150s);
+    ASSERT_EQ(listener.getCachedDevices(ServiceName).size(), 1u);
+
+    listener.processRecords(now + 220s);
+    ASSERT_TRUE(listener.getCachedDevices(ServiceName).empty());
+}
+
+TEST_F(MdnsDiscoveryCacheTest, GoodbyeRemovesDevice)
+{
+    MDNSDiscoveryListener listener;
+    listener.addServiceNames({ServiceName});
+
+    const auto now = Clock::now();
+    addDeviceRecords(listener, 120, now);
+    listener.processRecords(now);
+    ASSERT_EQ(listener.getCachedDevices(ServiceName).size(), 1u);
+
+    // a goodbye takes effect one second after it was received
+    listener.addPtrRecord(ServiceName, ServiceInstance, 0, now + 10s);
+    listener.processRecords(now + 10s);
+    ASSERT_EQ(listener.getCachedDevices(ServiceName).size(), 1u);
+
+    listener.processRecords(now + 11s);
+    ASSERT_TRUE(listener.getCachedDevices(ServiceName).empty());
+}
+
+TEST_F(MdnsDiscoveryCacheTest, GoodbyeOfUnknownRecordIgnored)
+{
+    MDNSDiscoveryListener listener;
+    listener.addServiceNames({ServiceName});
+
+    const auto now = Clock::now();
+    listener.addPtrRecord(ServiceName, ServiceInstance, 0, now);
+    addDeviceRecords(listener, 120, now + 1s);
+    listener.processRecords(now + 2s);
+
+    ASSERT_EQ(listener.getCachedDevices(ServiceName).size(), 1u);
+}
+
+TEST_F(MdnsDiscoveryCacheTest, DevicesChangedCallback)
+{
+    MDNSDiscoveryListener listener;
+    listener.addServiceNames({ServiceName});
+
+    std::vector<MdnsDiscoveredDevice> addedDevices;
+    std::vector<MdnsDiscoveredDevice> removedDevices;
+    listener.setDevicesChangedCallback(
+        [&](const std::vector<MdnsDiscoveredDevice>& added, const std::vector<MdnsDiscoveredDevice>& removed)
+        {
+            addedDevices = added;
+            removedDevices = removed;
+        });
+
+    const auto now = Clock::now();
+    addDeviceRecords(listener, 120, now);
+    listener.processRecords(now);
+    ASSERT_EQ(addedDevices.size(), 1u);
+    ASSERT_TRUE(removedDevices.empty());
+
+    // a changed record is reported as the old device removed and the new one added
+    addedDevices.clear();
+    listener.addSrvRecord(ServiceInstance, ServiceQualified, 1, 2, 7421, 120, now);
+    listener.processRecords(now);
+    ASSERT_EQ(addedDevices.size(), 1u);
+    ASSERT_EQ(addedDevices[0].servicePort, 7421u);
+    ASSERT_EQ(removedDevices.size(), 1u);
+    ASSERT_EQ(removedDevices[0].servicePort, 7420u);
+
+    // unchanged records are not reported
+    addedDevices.clear();
+    removedDevices.clear();
+    listener.addSrvRecord(ServiceInstance, ServiceQualified, 1, 2, 7421, 120, now + 10s);
+    listener.addAddressRecord("192.168.1.10", false, ServiceQualified, 120, now + 10s);
+    listener.processRecords(now + 10s);
+    ASSERT_TRUE(addedDevices.empty());
+    ASSERT_TRUE(removedDevices.empty());
+}
+
+TEST_F(MdnsDiscoveryCacheTest, CacheGetDevices)
+{
+    auto cacheImpl = new MdnsDiscoveryCacheImpl(0ms);
+    ObjectPtr<IMdnsDiscoveryCache> cache;
+    checkErrorInfo(cacheImpl->queryInterface(IMdnsDiscoveryCache::Id, reinterpret_cast<void**>(&cache)));
+
+    checkErrorInfo(cache->addServiceNames(List<IString>(String(ServiceName))));
+    addDeviceRecords(cacheImpl->getListener(), 120, Clock::now());
+    cacheImpl->getListener().processRecords(Clock::now());
+
+    ListPtr<IDict> devices;
+    checkErrorInfo(cache->getDevices(String(ServiceName), &devices));
+    ASSERT_EQ(devices.getCount(), 1u);
+
+    const auto device = MdnsDiscoveredDeviceFromDict(devices[0]);
+    ASSERT_EQ(device.serviceInstance, ServiceInstance);
+    ASSERT_EQ(device.servicePort, 7420u);
+    ASSERT_EQ(device.ipv4Address, "192.168.1.10");
+    ASSERT_EQ(device.getPropertyOrDefault("model"), "test");
+
+    checkErrorInfo(cache->getDevices(String("_other._tcp.local."), &devices));
+    ASSERT_EQ(devices.getCount(), 0u);
+}
+
+TEST_F(MdnsDiscoveryCacheTest, CacheDeviceEvents)
+{
+    // declared before the cache, as its listener thread may trigger the events until the cache is destroyed
+    std::promise<std::string> addedPromise;
+    std::promise<std::string> removedPromise;
+
+    auto cacheImpl = new MdnsDiscoveryCacheImpl(0ms);
+    ObjectPtr<IMdnsDiscoveryCache> cache;
+    checkErrorInfo(cacheImpl->queryInterface(IMdnsDiscoveryCache::Id, reinterpret_cast<void**>(&cache)));
+    checkErrorInfo(cache->addServiceNames(List<IString>(String(ServiceName))));
+
+    EventPtr<DeviceDict, EventArgsPtr<>> onDeviceAdded;
+    EventPtr<DeviceDict, EventArgsPtr<>> onDeviceRemoved;
+    checkErrorInfo(cache->getOnDeviceAdded(&onDeviceAdded));
+    checkErrorInfo(cache->getOnDeviceRemoved(&onDeviceRemoved));
+
+    Event<DeviceDict, EventArgsPtr<>>(onDeviceAdded) += [&addedPromise](DeviceDict& device, EventArgsPtr<>&)
+    {
+        addedPromise.set_value(StringPtr(device.get("serviceInstance")).toStdString());
+    };
+    Event<DeviceDict, EventArgsPtr<>>(onDeviceRemoved) += [&removedPromise](DeviceDict& device, EventArgsPtr<>&)
+    {
+        removedPromise.set_value(StringPtr(device.get("serviceInstance")).toStdString());
+    };
+
+    auto& listener = cacheImpl->getListener();
+    const auto now = Clock::now();
+
+    addDeviceRecords(listener, 120, now);
+    listener.processRecords(now);
+
+    auto addedFuture = addedPromise.get_future();
+    ASSERT_EQ(addedFuture.wait_for(1s), std::future_status::ready);
+    ASSERT_EQ(addedFuture.get(), ServiceInstance);
+
+    listener.addPtrRecord(ServiceName, ServiceInstance, 0, now);
+    listener.processRecords(now + 2s);
+
+    auto removedFuture = removedPromise.get_future();
+    ASSERT_EQ(removedFuture.wait_for(1s), std::future_status::ready);
+    ASSERT_EQ(removedFuture.get(), ServiceInstance);
+
+    onDeviceAdded.clear();
+    onDeviceRemoved.clear();
+}
@@ -25,6 +25,8 @@
 #include <config_protocol/config_protocol.h>
 #include <packet_streaming/packet_streaming.h>
 
+#include <atomic>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 static const SizeT UNLIMITED_PACKET_SEND_TIME = 0;
@@ -55,6 +57,10 @@ public:
                                                std::vector<daq::native_streaming::WriteTask>& tasks);
     static void copyHeadersToBuffer(const packet_streaming::PacketBufferPtr& packetBuffer, char* bufferDestPtr);
 
+    // counts the bytes of packet buffers scheduled for writing until the writes complete
+    void enablePendingWriteTracking();
+    size_t getPendingWriteSize() const;
+
     void setConfigPacketReceivedHandler(const ProcessConfigProtocolPacketCb& configPacketReceivedHandler);
     void setPacketBufferReceivedHandler(const OnPacketBufferReceivedCallback& packetBufferReceivedHandler);
 
@@ -66,6 +72,9 @@ public:
     void sendUnsubscribingDone(const SignalNumericIdType signalNumericId);
     void sendSignalSubscribe(const SignalNumericIdType& signalNumericId, const std::string& signalStringId);
     void sendSignalUnsubscribe(const SignalNumericIdType& signalNumericId, const std::string& signalStringId);
+    void sendSharedMemoryInfo(const std::string& name, uint64_t size);
+
+    void setSharedMemoryInfoHandler(const OnSharedMemoryInfoCallback& sharedMemoryInfoHandler);
 
 protected:
     virtual daq::native_streaming::ReadTask readHeader(const void* data, size_t size);
@@ -89,6 +98,8 @@ protected:
         return daq::native_streaming::WriteTask(valuePayload, valuePayloadHandler);
     }
 
+    void trackPendingWrites(std::vector<daq::native_streaming::WriteTask>& tasks);
+
     static void copyData(void* destination, const void* source, size_t bytesToCopy, size_t sourceOffset, size_t sourceSize);
     static std::string getStringFromData(const void* source, size_t stringSize, size_t sourceOffset, size_t sourceSize);
 
@@ -98,6 +109,7 @@ protected:
     daq::native_streaming::ReadTask readSignalUnsubscribedAck(const void* data, size_t size);
     daq::native_streaming::ReadTask readSignalSubscribe(const void* data, size_t size);
     daq::native_streaming::ReadTask readSignalUnsubscribe(const void* data, size_t size);
+    daq::native_streaming::ReadTask readSharedMemoryInfo(const void* data, size_t size);
 
     virtual bool hasUserAccessToSignal(const SignalPtr& signal);
     virtual std::string getClientId();
@@ -111,10 +123,12 @@ protected:
     LoggerComponentPtr loggerComponent;
     bool connectionActivityMonitoringStarted{false};
     std::chrono::milliseconds streamingPacketSendTimeout;
+    std::shared_ptr<std::atomic<size_t>> pendingWriteSize;
 
     OnSignalCallback signalReceivedHandler;
     OnSubscriptionAckCallback subscriptionAckHandler;
     OnFindSignalCallback findSignalHandler;
     OnSignalSubscriptionCallback signalSubscriptionHandler;
+    OnSharedMemoryInfoCallback sharedMemoryInfoHandler;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
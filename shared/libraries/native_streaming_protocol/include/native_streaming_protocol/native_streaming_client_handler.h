@@ -114,6 +114,7 @@ protected:
     void onConnectionFailed(const std::string& errorMessage, const ConnectionResult result);
     void onSessionError(const std::string& errorMessage, SessionPtr session);
     void onPacketBufferReceived(const packet_streaming::PacketBufferPtr& packetBuffer);
+    void handleSharedMemoryInfo(const std::string& name, uint64_t size);
 
     SignalNumericIdType registerSignal(const SignalPtr& signal);
     SignalPtr findClientSignal(const std::string& signalStringId);
@@ -151,6 +152,10 @@ protected:
     // client to device streaming streaming producer
     std::shared_ptr<packet_streaming::PacketStreamingServer> packetStreamingServerPtr;
 
+    // ring of device to client data payloads, if the server is on the same host and shared memory is enabled
+    packet_streaming::SharedMemoryRingPtr sharedMemoryRing;
+    std::mutex sharedMemorySync;
+
     std::promise<ConnectionResult> connectedPromise;
     std::future<ConnectionResult> connectedFuture;
 
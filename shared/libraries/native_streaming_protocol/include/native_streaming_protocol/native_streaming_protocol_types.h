@@ -65,6 +65,9 @@ using ProcessConfigProtocolPacketCb = std::function<void(config_protocol::Packet
 
 using OnTrasportLayerPropertiesCallback = std::function<void(const PropertyObjectPtr& propertyObject)>;
 
+// shared memory ring offered by the server, or accepted by the client, for data packet payloads
+using OnSharedMemoryInfoCallback = std::function<void(const std::string& name, uint64_t size)>;
+
 using OnSignalAvailableCallback = std::function<void(const StringPtr& signalStringId,
                                                      const StringPtr& serializedSignal)>;
 using OnSignalUnavailableCallback = std::function<void(const StringPtr& signalStringId)>;
@@ -86,7 +89,8 @@ enum class PayloadType
     PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_ACK = 8,
     PAYLOAD_TYPE_CONFIGURATION_PACKET = 9,
     PAYLOAD_TYPE_TRANSPORT_LAYER_PROPERTIES = 10,
-    PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST = 11
+    PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST = 11,
+    PAYLOAD_TYPE_SHARED_MEMORY_INFO = 12
 };
 
 constexpr std::initializer_list<PayloadType> allPayloadTypes =
@@ -101,7 +105,8 @@ constexpr std::initializer_list<PayloadType> allPayloadTypes =
         PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_ACK,
         PayloadType::PAYLOAD_TYPE_CONFIGURATION_PACKET,
         PayloadType::PAYLOAD_TYPE_TRANSPORT_LAYER_PROPERTIES,
-        PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST
+        PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST,
+        PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_INFO
     };
 
 inline std::string convertPayloadTypeToString(PayloadType type)
@@ -130,6 +135,8 @@ inline std::string convertPayloadTypeToString(PayloadType type)
             return "PAYLOAD_TYPE_TRANSPORT_LAYER_PROPERTIES";
         case PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST:
             return "PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST";
+        case PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_INFO:
+            return "PAYLOAD_TYPE_SHARED_MEMORY_INFO";
     }
 
     return "PAYLOAD_TYPE_INVALID";
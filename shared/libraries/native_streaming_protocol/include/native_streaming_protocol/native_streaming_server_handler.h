@@ -76,6 +76,8 @@ protected:
     void initSessionHandler(SessionPtr session);
     void handleTransportLayerProps(const PropertyObjectPtr& propertyObject, std::shared_ptr<ServerSessionHandler> sessionHandler);
     void setUpTransportLayerPropsCallback(std::shared_ptr<ServerSessionHandler> sessionHandler);
+    void offerSharedMemory(std::shared_ptr<ServerSessionHandler> sessionHandler);
+    void handleSharedMemoryAccepted(std::shared_ptr<ServerSessionHandler> sessionHandler, const std::string& name);
     void setUpConfigProtocolCallbacks(std::shared_ptr<ServerSessionHandler> sessionHandler,
                                       config_protocol::PacketBuffer&& firstPacketBuffer);
     void connectConfigProtocol(std::shared_ptr<ServerSessionHandler> sessionHandler,
@@ -143,6 +145,8 @@ protected:
     SizeT streamingPacketSendTimeout;
     SizeT packetStreamingReleaseThreshold;
     SizeT cacheablePacketPayloadSizeMax;
+    SizeT streamingFlowControlQueueSize;
+    SizeT streamingFlowControlDecimation;
 
     // streaming-to-device callbacks
     OnSignalAvailableCallback signalAvailableHandler;
@@ -21,6 +21,7 @@
 #include <opendaq/context_ptr.h>
 #include <opendaq/signal_ptr.h>
 #include <opendaq/client_type.h>
+#include <packet_streaming/shared_memory_ring.h>
 
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
@@ -60,6 +61,13 @@ public:
     bool isConfigProtocolUsed();
     void triggerUseConfigProtocol();
 
+    void setSharedMemoryRing(const packet_streaming::SharedMemoryRingPtr& ring);
+    packet_streaming::SharedMemoryRingPtr getSharedMemoryRing();
+    void setSharedMemoryAccepted(bool accepted);
+    bool isSharedMemoryAccepted();
+    void setPayloadCompressionEnabled(bool enabled);
+    bool isPayloadCompressionEnabled();
+
 private:
     daq::native_streaming::ReadTask readHeader(const void* data, size_t size) override;
     daq::native_streaming::ReadTask readTransportLayerProperties(const void* data, size_t size);
@@ -75,5 +83,8 @@ private:
     bool useConfigProtocol;
     ClientType clientType = ClientType::Control;
     bool exclusiveControlDropOthers = false;
+    packet_streaming::SharedMemoryRingPtr sharedMemoryRing;
+    bool sharedMemoryAccepted = false;
+    bool payloadCompressionEnabled = false;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
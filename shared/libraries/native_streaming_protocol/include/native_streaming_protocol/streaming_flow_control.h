@@ -0,0 +1,91 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <native_streaming_protocol/native_streaming_protocol_types.h>
+#include <opendaq/event_packet_ptr.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+static const SizeT UNLIMITED_STREAMING_QUEUE_SIZE = 0;
+static const SizeT STREAMING_DECIMATION_DEFAULT = 10;
+
+namespace streaming_flow_control
+{
+    /*!
+     * Sent to a client for each subscribed low-priority signal when the rate of its data packets changes.
+     * Parameter dictionary elements:
+     *  - "Level" : Int         // StreamingFlowControlLevel
+     *  - "Decimation" : Int    // only every n-th data packet is sent; 1 at full rate, 0 if only the latest one is
+     */
+    const std::string STREAMING_RATE_CHANGED = "STREAMING_RATE_CHANGED";
+    const std::string LEVEL = "Level";
+    const std::string DECIMATION = "Decimation";
+}
+
+enum class StreamingFlowControlLevel : Int
+{
+    FullRate = 0,
+    Decimated,
+    LatestOnly
+};
+
+/*
+ * Adapts the data packet rate of low-priority signals sent to a single streaming client to the size of its
+ * pending write queue. At or above the queue threshold only every n-th data packet is sent; at or above twice
+ * the threshold only the latest data packet of each signal is kept and sent when the queue is next evaluated.
+ * The level is lowered one step once the queue drains below the threshold, and the full rate is restored
+ * below half of it. Event packets and packets of high-priority signals are never withheld; a kept packet is sent
+ * ahead of any later packet of the same signal, so that it is not decoded with a descriptor changed after it.
+ */
+class StreamingFlowControl
+{
+public:
+    StreamingFlowControl(SizeT queueThreshold, SizeT decimation);
+
+    /// Re-evaluates the level from the number of bytes scheduled for writing but not yet written.
+    /// @return true if the level has changed.
+    bool update(SizeT pendingWriteSize);
+    StreamingFlowControlLevel getLevel() const;
+
+    /// Decides whether a data packet of a low-priority signal is sent now. In latest-only mode the packet is
+    /// kept instead, replacing the one kept before for the same signal.
+    /// @return true if the packet should be sent.
+    bool admitDataPacket(SignalNumericIdType signalNumericId, const PacketPtr& packet);
+
+    /// Returns the kept packets ordered by signal numeric ID and clears them.
+    std::vector<std::pair<SignalNumericIdType, PacketPtr>> takeHeldPackets();
+    /// Returns the packet kept for the signal, or an unassigned packet if there is none, and clears it.
+    PacketPtr takeHeldPacket(SignalNumericIdType signalNumericId);
+    void removeSignal(SignalNumericIdType signalNumericId);
+
+    EventPacketPtr createRateChangedEventPacket() const;
+
+private:
+    SizeT queueThreshold;
+    SizeT decimation;
+    StreamingFlowControlLevel level;
+
+    std::unordered_map<SignalNumericIdType, SizeT> decimationCounters;
+    std::map<SignalNumericIdType, PacketPtr> heldPackets;
+};
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <native_streaming_protocol/server_session_handler.h>
+#include <native_streaming_protocol/streaming_flow_control.h>
 
 #include <opendaq/context_ptr.h>
 #include <opendaq/logger_component_ptr.h>
@@ -72,6 +73,7 @@ public:
                                  const SendPacketBufferCallback& sendPacketBufferCb);
 
     /// Pushes packets the packet streaming servers associated with clients subscribed to signals.
+    /// Data packets of low-priority signals are withheld from clients with reduced streaming rate.
     /// @param packetIndices A map of signal ID and information on buffer index/count where the packets of said signals are located in the `packets` vector.
     /// @param packets The openDAQ packets to be processed.
     /// @throw NativeStreamingProtocolException if any signal in the packetIndices map is not registered.
@@ -111,6 +113,32 @@ public:
                         size_t packetStreamingReleaseThreshold,
                         size_t cacheablePacketPayloadSizeMax);
 
+    /// Places the data packet payloads sent to a registered client into a shared memory ring.
+    /// @param clientId The unique string ID of the client.
+    /// @param ring The shared memory ring the client has mapped.
+    /// @return false if the client is not registered as a streaming client.
+    bool setClientSharedMemoryRing(const std::string& clientId, const packet_streaming::SharedMemoryRingPtr& ring);
+
+    /// Enables lossless compression of the data packet payloads sent to a registered client.
+    /// @param clientId The unique string ID of the client.
+    /// @param enabled true if the client has announced that it can decode compressed payloads.
+    /// @return false if the client is not registered as a streaming client.
+    bool setClientPayloadCompressionEnabled(const std::string& clientId, bool enabled);
+
+    /// Adapts the rate of data packets of low-priority signals sent to a registered client to its write queue size.
+    /// @param clientId The unique string ID of the client.
+    /// @param queueThreshold The size in bytes of pending writes above which the rate is reduced.
+    /// @param decimation Only every n-th data packet is sent while the rate is reduced.
+    /// @return false if the client is not registered as a streaming client.
+    bool setClientFlowControl(const std::string& clientId, SizeT queueThreshold, SizeT decimation);
+
+    /// Re-evaluates the streaming rate of a client with flow control. Pushes the data packets kept for the client
+    /// and, if the rate has changed, an event packet announcing the new rate for each of its low-priority signals
+    /// to the associated packet streaming server.
+    /// @param clientId The unique string ID of the client.
+    /// @param pendingWriteSize The size in bytes of packet buffers scheduled for writing to the client but not yet written.
+    void updateClientFlowControl(const std::string& clientId, SizeT pendingWriteSize);
+
     /// Removes a registered client on disconnection.
     /// @param clientId The unique string ID provided by the client or automatically assigned by the server.
     /// @return A list of openDAQ signals which were subscribed to by the client
@@ -206,6 +234,8 @@ private:
         std::unordered_set<std::string> subscribedClientsIds;
         DataDescriptorPtr lastDataDescriptorParam;
         DataDescriptorPtr lastDomainDescriptorParam;
+        // data packets of low-priority signals may be withheld from slow clients
+        bool lowPriority{false};
     };
 
     struct RegisteredClientSignal
@@ -227,6 +257,9 @@ private:
                                                                   size_t cacheableGroupId,
                                                                   std::optional<std::chrono::steady_clock::time_point>& timeStamp);
 
+    static bool isLowPrioritySignal(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor);
+    bool admitDataPacket(const std::string& clientId, SignalNumericIdType signalNumericId, const PacketPtr& packet);
+    void flushHeldPacket(const std::string& clientId, SignalNumericIdType signalNumericId);
     bool removeSignalSubscriberNoLock(const std::string& signalStringId, const std::string& subscribedClientId);
 
     ContextPtr context;
@@ -240,6 +273,7 @@ private:
     std::unordered_map<std::string, PacketStreamingServerPtr> packetStreamingServers;
     std::unordered_set<std::string> streamingClientsIds;
     std::unordered_map<std::string, PacketStreamingClientPtr> packetStreamingClients;
+    std::unordered_map<std::string, StreamingFlowControl> flowControls;
 
     // key: signal global id as it appears on the client
     std::unordered_map<std::string, RegisteredClientSignal> registeredClientSignals;
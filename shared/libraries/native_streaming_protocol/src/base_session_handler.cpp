@@ -84,6 +84,11 @@ void BaseSessionHandler::setPacketBufferReceivedHandler(const OnPacketBufferRece
     this->packetBufferReceivedHandler = packetBufferReceivedHandler;
 }
 
+void BaseSessionHandler::setSharedMemoryInfoHandler(const OnSharedMemoryInfoCallback& sharedMemoryInfoHandler)
+{
+    this->sharedMemoryInfoHandler = sharedMemoryInfoHandler;
+}
+
 ReadTask BaseSessionHandler::readConfigurationPacket(const void* data, size_t size)
 {
     if (!configPacketReceivedHandler)
@@ -359,6 +364,7 @@ void BaseSessionHandler::sendPacketBuffer(PacketBufferPtr&& packetBuffer)
             : std::nullopt;
 
     createAndPushPacketBufferTasks(std::move(packetBuffer), tasks);
+    trackPendingWrites(tasks);
 
     session->scheduleWrite(std::move(tasks), std::move(deadlineTime));
 }
@@ -371,9 +377,40 @@ void BaseSessionHandler::schedulePacketBufferWriteTasks(std::vector<native_strea
             ? std::optional(timeStamp.value() + streamingPacketSendTimeout)
             : std::nullopt;
 
+    trackPendingWrites(tasks);
+
     session->scheduleWrite(std::move(tasks), std::move(deadlineTime));
 }
 
+void BaseSessionHandler::enablePendingWriteTracking()
+{
+    if (!pendingWriteSize)
+        pendingWriteSize = std::make_shared<std::atomic<size_t>>(0);
+}
+
+size_t BaseSessionHandler::getPendingWriteSize() const
+{
+    return pendingWriteSize ? pendingWriteSize->load(std::memory_order_relaxed) : 0;
+}
+
+void BaseSessionHandler::trackPendingWrites(std::vector<native_streaming::WriteTask>& tasks)
+{
+    if (!pendingWriteSize)
+        return;
+
+    size_t size = 0;
+    for (const auto& task : tasks)
+        size += task.getBuffer().size();
+    pendingWriteSize->fetch_add(size, std::memory_order_relaxed);
+
+    // tasks are written in order, so the handler of an empty trailing task runs once all the others are written
+    WriteHandler writtenHandler = [pendingWriteSize = pendingWriteSize, size]()
+    {
+        pendingWriteSize->fetch_sub(size, std::memory_order_relaxed);
+    };
+    tasks.push_back(WriteTask(boost::asio::const_buffer(nullptr, 0), writtenHandler));
+}
+
 void BaseSessionHandler::copyHeadersToBuffer(const packet_streaming::PacketBufferPtr& packetBuffer, char* bufferDestPtr)
 {
     size_t payloadSize = packetBuffer->packetHeader->size + packetBuffer->packetHeader->payloadSize;
@@ -763,4 +800,55 @@ void BaseSessionHandler::sendUnsubscribingDone(const SignalNumericIdType signalN
     session->scheduleWrite(std::move(tasks));
 }
 
+void BaseSessionHandler::sendSharedMemoryInfo(const std::string& name, uint64_t size)
+{
+    std::vector<WriteTask> tasks;
+    tasks.reserve(3);
+
+    // create write task for size of the shared memory ring
+    tasks.push_back(createWriteNumberTask<uint64_t>(size));
+
+    // create write task for name of the shared memory object
+    tasks.push_back(createWriteStringTask(name));
+
+    // create write task for transport header
+    size_t payloadSize = calculatePayloadSize(tasks);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_INFO, payloadSize);
+    tasks.insert(tasks.begin(), writeHeaderTask);
+
+    session->scheduleWrite(std::move(tasks));
+}
+
+ReadTask BaseSessionHandler::readSharedMemoryInfo(const void* data, size_t size)
+{
+    if (!sharedMemoryInfoHandler)
+        return discardPayload(data, size);
+
+    size_t bytesDone = 0;
+
+    uint64_t ringSize;
+    std::string name;
+
+    try
+    {
+        auto errorGuard = DAQ_ERROR_GUARD();
+        // Get size of the shared memory ring from received buffer
+        copyData(&ringSize, data, sizeof(ringSize), bytesDone, size);
+        bytesDone += sizeof(ringSize);
+
+        // Get name of the shared memory object from received buffer
+        name = getStringFromData(data, size - bytesDone, bytesDone, size);
+        LOG_D("Received shared memory info: name {}, size {}", name, ringSize);
+    }
+    catch (const DaqException& e)
+    {
+        LOG_E("Protocol error: {}", e.what());
+        errorHandler(std::string("Protocol error - readSharedMemoryInfo - ") + e.what(), session);
+        return createReadStopTask();
+    }
+
+    sharedMemoryInfoHandler(name, ringSize);
+    return createReadHeaderTask();
+}
+
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -170,6 +170,18 @@ ReadTask ClientSessionHandler::readHeader(const void* data, size_t size)
             payloadSize
         );
     }
+    else if (payloadType == PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_INFO)
+    {
+        return ReadTask(
+            [thisWeakPtr](const void* data, size_t size)
+            {
+                if (const auto thisPtr = std::static_pointer_cast<ClientSessionHandler>(thisWeakPtr.lock()))
+                    return thisPtr->readSharedMemoryInfo(data, size);
+                return ReadTask();
+            },
+            payloadSize
+        );
+    }
     else
     {
         LOG_W("Received type: {} cannot be handled by client side", convertPayloadTypeToString(payloadType));
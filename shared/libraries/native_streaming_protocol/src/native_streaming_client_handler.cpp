@@ -346,7 +346,12 @@ void NativeStreamingClientImpl::sendConfigRequest(const config_protocol::PacketB
 void NativeStreamingClientImpl::sendStreamingRequest()
 {
     // FIXME keep and reuse packet client when packet retransmission feature will be enabled
-    packetStreamingClientPtr = std::make_shared<packet_streaming::PacketStreamingClient>();
+    {
+        std::scoped_lock lock(sharedMemorySync);
+        auto packetStreamingClient = std::make_shared<packet_streaming::PacketStreamingClient>();
+        packetStreamingClient->setSharedMemoryRing(sharedMemoryRing);
+        packetStreamingClientPtr = packetStreamingClient;
+    }
 
     {
         std::scoped_lock lock(registeredSignalsSync);
@@ -410,6 +415,10 @@ void NativeStreamingClientImpl::onSessionError(const std::string& errorMessage,
     LOG_W("Closing connection caused by: {}", errorMessage);
     sessionHandler.reset();
     packetStreamingServerPtr.reset();
+    {
+        std::scoped_lock lock(sharedMemorySync);
+        sharedMemoryRing.reset();
+    }
 
     connectionStatusChanged(Enumeration("ConnectionStatusType", "Reconnecting", this->context.getTypeManager()),
                             "Network connection interrupted or closed by the remote device");
@@ -435,6 +444,33 @@ void NativeStreamingClientImpl::onPacketBufferReceived(const packet_streaming::P
     }
 }
 
+void NativeStreamingClientImpl::handleSharedMemoryInfo(const std::string& name, uint64_t size)
+{
+    packet_streaming::SharedMemoryRingPtr ring;
+    try
+    {
+        ring = packet_streaming::SharedMemoryRing::Open(name, static_cast<size_t>(size));
+    }
+    catch (const packet_streaming::PacketStreamingException& e)
+    {
+        LOG_W("Shared memory streaming unavailable, falling back to the network connection: {}", e.what());
+        return;
+    }
+
+    {
+        std::scoped_lock lock(sharedMemorySync);
+        sharedMemoryRing = ring;
+        if (packetStreamingClientPtr)
+            packetStreamingClientPtr->setSharedMemoryRing(ring);
+    }
+
+    LOG_I("Receiving data packet payloads through shared memory {}", name);
+
+    // confirm that the ring is mapped, only then the server starts placing payloads into it
+    if (auto sessionHandlerTemp = this->sessionHandler; sessionHandlerTemp)
+        sessionHandlerTemp->sendSharedMemoryInfo(name, size);
+}
+
 void NativeStreamingClientImpl::initClientSessionHandler(SessionPtr session)
 {
     LOG_I("Client connected to server endpoint: {}:{}", session->getEndpointAddress(), session->getEndpointPortNumber());
@@ -525,6 +561,14 @@ void NativeStreamingClientImpl::initClientSessionHandler(SessionPtr session)
     };
     sessionHandler->setPacketBufferReceivedHandler(packetBufferReceivedHandler);
 
+    OnSharedMemoryInfoCallback sharedMemoryInfoHandler =
+        [thisWeakPtr = this->weak_from_this()](const std::string& name, uint64_t size)
+    {
+        if (const auto thisPtr = thisWeakPtr.lock())
+            thisPtr->handleSharedMemoryInfo(name, size);
+    };
+    sessionHandler->setSharedMemoryInfoHandler(sharedMemoryInfoHandler);
+
     packetStreamingServerPtr =
         std::make_shared<packet_streaming::PacketStreamingServer>(packet_streaming::PACKET_ZERO_PAYLOAD_SIZE,
                                                                   packet_streaming::PACKET_RELEASE_THRESHOLD_DEFAULT,
@@ -54,6 +54,8 @@ NativeStreamingServerHandler::NativeStreamingServerHandler(const ContextPtr& con
     , streamingPacketSendTimeout(config.getPropertyValue("StreamingPacketSendTimeout"))
     , packetStreamingReleaseThreshold(config.getPropertyValue("StreamingPacketReleaseThreshold"))
     , cacheablePacketPayloadSizeMax(config.getPropertyValue("StreamingCacheablePayloadSizeMax"))
+    , streamingFlowControlQueueSize(config.getPropertyValue("StreamingFlowControlQueueSize"))
+    , streamingFlowControlDecimation(config.getPropertyValue("StreamingFlowControlDecimation"))
 {
     for (const auto& signal : signalsList)
     {
@@ -266,6 +268,9 @@ void NativeStreamingServerHandler::sendAvailableStreamingPackets()
     {
         if (const auto packetStreamingServerPtr = streamingManager.getPacketServerIfRegistered(clientId))
         {
+            if (streamingFlowControlQueueSize != UNLIMITED_STREAMING_QUEUE_SIZE)
+                streamingManager.updateClientFlowControl(clientId, sessionHandler->getPendingWriteSize());
+
             auto [tasks, timeStamp] = StreamingManager::getStreamingWriteTasks(packetStreamingServerPtr);
             if (!tasks.empty())
                 sessionHandler->schedulePacketBufferWriteTasks(std::move(tasks), std::move(timeStamp));
@@ -335,6 +340,34 @@ PropertyObjectPtr NativeStreamingServerHandler::createDefaultConfig()
                 .build();
         defaultConfig.addProperty(packetReleaseThresholdProp);
     }
+    {
+        const auto flowControlQueueSizePropDescription =
+            "Defines the size (in bytes) of streaming data awaiting transmission to a client above which the server "
+            "reduces the rate of data packets sent to that client instead of letting its queue grow. Above the size only "
+            "every n-th data packet of low-priority signals is sent, above twice the size only the latest one per signal "
+            "and polling period. There is no per-signal priority setting: every value signal with explicit data and "
+            "a domain signal is low priority, while packets of domain signals, of signals with implicit data or without "
+            "a domain signal, and event packets are always sent. "
+            "The client is notified of rate changes with a \"STREAMING_RATE_CHANGED\" event packet, and the full rate "
+            "is restored once the queue drains below half of the size. The default value '0' disables the rate reduction.";
+        const auto flowControlQueueSizeProp =
+            IntPropertyBuilder("StreamingFlowControlQueueSize", UNLIMITED_STREAMING_QUEUE_SIZE)
+                .setMinValue(0)
+                .setDescription(flowControlQueueSizePropDescription)
+                .build();
+        defaultConfig.addProperty(flowControlQueueSizeProp);
+    }
+    {
+        const auto flowControlDecimationPropDescription =
+            "Defines the decimation applied to the data packets of value signals sent to a client whose queue of streaming "
+            "data exceeds \"StreamingFlowControlQueueSize\", i.e. only every n-th packet is sent.";
+        const auto flowControlDecimationProp =
+            IntPropertyBuilder("StreamingFlowControlDecimation", STREAMING_DECIMATION_DEFAULT)
+                .setMinValue(2)
+                .setDescription(flowControlDecimationPropDescription)
+                .build();
+        defaultConfig.addProperty(flowControlDecimationProp);
+    }
     {
         // TODO reminder for future improvements
         const auto linearCacheSizeMaxPropDescription =
@@ -555,6 +588,79 @@ void NativeStreamingServerHandler::handleTransportLayerProps(const PropertyObjec
     {
         sessionHandler->setExclusiveControlDropOthers(false);
     }
+
+    if (propertyObject.hasProperty("PayloadCompressionEnabled") &&
+        propertyObject.getProperty("PayloadCompressionEnabled").getValueType() == ctBool)
+    {
+        sessionHandler->setPayloadCompressionEnabled(propertyObject.getPropertyValue("PayloadCompressionEnabled"));
+    }
+
+    if (propertyObject.hasProperty("SharedMemoryEnabled") &&
+        propertyObject.getProperty("SharedMemoryEnabled").getValueType() == ctBool &&
+        static_cast<bool>(propertyObject.getPropertyValue("SharedMemoryEnabled")))
+    {
+        offerSharedMemory(sessionHandler);
+    }
+}
+
+void NativeStreamingServerHandler::offerSharedMemory(std::shared_ptr<ServerSessionHandler> sessionHandler)
+{
+    if (!packet_streaming::SharedMemoryRing::IsSupported())
+    {
+        LOG_W("Client requested shared memory streaming, which is not supported on this platform");
+        return;
+    }
+
+    if (sessionHandler->getClientHostName() != boost::asio::ip::host_name())
+    {
+        LOG_W("Client on host \"{}\" requested shared memory streaming, but is not running on this host",
+              sessionHandler->getClientHostName());
+        return;
+    }
+
+    packet_streaming::SharedMemoryRingPtr ring;
+    try
+    {
+        ring = packet_streaming::SharedMemoryRing::Create(packet_streaming::SHARED_MEMORY_RING_SIZE_DEFAULT);
+    }
+    catch (const packet_streaming::PacketStreamingException& e)
+    {
+        LOG_W("Shared memory streaming unavailable: {}", e.what());
+        return;
+    }
+
+    sessionHandler->setSharedMemoryRing(ring);
+
+    // payloads are only placed into the ring once the client confirms it has mapped it
+    auto sessionHandlerWeakPtr = std::weak_ptr<ServerSessionHandler>(sessionHandler);
+    OnSharedMemoryInfoCallback sharedMemoryAcceptedCb =
+        [thisWeakPtr = this->weak_from_this(), sessionHandlerWeakPtr](const std::string& name, uint64_t /*size*/)
+    {
+        if (const auto sessionHandlerPtr = sessionHandlerWeakPtr.lock())
+            if (const auto thisPtr = thisWeakPtr.lock())
+                thisPtr->handleSharedMemoryAccepted(sessionHandlerPtr, name);
+    };
+    sessionHandler->setSharedMemoryInfoHandler(sharedMemoryAcceptedCb);
+
+    sessionHandler->sendSharedMemoryInfo(ring->getName(), ring->getSize());
+}
+
+void NativeStreamingServerHandler::handleSharedMemoryAccepted(std::shared_ptr<ServerSessionHandler> sessionHandler,
+                                                              const std::string& name)
+{
+    std::scoped_lock lock(sync);
+
+    const auto ring = sessionHandler->getSharedMemoryRing();
+    if (!ring || ring->getName() != name)
+    {
+        LOG_W("Client accepted unknown shared memory object {}", name);
+        return;
+    }
+
+    sessionHandler->setSharedMemoryAccepted(true);
+
+    // if streaming was already initialized, switch the client over right away
+    streamingManager.setClientSharedMemoryRing(sessionHandler->getClientId(), ring);
 }
 
 void NativeStreamingServerHandler::setUpTransportLayerPropsCallback(std::shared_ptr<ServerSessionHandler> sessionHandler)
@@ -739,6 +845,18 @@ void NativeStreamingServerHandler::handleStreamingInit(std::shared_ptr<ServerSes
                                     cacheablePacketPayloadSizeMax,
                                     packetStreamingReleaseThreshold);
 
+    if (sessionHandler->isSharedMemoryAccepted())
+        streamingManager.setClientSharedMemoryRing(sessionHandler->getClientId(), sessionHandler->getSharedMemoryRing());
+    if (sessionHandler->isPayloadCompressionEnabled())
+        streamingManager.setClientPayloadCompressionEnabled(sessionHandler->getClientId(), true);
+    if (streamingFlowControlQueueSize != UNLIMITED_STREAMING_QUEUE_SIZE)
+    {
+        sessionHandler->enablePendingWriteTracking();
+        streamingManager.setClientFlowControl(sessionHandler->getClientId(),
+                                              streamingFlowControlQueueSize,
+                                              streamingFlowControlDecimation);
+    }
+
     OnPacketBufferReceivedCallback packetBufferReceivedHandler =
         [clientId = sessionHandler->getClientId(), thisWeakPtr = this->weak_from_this()](const packet_streaming::PacketBufferPtr& packetBuffer)
     {
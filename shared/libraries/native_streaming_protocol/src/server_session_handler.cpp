@@ -113,6 +113,36 @@ bool ServerSessionHandler::isConfigProtocolUsed()
     return this->useConfigProtocol;
 }
 
+void ServerSessionHandler::setSharedMemoryRing(const packet_streaming::SharedMemoryRingPtr& ring)
+{
+    this->sharedMemoryRing = ring;
+}
+
+packet_streaming::SharedMemoryRingPtr ServerSessionHandler::getSharedMemoryRing()
+{
+    return this->sharedMemoryRing;
+}
+
+void ServerSessionHandler::setSharedMemoryAccepted(bool accepted)
+{
+    this->sharedMemoryAccepted = accepted;
+}
+
+bool ServerSessionHandler::isSharedMemoryAccepted()
+{
+    return this->sharedMemoryAccepted;
+}
+
+void ServerSessionHandler::setPayloadCompressionEnabled(bool enabled)
+{
+    this->payloadCompressionEnabled = enabled;
+}
+
+bool ServerSessionHandler::isPayloadCompressionEnabled()
+{
+    return this->payloadCompressionEnabled;
+}
+
 UserPtr ServerSessionHandler::getUser()
 {
     auto user = (IUser*) session->getUserContext().get();
@@ -284,6 +314,18 @@ ReadTask ServerSessionHandler::readHeader(const void* data, size_t size)
             payloadSize
         );
     }
+    else if (payloadType == PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_INFO)
+    {
+        return ReadTask(
+            [thisWeakPtr](const void* data, size_t size)
+            {
+                if (const auto thisPtr = std::static_pointer_cast<ServerSessionHandler>(thisWeakPtr.lock()))
+                    return thisPtr->readSharedMemoryInfo(data, size);
+                return ReadTask();
+            },
+            payloadSize
+        );
+    }
     else
     {
         LOG_W("Received type: {} cannot be handled by server side", convertPayloadTypeToString(payloadType));
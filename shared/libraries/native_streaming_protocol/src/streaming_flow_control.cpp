@@ -0,0 +1,101 @@
+#include <native_streaming_protocol/streaming_flow_control.h>
+
+#include <opendaq/packet_factory.h>
+#include <coretypes/dictobject_factory.h>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+StreamingFlowControl::StreamingFlowControl(SizeT queueThreshold, SizeT decimation)
+    : queueThreshold(queueThreshold)
+    , decimation(decimation > 1 ? decimation : 2)
+    , level(StreamingFlowControlLevel::FullRate)
+{
+}
+
+bool StreamingFlowControl::update(SizeT pendingWriteSize)
+{
+    auto newLevel = level;
+
+    if (queueThreshold == UNLIMITED_STREAMING_QUEUE_SIZE)
+        newLevel = StreamingFlowControlLevel::FullRate;
+    else if (pendingWriteSize >= 2 * queueThreshold)
+        newLevel = StreamingFlowControlLevel::LatestOnly;
+    else if (pendingWriteSize >= queueThreshold)
+        newLevel = level == StreamingFlowControlLevel::LatestOnly ? level : StreamingFlowControlLevel::Decimated;
+    else if (pendingWriteSize >= queueThreshold / 2)
+        newLevel = level == StreamingFlowControlLevel::FullRate ? level : StreamingFlowControlLevel::Decimated;
+    else
+        newLevel = StreamingFlowControlLevel::FullRate;
+
+    if (newLevel == level)
+        return false;
+
+    level = newLevel;
+    decimationCounters.clear();
+    return true;
+}
+
+StreamingFlowControlLevel StreamingFlowControl::getLevel() const
+{
+    return level;
+}
+
+bool StreamingFlowControl::admitDataPacket(SignalNumericIdType signalNumericId, const PacketPtr& packet)
+{
+    switch (level)
+    {
+        case StreamingFlowControlLevel::Decimated:
+            return decimationCounters[signalNumericId]++ % decimation == 0;
+        case StreamingFlowControlLevel::LatestOnly:
+            heldPackets.insert_or_assign(signalNumericId, packet);
+            return false;
+        default:
+            return true;
+    }
+}
+
+std::vector<std::pair<SignalNumericIdType, PacketPtr>> StreamingFlowControl::takeHeldPackets()
+{
+    std::vector<std::pair<SignalNumericIdType, PacketPtr>> packets;
+    packets.reserve(heldPackets.size());
+
+    for (auto& [signalNumericId, packet] : heldPackets)
+        packets.emplace_back(signalNumericId, std::move(packet));
+    heldPackets.clear();
+
+    return packets;
+}
+
+PacketPtr StreamingFlowControl::takeHeldPacket(SignalNumericIdType signalNumericId)
+{
+    auto it = heldPackets.find(signalNumericId);
+    if (it == heldPackets.end())
+        return nullptr;
+
+    auto packet = std::move(it->second);
+    heldPackets.erase(it);
+    return packet;
+}
+
+void StreamingFlowControl::removeSignal(SignalNumericIdType signalNumericId)
+{
+    decimationCounters.erase(signalNumericId);
+    heldPackets.erase(signalNumericId);
+}
+
+EventPacketPtr StreamingFlowControl::createRateChangedEventPacket() const
+{
+    Int effectiveDecimation = 1;
+    if (level == StreamingFlowControlLevel::Decimated)
+        effectiveDecimation = static_cast<Int>(decimation);
+    else if (level == StreamingFlowControlLevel::LatestOnly)
+        effectiveDecimation = 0;
+
+    auto parameters = Dict<IString, IBaseObject>();
+    parameters.set(streaming_flow_control::LEVEL, static_cast<Int>(level));
+    parameters.set(streaming_flow_control::DECIMATION, effectiveDecimation);
+
+    return EventPacket(streaming_flow_control::STREAMING_RATE_CHANGED, parameters);
+}
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -40,6 +40,8 @@ void StreamingManager::sendPacketToSubscribers(const std::string& signalStringId
                     registeredSignal.lastDataDescriptorParam = dataDescriptorParam;
                 if (domainDescriptorParam.assigned())
                     registeredSignal.lastDomainDescriptorParam = domainDescriptorParam;
+                registeredSignal.lowPriority = isLowPrioritySignal(registeredSignal.lastDataDescriptorParam,
+                                                                   registeredSignal.lastDomainDescriptorParam);
             }
         }
 
@@ -47,10 +49,12 @@ void StreamingManager::sendPacketToSubscribers(const std::string& signalStringId
         {
             while (std::next(it) != registeredSignal.subscribedClientsIds.end())
             {
+                flushHeldPacket(*it, registeredSignal.numericId);
                 sendDaqPacket(sendPacketBufferCb, packetStreamingServers.at(*it), PacketPtr(packet), *it, registeredSignal.numericId);  // copy packet ptr
                 ++it;
             }
 
+            flushHeldPacket(*it, registeredSignal.numericId);
             sendDaqPacket(sendPacketBufferCb, packetStreamingServers.at(*it), std::move(packet), *it, registeredSignal.numericId); // move packet ptr
         }
     }
@@ -87,18 +91,32 @@ void StreamingManager::processPackets(const tsl::ordered_map<std::string, Packet
                             registeredSignal.lastDataDescriptorParam = dataDescriptorParam;
                         if (domainDescriptorParam.assigned())
                             registeredSignal.lastDomainDescriptorParam = domainDescriptorParam;
+                        registeredSignal.lowPriority = isLowPrioritySignal(registeredSignal.lastDataDescriptorParam,
+                                                                           registeredSignal.lastDomainDescriptorParam);
                     }
                 }
 
+                const bool flowControlled = registeredSignal.lowPriority &&
+                                            !flowControls.empty() &&
+                                            packet.getType() == PacketType::Data;
+
                 if (auto it2 = registeredSignal.subscribedClientsIds.begin(); it2 != registeredSignal.subscribedClientsIds.end())
                 {
                     while (std::next(it2) != registeredSignal.subscribedClientsIds.end())
                     {
-                        packetStreamingServers.at(*it2)->addDaqPacket(registeredSignal.numericId, packet);
+                        if (!flowControlled || admitDataPacket(*it2, registeredSignal.numericId, packet))
+                        {
+                            flushHeldPacket(*it2, registeredSignal.numericId);
+                            packetStreamingServers.at(*it2)->addDaqPacket(registeredSignal.numericId, packet);
+                        }
                         ++it2;
                     }
-        
-                    pushToPacketStreamingServer(packetStreamingServers.at(*it2), std::move(packet), registeredSignal.numericId);
+
+                    if (!flowControlled || admitDataPacket(*it2, registeredSignal.numericId, packet))
+                    {
+                        flushHeldPacket(*it2, registeredSignal.numericId);
+                        pushToPacketStreamingServer(packetStreamingServers.at(*it2), std::move(packet), registeredSignal.numericId);
+                    }
                 }
             }
         }
@@ -244,6 +262,8 @@ void StreamingManager::removeSignal(const SignalPtr& signal)
     std::scoped_lock lock(sync);
     if (auto signalIter = registeredSignals.find(signalStringId); signalIter != registeredSignals.end())
     {
+        for (auto& [_, flowControl] : flowControls)
+            flowControl.removeSignal(signalIter->second.numericId);
         registeredSignals.erase(signalIter);
     }
     else
@@ -289,6 +309,7 @@ void StreamingManager::registerClient(const std::string& clientId,
     LOG_I("Client with ID \"{}\" (reconnected - {}) requested streaming", clientId, reconnected);
 
     streamingClientsIds.insert(clientId);
+    flowControls.erase(clientId);
 
     // remove cached packet server & client if client is not auto-reconnected
     if (auto it = packetStreamingServers.find(clientId); it != packetStreamingServers.end() && !reconnected)
@@ -322,6 +343,105 @@ void StreamingManager::registerClient(const std::string& clientId,
     }
 }
 
+bool StreamingManager::setClientSharedMemoryRing(const std::string& clientId, const packet_streaming::SharedMemoryRingPtr& ring)
+{
+    std::scoped_lock lock(sync);
+
+    if (streamingClientsIds.find(clientId) == streamingClientsIds.end())
+        return false;
+
+    packetStreamingServers.at(clientId)->setSharedMemoryRing(ring);
+    LOG_I("Client with ID \"{}\" receives data packet payloads through shared memory {}", clientId, ring->getName());
+    return true;
+}
+
+bool StreamingManager::setClientPayloadCompressionEnabled(const std::string& clientId, bool enabled)
+{
+    std::scoped_lock lock(sync);
+
+    if (streamingClientsIds.find(clientId) == streamingClientsIds.end())
+        return false;
+
+    packetStreamingServers.at(clientId)->setPayloadCompressionEnabled(enabled);
+    if (enabled)
+        LOG_I("Data packet payloads sent to client with ID \"{}\" are compressed", clientId);
+    return true;
+}
+
+bool StreamingManager::setClientFlowControl(const std::string& clientId, SizeT queueThreshold, SizeT decimation)
+{
+    std::scoped_lock lock(sync);
+
+    if (streamingClientsIds.find(clientId) == streamingClientsIds.end())
+        return false;
+
+    flowControls.insert_or_assign(clientId, StreamingFlowControl(queueThreshold, decimation));
+    return true;
+}
+
+void StreamingManager::updateClientFlowControl(const std::string& clientId, SizeT pendingWriteSize)
+{
+    std::scoped_lock lock(sync);
+
+    auto flowControlIter = flowControls.find(clientId);
+    if (flowControlIter == flowControls.end())
+        return;
+
+    auto& flowControl = flowControlIter->second;
+    const auto& packetStreamingServer = packetStreamingServers.at(clientId);
+
+    const bool levelChanged = flowControl.update(pendingWriteSize);
+
+    for (auto& [signalNumericId, packet] : flowControl.takeHeldPackets())
+        pushToPacketStreamingServer(packetStreamingServer, std::move(packet), signalNumericId);
+
+    if (!levelChanged)
+        return;
+
+    const auto level = flowControl.getLevel();
+    if (level == StreamingFlowControlLevel::FullRate)
+        LOG_I("Streaming client with ID \"{}\" caught up, full streaming rate restored", clientId);
+    else
+        LOG_W("Streaming client with ID \"{}\" falls behind with {} bytes pending, streaming rate reduced to level {}",
+              clientId,
+              pendingWriteSize,
+              static_cast<Int>(level));
+
+    for (const auto& [_, registeredSignal] : registeredSignals)
+    {
+        if (registeredSignal.lowPriority && registeredSignal.subscribedClientsIds.count(clientId))
+            pushToPacketStreamingServer(packetStreamingServer, flowControl.createRateChangedEventPacket(), registeredSignal.numericId);
+    }
+}
+
+bool StreamingManager::isLowPrioritySignal(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor)
+{
+    // domain signals and signals of implicit rules are never withheld as the packets of other signals refer to them
+    if (!dataDescriptor.assigned() || !domainDescriptor.assigned())
+        return false;
+
+    const auto rule = dataDescriptor.getRule();
+    return !rule.assigned() || rule.getType() == DataRuleType::Explicit;
+}
+
+bool StreamingManager::admitDataPacket(const std::string& clientId, SignalNumericIdType signalNumericId, const PacketPtr& packet)
+{
+    if (auto it = flowControls.find(clientId); it != flowControls.end())
+        return it->second.admitDataPacket(signalNumericId, packet);
+    return true;
+}
+
+void StreamingManager::flushHeldPacket(const std::string& clientId, SignalNumericIdType signalNumericId)
+{
+    // a data packet kept in latest-only mode precedes the packet about to be sent, e.g. a descriptor change,
+    // and has to reach the client first to be decoded with the descriptor it was created with
+    if (auto it = flowControls.find(clientId); it != flowControls.end())
+    {
+        if (auto heldPacket = it->second.takeHeldPacket(signalNumericId); heldPacket.assigned())
+            pushToPacketStreamingServer(packetStreamingServers.at(clientId), std::move(heldPacket), signalNumericId);
+    }
+}
+
 ListPtr<ISignal> StreamingManager::unregisterClient(const std::string& clientId)
 {
     auto signalsToUnsubscribe = List<ISignal>();
@@ -347,6 +467,8 @@ ListPtr<ISignal> StreamingManager::unregisterClient(const std::string& clientId)
     if (auto it = packetStreamingClients.find(clientId); it != packetStreamingClients.end())
         packetStreamingClients.erase(it);
 
+    flowControls.erase(clientId);
+
     // find and remove client Id from subscribers
     for (auto& [signalStringId, registeredSignal] : registeredSignals)
     {
@@ -426,6 +548,8 @@ bool StreamingManager::removeSignalSubscriberNoLock(const std::string& signalStr
         if (auto subscribersIter = subscribers.find(subscribedClientId); subscribersIter != subscribers.end())
         {
             subscribers.erase(subscribersIter);
+            if (auto flowControlIter = flowControls.find(subscribedClientId); flowControlIter != flowControls.end())
+                flowControlIter->second.removeSignal(iter->second.numericId);
             if (subscribers.empty())
             {
                 LOG_D("Signal: {} has not subscribers", signalStringId);
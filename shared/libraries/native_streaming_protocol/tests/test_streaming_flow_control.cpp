@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <native_streaming_protocol/streaming_flow_control.h>
+#include <native_streaming_protocol/streaming_manager.h>
+#include <opendaq/opendaq.h>
+
+using namespace daq;
+using namespace daq::opendaq_native_streaming_protocol;
+
+using StreamingFlowControlTest = testing::Test;
+
+static PacketPtr createDataPacket()
+{
+    return DataPacket(DataDescriptorBuilder().setSampleType(SampleType::Float64).build(), 1);
+}
+
+TEST_F(StreamingFlowControlTest, Levels)
+{
+    StreamingFlowControl flowControl(1000, 4);
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::FullRate);
+
+    ASSERT_FALSE(flowControl.update(999));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::FullRate);
+
+    ASSERT_TRUE(flowControl.update(1000));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::Decimated);
+
+    ASSERT_TRUE(flowControl.update(2000));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::LatestOnly);
+
+    // one step down below the threshold, full rate only below half of it
+    ASSERT_FALSE(flowControl.update(1000));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::LatestOnly);
+    ASSERT_TRUE(flowControl.update(999));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::Decimated);
+    ASSERT_FALSE(flowControl.update(500));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::Decimated);
+    ASSERT_TRUE(flowControl.update(499));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::FullRate);
+
+    // from full rate the level is not raised until the threshold is reached again
+    ASSERT_FALSE(flowControl.update(500));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::FullRate);
+}
+
+TEST_F(StreamingFlowControlTest, Decimation)
+{
+    StreamingFlowControl flowControl(1000, 3);
+    const auto packet = createDataPacket();
+
+    ASSERT_TRUE(flowControl.admitDataPacket(1, packet));
+
+    flowControl.update(1000);
+
+    std::vector<bool> admitted;
+    for (int i = 0; i < 7; ++i)
+        admitted.push_back(flowControl.admitDataPacket(1, packet));
+    ASSERT_EQ(admitted, std::vector<bool>({true, false, false, true, false, false, true}));
+
+    // signals are decimated independently
+    ASSERT_TRUE(flowControl.admitDataPacket(2, packet));
+    ASSERT_FALSE(flowControl.admitDataPacket(2, packet));
+
+    ASSERT_TRUE(flowControl.takeHeldPackets().empty());
+}
+
+TEST_F(StreamingFlowControlTest, LatestOnly)
+{
+    StreamingFlowControl flowControl(1000, 3);
+    flowControl.update(2000);
+
+    const auto packet1 = createDataPacket();
+    const auto packet2 = createDataPacket();
+    const auto packet3 = createDataPacket();
+
+    ASSERT_FALSE(flowControl.admitDataPacket(2, packet1));
+    ASSERT_FALSE(flowControl.admitDataPacket(2, packet2));
+    ASSERT_FALSE(flowControl.admitDataPacket(1, packet3));
+
+    auto heldPackets = flowControl.takeHeldPackets();
+    ASSERT_EQ(heldPackets.size(), 2u);
+    ASSERT_EQ(heldPackets[0].first, 1u);
+    ASSERT_EQ(heldPackets[0].second, packet3);
+    ASSERT_EQ(heldPackets[1].first, 2u);
+    ASSERT_EQ(heldPackets[1].second, packet2);
+
+    ASSERT_TRUE(flowControl.takeHeldPackets().empty());
+
+    ASSERT_FALSE(flowControl.admitDataPacket(1, packet1));
+    flowControl.removeSignal(1);
+    ASSERT_TRUE(flowControl.takeHeldPackets().empty());
+}
+
+TEST_F(StreamingFlowControlTest, TakeHeldPacket)
+{
+    StreamingFlowControl flowControl(1000, 3);
+    flowControl.update(2000);
+
+    const auto packet1 = createDataPacket();
+    const auto packet2 = createDataPacket();
+
+    ASSERT_FALSE(flowControl.takeHeldPacket(1).assigned());
+
+    ASSERT_FALSE(flowControl.admitDataPacket(1, packet1));
+    ASSERT_FALSE(flowControl.admitDataPacket(2, packet2));
+
+    ASSERT_EQ(flowControl.takeHeldPacket(1), packet1);
+    ASSERT_FALSE(flowControl.takeHeldPacket(1).assigned());
+
+    auto heldPackets = flowControl.takeHeldPackets();
+    ASSERT_EQ(heldPackets.size(), 1u);
+    ASSERT_EQ(heldPackets[0].second, packet2);
+}
+
+TEST_F(StreamingFlowControlTest, DescriptorChangedWhileLatestOnly)
+{
+    const auto context = NullContext();
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setRule(LinearDataRule(1, 0))
+                                      .setTickResolution(Ratio(1, 1000))
+                                      .build();
+    const auto oldDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    const auto newDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+
+    const auto signal = SignalWithDescriptor(context, oldDescriptor, nullptr, "signal");
+    const auto signalStringId = signal.getGlobalId().toStdString();
+    const std::string clientId = "client";
+
+    StreamingManager streamingManager(context);
+    const auto signalNumericId = streamingManager.registerSignal(signal);
+    streamingManager.registerClient(clientId, false, false, 0, 0);
+    ASSERT_TRUE(streamingManager.setClientFlowControl(clientId, 1000, 3));
+    streamingManager.registerSignalSubscriber(signalStringId, clientId, [](const std::string&, packet_streaming::PacketBufferPtr&&) {});
+
+    const auto processPacket = [&](const PacketPtr& packet)
+    {
+        std::vector<IPacket*> packets{PacketPtr(packet).detach()};
+        tsl::ordered_map<std::string, PacketBufferData> packetIndices;
+
+        auto packetBufferData = PacketBufferData();
+        packetBufferData.index = 0;
+        packetBufferData.count = 1;
+        packetIndices.insert(std::make_pair(signalStringId, packetBufferData));
+
+        streamingManager.processPackets(packetIndices, packets);
+    };
+
+    processPacket(DataDescriptorChangedEventPacket(oldDescriptor, domainDescriptor));
+    streamingManager.updateClientFlowControl(clientId, 2000);
+
+    // the data packet is kept in latest-only mode, the descriptor change that follows it is not
+    processPacket(DataPacket(oldDescriptor, 4));
+    processPacket(DataDescriptorChangedEventPacket(newDescriptor, domainDescriptor));
+
+    packet_streaming::PacketStreamingClient packetStreamingClient;
+    const auto packetStreamingServer = streamingManager.getPacketServerIfRegistered(clientId);
+    while (auto packetBuffer = packetStreamingServer->getNextPacketBuffer())
+        packetStreamingClient.addPacketBuffer(packetBuffer);
+
+    std::vector<PacketPtr> receivedPackets;
+    while (true)
+    {
+        auto [receivedSignalNumericId, packet] = packetStreamingClient.getNextDaqPacket();
+        if (!packet.assigned())
+            break;
+        ASSERT_EQ(receivedSignalNumericId, signalNumericId);
+        receivedPackets.push_back(packet);
+    }
+
+    // initial descriptor, rate change, the kept data packet and the new descriptor
+    ASSERT_EQ(receivedPackets.size(), 4u);
+
+    ASSERT_EQ(receivedPackets[1].asPtr<IEventPacket>().getEventId(), streaming_flow_control::STREAMING_RATE_CHANGED);
+
+    const auto dataPacket = receivedPackets[2].asPtr<IDataPacket>();
+    ASSERT_EQ(dataPacket.getDataDescriptor(), oldDescriptor);
+    ASSERT_EQ(dataPacket.getSampleCount(), 4u);
+
+    const auto eventPacket = receivedPackets[3].asPtr<IEventPacket>();
+    ASSERT_EQ(eventPacket.getEventId(), event_packet_id::DATA_DESCRIPTOR_CHANGED);
+    ASSERT_EQ(eventPacket.getParameters().get(event_packet_param::DATA_DESCRIPTOR), newDescriptor);
+}
+
+TEST_F(StreamingFlowControlTest, RateChangedEventPacket)
+{
+    StreamingFlowControl flowControl(1000, 5);
+
+    auto eventPacket = flowControl.createRateChangedEventPacket();
+    ASSERT_EQ(eventPacket.getEventId(), streaming_flow_control::STREAMING_RATE_CHANGED);
+    ASSERT_EQ(eventPacket.getParameters().get(streaming_flow_control::LEVEL), static_cast<Int>(StreamingFlowControlLevel::FullRate));
+    ASSERT_EQ(eventPacket.getParameters().get(streaming_flow_control::DECIMATION), 1);
+
+    flowControl.update(1000);
+    eventPacket = flowControl.createRateChangedEventPacket();
+    ASSERT_EQ(eventPacket.getParameters().get(streaming_flow_control::LEVEL), static_cast<Int>(StreamingFlowControlLevel::Decimated));
+    ASSERT_EQ(eventPacket.getParameters().get(streaming_flow_control::DECIMATION), 5);
+
+    flowControl.update(2000);
+    eventPacket = flowControl.createRateChangedEventPacket();
+    ASSERT_EQ(eventPacket.getParameters().get(streaming_flow_control::LEVEL), static_cast<Int>(StreamingFlowControlLevel::LatestOnly));
+    ASSERT_EQ(eventPacket.getParameters().get(streaming_flow_control::DECIMATION), 0);
+}
+
+TEST_F(StreamingFlowControlTest, Disabled)
+{
+    StreamingFlowControl flowControl(UNLIMITED_STREAMING_QUEUE_SIZE, 5);
+
+    ASSERT_FALSE(flowControl.update(1000000));
+    ASSERT_EQ(flowControl.getLevel(), StreamingFlowControlLevel::FullRate);
+    ASSERT_TRUE(flowControl.admitDataPacket(1, createDataPacket()));
+}
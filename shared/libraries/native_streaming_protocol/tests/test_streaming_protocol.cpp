@@ -4,6 +4,7 @@
 #include <opendaq/opendaq.h>
 #include <opendaq/deserialize_component_ptr.h>
 #include <opendaq/component_deserialize_context_factory.h>
+#include <native_streaming_protocol/streaming_flow_control.h>
 
 #include <memory>
 #include <future>
@@ -186,10 +187,18 @@ public:
     }
 
     std::shared_ptr<NativeStreamingClientHandler> createClient(StreamingProtocolAttributes& client,
-                                                               OnSignalAvailableCallback signalAvailableHandler)
+                                                               OnSignalAvailableCallback signalAvailableHandler,
+                                                               bool sharedMemoryEnabled = false,
+                                                               bool payloadCompressionEnabled = false)
     {
+        auto transportLayerConfig = ClientAttributesBase::createTransportLayerConfig();
+        if (sharedMemoryEnabled)
+            transportLayerConfig.addProperty(BoolProperty("SharedMemoryEnabled", True));
+        if (payloadCompressionEnabled)
+            transportLayerConfig.addProperty(BoolProperty("PayloadCompressionEnabled", True));
+
         auto clientHandler = std::make_shared<NativeStreamingClientHandler>(
-            client.clientContext, ClientAttributesBase::createTransportLayerConfig(), ClientAttributesBase::createAuthenticationConfig());
+            client.clientContext, transportLayerConfig, ClientAttributesBase::createAuthenticationConfig());
 
         clientHandler->setStreamingHandlers(signalAvailableHandler,
                                             client.signalUnavailableHandler,
@@ -201,12 +210,15 @@ public:
         return clientHandler;
     }
 
-    void startServer(const ListPtr<ISignal>& signalsList, const EventPacketPtr& eventPacket = nullptr)
+    void startServer(const ListPtr<ISignal>& signalsList,
+                     const EventPacketPtr& eventPacket = nullptr,
+                     PropertyObjectPtr config = nullptr)
     {
         initialEventPacket = eventPacket;
         startIoOperations();
 
-        auto config = NativeStreamingServerHandler::createDefaultConfig();
+        if (!config.assigned())
+            config = NativeStreamingServerHandler::createDefaultConfig();
         // maxAllowedConfigConnections = 1 is used here to verify that the limit does not impact streaming connections
         config.setPropertyValue("MaxAllowedConfigConnections", 1);
 
@@ -804,6 +816,103 @@ TEST_P(StreamingProtocolTest, SendDataPacket)
     }
 }
 
+TEST_P(StreamingProtocolTest, SendDataPacketThroughSharedMemory)
+{
+    if (!packet_streaming::SharedMemoryRing::IsSupported())
+        GTEST_SKIP() << "Shared memory rings are not supported on this platform";
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    auto serverEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, NullDataDescriptor());
+    auto serverDataPacket = DataPacket(valueDescriptor, 1000);
+    auto data = static_cast<double*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < 1000; ++i)
+        data[i] = static_cast<double>(i) * 0.5;
+    auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+
+    startServer(List<ISignal>(serverSignal), serverEventPacket);
+
+    for (auto& client : clients)
+    {
+        client.clientHandler = createClient(client, client.signalAvailableHandler, true);
+        ASSERT_TRUE(client.clientHandler->connect(SERVER_ADDRESS, NATIVE_STREAMING_LISTENING_PORT));
+        client.clientHandler->sendStreamingRequest();
+        ASSERT_EQ(client.streamingInitFuture.wait_for(timeout), std::future_status::ready);
+
+        ASSERT_EQ(client.signalAvailableFuture.wait_for(timeout), std::future_status::ready);
+        auto clientSignalStringId = std::get<0>(client.signalAvailableFuture.get());
+
+        client.clientHandler->subscribeSignal(clientSignalStringId);
+        ASSERT_EQ(client.subscribedAckFuture.wait_for(timeout), std::future_status::ready);
+    }
+
+    ASSERT_EQ(signalSubscribedFuture.wait_for(timeout), std::future_status::ready);
+
+    for (auto& client : clients)
+    {
+        // wait for event packet
+        ASSERT_EQ(client.packetReceivedFuture.wait_for(timeout), std::future_status::ready);
+        client.packetReceivedPromise = std::promise< std::tuple<StringPtr, PacketPtr> >();
+        client.packetReceivedFuture = client.packetReceivedPromise.get_future();
+    }
+
+    serverHandler->sendPacket(serverSignal.getGlobalId().toStdString(), serverDataPacket);
+    for (auto& client : clients)
+    {
+        // wait for data packet
+        ASSERT_EQ(client.packetReceivedFuture.wait_for(timeout), std::future_status::ready);
+        auto [signalId, packet] = client.packetReceivedFuture.get();
+        ASSERT_EQ(signalId, serverSignal.getGlobalId());
+        ASSERT_EQ(packet, serverDataPacket);
+    }
+}
+
+TEST_P(StreamingProtocolTest, SendCompressedDataPacket)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+    auto serverEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, NullDataDescriptor());
+    auto serverDataPacket = DataPacket(valueDescriptor, 1000);
+    auto data = static_cast<int32_t*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < 1000; ++i)
+        data[i] = 100000 + static_cast<int32_t>(i % 50);
+    auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+
+    startServer(List<ISignal>(serverSignal), serverEventPacket);
+
+    for (auto& client : clients)
+    {
+        client.clientHandler = createClient(client, client.signalAvailableHandler, false, true);
+        ASSERT_TRUE(client.clientHandler->connect(SERVER_ADDRESS, NATIVE_STREAMING_LISTENING_PORT));
+        client.clientHandler->sendStreamingRequest();
+        ASSERT_EQ(client.streamingInitFuture.wait_for(timeout), std::future_status::ready);
+
+        ASSERT_EQ(client.signalAvailableFuture.wait_for(timeout), std::future_status::ready);
+        auto clientSignalStringId = std::get<0>(client.signalAvailableFuture.get());
+
+        client.clientHandler->subscribeSignal(clientSignalStringId);
+        ASSERT_EQ(client.subscribedAckFuture.wait_for(timeout), std::future_status::ready);
+    }
+
+    ASSERT_EQ(signalSubscribedFuture.wait_for(timeout), std::future_status::ready);
+
+    for (auto& client : clients)
+    {
+        // wait for event packet
+        ASSERT_EQ(client.packetReceivedFuture.wait_for(timeout), std::future_status::ready);
+        client.packetReceivedPromise = std::promise< std::tuple<StringPtr, PacketPtr> >();
+        client.packetReceivedFuture = client.packetReceivedPromise.get_future();
+    }
+
+    serverHandler->sendPacket(serverSignal.getGlobalId().toStdString(), serverDataPacket);
+    for (auto& client : clients)
+    {
+        // wait for data packet
+        ASSERT_EQ(client.packetReceivedFuture.wait_for(timeout), std::future_status::ready);
+        auto [signalId, packet] = client.packetReceivedFuture.get();
+        ASSERT_EQ(signalId, serverSignal.getGlobalId());
+        ASSERT_EQ(packet, serverDataPacket);
+    }
+}
+
 TEST_P(StreamingProtocolTest, SendMultipleDataPackets)
 {
     const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
@@ -901,6 +1010,132 @@ TEST_P(StreamingProtocolTest, SendMultipleDataPackets)
     }
 }
 
+TEST_P(StreamingProtocolTest, SlowClientStreamingRate)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setRule(LinearDataRule(1, 0))
+                                      .setTickResolution(Ratio(1, 1000))
+                                      .build();
+    auto serverEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, domainDescriptor);
+    auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+    const auto signalStringId = serverSignal.getGlobalId().toStdString();
+
+    auto config = NativeStreamingServerHandler::createDefaultConfig();
+    config.setPropertyValue("StreamingFlowControlQueueSize", 1024 * 1024);
+    startServer(List<ISignal>(serverSignal), serverEventPacket, config);
+
+    for (auto& client : clients)
+    {
+        client.clientHandler = createClient(client, client.signalAvailableHandler);
+        ASSERT_TRUE(client.clientHandler->connect(SERVER_ADDRESS, NATIVE_STREAMING_LISTENING_PORT));
+        client.clientHandler->sendStreamingRequest();
+        ASSERT_EQ(client.streamingInitFuture.wait_for(timeout), std::future_status::ready);
+
+        ASSERT_EQ(client.signalAvailableFuture.wait_for(timeout), std::future_status::ready);
+        auto clientSignalStringId = std::get<0>(client.signalAvailableFuture.get());
+
+        client.clientHandler->subscribeSignal(clientSignalStringId);
+        ASSERT_EQ(client.subscribedAckFuture.wait_for(timeout), std::future_status::ready);
+    }
+
+    ASSERT_EQ(signalSubscribedFuture.wait_for(timeout), std::future_status::ready);
+
+    // the clients stop reading on their first data packet until released, so the data piles up on the server
+    std::promise<void> releasePromise;
+    std::shared_future<void> releaseFuture = releasePromise.get_future().share();
+
+    struct RateChanges
+    {
+        std::promise<Int> reducedPromise;
+        std::promise<void> restoredPromise;
+        bool reduced = false;
+        bool restored = false;
+    };
+    std::vector<std::shared_ptr<RateChanges>> rateChanges;
+
+    for (auto& client : clients)
+    {
+        // wait for event packet
+        ASSERT_EQ(client.packetReceivedFuture.wait_for(timeout), std::future_status::ready);
+
+        auto clientRateChanges = std::make_shared<RateChanges>();
+        rateChanges.push_back(clientRateChanges);
+
+        client.packetHandler = [releaseFuture, clientRateChanges](const StringPtr&, const PacketPtr& packet)
+        {
+            releaseFuture.wait();
+
+            if (packet.getType() != PacketType::Event)
+                return;
+
+            const auto eventPacket = packet.asPtr<IEventPacket>();
+            if (eventPacket.getEventId() != streaming_flow_control::STREAMING_RATE_CHANGED)
+                return;
+
+            const Int level = eventPacket.getParameters().get(streaming_flow_control::LEVEL);
+            if (level != static_cast<Int>(StreamingFlowControlLevel::FullRate) && !clientRateChanges->reduced)
+            {
+                clientRateChanges->reduced = true;
+                clientRateChanges->reducedPromise.set_value(eventPacket.getParameters().get(streaming_flow_control::DECIMATION));
+            }
+            else if (level == static_cast<Int>(StreamingFlowControlLevel::FullRate) && clientRateChanges->reduced &&
+                     !clientRateChanges->restored)
+            {
+                clientRateChanges->restored = true;
+                clientRateChanges->restoredPromise.set_value();
+            }
+        };
+
+        client.clientHandler->setStreamingHandlers(
+            client.signalAvailableHandler,
+            client.signalUnavailableHandler,
+            client.packetHandler,
+            client.signalSubscriptionAckHandler,
+            client.connectionStatusChangedHandler,
+            client.streamingInitDoneHandler
+        );
+    }
+
+    const auto sendDataPacket = [&]()
+    {
+        std::vector<IPacket*> packetBuf{PacketPtr(DataPacket(valueDescriptor, 128 * 1024)).detach()};
+        tsl::ordered_map<std::string, opendaq_native_streaming_protocol::PacketBufferData> packetIndices;
+
+        auto packetBufferData = PacketBufferData();
+        packetBufferData.index = 0;
+        packetBufferData.count = 1;
+        packetIndices.insert(std::make_pair(signalStringId, packetBufferData));
+
+        serverHandler->processStreamingPackets(packetIndices, packetBuf);
+        serverHandler->sendAvailableStreamingPackets();
+    };
+
+    // 64 MB of data, far more than the socket buffers of the stalled clients hold
+    for (int i = 0; i < 64; ++i)
+        sendDataPacket();
+
+    releasePromise.set_value();
+
+    for (const auto& clientRateChanges : rateChanges)
+    {
+        auto reducedFuture = clientRateChanges->reducedPromise.get_future();
+        ASSERT_EQ(reducedFuture.wait_for(timeout), std::future_status::ready);
+        const auto decimation = reducedFuture.get();
+        ASSERT_TRUE(decimation == static_cast<Int>(STREAMING_DECIMATION_DEFAULT) || decimation == 0);
+    }
+
+    // once the clients catch up, the full rate is restored on the next send cycles
+    for (const auto& clientRateChanges : rateChanges)
+    {
+        auto restoredFuture = clientRateChanges->restoredPromise.get_future();
+        for (int i = 0; i < 50 && restoredFuture.wait_for(std::chrono::milliseconds(10)) != std::future_status::ready; ++i)
+            serverHandler->sendAvailableStreamingPackets();
+        ASSERT_EQ(restoredFuture.wait_for(timeout), std::future_status::ready);
+    }
+}
+
 TEST_P(StreamingProtocolTest, AddNotPublicSignal)
 {
     startServer(List<ISignal>());
@@ -50,6 +50,12 @@ public:
     void setClientConnectedHandler(const OnClientConnectedCallback& callback);
     void setClientDisconnectedHandler(const OnClientDisconnectedCallback& callback);
 
+#ifdef UA_ENABLE_HISTORIZING
+    // Must be set before the server is prepared. The server does not take ownership of the database context.
+    void setHistoryDatabase(const UA_HistoryDatabase& historyDatabase);
+#endif
+    void setHistorizing(const OpcUaNodeId& nodeId, bool historizing);
+
     void setSecurityConfig(OpcUaServerSecurityConfig* config);
     const OpcUaServerSecurityConfig* getSecurityConfig() const;
     void prepare();
@@ -167,6 +173,9 @@ private:
     AuthenticationProviderPtr authenticationProvider;
     OnClientConnectedCallback clientConnectedHandler;
     OnClientDisconnectedCallback clientDisconnectedHandler;
+#ifdef UA_ENABLE_HISTORIZING
+    UA_HistoryDatabase historyDatabase{};
+#endif
 };
 
 END_NAMESPACE_OPENDAQ_OPCUA
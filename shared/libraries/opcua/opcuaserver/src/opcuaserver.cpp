@@ -64,6 +64,37 @@ void OpcUaServer::setClientDisconnectedHandler(const OnClientDisconnectedCallbac
     this->clientDisconnectedHandler = callback;
 }
 
+#ifdef UA_ENABLE_HISTORIZING
+void OpcUaServer::setHistoryDatabase(const UA_HistoryDatabase& historyDatabase)
+{
+    if (isPrepared())
+        throw OpcUaException(UA_STATUSCODE_BADINVALIDSTATE, "History database must be set before the server is prepared");
+
+    this->historyDatabase = historyDatabase;
+}
+#endif
+
+void OpcUaServer::setHistorizing(const OpcUaNodeId& nodeId, bool historizing)
+{
+#ifdef UA_ENABLE_HISTORIZING
+    UA_StatusCode status = UA_Server_writeHistorizing(server, *nodeId, historizing);
+    CheckStatusCodeException(status, "Failed to set historizing attribute.");
+
+    UA_Byte accessLevel = 0;
+    status = UA_Server_readAccessLevel(server, *nodeId, &accessLevel);
+    CheckStatusCodeException(status, "Failed to read access level.");
+
+    if (historizing)
+        accessLevel |= UA_ACCESSLEVELMASK_HISTORYREAD;
+    else
+        accessLevel &= ~UA_ACCESSLEVELMASK_HISTORYREAD;
+    setAccessLevel(nodeId, accessLevel);
+#else
+    if (historizing)
+        throw OpcUaException(UA_STATUSCODE_BADNOTSUPPORTED, "Server was built without historizing support");
+#endif
+}
+
 void OpcUaServer::setSecurityConfig(OpcUaServerSecurityConfig* config)
 {
     throw std::runtime_error("method setSecurityConfig() is deprecated");
@@ -135,6 +166,9 @@ void OpcUaServer::prepareServer()
     prepareServerMinimal(config);
     config->context = this;
     config->nodeLifecycle.generateChildNodeId = generateChildId;
+#ifdef UA_ENABLE_HISTORIZING
+    config->historyDatabase = historyDatabase;
+#endif
 
     prepareAccessControl(config);
     addTmsTypes(server);
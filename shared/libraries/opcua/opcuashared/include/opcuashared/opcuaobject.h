@@ -305,6 +305,8 @@ ADD_STANDARD_TYPE_MAPPING(UA_QualifiedName, UA_TYPES_QUALIFIEDNAME)
 ADD_STANDARD_TYPE_MAPPING(UA_LocalizedText, UA_TYPES_LOCALIZEDTEXT)
 ADD_STANDARD_TYPE_MAPPING(UA_ReadRequest, UA_TYPES_READREQUEST)
 ADD_STANDARD_TYPE_MAPPING(UA_ReadResponse, UA_TYPES_READRESPONSE)
+ADD_STANDARD_TYPE_MAPPING(UA_HistoryReadRequest, UA_TYPES_HISTORYREADREQUEST)
+ADD_STANDARD_TYPE_MAPPING(UA_HistoryReadResponse, UA_TYPES_HISTORYREADRESPONSE)
 ADD_STANDARD_TYPE_MAPPING(UA_CallRequest, UA_TYPES_CALLREQUEST)
 ADD_STANDARD_TYPE_MAPPING(UA_CallResponse, UA_TYPES_CALLRESPONSE)
 ADD_STANDARD_TYPE_MAPPING(UA_NodeId, UA_TYPES_NODEID)
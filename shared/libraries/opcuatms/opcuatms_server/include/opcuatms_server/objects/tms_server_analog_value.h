@@ -17,6 +17,7 @@
 #pragma once
 #include <opendaq/signal_ptr.h>
 #include <opcuatms_server/objects/tms_server_variable.h>
+#include <opcuatms_server/objects/tms_server_variant_cache.h>
 
 BEGIN_NAMESPACE_OPENDAQ_OPCUA_TMS
 
@@ -33,6 +34,9 @@ public:
     TmsServerAnalogValue(const SignalPtr& signal, const opcua::OpcUaServerPtr& server, const ContextPtr& context, const TmsServerContextPtr& tmsContext);
     std::string getBrowseName() override;
 
+    // Drops the cached variant of the last value.
+    void descriptorChanged();
+
 protected:
     opcua::OpcUaNodeId getTmsTypeId() override;
     opcua::OpcUaNodeId getDataTypeId() override;
@@ -42,6 +46,7 @@ private:
     static opcua::OpcUaNodeId sampleTypeToOpcUaDataType(SampleType sampleType);
     
     SignalPtr signal;
+    TmsServerVariantCache lastValueCache;
 };
 
 END_NAMESPACE_OPENDAQ_OPCUA_TMS
@@ -17,6 +17,8 @@
 #pragma once
 #include <opendaq/signal_ptr.h>
 #include <opcuatms_server/objects/tms_server_variable.h>
+#include <opcuatms_server/objects/tms_server_variant_cache.h>
+#include <opcuatms_server/tms_server_history.h>
 
 BEGIN_NAMESPACE_OPENDAQ_OPCUA_TMS
 
@@ -33,8 +35,14 @@ public:
     TmsServerValue(const SignalPtr& signal, const opcua::OpcUaServerPtr& server, const ContextPtr& context, const TmsServerContextPtr& tmsContext);
     std::string getBrowseName() override;
 
+    // Drops the cached variants of the data descriptor and last value nodes.
+    void descriptorChanged();
+
     static opcua::OpcUaNodeId SampleTypeToOpcUaDataType(SampleType sampleType);
 
+    // Minimum time between two conversions of the last value of the signal.
+    static constexpr std::chrono::milliseconds LastValueRefreshInterval{100};
+
 protected:
     opcua::OpcUaNodeId getTmsTypeId() override;
     opcua::OpcUaNodeId getDataTypeId() override;
@@ -43,6 +51,9 @@ protected:
 
 private:
     SignalPtr signal;
+    TmsServerVariantCache descriptorCache;
+    TmsServerVariantCache lastValueCache{LastValueRefreshInterval};
+    TmsServerSignalHistoryPtr signalHistory;
 };
 
 END_NAMESPACE_OPENDAQ_OPCUA_TMS
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opcuatms/opcuatms.h>
+#include <opcuashared/opcuavariant.h>
+#include <coretypes/baseobject_factory.h>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+BEGIN_NAMESPACE_OPENDAQ_OPCUA_TMS
+
+// TmsServerVariantCache
+
+/*
+ * Caches the result of converting an openDAQ object to an OPC UA variant for the read callback of a node.
+ * The cached variant is returned until it is invalidated or, if a maximum age is set, until it is older than
+ * the maximum age. Read callbacks run on the server thread while invalidation is triggered by core events,
+ * so access to the cached variant is synchronized. The conversion runs without the lock held; its result is
+ * discarded if the cache was invalidated in the meantime.
+ *
+ * A variant can instead be keyed on the object it was converted from, in which case it is returned only while
+ * the same object is passed in. This does not rely on an invalidating event reaching the cache, as core events
+ * are muted while a configuration is loaded.
+ */
+class TmsServerVariantCache
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit TmsServerVariantCache(Clock::duration maxAge = Clock::duration::max())
+        : maxAge(maxAge)
+    {
+    }
+
+    template <typename ConvertFunc>
+    opcua::OpcUaVariant get(ConvertFunc&& convert)
+    {
+        const auto now = Clock::now();
+        uint64_t convertedVersion;
+        {
+            std::scoped_lock lock(sync);
+            if (valid && now - updated < maxAge)
+                return variant;
+            convertedVersion = version;
+        }
+
+        opcua::OpcUaVariant converted = convert();
+
+        std::scoped_lock lock(sync);
+        if (convertedVersion == version)
+        {
+            variant = converted;
+            updated = now;
+            valid = true;
+        }
+
+        return converted;
+    }
+
+    template <typename ConvertFunc>
+    opcua::OpcUaVariant get(const BaseObjectPtr& source, ConvertFunc&& convert)
+    {
+        {
+            std::scoped_lock lock(sync);
+            if (valid && cachedSource.getObject() == source.getObject())
+                return variant;
+        }
+
+        opcua::OpcUaVariant converted = convert();
+
+        std::scoped_lock lock(sync);
+        variant = converted;
+        cachedSource = source;
+        updated = Clock::now();
+        valid = true;
+
+        return converted;
+    }
+
+    void invalidate()
+    {
+        std::scoped_lock lock(sync);
+        valid = false;
+        version++;
+        cachedSource.release();
+    }
+
+private:
+    std::mutex sync;
+    Clock::duration maxAge;
+    Clock::time_point updated;
+    uint64_t version = 0;
+    bool valid = false;
+    opcua::OpcUaVariant variant;
+    BaseObjectPtr cachedSource;
+};
+
+END_NAMESPACE_OPENDAQ_OPCUA_TMS
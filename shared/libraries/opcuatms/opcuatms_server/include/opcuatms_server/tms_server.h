@@ -21,6 +21,7 @@
 #include <opcuaserver/opcuaserver.h>
 #include <opcuatms_server/objects/tms_server_device.h>
 #include <opcuatms_server/tms_server_context.h>
+#include <opcuatms_server/tms_server_history.h>
 
 BEGIN_NAMESPACE_OPENDAQ_OPCUA
 
@@ -33,6 +34,7 @@ public:
 
     void setOpcUaPort(uint16_t port);
     void setOpcUaPath(const std::string& path);
+    void setHistoryConfig(const daq::opcua::tms::TmsServerHistoryConfig& config);
     void start();
     void stop();
 
@@ -42,6 +44,8 @@ protected:
     std::unique_ptr<daq::opcua::tms::TmsServerDevice> tmsDevice;
     std::shared_ptr<daq::opcua::tms::TmsServerContext> tmsContext;
     daq::opcua::OpcUaServerPtr server;
+    std::shared_ptr<daq::opcua::tms::TmsServerHistory> history;
+    daq::opcua::tms::TmsServerHistoryConfig historyConfig;
     uint16_t opcUaPort = 4840;
     std::string opcUaPath = "/";
     std::unordered_map<std::string, SizeT> registeredClientIds;
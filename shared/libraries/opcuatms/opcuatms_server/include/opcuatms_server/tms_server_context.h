@@ -19,6 +19,7 @@
 #include <opendaq/context_ptr.h>
 #include <opendaq/device_ptr.h>
 #include <opcuatms_server/objects/tms_server_object.h>
+#include <opcuatms_server/tms_server_history.h>
 
 BEGIN_NAMESPACE_OPENDAQ_OPCUA_TMS
 
@@ -30,10 +31,13 @@ public:
     void registerComponent(const ComponentPtr& component, TmsServerObject& obj);
     DevicePtr getRootDevice();
     ComponentPtr findComponent(const std::string& globalId);
+    void setHistory(const TmsServerHistoryPtr& history);
+    TmsServerHistoryPtr getHistory();
 
 private:
     ContextPtr context;
     DevicePtr rootDevice;
+    TmsServerHistoryPtr history;
 
     std::unordered_map<std::string, std::weak_ptr<tms::TmsServerObject>> idToObjMap;
     void coreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs);
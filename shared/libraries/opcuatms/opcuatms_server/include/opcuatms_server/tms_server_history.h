@@ -0,0 +1,170 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opcuatms/opcuatms.h>
+#include <opcuashared/opcuanodeid.h>
+#include <opendaq/context_ptr.h>
+#include <opendaq/signal_ptr.h>
+#include <opendaq/stream_reader_ptr.h>
+#include <opendaq/time_reader.h>
+#include <open62541/server.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_OPCUA_TMS
+
+struct TmsServerHistoryConfig
+{
+    // Number of samples kept per signal. The history is disabled if 0.
+    SizeT depth = 0;
+    // Only every n-th sample of a signal is kept.
+    SizeT decimation = 1;
+};
+
+enum class TmsServerHistoryAggregate
+{
+    Minimum,
+    Maximum,
+    Average
+};
+
+/*
+ * Ring of the most recent samples of a signal, stored as timestamp/value pairs. Samples are read from the
+ * signal with a stream reader on every data-available notification, so the ring holds plain numbers rather
+ * than boxed last values.
+ */
+class TmsServerSignalHistory
+{
+public:
+    struct Sample
+    {
+        UA_DateTime timestamp;
+        Float value;
+    };
+
+    struct ProcessedSample
+    {
+        UA_DateTime timestamp;
+        std::optional<Float> value;
+    };
+
+    TmsServerSignalHistory(SizeT depth, SizeT decimation);
+    ~TmsServerSignalHistory();
+
+    // Starts recording the signal. Throws if the signal values cannot be read as numbers with time-points.
+    void record(const SignalPtr& signal);
+    void append(const Float* values, const UA_DateTime* timestamps, SizeT count);
+
+    SizeT getCount() const;
+
+    /*
+     * Returns the samples in the time range, ordered from start to end. Either bound can be 0 (unspecified),
+     * in which case the range is open in that direction. At most maxValues samples are returned if non-zero.
+     */
+    std::vector<Sample> readRaw(UA_DateTime start, UA_DateTime end, SizeT maxValues) const;
+
+    /*
+     * Aggregates the samples of every interval of the range. Intervals without samples have no value. The
+     * minimum and maximum carry the timestamp of the selected sample (the first one if several are equal),
+     * the average and empty intervals the start of the interval.
+     */
+    std::vector<ProcessedSample> readProcessed(UA_DateTime start,
+                                               UA_DateTime end,
+                                               UA_DateTime interval,
+                                               TmsServerHistoryAggregate aggregate) const;
+
+private:
+    void onDataAvailable();
+    const Sample& at(SizeT index) const;
+    SizeT lowerBound(UA_DateTime timestamp) const;
+
+    mutable std::mutex sync;
+    std::vector<Sample> ring;
+    SizeT head = 0;
+    SizeT count = 0;
+    SizeT decimation;
+    SizeT decimationCounter = 0;
+
+    std::unique_ptr<TimeReader<StreamReaderPtr>> reader;
+    std::vector<Float> valueBuffer;
+    std::vector<std::chrono::system_clock::time_point> timeBuffer;
+    std::vector<UA_DateTime> timestampBuffer;
+};
+
+using TmsServerSignalHistoryPtr = std::shared_ptr<TmsServerSignalHistory>;
+
+/*
+ * History database of the OPC UA server. Maps the nodes of signal values to the rings of their signals and
+ * serves the raw and processed (minimum, maximum and average) history reads from them.
+ */
+class TmsServerHistory
+{
+public:
+    TmsServerHistory(const TmsServerHistoryConfig& config, const ContextPtr& context);
+
+    // Creates and registers the history of the signal. Returns nullptr if the signal cannot be historized.
+    TmsServerSignalHistoryPtr createSignalHistory(const opcua::OpcUaNodeId& nodeId, const SignalPtr& signal);
+    TmsServerSignalHistoryPtr getSignalHistory(const opcua::OpcUaNodeId& nodeId);
+
+#ifdef UA_ENABLE_HISTORIZING
+    // The database refers to this object, which must outlive the server.
+    UA_HistoryDatabase createDatabase();
+#endif
+
+private:
+#ifdef UA_ENABLE_HISTORIZING
+    static void readRaw(UA_Server* server,
+                        void* hdbContext,
+                        const UA_NodeId* sessionId,
+                        void* sessionContext,
+                        const UA_RequestHeader* requestHeader,
+                        const UA_ReadRawModifiedDetails* historyReadDetails,
+                        UA_TimestampsToReturn timestampsToReturn,
+                        UA_Boolean releaseContinuationPoints,
+                        size_t nodesToReadSize,
+                        const UA_HistoryReadValueId* nodesToRead,
+                        UA_HistoryReadResponse* response,
+                        UA_HistoryData* const* const historyData);
+
+    static void readProcessed(UA_Server* server,
+                              void* hdbContext,
+                              const UA_NodeId* sessionId,
+                              void* sessionContext,
+                              const UA_RequestHeader* requestHeader,
+                              const UA_ReadProcessedDetails* historyReadDetails,
+                              UA_TimestampsToReturn timestampsToReturn,
+                              UA_Boolean releaseContinuationPoints,
+                              size_t nodesToReadSize,
+                              const UA_HistoryReadValueId* nodesToRead,
+                              UA_HistoryReadResponse* response,
+                              UA_HistoryData* const* const historyData);
+#endif
+
+    TmsServerHistoryConfig config;
+    ContextPtr context;
+
+    std::mutex sync;
+    std::unordered_map<opcua::OpcUaNodeId, std::weak_ptr<TmsServerSignalHistory>> signalHistories;
+};
+
+using TmsServerHistoryPtr = std::shared_ptr<TmsServerHistory>;
+
+END_NAMESPACE_OPENDAQ_OPCUA_TMS
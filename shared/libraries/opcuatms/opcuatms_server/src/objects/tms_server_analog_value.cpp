@@ -1,4 +1,5 @@
 #include <opcuatms_server/objects/tms_server_analog_value.h>
+#include <opcuatms_server/objects/tms_server_value.h>
 #include <opcuatms/converters/variant_converter.h>
 #include <open62541/daqbsp_nodeids.h>
 
@@ -9,6 +10,7 @@ using namespace opcua;
 TmsServerAnalogValue::TmsServerAnalogValue(const SignalPtr& signal, const opcua::OpcUaServerPtr& server, const ContextPtr& context, const TmsServerContextPtr& tmsContext)
     : Super(BaseObjectPtr(), server, context, tmsContext)
     , signal(signal)
+    , lastValueCache(TmsServerValue::LastValueRefreshInterval)
 {
 }
 
@@ -17,6 +19,11 @@ std::string TmsServerAnalogValue::getBrowseName()
     return "AnalogValue";
 }
 
+void TmsServerAnalogValue::descriptorChanged()
+{
+    lastValueCache.invalidate();
+}
+
 opcua::OpcUaNodeId TmsServerAnalogValue::getTmsTypeId()
 {
     // Return the base data variable type definition
@@ -86,21 +93,24 @@ void TmsServerAnalogValue::bindCallbacks()
     
     addReadCallback(nodeId, [this]()
     {
-        const auto descriptor = signal.getDescriptor();
-        SampleType type = descriptor.assigned() ? descriptor.getSampleType() : SampleType::Undefined;
+        return lastValueCache.get([this]
+        {
+            const auto descriptor = signal.getDescriptor();
+            SampleType type = descriptor.assigned() ? descriptor.getSampleType() : SampleType::Undefined;
 
-        if (type != SampleType::Float32 && type != SampleType::Float64 && type != SampleType::Int8 &&
-            type != SampleType::Int16 && type != SampleType::Int32 && type != SampleType::Int64 &&
-            type != SampleType::UInt8 && type != SampleType::UInt16 && type != SampleType::UInt32 &&
-            type != SampleType::UInt64 && type != SampleType::RangeInt64 && type != SampleType::ComplexFloat32 &&
-            type != SampleType::ComplexFloat64)
-            return OpcUaVariant();
+            if (type != SampleType::Float32 && type != SampleType::Float64 && type != SampleType::Int8 &&
+                type != SampleType::Int16 && type != SampleType::Int32 && type != SampleType::Int64 &&
+                type != SampleType::UInt8 && type != SampleType::UInt16 && type != SampleType::UInt32 &&
+                type != SampleType::UInt64 && type != SampleType::RangeInt64 && type != SampleType::ComplexFloat32 &&
+                type != SampleType::ComplexFloat64)
+                return OpcUaVariant();
 
-        ObjectPtr lastValue = signal.getLastValue();
-        if (lastValue != nullptr)
-            return VariantConverter<IBaseObject>::ToVariant(lastValue, nullptr, daqContext);
+            ObjectPtr lastValue = signal.getLastValue();
+            if (lastValue != nullptr)
+                return VariantConverter<IBaseObject>::ToVariant(lastValue, nullptr, daqContext);
 
-        return OpcUaVariant();
+            return OpcUaVariant();
+        });
     });
     
     Super::bindCallbacks();
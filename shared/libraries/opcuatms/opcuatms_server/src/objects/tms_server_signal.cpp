@@ -51,6 +51,11 @@ void TmsServerSignal::onCoreEvent(const CoreEventArgsPtr& args)
     {
         try
         {
+            if (valueServer)
+                valueServer->descriptorChanged();
+            if (analogValueServer)
+                analogValueServer->descriptorChanged();
+
             const auto descriptor = object.getDescriptor();
             if (!descriptor.assigned() || !valueServer)
                 return;
@@ -1,4 +1,5 @@
 #include <opcuatms_server/objects/tms_server_value.h>
+#include <opcuatms_server/tms_server_context.h>
 #include <opcuatms/converters/variant_converter.h>
 #include <open62541/daqbsp_nodeids.h>
 #include "opendaq/custom_log.h"
@@ -18,6 +19,12 @@ std::string TmsServerValue::getBrowseName()
     return "Value";
 }
 
+void TmsServerValue::descriptorChanged()
+{
+    descriptorCache.invalidate();
+    lastValueCache.invalidate();
+}
+
 opcua::OpcUaNodeId TmsServerValue::getTmsTypeId()
 {
     // Return the base data variable type definition
@@ -108,22 +115,35 @@ void TmsServerValue::bindCallbacks()
 {
     addReadCallback(nodeId, [this]()
     {
-        ObjectPtr lastValue = signal.getLastValue();
-        if (lastValue != nullptr)
-            return VariantConverter<IBaseObject>::ToVariant(lastValue, nullptr, daqContext);
+        return lastValueCache.get([this]
+        {
+            ObjectPtr lastValue = signal.getLastValue();
+            if (lastValue != nullptr)
+                return VariantConverter<IBaseObject>::ToVariant(lastValue, nullptr, daqContext);
 
-        return OpcUaVariant();
+            return OpcUaVariant();
+        });
     });
 
     addReadCallback("DataDescriptor", [this]()
     {
-        DataDescriptorPtr descriptor = signal.getDescriptor();
-        if (descriptor.assigned())
-            return VariantConverter<IBaseObject>::ToVariant(descriptor, nullptr, daqContext);
-        else
-            return OpcUaVariant();
+        const DataDescriptorPtr descriptor = signal.getDescriptor();
+        return descriptorCache.get(descriptor, [this, &descriptor]
+        {
+            if (descriptor.assigned())
+                return VariantConverter<IBaseObject>::ToVariant(descriptor, nullptr, daqContext);
+            else
+                return OpcUaVariant();
+        });
     });
 
+    if (const auto history = tmsContext ? tmsContext->getHistory() : nullptr)
+    {
+        signalHistory = history->createSignalHistory(nodeId, signal);
+        if (signalHistory)
+            server->setHistorizing(nodeId, true);
+    }
+
     Super::bindCallbacks();
 }
 
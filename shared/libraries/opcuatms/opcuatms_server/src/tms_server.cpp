@@ -38,6 +38,11 @@ void TmsServer::setOpcUaPath(const std::string& path)
     this->opcUaPath = path;
 }
 
+void TmsServer::setHistoryConfig(const TmsServerHistoryConfig& config)
+{
+    this->historyConfig = config;
+}
+
 void TmsServer::start()
 {
     if (!device.assigned())
@@ -82,9 +87,21 @@ void TmsServer::start()
             }
         }
     );
+    if (historyConfig.depth > 0)
+    {
+#ifdef UA_ENABLE_HISTORIZING
+        history = std::make_shared<TmsServerHistory>(historyConfig, context);
+        server->setHistoryDatabase(history->createDatabase());
+#else
+        const auto loggerComponent = context.getLogger().getOrAddComponent("TmsServer");
+        LOG_W("Signal history is not available; the OPC UA server is built without historizing support.");
+#endif
+    }
+
     server->prepare();
 
     tmsContext = std::make_shared<TmsServerContext>(context, device);
+    tmsContext->setHistory(history);
 
     auto serverCapability = ServerCapability("OpenDAQOPCUAConfiguration", "OpenDAQOPCUA", ProtocolType::Configuration);
     serverCapability.setPrefix("daq.opcua");
@@ -121,6 +138,7 @@ void TmsServer::stop()
     
     server.reset();
     tmsDevice.reset();
+    history.reset();
 }
 
 END_NAMESPACE_OPENDAQ_OPCUA
@@ -33,6 +33,16 @@ ComponentPtr TmsServerContext::findComponent(const std::string& globalId)
     return rootDevice.findComponent(relativeGlobalId);
 }
 
+void TmsServerContext::setHistory(const TmsServerHistoryPtr& history)
+{
+    this->history = history;
+}
+
+TmsServerHistoryPtr TmsServerContext::getHistory()
+{
+    return history;
+}
+
 void TmsServerContext::coreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs)
 {
     if (!component.assigned())
@@ -0,0 +1,545 @@
+#include <opcuatms_server/tms_server_history.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/reader_factory.h>
+#include <algorithm>
+
+BEGIN_NAMESPACE_OPENDAQ_OPCUA_TMS
+
+using namespace opcua;
+
+namespace
+{
+    constexpr SizeT ReadBlockSize = 1024;
+    constexpr SizeT MaxProcessedIntervals = 65536;
+
+    bool isNumeric(SampleType sampleType)
+    {
+        switch (sampleType)
+        {
+            case SampleType::Float32:
+            case SampleType::Float64:
+            case SampleType::Int8:
+            case SampleType::UInt8:
+            case SampleType::Int16:
+            case SampleType::UInt16:
+            case SampleType::Int32:
+            case SampleType::UInt32:
+            case SampleType::Int64:
+            case SampleType::UInt64:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    UA_DateTime toDateTime(const std::chrono::system_clock::time_point& timePoint)
+    {
+        using Ticks = std::chrono::duration<int64_t, std::ratio<1, 10000000>>;
+        return UA_DATETIME_UNIX_EPOCH + std::chrono::duration_cast<Ticks>(timePoint.time_since_epoch()).count();
+    }
+}
+
+// TmsServerSignalHistory
+
+TmsServerSignalHistory::TmsServerSignalHistory(SizeT depth, SizeT decimation)
+    : ring(depth)
+    , decimation(std::max<SizeT>(decimation, 1))
+{
+    if (depth == 0)
+        DAQ_THROW_EXCEPTION(InvalidParameterException, "History depth must be greater than 0.");
+}
+
+TmsServerSignalHistory::~TmsServerSignalHistory()
+{
+    if (reader)
+        reader->setOnDataAvailable(nullptr);
+}
+
+void TmsServerSignalHistory::record(const SignalPtr& signal)
+{
+    if (reader)
+        DAQ_THROW_EXCEPTION(InvalidStateException, "History is already recording a signal.");
+
+    if (!signal.getDomainSignal().assigned())
+        DAQ_THROW_EXCEPTION(InvalidParameterException, "Signal has no domain signal.");
+
+    const auto descriptor = signal.getDescriptor();
+    if (descriptor.assigned() && !isNumeric(descriptor.getSampleType()))
+        DAQ_THROW_EXCEPTION(InvalidParameterException, "Signal values are not numeric.");
+
+    reader = std::make_unique<TimeReader<StreamReaderPtr>>(
+        StreamReader(signal, SampleType::Float64, SampleType::Int64, ReadMode::Scaled, ReadTimeoutType::Any));
+    reader->setOnDataAvailable([this] { onDataAvailable(); });
+}
+
+void TmsServerSignalHistory::onDataAvailable()
+{
+    try
+    {
+        for (;;)
+        {
+            SizeT toRead = std::min(reader->getAvailableCount(), ReadBlockSize);
+
+            valueBuffer.resize(std::max<SizeT>(toRead, 1));
+            timeBuffer.resize(std::max<SizeT>(toRead, 1));
+
+            ReaderStatusPtr status;
+            reader->readWithDomain(valueBuffer.data(), timeBuffer.data(), &toRead, 0, &status);
+
+            if (toRead > 0)
+            {
+                timestampBuffer.resize(toRead);
+                for (SizeT i = 0; i < toRead; ++i)
+                    timestampBuffer[i] = toDateTime(timeBuffer[i]);
+
+                append(valueBuffer.data(), timestampBuffer.data(), toRead);
+            }
+            else if (!status.assigned() || status.getReadStatus() != ReadStatus::Event)
+            {
+                break;
+            }
+
+            if (status.assigned() && !status.getValid())
+                break;
+        }
+    }
+    catch (const DaqException&)
+    {
+        // Descriptor changed to a type that cannot be read as numbers; keep the samples recorded so far.
+    }
+}
+
+void TmsServerSignalHistory::append(const Float* values, const UA_DateTime* timestamps, SizeT count)
+{
+    std::scoped_lock lock(sync);
+
+    const SizeT depth = ring.size();
+    for (SizeT i = 0; i < count; ++i)
+    {
+        const bool keep = decimationCounter == 0;
+        decimationCounter = (decimationCounter + 1) % decimation;
+        if (!keep)
+            continue;
+
+        if (this->count < depth)
+        {
+            ring[(head + this->count) % depth] = {timestamps[i], values[i]};
+            this->count++;
+        }
+        else
+        {
+            ring[head] = {timestamps[i], values[i]};
+            head = (head + 1) % depth;
+        }
+    }
+}
+
+SizeT TmsServerSignalHistory::getCount() const
+{
+    std::scoped_lock lock(sync);
+    return count;
+}
+
+const TmsServerSignalHistory::Sample& TmsServerSignalHistory::at(SizeT index) const
+{
+    return ring[(head + index) % ring.size()];
+}
+
+SizeT TmsServerSignalHistory::lowerBound(UA_DateTime timestamp) const
+{
+    SizeT first = 0;
+    SizeT length = count;
+    while (length > 0)
+    {
+        const SizeT half = length / 2;
+        if (at(first + half).timestamp < timestamp)
+        {
+            first += half + 1;
+            length -= half + 1;
+        }
+        else
+        {
+            length = half;
+        }
+    }
+
+    return first;
+}
+
+std::vector<TmsServerSignalHistory::Sample> TmsServerSignalHistory::readRaw(UA_DateTime start, UA_DateTime end, SizeT maxValues) const
+{
+    std::scoped_lock lock(sync);
+
+    // The start bound is included and the end bound is excluded; the samples are returned in reverse
+    // order if the range ends before it starts, or if only the end is specified.
+    const bool reverse = start == 0 ? end != 0 : end != 0 && start > end;
+
+    SizeT first;
+    SizeT last;
+    if (!reverse)
+    {
+        first = start != 0 ? lowerBound(start) : 0;
+        last = end != 0 ? lowerBound(end == start ? end + 1 : end) : count;
+    }
+    else
+    {
+        first = start != 0 ? lowerBound(end + 1) : 0;
+        last = lowerBound((start != 0 ? start : end) + 1);
+    }
+
+    last = std::max(first, last);
+    SizeT size = last - first;
+    if (maxValues != 0)
+        size = std::min(size, maxValues);
+
+    std::vector<Sample> samples;
+    samples.reserve(size);
+    for (SizeT i = 0; i < size; ++i)
+        samples.push_back(reverse ? at(last - 1 - i) : at(first + i));
+
+    return samples;
+}
+
+std::vector<TmsServerSignalHistory::ProcessedSample> TmsServerSignalHistory::readProcessed(UA_DateTime start,
+                                                                                           UA_DateTime end,
+                                                                                           UA_DateTime interval,
+                                                                                           TmsServerHistoryAggregate aggregate) const
+{
+    const bool reverse = start > end;
+    if (reverse)
+        std::swap(start, end);
+
+    if (interval <= 0)
+        interval = end - start;
+    if (interval <= 0)
+        return {};
+
+    if ((end - start) / interval >= static_cast<UA_DateTime>(MaxProcessedIntervals))
+        DAQ_THROW_EXCEPTION(InvalidParameterException, "Processing interval is too short for the requested time range.");
+
+    std::scoped_lock lock(sync);
+
+    std::vector<ProcessedSample> samples;
+    SizeT index = lowerBound(start);
+    for (UA_DateTime intervalStart = start; intervalStart < end; intervalStart += interval)
+    {
+        const UA_DateTime intervalEnd = std::min(intervalStart + interval, end);
+
+        // The minimum and maximum are timestamped with the selected sample, the average with the interval start
+        SizeT intervalCount = 0;
+        Float result = 0.0;
+        UA_DateTime resultTimestamp = intervalStart;
+        for (; index < count && at(index).timestamp < intervalEnd; ++index)
+        {
+            const auto& sample = at(index);
+            switch (aggregate)
+            {
+                case TmsServerHistoryAggregate::Minimum:
+                    if (intervalCount == 0 || sample.value < result)
+                    {
+                        result = sample.value;
+                        resultTimestamp = sample.timestamp;
+                    }
+                    break;
+                case TmsServerHistoryAggregate::Maximum:
+                    if (intervalCount == 0 || sample.value > result)
+                    {
+                        result = sample.value;
+                        resultTimestamp = sample.timestamp;
+                    }
+                    break;
+                case TmsServerHistoryAggregate::Average:
+                    result += sample.value;
+                    break;
+            }
+            intervalCount++;
+        }
+
+        if (intervalCount == 0)
+            samples.push_back({intervalStart, std::nullopt});
+        else if (aggregate == TmsServerHistoryAggregate::Average)
+            samples.push_back({intervalStart, result / static_cast<Float>(intervalCount)});
+        else
+            samples.push_back({resultTimestamp, result});
+    }
+
+    if (reverse)
+        std::reverse(samples.begin(), samples.end());
+
+    return samples;
+}
+
+// TmsServerHistory
+
+TmsServerHistory::TmsServerHistory(const TmsServerHistoryConfig& config, const ContextPtr& context)
+    : config(config)
+    , context(context)
+{
+}
+
+TmsServerSignalHistoryPtr TmsServerHistory::createSignalHistory(const OpcUaNodeId& nodeId, const SignalPtr& signal)
+{
+    if (config.depth == 0)
+        return nullptr;
+
+    auto signalHistory = std::make_shared<TmsServerSignalHistory>(config.depth, config.decimation);
+    try
+    {
+        signalHistory->record(signal);
+    }
+    catch (const DaqException& e)
+    {
+        const auto loggerComponent = context.getLogger().getOrAddComponent("OpenDAQOPCUAServerModule");
+        LOG_D("Signal {} is not historized: {}", signal.getGlobalId(), e.what());
+        return nullptr;
+    }
+
+    std::scoped_lock lock(sync);
+    signalHistories[nodeId] = signalHistory;
+    return signalHistory;
+}
+
+TmsServerSignalHistoryPtr TmsServerHistory::getSignalHistory(const OpcUaNodeId& nodeId)
+{
+    std::scoped_lock lock(sync);
+
+    const auto it = signalHistories.find(nodeId);
+    if (it == signalHistories.end())
+        return nullptr;
+
+    auto signalHistory = it->second.lock();
+    if (!signalHistory)
+        signalHistories.erase(it);
+
+    return signalHistory;
+}
+
+#ifdef UA_ENABLE_HISTORIZING
+
+namespace
+{
+    void setDataValue(UA_DataValue& dataValue, UA_DateTime timestamp, const Float* value, UA_TimestampsToReturn timestampsToReturn)
+    {
+        UA_DataValue_init(&dataValue);
+
+        if (value)
+        {
+            UA_Variant_setScalarCopy(&dataValue.value, value, &UA_TYPES[UA_TYPES_DOUBLE]);
+            dataValue.hasValue = true;
+        }
+        else
+        {
+            dataValue.status = UA_STATUSCODE_BADNODATA;
+            dataValue.hasStatus = true;
+        }
+
+        if (timestampsToReturn == UA_TIMESTAMPSTORETURN_SOURCE || timestampsToReturn == UA_TIMESTAMPSTORETURN_BOTH)
+        {
+            dataValue.sourceTimestamp = timestamp;
+            dataValue.hasSourceTimestamp = true;
+        }
+
+        if (timestampsToReturn == UA_TIMESTAMPSTORETURN_SERVER || timestampsToReturn == UA_TIMESTAMPSTORETURN_BOTH)
+        {
+            dataValue.serverTimestamp = timestamp;
+            dataValue.hasServerTimestamp = true;
+        }
+    }
+
+    bool toAggregate(const UA_NodeId& aggregateType, TmsServerHistoryAggregate& aggregate)
+    {
+        if (aggregateType.namespaceIndex != 0 || aggregateType.identifierType != UA_NODEIDTYPE_NUMERIC)
+            return false;
+
+        switch (aggregateType.identifier.numeric)
+        {
+            case UA_NS0ID_AGGREGATEFUNCTION_MINIMUM:
+                aggregate = TmsServerHistoryAggregate::Minimum;
+                return true;
+            case UA_NS0ID_AGGREGATEFUNCTION_MAXIMUM:
+                aggregate = TmsServerHistoryAggregate::Maximum;
+                return true;
+            case UA_NS0ID_AGGREGATEFUNCTION_AVERAGE:
+                aggregate = TmsServerHistoryAggregate::Average;
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+UA_HistoryDatabase TmsServerHistory::createDatabase()
+{
+    UA_HistoryDatabase database{};
+    database.context = this;
+    database.readRaw = &TmsServerHistory::readRaw;
+    database.readProcessed = &TmsServerHistory::readProcessed;
+    return database;
+}
+
+void TmsServerHistory::readRaw(UA_Server* /*server*/,
+                               void* hdbContext,
+                               const UA_NodeId* /*sessionId*/,
+                               void* /*sessionContext*/,
+                               const UA_RequestHeader* /*requestHeader*/,
+                               const UA_ReadRawModifiedDetails* historyReadDetails,
+                               UA_TimestampsToReturn timestampsToReturn,
+                               UA_Boolean releaseContinuationPoints,
+                               size_t nodesToReadSize,
+                               const UA_HistoryReadValueId* nodesToRead,
+                               UA_HistoryReadResponse* response,
+                               UA_HistoryData* const* const historyData)
+{
+    auto* history = static_cast<TmsServerHistory*>(hdbContext);
+
+    for (size_t i = 0; i < nodesToReadSize; ++i)
+    {
+        UA_StatusCode& status = response->results[i].statusCode;
+
+        // Reads are never split, so there are no continuation points to release or resume from.
+        if (releaseContinuationPoints)
+            continue;
+
+        if (nodesToRead[i].continuationPoint.length > 0)
+        {
+            status = UA_STATUSCODE_BADCONTINUATIONPOINTINVALID;
+            continue;
+        }
+
+        if (historyReadDetails->isReadModified)
+        {
+            status = UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED;
+            continue;
+        }
+
+        if (historyReadDetails->startTime == 0 && historyReadDetails->endTime == 0)
+        {
+            status = UA_STATUSCODE_BADINVALIDTIMESTAMPARGUMENT;
+            continue;
+        }
+
+        const auto signalHistory = history->getSignalHistory(OpcUaNodeId(nodesToRead[i].nodeId));
+        if (!signalHistory)
+        {
+            status = UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED;
+            continue;
+        }
+
+        const auto samples =
+            signalHistory->readRaw(historyReadDetails->startTime, historyReadDetails->endTime, historyReadDetails->numValuesPerNode);
+        if (samples.empty())
+        {
+            status = UA_STATUSCODE_GOODNODATA;
+            continue;
+        }
+
+        auto* dataValues = static_cast<UA_DataValue*>(UA_Array_new(samples.size(), &UA_TYPES[UA_TYPES_DATAVALUE]));
+        if (!dataValues)
+        {
+            status = UA_STATUSCODE_BADOUTOFMEMORY;
+            continue;
+        }
+
+        for (size_t j = 0; j < samples.size(); ++j)
+            setDataValue(dataValues[j], samples[j].timestamp, &samples[j].value, timestampsToReturn);
+
+        historyData[i]->dataValues = dataValues;
+        historyData[i]->dataValuesSize = samples.size();
+        status = UA_STATUSCODE_GOOD;
+    }
+}
+
+void TmsServerHistory::readProcessed(UA_Server* /*server*/,
+                                     void* hdbContext,
+                                     const UA_NodeId* /*sessionId*/,
+                                     void* /*sessionContext*/,
+                                     const UA_RequestHeader* /*requestHeader*/,
+                                     const UA_ReadProcessedDetails* historyReadDetails,
+                                     UA_TimestampsToReturn timestampsToReturn,
+                                     UA_Boolean releaseContinuationPoints,
+                                     size_t nodesToReadSize,
+                                     const UA_HistoryReadValueId* nodesToRead,
+                                     UA_HistoryReadResponse* response,
+                                     UA_HistoryData* const* const historyData)
+{
+    auto* history = static_cast<TmsServerHistory*>(hdbContext);
+    const auto interval = static_cast<UA_DateTime>(historyReadDetails->processingInterval * UA_DATETIME_MSEC);
+
+    for (size_t i = 0; i < nodesToReadSize; ++i)
+    {
+        UA_StatusCode& status = response->results[i].statusCode;
+
+        if (releaseContinuationPoints)
+            continue;
+
+        if (nodesToRead[i].continuationPoint.length > 0)
+        {
+            status = UA_STATUSCODE_BADCONTINUATIONPOINTINVALID;
+            continue;
+        }
+
+        if (historyReadDetails->aggregateTypeSize != nodesToReadSize)
+        {
+            status = UA_STATUSCODE_BADAGGREGATELISTMISMATCH;
+            continue;
+        }
+
+        TmsServerHistoryAggregate aggregate;
+        if (!toAggregate(historyReadDetails->aggregateType[i], aggregate))
+        {
+            status = UA_STATUSCODE_BADAGGREGATENOTSUPPORTED;
+            continue;
+        }
+
+        if (historyReadDetails->startTime == 0 || historyReadDetails->endTime == 0)
+        {
+            status = UA_STATUSCODE_BADINVALIDTIMESTAMPARGUMENT;
+            continue;
+        }
+
+        const auto signalHistory = history->getSignalHistory(OpcUaNodeId(nodesToRead[i].nodeId));
+        if (!signalHistory)
+        {
+            status = UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED;
+            continue;
+        }
+
+        std::vector<TmsServerSignalHistory::ProcessedSample> samples;
+        try
+        {
+            samples = signalHistory->readProcessed(historyReadDetails->startTime, historyReadDetails->endTime, interval, aggregate);
+        }
+        catch (const DaqException&)
+        {
+            status = UA_STATUSCODE_BADINVALIDARGUMENT;
+            continue;
+        }
+
+        if (samples.empty())
+        {
+            status = UA_STATUSCODE_GOODNODATA;
+            continue;
+        }
+
+        auto* dataValues = static_cast<UA_DataValue*>(UA_Array_new(samples.size(), &UA_TYPES[UA_TYPES_DATAVALUE]));
+        if (!dataValues)
+        {
+            status = UA_STATUSCODE_BADOUTOFMEMORY;
+            continue;
+        }
+
+        for (size_t j = 0; j < samples.size(); ++j)
+        {
+            const auto& value = samples[j].value;
+            setDataValue(dataValues[j], samples[j].timestamp, value ? &value.value() : nullptr, timestampsToReturn);
+        }
+
+        historyData[i]->dataValues = dataValues;
+        historyData[i]->dataValuesSize = samples.size();
+        status = UA_STATUSCODE_GOOD;
+    }
+}
+
+#endif
+
+END_NAMESPACE_OPENDAQ_OPCUA_TMS
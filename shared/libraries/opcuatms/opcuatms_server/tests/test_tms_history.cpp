@@ -0,0 +1,436 @@
+#include <gtest/gtest.h>
+#include <opcuatms_server/tms_server_history.h>
+#include <opcuatms_server/objects/tms_server_signal.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/signal_factory.h>
+#include <coreobjects/unit_factory.h>
+#include <coretypes/ratio_factory.h>
+#include "tms_server_test.h"
+
+using namespace daq;
+using namespace opcua::tms;
+using namespace opcua;
+
+using TmsHistoryTest = testing::Test;
+
+static void appendSamples(TmsServerSignalHistory& history, SizeT count, UA_DateTime firstTimestamp = 10)
+{
+    std::vector<Float> values(count);
+    std::vector<UA_DateTime> timestamps(count);
+    for (SizeT i = 0; i < count; ++i)
+    {
+        values[i] = static_cast<Float>(i);
+        timestamps[i] = firstTimestamp + static_cast<UA_DateTime>(i) * 10;
+    }
+
+    history.append(values.data(), timestamps.data(), count);
+}
+
+TEST_F(TmsHistoryTest, RingKeepsLatestSamples)
+{
+    TmsServerSignalHistory history(4, 1);
+    appendSamples(history, 6);
+
+    ASSERT_EQ(history.getCount(), 4u);
+
+    const auto samples = history.readRaw(1, 1000, 0);
+    ASSERT_EQ(samples.size(), 4u);
+    ASSERT_EQ(samples.front().value, 2.0);
+    ASSERT_EQ(samples.front().timestamp, 30);
+    ASSERT_EQ(samples.back().value, 5.0);
+    ASSERT_EQ(samples.back().timestamp, 60);
+}
+
+TEST_F(TmsHistoryTest, Decimation)
+{
+    TmsServerSignalHistory history(10, 3);
+    appendSamples(history, 7);
+
+    const auto samples = history.readRaw(1, 1000, 0);
+    ASSERT_EQ(samples.size(), 3u);
+    ASSERT_EQ(samples[0].value, 0.0);
+    ASSERT_EQ(samples[1].value, 3.0);
+    ASSERT_EQ(samples[2].value, 6.0);
+}
+
+TEST_F(TmsHistoryTest, ReadRawRange)
+{
+    TmsServerSignalHistory history(100, 1);
+    appendSamples(history, 10);
+
+    // Start is included, end is excluded
+    auto samples = history.readRaw(30, 60, 0);
+    ASSERT_EQ(samples.size(), 3u);
+    ASSERT_EQ(samples[0].timestamp, 30);
+    ASSERT_EQ(samples[2].timestamp, 50);
+
+    samples = history.readRaw(30, 0, 2);
+    ASSERT_EQ(samples.size(), 2u);
+    ASSERT_EQ(samples[0].timestamp, 30);
+    ASSERT_EQ(samples[1].timestamp, 40);
+
+    samples = history.readRaw(1000, 2000, 0);
+    ASSERT_TRUE(samples.empty());
+}
+
+TEST_F(TmsHistoryTest, ReadRawReverse)
+{
+    TmsServerSignalHistory history(100, 1);
+    appendSamples(history, 10);
+
+    auto samples = history.readRaw(60, 30, 0);
+    ASSERT_EQ(samples.size(), 3u);
+    ASSERT_EQ(samples[0].timestamp, 60);
+    ASSERT_EQ(samples[2].timestamp, 40);
+
+    samples = history.readRaw(0, 50, 2);
+    ASSERT_EQ(samples.size(), 2u);
+    ASSERT_EQ(samples[0].timestamp, 50);
+    ASSERT_EQ(samples[1].timestamp, 40);
+}
+
+TEST_F(TmsHistoryTest, ReadProcessed)
+{
+    TmsServerSignalHistory history(100, 1);
+    appendSamples(history, 10);
+
+    const auto minimum = history.readProcessed(10, 110, 50, TmsServerHistoryAggregate::Minimum);
+    ASSERT_EQ(minimum.size(), 2u);
+    ASSERT_EQ(minimum[0].timestamp, 10);
+    ASSERT_EQ(minimum[0].value, 0.0);
+    ASSERT_EQ(minimum[1].timestamp, 60);
+    ASSERT_EQ(minimum[1].value, 5.0);
+
+    const auto maximum = history.readProcessed(10, 110, 50, TmsServerHistoryAggregate::Maximum);
+    ASSERT_EQ(maximum[0].timestamp, 50);
+    ASSERT_EQ(maximum[0].value, 4.0);
+    ASSERT_EQ(maximum[1].timestamp, 100);
+    ASSERT_EQ(maximum[1].value, 9.0);
+
+    const auto average = history.readProcessed(10, 110, 50, TmsServerHistoryAggregate::Average);
+    ASSERT_EQ(average[0].timestamp, 10);
+    ASSERT_EQ(average[0].value, 2.0);
+    ASSERT_EQ(average[1].timestamp, 60);
+    ASSERT_EQ(average[1].value, 7.0);
+}
+
+TEST_F(TmsHistoryTest, ReadProcessedEmptyInterval)
+{
+    TmsServerSignalHistory history(100, 1);
+    appendSamples(history, 2);
+
+    const auto samples = history.readProcessed(10, 70, 20, TmsServerHistoryAggregate::Average);
+    ASSERT_EQ(samples.size(), 3u);
+    ASSERT_EQ(samples[0].value, 0.5);
+    ASSERT_FALSE(samples[1].value.has_value());
+    ASSERT_FALSE(samples[2].value.has_value());
+}
+
+TEST_F(TmsHistoryTest, SignalWithoutDomainNotHistorized)
+{
+    const auto context = NullContext();
+    TmsServerHistoryConfig config;
+    config.depth = 10;
+    TmsServerHistory history(config, context);
+
+    const auto signal = Signal(context, nullptr, "sig");
+    ASSERT_EQ(history.createSignalHistory(OpcUaNodeId(1, "sig"), signal), nullptr);
+}
+
+TEST_F(TmsHistoryTest, DisabledHistory)
+{
+    const auto context = NullContext();
+    TmsServerHistory history(TmsServerHistoryConfig(), context);
+
+    const auto signal = Signal(context, nullptr, "sig");
+    ASSERT_EQ(history.createSignalHistory(OpcUaNodeId(1, "sig"), signal), nullptr);
+}
+
+#ifdef UA_ENABLE_HISTORIZING
+
+class TmsHistoryServerTest : public TmsServerObjectTest
+{
+public:
+    void SetUp() override
+    {
+        testing::Test::SetUp();
+
+        ctx = NullContext();
+        TmsServerHistoryConfig config;
+        config.depth = 100;
+        history = std::make_shared<TmsServerHistory>(config, ctx);
+
+        server = std::make_shared<OpcUaServer>();
+        server->setPort(4840);
+        server->setHistoryDatabase(history->createDatabase());
+        server->start();
+        client = CreateAndConnectTestClient();
+
+        tmsCtx = std::make_shared<TmsServerContext>(ctx, nullptr);
+        tmsCtx->setHistory(history);
+    }
+
+    void TearDown() override
+    {
+        // The server refers to the history database, so it is stopped first
+        TmsServerObjectTest::TearDown();
+        history.reset();
+    }
+
+    SignalConfigPtr createSignal()
+    {
+        auto domainSignal = Signal(ctx, nullptr, "time");
+        domainSignal.setDescriptor(DataDescriptorBuilder()
+                                       .setSampleType(SampleType::Int64)
+                                       .setRule(LinearDataRule(1, 0))
+                                       .setTickResolution(Ratio(1, 1000))
+                                       .setOrigin("1970-01-01T00:00:00Z")
+                                       .setUnit(Unit("s", -1, "second", "time"))
+                                       .build());
+
+        auto signal = Signal(ctx, nullptr, "sig");
+        signal.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).build());
+        signal.setDomainSignal(domainSignal);
+        return signal;
+    }
+
+    // Sends values 0, 1, 2, ... timestamped every millisecond from firstTick milliseconds after the Unix epoch
+    static void sendSamples(const SignalConfigPtr& signal, SizeT count, Int firstTick)
+    {
+        const auto domainPacket = DataPacket(signal.getDomainSignal().getDescriptor(), count, firstTick);
+        const auto packet = DataPacketWithDomain(domainPacket, signal.getDescriptor(), count);
+
+        auto* data = static_cast<Float*>(packet.getRawData());
+        for (SizeT i = 0; i < count; ++i)
+            data[i] = static_cast<Float>(i);
+
+        signal.sendPacket(packet);
+    }
+
+    static UA_DateTime tickToDateTime(Int tick)
+    {
+        return UA_DATETIME_UNIX_EPOCH + tick * UA_DATETIME_MSEC;
+    }
+
+    OpcUaObject<UA_HistoryReadResponse> historyRead(const OpcUaNodeId& nodeId,
+                                                    void* details,
+                                                    const UA_DataType* detailsType,
+                                                    UA_TimestampsToReturn timestampsToReturn)
+    {
+        OpcUaObject<UA_HistoryReadRequest> request;
+        UA_ExtensionObject_setValue(&request->historyReadDetails, details, detailsType);
+        request->timestampsToReturn = timestampsToReturn;
+        request->nodesToRead = UA_HistoryReadValueId_new();
+        request->nodesToReadSize = 1;
+        request->nodesToRead[0].nodeId = nodeId.copyAndGetDetachedValue();
+
+        return UA_Client_Service_historyRead(client->getUaClient(), *request);
+    }
+
+    OpcUaObject<UA_HistoryReadResponse> readRaw(const OpcUaNodeId& nodeId,
+                                                UA_DateTime start,
+                                                UA_DateTime end,
+                                                UA_UInt32 maxValues,
+                                                UA_TimestampsToReturn timestampsToReturn = UA_TIMESTAMPSTORETURN_SOURCE)
+    {
+        auto* details = UA_ReadRawModifiedDetails_new();
+        details->startTime = start;
+        details->endTime = end;
+        details->numValuesPerNode = maxValues;
+        return historyRead(nodeId, details, &UA_TYPES[UA_TYPES_READRAWMODIFIEDDETAILS], timestampsToReturn);
+    }
+
+    OpcUaObject<UA_HistoryReadResponse> readProcessed(
+        const OpcUaNodeId& nodeId, UA_DateTime start, UA_DateTime end, UA_Double intervalMs, UA_UInt32 aggregate)
+    {
+        auto* details = UA_ReadProcessedDetails_new();
+        details->startTime = start;
+        details->endTime = end;
+        details->processingInterval = intervalMs;
+        details->aggregateType = UA_NodeId_new();
+        details->aggregateTypeSize = 1;
+        *details->aggregateType = UA_NODEID_NUMERIC(0, aggregate);
+        return historyRead(nodeId, details, &UA_TYPES[UA_TYPES_READPROCESSEDDETAILS], UA_TIMESTAMPSTORETURN_SOURCE);
+    }
+
+    static const UA_HistoryData& getHistoryData(const OpcUaObject<UA_HistoryReadResponse>& response)
+    {
+        EXPECT_EQ(response->results[0].historyData.content.decoded.type, &UA_TYPES[UA_TYPES_HISTORYDATA]);
+        return *static_cast<UA_HistoryData*>(response->results[0].historyData.content.decoded.data);
+    }
+
+    static Float getValue(const UA_DataValue& dataValue)
+    {
+        EXPECT_TRUE(dataValue.hasValue);
+        return *static_cast<UA_Double*>(dataValue.value.data);
+    }
+
+    TmsServerHistoryPtr history;
+};
+
+TEST_F(TmsHistoryServerTest, ValueNodeHistorizing)
+{
+    const auto signal = createSignal();
+    auto serverSignal = TmsServerSignal(signal, getServer(), ctx, tmsCtx);
+    const auto valueNodeId = getChildNodeId(serverSignal.registerOpcUaNode(), "Value");
+
+    UA_Boolean historizing = false;
+    ASSERT_EQ(UA_Client_readHistorizingAttribute(client->getUaClient(), *valueNodeId, &historizing), UA_STATUSCODE_GOOD);
+    ASSERT_TRUE(historizing);
+
+    UA_Byte accessLevel = 0;
+    ASSERT_EQ(UA_Client_readAccessLevelAttribute(client->getUaClient(), *valueNodeId, &accessLevel), UA_STATUSCODE_GOOD);
+    ASSERT_TRUE(accessLevel & UA_ACCESSLEVELMASK_HISTORYREAD);
+    ASSERT_TRUE(accessLevel & UA_ACCESSLEVELMASK_READ);
+}
+
+TEST_F(TmsHistoryServerTest, SignalWithoutDomainNotHistorized)
+{
+    const auto signal = Signal(ctx, nullptr, "sig");
+    auto serverSignal = TmsServerSignal(signal, getServer(), ctx, tmsCtx);
+    const auto valueNodeId = getChildNodeId(serverSignal.registerOpcUaNode(), "Value");
+
+    UA_Boolean historizing = true;
+    ASSERT_EQ(UA_Client_readHistorizingAttribute(client->getUaClient(), *valueNodeId, &historizing), UA_STATUSCODE_GOOD);
+    ASSERT_FALSE(historizing);
+
+    const auto response = readRaw(valueNodeId, tickToDateTime(0), tickToDateTime(1000), 0);
+    ASSERT_EQ(response->resultsSize, 1u);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED);
+}
+
+TEST_F(TmsHistoryServerTest, ReadRaw)
+{
+    const auto signal = createSignal();
+    auto serverSignal = TmsServerSignal(signal, getServer(), ctx, tmsCtx);
+    const auto valueNodeId = getChildNodeId(serverSignal.registerOpcUaNode(), "Value");
+
+    sendSamples(signal, 10, 1000);
+
+    auto response = readRaw(valueNodeId, tickToDateTime(1002), tickToDateTime(1005), 0);
+    ASSERT_EQ(response->resultsSize, 1u);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_GOOD);
+
+    const auto& data = getHistoryData(response);
+    ASSERT_EQ(data.dataValuesSize, 3u);
+    for (size_t i = 0; i < data.dataValuesSize; ++i)
+    {
+        ASSERT_EQ(getValue(data.dataValues[i]), static_cast<Float>(i + 2));
+        ASSERT_TRUE(data.dataValues[i].hasSourceTimestamp);
+        ASSERT_EQ(data.dataValues[i].sourceTimestamp, tickToDateTime(1002 + static_cast<Int>(i)));
+        ASSERT_FALSE(data.dataValues[i].hasServerTimestamp);
+    }
+
+    // Reverse order, limited to numValuesPerNode
+    response = readRaw(valueNodeId, tickToDateTime(1009), tickToDateTime(1000), 2);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_GOOD);
+    const auto& reverseData = getHistoryData(response);
+    ASSERT_EQ(reverseData.dataValuesSize, 2u);
+    ASSERT_EQ(getValue(reverseData.dataValues[0]), 9.0);
+    ASSERT_EQ(getValue(reverseData.dataValues[1]), 8.0);
+}
+
+TEST_F(TmsHistoryServerTest, ReadRawTimestampsToReturn)
+{
+    const auto signal = createSignal();
+    auto serverSignal = TmsServerSignal(signal, getServer(), ctx, tmsCtx);
+    const auto valueNodeId = getChildNodeId(serverSignal.registerOpcUaNode(), "Value");
+
+    sendSamples(signal, 1, 1000);
+
+    auto response = readRaw(valueNodeId, tickToDateTime(1000), tickToDateTime(2000), 0, UA_TIMESTAMPSTORETURN_BOTH);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_GOOD);
+    auto value = getHistoryData(response).dataValues[0];
+    ASSERT_TRUE(value.hasSourceTimestamp);
+    ASSERT_TRUE(value.hasServerTimestamp);
+    ASSERT_EQ(value.sourceTimestamp, tickToDateTime(1000));
+
+    response = readRaw(valueNodeId, tickToDateTime(1000), tickToDateTime(2000), 0, UA_TIMESTAMPSTORETURN_NEITHER);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_GOOD);
+    value = getHistoryData(response).dataValues[0];
+    ASSERT_FALSE(value.hasSourceTimestamp);
+    ASSERT_FALSE(value.hasServerTimestamp);
+    ASSERT_EQ(getValue(value), 0.0);
+}
+
+TEST_F(TmsHistoryServerTest, ReadRawStatusCodes)
+{
+    const auto signal = createSignal();
+    auto serverSignal = TmsServerSignal(signal, getServer(), ctx, tmsCtx);
+    const auto valueNodeId = getChildNodeId(serverSignal.registerOpcUaNode(), "Value");
+
+    sendSamples(signal, 10, 1000);
+
+    auto response = readRaw(valueNodeId, tickToDateTime(5000), tickToDateTime(6000), 0);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_GOODNODATA);
+
+    response = readRaw(valueNodeId, 0, 0, 0);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_BADINVALIDTIMESTAMPARGUMENT);
+
+    auto* details = UA_ReadRawModifiedDetails_new();
+    details->isReadModified = true;
+    details->startTime = tickToDateTime(1000);
+    details->endTime = tickToDateTime(2000);
+    response = historyRead(valueNodeId, details, &UA_TYPES[UA_TYPES_READRAWMODIFIEDDETAILS], UA_TIMESTAMPSTORETURN_SOURCE);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED);
+}
+
+TEST_F(TmsHistoryServerTest, ReadProcessed)
+{
+    const auto signal = createSignal();
+    auto serverSignal = TmsServerSignal(signal, getServer(), ctx, tmsCtx);
+    const auto valueNodeId = getChildNodeId(serverSignal.registerOpcUaNode(), "Value");
+
+    sendSamples(signal, 10, 1000);
+
+    auto response = readProcessed(valueNodeId, tickToDateTime(1000), tickToDateTime(1010), 5, UA_NS0ID_AGGREGATEFUNCTION_MINIMUM);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_GOOD);
+    const auto& minimum = getHistoryData(response);
+    ASSERT_EQ(minimum.dataValuesSize, 2u);
+    ASSERT_EQ(getValue(minimum.dataValues[0]), 0.0);
+    ASSERT_EQ(minimum.dataValues[0].sourceTimestamp, tickToDateTime(1000));
+    ASSERT_EQ(getValue(minimum.dataValues[1]), 5.0);
+    ASSERT_EQ(minimum.dataValues[1].sourceTimestamp, tickToDateTime(1005));
+
+    response = readProcessed(valueNodeId, tickToDateTime(1000), tickToDateTime(1010), 5, UA_NS0ID_AGGREGATEFUNCTION_MAXIMUM);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_GOOD);
+    const auto& maximum = getHistoryData(response);
+    ASSERT_EQ(maximum.dataValuesSize, 2u);
+    ASSERT_EQ(getValue(maximum.dataValues[0]), 4.0);
+    ASSERT_EQ(maximum.dataValues[0].sourceTimestamp, tickToDateTime(1004));
+    ASSERT_EQ(getValue(maximum.dataValues[1]), 9.0);
+    ASSERT_EQ(maximum.dataValues[1].sourceTimestamp, tickToDateTime(1009));
+
+    response = readProcessed(valueNodeId, tickToDateTime(1000), tickToDateTime(1020), 10, UA_NS0ID_AGGREGATEFUNCTION_AVERAGE);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_GOOD);
+    const auto& average = getHistoryData(response);
+    ASSERT_EQ(average.dataValuesSize, 2u);
+    ASSERT_EQ(getValue(average.dataValues[0]), 4.5);
+    ASSERT_EQ(average.dataValues[0].sourceTimestamp, tickToDateTime(1000));
+    ASSERT_FALSE(average.dataValues[1].hasValue);
+    ASSERT_EQ(average.dataValues[1].status, UA_STATUSCODE_BADNODATA);
+    ASSERT_EQ(average.dataValues[1].sourceTimestamp, tickToDateTime(1010));
+}
+
+TEST_F(TmsHistoryServerTest, ReadProcessedStatusCodes)
+{
+    const auto signal = createSignal();
+    auto serverSignal = TmsServerSignal(signal, getServer(), ctx, tmsCtx);
+    const auto valueNodeId = getChildNodeId(serverSignal.registerOpcUaNode(), "Value");
+
+    sendSamples(signal, 10, 1000);
+
+    auto response = readProcessed(valueNodeId, tickToDateTime(1000), tickToDateTime(1010), 5, UA_NS0ID_AGGREGATEFUNCTION_COUNT);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_BADAGGREGATENOTSUPPORTED);
+
+    response = readProcessed(valueNodeId, 0, tickToDateTime(1010), 5, UA_NS0ID_AGGREGATEFUNCTION_AVERAGE);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_BADINVALIDTIMESTAMPARGUMENT);
+
+    response = readProcessed(valueNodeId, tickToDateTime(0), tickToDateTime(1000000), 0.001, UA_NS0ID_AGGREGATEFUNCTION_AVERAGE);
+    ASSERT_EQ(response->results[0].statusCode, UA_STATUSCODE_BADINVALIDARGUMENT);
+}
+
+#endif
@@ -2,12 +2,14 @@
 #include <open62541/daqbsp_nodeids.h>
 #include <open62541/daqbt_nodeids.h>
 #include <open62541/nodeids.h>
+#include <opendaq/core_opendaq_event_args_factory.h>
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/range_factory.h>
 #include <opendaq/signal_factory.h>
 #include <opendaq/signal_ptr.h>
 #include <gtest/gtest.h>
 #include <opcuaclient/opcuaclient.h>
+#include <opcuatms/converters/variant_converter.h>
 #include <opcuatms_server/objects/tms_server_input_port.h>
 #include <opcuatms_server/objects/tms_server_signal.h>
 #include "tms_server_test.h"
@@ -116,4 +118,52 @@ TEST_F(TmsSignalTest, ValueAndAnalogValueDataTypeInt32)
     // Check that AnalogValue node has Int32 data type (not abstract NUMBER)
     auto analogValueDataType = this->getClient()->readDataType(analogValueNodeId);
     ASSERT_EQ(analogValueDataType, OpcUaNodeId(0, UA_NS0ID_INT32));
-}
\ No newline at end of file
+}
+
+TEST_F(TmsSignalTest, DataDescriptorCachedUntilChanged)
+{
+    SignalConfigPtr signal = createSignal(ctx, "signal");
+    signal.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).setName("first").build());
+
+    auto serverSignal = TmsServerSignal(signal, this->getServer(), ctx, tmsCtx);
+    auto signalNodeId = serverSignal.registerOpcUaNode();
+    auto descriptorNodeId = getChildNodeId(getChildNodeId(signalNodeId, "Value"), "DataDescriptor");
+
+    const auto readDescriptorName = [&]
+    {
+        DataDescriptorPtr descriptor = VariantConverter<IBaseObject>::ToDaqObject(this->getClient()->readValue(descriptorNodeId), ctx);
+        return descriptor.getName();
+    };
+
+    ASSERT_EQ(readDescriptorName(), "first");
+    ASSERT_EQ(readDescriptorName(), "first");
+
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).setName("second").build();
+    signal.setDescriptor(descriptor);
+    serverSignal.onCoreEvent(CoreEventArgsDataDescriptorChanged(descriptor));
+
+    ASSERT_EQ(readDescriptorName(), "second");
+}
+
+TEST_F(TmsSignalTest, DataDescriptorCacheWithoutChangeEvent)
+{
+    SignalConfigPtr signal = createSignal(ctx, "signal");
+    signal.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).setName("first").build());
+
+    auto serverSignal = TmsServerSignal(signal, this->getServer(), ctx, tmsCtx);
+    auto signalNodeId = serverSignal.registerOpcUaNode();
+    auto descriptorNodeId = getChildNodeId(getChildNodeId(signalNodeId, "Value"), "DataDescriptor");
+
+    const auto readDescriptorName = [&]
+    {
+        DataDescriptorPtr descriptor = VariantConverter<IBaseObject>::ToDaqObject(this->getClient()->readValue(descriptorNodeId), ctx);
+        return descriptor.getName();
+    };
+
+    ASSERT_EQ(readDescriptorName(), "first");
+
+    // core events are muted while a configuration is loaded, so the cache must not rely on them
+    signal.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).setName("second").build());
+
+    ASSERT_EQ(readDescriptorName(), "second");
+}
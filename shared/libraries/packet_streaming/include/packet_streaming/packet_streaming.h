@@ -30,6 +30,8 @@ enum PacketType: uint8_t { event = 0, data, release, alreadySent };
 
 #define PACKET_FLAG_CAN_RELEASE            0x1
 #define PACKET_FLAG_OFFSET_TYPE_MASK       (0x2 | 0x4)
+#define PACKET_FLAG_SHARED_MEMORY_PAYLOAD  0x8
+#define PACKET_FLAG_COMPRESSED_PAYLOAD     0x10
 
 #define PACKET_FLAG_OFFSET_TYPE_SHIFT      1
 
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <packet_streaming/packet_streaming.h>
+#include <packet_streaming/payload_codec.h>
+#include <packet_streaming/shared_memory_ring.h>
 #include <opendaq/data_packet_ptr.h>
 #include "opendaq/event_packet_ptr.h"
 #include <queue>
@@ -43,6 +45,9 @@ public:
 
     bool areReferencesCleared() const;
 
+    // required to receive data packets whose payload was placed into shared memory by the server
+    void setSharedMemoryRing(const SharedMemoryRingPtr& ring);
+
 private:
     DeserializerPtr jsonDeserializer;
     std::queue<std::tuple<uint32_t, PacketPtr>> queue;
@@ -54,6 +59,8 @@ private:
     std::unordered_map<Int, std::vector<PacketBufferPtr>> packetBuffersWaitingForDomainPackets;
 
     mutable std::mutex descriptorsSync;
+    SharedMemoryRingPtr sharedMemoryRing;
+    PayloadBufferPoolPtr payloadBufferPool;
 
     void addEventPacketBuffer(const PacketBufferPtr& packetBuffer);
     DataPacketPtr addDataPacketBuffer(const PacketBufferPtr& packetBuffer, const DataPacketPtr& domainPacket);
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <packet_streaming/packet_streaming.h>
+#include <packet_streaming/payload_codec.h>
+#include <packet_streaming/shared_memory_ring.h>
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ptr.h>
 #include <queue>
@@ -59,6 +61,15 @@ public:
     void checkAndSendReleasePacket(bool force);
     void addAlreadySentPacket(uint32_t signalId, Int packetId, Int domainPacketId, bool markForRelease);
 
+    // data payloads of at least `minPayloadSize` bytes are placed into the ring instead of the packet buffer
+    void setSharedMemoryRing(const SharedMemoryRingPtr& ring, size_t minPayloadSize = 0);
+    SharedMemoryRingPtr getSharedMemoryRing() const;
+
+    // data payloads of signals with a suitable sample type are encoded with a lossless codec if that makes them smaller;
+    // must only be enabled if the client can decode them
+    void setPayloadCompressionEnabled(bool enabled);
+    bool getPayloadCompressionEnabled() const;
+
 private:
     SerializerPtr jsonSerializer;
     std::queue<PacketBufferPtr> queue;
@@ -74,10 +85,19 @@ private:
     size_t currentCacheablePacketGroupId;
 
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
+    struct SignalPayloadCodec
+    {
+        PayloadCodec codec{PayloadCodec::none};
+        size_t sampleSize{0};
+    };
+    std::unordered_map<uint32_t, SignalPayloadCodec> payloadCodecs;
     PacketCollectionPtr packetCollection;
     size_t releaseThreshold;
     const bool attachTimestampToPacketBuffer;
     size_t cacheablePacketPayloadSizeMax;
+    SharedMemoryRingPtr sharedMemoryRing;
+    size_t sharedMemoryMinPayloadSize;
+    bool payloadCompressionEnabled;
 
     void addEventPacket(const uint32_t signalId, const EventPacketPtr& packet);
     template <bool CheckRefCount>
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <packet_streaming/packet_streaming.h>
+#include <opendaq/data_descriptor_ptr.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+// payloads smaller than this are always sent raw
+static const size_t PAYLOAD_COMPRESSION_MIN_SIZE = 64;
+
+enum class PayloadCodec : uint8_t
+{
+    none = 0,
+    // differences of consecutive integer samples, zigzag-encoded as varints
+    integerDelta,
+    // XOR of consecutive floating point samples, leading and trailing zero bytes dropped
+    floatXor
+};
+
+// Precedes the encoded samples in the payload of a data packet buffer flagged with PACKET_FLAG_COMPRESSED_PAYLOAD
+struct CompressedPayloadHeader
+{
+    PayloadCodec codec;
+    uint8_t sampleSize;
+    uint16_t reserved;
+    uint32_t rawSize;
+};
+
+// Picks the codec for the values of a signal; returns `none` for sample types that are not compressed
+PayloadCodec selectPayloadCodec(const DataDescriptorPtr& descriptor);
+
+/*
+ * Encodes the raw payload, header included, into `output`. Returns false and leaves `output` in an
+ * unspecified state if the payload cannot be encoded with the codec or does not get smaller.
+ */
+bool encodePayload(PayloadCodec codec, size_t sampleSize, const void* data, size_t size, std::vector<uint8_t>& output);
+
+// Returns the size of the raw payload of an encoded one
+size_t getDecodedPayloadSize(const void* data, size_t size);
+
+// Decodes an encoded payload into `output`, which must hold getDecodedPayloadSize() bytes
+void decodePayload(const void* data, size_t size, void* output);
+
+/*
+ * Pool of the buffers that decoded payloads are written to. Buffers are handed out to data packets
+ * and returned to the pool when the packets are destroyed, which may happen after the pool owner is
+ * gone, so the pool is always shared.
+ */
+class PayloadBufferPool : public std::enable_shared_from_this<PayloadBufferPool>
+{
+public:
+    explicit PayloadBufferPool(size_t maxPooledBuffers = 16);
+
+    std::vector<uint8_t>* acquire(size_t size);
+    void release(std::vector<uint8_t>* buffer);
+    size_t getPooledCount();
+
+private:
+    std::mutex sync;
+    std::vector<std::unique_ptr<std::vector<uint8_t>>> buffers;
+    size_t maxPooledBuffers;
+};
+
+using PayloadBufferPoolPtr = std::shared_ptr<PayloadBufferPool>;
+
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <packet_streaming/packet_streaming.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+static const size_t SHARED_MEMORY_RING_SIZE_DEFAULT = 16 * 1024 * 1024;
+
+// Sent as the payload of a data packet buffer flagged with PACKET_FLAG_SHARED_MEMORY_PAYLOAD
+struct SharedMemoryPayloadReference
+{
+    uint64_t offset;
+    uint64_t size;
+};
+
+/*
+ * Ring of data packet payloads in a named POSIX shared memory object, shared between a producing
+ * and a consuming process on the same host.
+ *
+ * The producer (packet streaming server side) copies payloads into the ring and sends only a
+ * SharedMemoryPayloadReference over the regular channel. The consumer wraps the referenced memory
+ * without copying it and calls release() once the packet is destroyed. Releases are passed back
+ * through a single-producer/single-consumer queue in the shared control block and are drained by
+ * the producer on its next write; payloads released out of order are held back until the ones
+ * before them are released, so the ring tail only moves over contiguous free space.
+ *
+ * The data area is mapped twice at consecutive addresses, so payloads never wrap. Offsets are
+ * monotonic byte counters that are reduced modulo the ring size only when the memory is accessed.
+ *
+ * Only supported on Linux.
+ */
+class SharedMemoryRing
+{
+public:
+    static constexpr size_t ALLOCATION_ALIGNMENT = 64;
+    static constexpr size_t RELEASE_QUEUE_CAPACITY = 4096;
+
+    ~SharedMemoryRing();
+
+    SharedMemoryRing(const SharedMemoryRing&) = delete;
+    SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+
+    static bool IsSupported();
+
+    // Creates a new shared memory object of at least `size` bytes; the object is unlinked when the producer is destroyed
+    static std::shared_ptr<SharedMemoryRing> Create(size_t size);
+    // Maps a shared memory object created by a producer in another process
+    static std::shared_ptr<SharedMemoryRing> Open(const std::string& name, size_t size);
+
+    const std::string& getName() const;
+    size_t getSize() const;
+
+    // producer side; returns false if the ring has no room for the payload
+    bool write(const void* data, size_t size, SharedMemoryPayloadReference& reference);
+    size_t getUsedSize();
+
+    // consumer side
+    void* getPayload(const SharedMemoryPayloadReference& reference) const;
+    void release(const SharedMemoryPayloadReference& reference);
+
+private:
+    struct ControlBlock;
+
+    SharedMemoryRing(std::string name, bool producer);
+
+    void map(int fd, size_t size);
+    void unmap();
+    void drainReleases();
+    static uint64_t allocationSize(uint64_t size);
+
+    std::string name;
+    bool producer;
+
+    ControlBlock* control{};
+    size_t controlSize{};
+    uint8_t* data{};
+    size_t size{};
+
+    // producer state, private to the producing process
+    uint64_t head{};
+    uint64_t tail{};
+    size_t outstanding{};
+    struct ReleasedAfter
+    {
+        bool operator()(const SharedMemoryPayloadReference& a, const SharedMemoryPayloadReference& b) const
+        {
+            return a.offset > b.offset;
+        }
+    };
+    std::priority_queue<SharedMemoryPayloadReference, std::vector<SharedMemoryPayloadReference>, ReleasedAfter> outOfOrderReleases;
+
+    // consumer state; packets may be destroyed on any thread of the consuming process
+    std::mutex releaseSync;
+};
+
+using SharedMemoryRingPtr = std::shared_ptr<SharedMemoryRing>;
+
+}
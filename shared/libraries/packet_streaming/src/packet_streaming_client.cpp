@@ -5,12 +5,14 @@
 #include <opendaq/deleter_factory.h>
 #include <opendaq/data_descriptor_factory.h>
 #include <algorithm>
+#include <cstring>
 
 namespace daq::packet_streaming
 {
 
 PacketStreamingClient::PacketStreamingClient()
     : jsonDeserializer(JsonDeserializer())
+    , payloadBufferPool(std::make_shared<PayloadBufferPool>())
 {
 }
 
@@ -48,6 +50,11 @@ bool PacketStreamingClient::areReferencesCleared() const
     return (referencedPacketBuffers.empty() && referencedPackets.empty() && packetBuffersWaitingForDomainPackets.empty());
 }
 
+void PacketStreamingClient::setSharedMemoryRing(const SharedMemoryRingPtr& ring)
+{
+    sharedMemoryRing = ring;
+}
+
 void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBuffer)
 {
     bool forwardPacket = false;
@@ -79,6 +86,11 @@ void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBu
         if (domainDescriptorChanged)
             domainDescriptors.insert_or_assign(signalId, newDomainDescriptors);
     }
+    else
+    {
+        // other events, such as streaming rate changes, are not deduplicated and always reach the receiver
+        forwardPacket = true;
+    }
 
     if (forwardPacket)
     {
@@ -141,6 +153,52 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
         packet = DataPacketWithDomain(domPacket, valueDescriptor, dataPacketHeader->sampleCount, offset);
         assert(packet.getRawData() == nullptr);
     }
+    else if (dataPacketHeader->genericHeader.flags & PACKET_FLAG_SHARED_MEMORY_PAYLOAD)
+    {
+        if (!sharedMemoryRing)
+            throw PacketStreamingException("Shared memory payload received without a shared memory ring");
+        if (dataPacketHeader->genericHeader.payloadSize != sizeof(SharedMemoryPayloadReference))
+            throw PacketStreamingException("Invalid shared memory payload reference size");
+
+        SharedMemoryPayloadReference reference;
+        std::memcpy(&reference, packetBuffer->payload, sizeof(SharedMemoryPayloadReference));
+
+        packet = DataPacketWithExternalMemory(domPacket,
+                                              valueDescriptor,
+                                              dataPacketHeader->sampleCount,
+                                              sharedMemoryRing->getPayload(reference),
+                                              Deleter([ring = sharedMemoryRing, reference](void*) { ring->release(reference); }),
+                                              offset,
+                                              reference.size);
+    }
+    else if (dataPacketHeader->genericHeader.flags & PACKET_FLAG_COMPRESSED_PAYLOAD)
+    {
+        const auto rawSize = getDecodedPayloadSize(packetBuffer->payload, dataPacketHeader->genericHeader.payloadSize);
+        const auto buffer = payloadBufferPool->acquire(rawSize);
+        try
+        {
+            decodePayload(packetBuffer->payload, dataPacketHeader->genericHeader.payloadSize, buffer->data());
+        }
+        catch (...)
+        {
+            payloadBufferPool->release(buffer);
+            throw;
+        }
+
+        packet = DataPacketWithExternalMemory(domPacket,
+                                              valueDescriptor,
+                                              dataPacketHeader->sampleCount,
+                                              buffer->data(),
+                                              Deleter([pool = std::weak_ptr<PayloadBufferPool>(payloadBufferPool), buffer](void*)
+                                              {
+                                                  if (const auto poolPtr = pool.lock())
+                                                      poolPtr->release(buffer);
+                                                  else
+                                                      delete buffer;
+                                              }),
+                                              offset,
+                                              rawSize);
+    }
     else
     {
         packet = DataPacketWithExternalMemory(domPacket,
@@ -5,6 +5,7 @@
 #include <opendaq/data_descriptor_factory.h>
 #include "opendaq/context_factory.h"
 #include "opendaq/custom_log.h"
+#include <opendaq/sample_type_traits.h>
 
 namespace daq::packet_streaming
 {
@@ -20,9 +21,32 @@ PacketStreamingServer::PacketStreamingServer(size_t cacheablePacketPayloadSizeMa
     , releaseThreshold(releaseThreshold)
     , attachTimestampToPacketBuffer(attachTimestampToPacketBuffer)
     , cacheablePacketPayloadSizeMax(cacheablePacketPayloadSizeMax)
+    , sharedMemoryMinPayloadSize(0)
+    , payloadCompressionEnabled(false)
 {
 }
 
+void PacketStreamingServer::setSharedMemoryRing(const SharedMemoryRingPtr& ring, size_t minPayloadSize)
+{
+    sharedMemoryRing = ring;
+    sharedMemoryMinPayloadSize = minPayloadSize;
+}
+
+SharedMemoryRingPtr PacketStreamingServer::getSharedMemoryRing() const
+{
+    return sharedMemoryRing;
+}
+
+void PacketStreamingServer::setPayloadCompressionEnabled(bool enabled)
+{
+    payloadCompressionEnabled = enabled;
+}
+
+bool PacketStreamingServer::getPayloadCompressionEnabled() const
+{
+    return payloadCompressionEnabled;
+}
+
 void PacketStreamingServer::addDaqPacket(const uint32_t signalId, const PacketPtr& packet)
 {
     switch (packet.getType())
@@ -177,7 +201,15 @@ void PacketStreamingServer::addEventPacket(const uint32_t signalId, const EventP
             parseDataDescriptorEventPacket(packet);
 
         if (valueDescriptorChanged)
+        {
             dataDescriptors.insert_or_assign(signalId, newValueDescriptor);
+
+            SignalPayloadCodec payloadCodec;
+            payloadCodec.codec = selectPayloadCodec(newValueDescriptor);
+            if (payloadCodec.codec != PayloadCodec::none)
+                payloadCodec.sampleSize = getSampleSize(newValueDescriptor.getSampleType());
+            payloadCodecs.insert_or_assign(signalId, payloadCodec);
+        }
     }
 
     queuePacketBuffer(packetBuffer);
@@ -357,6 +389,70 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
 
     const auto packetDataPtr = packet.getRawData();
     const auto packetDataSize = packetDataPtr != nullptr ? packet.getRawDataSize() : 0;
+
+    // the payload is copied into shared memory once and only its location is transmitted
+    if (sharedMemoryRing && packetDataSize > 0 && packetDataSize >= sharedMemoryMinPayloadSize)
+    {
+        SharedMemoryPayloadReference reference{};
+        if (sharedMemoryRing->write(packetDataPtr, packetDataSize, reference))
+        {
+            const auto referencePtr = new SharedMemoryPayloadReference(reference);
+            packetHeader->genericHeader.flags |= PACKET_FLAG_SHARED_MEMORY_PAYLOAD;
+            packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(sizeof(SharedMemoryPayloadReference));
+
+            const auto packetBuffer = std::make_shared<PacketBuffer>(
+                reinterpret_cast<GenericPacketHeader*>(packetHeader),
+                referencePtr,
+                [packetHeader, referencePtr]
+                {
+                    std::free(packetHeader);
+                    delete referencePtr;
+                },
+                attachTimestampToPacketBuffer,
+                getPacketCacheableGroupId(packetHeader->genericHeader.size, packetHeader->genericHeader.payloadSize)
+            );
+
+            if constexpr (isPacketRValue)
+                packet.release();
+
+            queuePacketBuffer(packetBuffer);
+            return;
+        }
+    }
+
+    if (payloadCompressionEnabled && packetDataSize >= PAYLOAD_COMPRESSION_MIN_SIZE)
+    {
+        const auto codecIt = payloadCodecs.find(signalId);
+        if (codecIt != payloadCodecs.end() && codecIt->second.codec != PayloadCodec::none)
+        {
+            auto encoded = std::make_unique<std::vector<uint8_t>>();
+            if (encodePayload(codecIt->second.codec, codecIt->second.sampleSize, packetDataPtr, packetDataSize, *encoded))
+            {
+                packetHeader->genericHeader.flags |= PACKET_FLAG_COMPRESSED_PAYLOAD;
+                packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(encoded->size());
+
+                const auto encodedPtr = encoded.release();
+                const auto packetBuffer = std::make_shared<PacketBuffer>(
+                    reinterpret_cast<GenericPacketHeader*>(packetHeader),
+                    encodedPtr->data(),
+                    [packetHeader, encodedPtr]
+                    {
+                        std::free(packetHeader);
+                        delete encodedPtr;
+                    },
+                    attachTimestampToPacketBuffer,
+                    getPacketCacheableGroupId(packetHeader->genericHeader.size, packetHeader->genericHeader.payloadSize)
+                );
+
+                if constexpr (isPacketRValue)
+                    packet.release();
+
+                queuePacketBuffer(packetBuffer);
+                return;
+            }
+        }
+    }
+
     packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(packetDataSize);
 
     const auto packetBuffer = std::make_shared<PacketBuffer>(
@@ -0,0 +1,325 @@
+#include <packet_streaming/payload_codec.h>
+#include <opendaq/data_rule_ptr.h>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace daq::packet_streaming
+{
+
+namespace
+{
+
+void writeHeader(PayloadCodec codec, size_t sampleSize, size_t rawSize, std::vector<uint8_t>& output)
+{
+    CompressedPayloadHeader header{};
+    header.codec = codec;
+    header.sampleSize = static_cast<uint8_t>(sampleSize);
+    header.rawSize = static_cast<uint32_t>(rawSize);
+
+    output.resize(sizeof(CompressedPayloadHeader));
+    std::memcpy(output.data(), &header, sizeof(CompressedPayloadHeader));
+}
+
+CompressedPayloadHeader readHeader(const void* data, size_t size)
+{
+    if (size < sizeof(CompressedPayloadHeader))
+        throw PacketStreamingException("Compressed payload is missing its header");
+
+    CompressedPayloadHeader header;
+    std::memcpy(&header, data, sizeof(CompressedPayloadHeader));
+
+    if (header.sampleSize == 0 || header.rawSize % header.sampleSize != 0)
+        throw PacketStreamingException("Compressed payload has an invalid sample size");
+
+    return header;
+}
+
+template <typename U>
+bool encodeIntegerDelta(const uint8_t* data, size_t size, std::vector<uint8_t>& output)
+{
+    using S = std::make_signed_t<U>;
+
+    U previous = 0;
+    for (size_t offset = 0; offset < size; offset += sizeof(U))
+    {
+        U current;
+        std::memcpy(&current, data + offset, sizeof(U));
+
+        // the difference wraps within the sample width, so it is lossless for any pair of values
+        const auto delta = static_cast<int64_t>(static_cast<S>(static_cast<U>(current - previous)));
+        auto zigzag = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+        previous = current;
+
+        while (zigzag >= 0x80)
+        {
+            output.push_back(static_cast<uint8_t>(zigzag | 0x80));
+            zigzag >>= 7;
+        }
+        output.push_back(static_cast<uint8_t>(zigzag));
+
+        if (output.size() >= size)
+            return false;
+    }
+
+    return true;
+}
+
+template <typename U>
+void decodeIntegerDelta(const uint8_t* data, size_t size, uint8_t* output, size_t rawSize)
+{
+    U previous = 0;
+    size_t position = 0;
+    for (size_t offset = 0; offset < rawSize; offset += sizeof(U))
+    {
+        uint64_t zigzag = 0;
+        for (unsigned shift = 0;; shift += 7)
+        {
+            if (position >= size || shift >= 64)
+                throw PacketStreamingException("Malformed compressed payload");
+
+            const uint8_t byte = data[position++];
+            zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                break;
+        }
+
+        const auto delta = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+        const U current = static_cast<U>(previous + static_cast<U>(delta));
+        std::memcpy(output + offset, &current, sizeof(U));
+        previous = current;
+    }
+}
+
+template <typename U>
+bool encodeFloatXor(const uint8_t* data, size_t size, std::vector<uint8_t>& output)
+{
+    U previous = 0;
+    for (size_t offset = 0; offset < size; offset += sizeof(U))
+    {
+        U current;
+        std::memcpy(&current, data + offset, sizeof(U));
+
+        U bits = current ^ previous;
+        previous = current;
+
+        if (bits == 0)
+        {
+            output.push_back(0);
+        }
+        else
+        {
+            // control byte: trailing zero bytes in the high nibble, count of the bytes that follow in the low one
+            unsigned trailing = 0;
+            while (((bits >> (trailing * 8)) & 0xFF) == 0)
+                trailing++;
+
+            unsigned leading = 0;
+            while (((bits >> ((sizeof(U) - 1 - leading) * 8)) & 0xFF) == 0)
+                leading++;
+
+            const unsigned count = static_cast<unsigned>(sizeof(U)) - leading - trailing;
+            output.push_back(static_cast<uint8_t>((trailing << 4) | count));
+
+            bits >>= trailing * 8;
+            for (unsigned i = 0; i < count; ++i)
+            {
+                output.push_back(static_cast<uint8_t>(bits & 0xFF));
+                bits >>= 8;
+            }
+        }
+
+        if (output.size() >= size)
+            return false;
+    }
+
+    return true;
+}
+
+template <typename U>
+void decodeFloatXor(const uint8_t* data, size_t size, uint8_t* output, size_t rawSize)
+{
+    U previous = 0;
+    size_t position = 0;
+    for (size_t offset = 0; offset < rawSize; offset += sizeof(U))
+    {
+        if (position >= size)
+            throw PacketStreamingException("Malformed compressed payload");
+
+        const uint8_t control = data[position++];
+        const unsigned trailing = control >> 4;
+        const unsigned count = control & 0x0F;
+        if (trailing + count > sizeof(U) || (count == 0 && trailing != 0) || position + count > size)
+            throw PacketStreamingException("Malformed compressed payload");
+
+        U bits = 0;
+        for (unsigned i = 0; i < count; ++i)
+            bits |= static_cast<U>(data[position++]) << (i * 8);
+        if (count > 0)
+            bits <<= trailing * 8;
+
+        const U current = previous ^ bits;
+        std::memcpy(output + offset, &current, sizeof(U));
+        previous = current;
+    }
+}
+
+}
+
+PayloadCodec selectPayloadCodec(const DataDescriptorPtr& descriptor)
+{
+    if (!descriptor.assigned() || descriptor.getPostScaling().assigned())
+        return PayloadCodec::none;
+
+    if (descriptor.getStructFields().assigned() && descriptor.getStructFields().getCount() > 0)
+        return PayloadCodec::none;
+
+    const auto rule = descriptor.getRule();
+    if (rule.assigned() && rule.getType() != DataRuleType::Explicit)
+        return PayloadCodec::none;
+
+    switch (descriptor.getSampleType())
+    {
+        case SampleType::Int8:
+        case SampleType::UInt8:
+        case SampleType::Int16:
+        case SampleType::UInt16:
+        case SampleType::Int32:
+        case SampleType::UInt32:
+        case SampleType::Int64:
+        case SampleType::UInt64:
+            return PayloadCodec::integerDelta;
+        case SampleType::Float32:
+        case SampleType::Float64:
+            return PayloadCodec::floatXor;
+        default:
+            return PayloadCodec::none;
+    }
+}
+
+bool encodePayload(PayloadCodec codec, size_t sampleSize, const void* data, size_t size, std::vector<uint8_t>& output)
+{
+    if (codec == PayloadCodec::none || sampleSize == 0 || size % sampleSize != 0 || size > std::numeric_limits<uint32_t>::max())
+        return false;
+
+    writeHeader(codec, sampleSize, size, output);
+    const auto bytes = static_cast<const uint8_t*>(data);
+
+    switch (codec)
+    {
+        case PayloadCodec::integerDelta:
+            switch (sampleSize)
+            {
+                case 1:
+                    return encodeIntegerDelta<uint8_t>(bytes, size, output);
+                case 2:
+                    return encodeIntegerDelta<uint16_t>(bytes, size, output);
+                case 4:
+                    return encodeIntegerDelta<uint32_t>(bytes, size, output);
+                case 8:
+                    return encodeIntegerDelta<uint64_t>(bytes, size, output);
+                default:
+                    return false;
+            }
+        case PayloadCodec::floatXor:
+            switch (sampleSize)
+            {
+                case 4:
+                    return encodeFloatXor<uint32_t>(bytes, size, output);
+                case 8:
+                    return encodeFloatXor<uint64_t>(bytes, size, output);
+                default:
+                    return false;
+            }
+        default:
+            return false;
+    }
+}
+
+size_t getDecodedPayloadSize(const void* data, size_t size)
+{
+    return readHeader(data, size).rawSize;
+}
+
+void decodePayload(const void* data, size_t size, void* output)
+{
+    const auto header = readHeader(data, size);
+    const auto encoded = static_cast<const uint8_t*>(data) + sizeof(CompressedPayloadHeader);
+    const auto encodedSize = size - sizeof(CompressedPayloadHeader);
+    const auto raw = static_cast<uint8_t*>(output);
+
+    switch (header.codec)
+    {
+        case PayloadCodec::integerDelta:
+            switch (header.sampleSize)
+            {
+                case 1:
+                    return decodeIntegerDelta<uint8_t>(encoded, encodedSize, raw, header.rawSize);
+                case 2:
+                    return decodeIntegerDelta<uint16_t>(encoded, encodedSize, raw, header.rawSize);
+                case 4:
+                    return decodeIntegerDelta<uint32_t>(encoded, encodedSize, raw, header.rawSize);
+                case 8:
+                    return decodeIntegerDelta<uint64_t>(encoded, encodedSize, raw, header.rawSize);
+                default:
+                    break;
+            }
+            break;
+        case PayloadCodec::floatXor:
+            switch (header.sampleSize)
+            {
+                case 4:
+                    return decodeFloatXor<uint32_t>(encoded, encodedSize, raw, header.rawSize);
+                case 8:
+                    return decodeFloatXor<uint64_t>(encoded, encodedSize, raw, header.rawSize);
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+
+    throw PacketStreamingException("Unsupported payload codec");
+}
+
+PayloadBufferPool::PayloadBufferPool(size_t maxPooledBuffers)
+    : maxPooledBuffers(maxPooledBuffers)
+{
+}
+
+std::vector<uint8_t>* PayloadBufferPool::acquire(size_t size)
+{
+    std::unique_ptr<std::vector<uint8_t>> buffer;
+    {
+        std::scoped_lock lock(sync);
+        if (!buffers.empty())
+        {
+            buffer = std::move(buffers.back());
+            buffers.pop_back();
+        }
+    }
+
+    if (!buffer)
+        buffer = std::make_unique<std::vector<uint8_t>>();
+
+    buffer->resize(size);
+    return buffer.release();
+}
+
+void PayloadBufferPool::release(std::vector<uint8_t>* buffer)
+{
+    std::unique_ptr<std::vector<uint8_t>> owned(buffer);
+
+    std::scoped_lock lock(sync);
+    if (buffers.size() < maxPooledBuffers)
+        buffers.push_back(std::move(owned));
+}
+
+size_t PayloadBufferPool::getPooledCount()
+{
+    std::scoped_lock lock(sync);
+    return buffers.size();
+}
+
+}
@@ -0,0 +1,273 @@
+#include <packet_streaming/shared_memory_ring.h>
+#include <fmt/format.h>
+#include <cstring>
+#include <thread>
+
+#ifdef __linux__
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace daq::packet_streaming
+{
+
+struct SharedMemoryRing::ControlBlock
+{
+    // written by the consumer
+    alignas(64) std::atomic<uint64_t> releaseWriteIndex;
+    // written by the producer
+    alignas(64) std::atomic<uint64_t> releaseReadIndex;
+    alignas(64) SharedMemoryPayloadReference releases[RELEASE_QUEUE_CAPACITY];
+};
+
+SharedMemoryRing::SharedMemoryRing(std::string name, bool producer)
+    : name(std::move(name))
+    , producer(producer)
+{
+}
+
+const std::string& SharedMemoryRing::getName() const
+{
+    return name;
+}
+
+size_t SharedMemoryRing::getSize() const
+{
+    return size;
+}
+
+uint64_t SharedMemoryRing::allocationSize(uint64_t size)
+{
+    return (size + ALLOCATION_ALIGNMENT - 1) / ALLOCATION_ALIGNMENT * ALLOCATION_ALIGNMENT;
+}
+
+bool SharedMemoryRing::write(const void* payload, size_t payloadSize, SharedMemoryPayloadReference& reference)
+{
+    if (!producer)
+        throw PacketStreamingException("Only the producer can write to a shared memory ring");
+
+    drainReleases();
+
+    const auto allocated = allocationSize(payloadSize);
+    // every outstanding payload can occupy at most one slot of the release queue
+    if (payloadSize == 0 || outstanding >= RELEASE_QUEUE_CAPACITY || head + allocated - tail > size)
+        return false;
+
+    std::memcpy(data + head % size, payload, payloadSize);
+
+    reference.offset = head;
+    reference.size = payloadSize;
+
+    head += allocated;
+    ++outstanding;
+    return true;
+}
+
+size_t SharedMemoryRing::getUsedSize()
+{
+    drainReleases();
+    return static_cast<size_t>(head - tail);
+}
+
+void* SharedMemoryRing::getPayload(const SharedMemoryPayloadReference& reference) const
+{
+    if (reference.size > size)
+        throw PacketStreamingException("Shared memory payload reference out of range");
+
+    return data + reference.offset % size;
+}
+
+void SharedMemoryRing::release(const SharedMemoryPayloadReference& reference)
+{
+    std::scoped_lock lock(releaseSync);
+
+    const auto writeIndex = control->releaseWriteIndex.load(std::memory_order_relaxed);
+
+    // cannot overflow while the producer bounds the outstanding payloads, but never overwrite an unread record
+    while (writeIndex - control->releaseReadIndex.load(std::memory_order_acquire) >= RELEASE_QUEUE_CAPACITY)
+        std::this_thread::yield();
+
+    control->releases[writeIndex % RELEASE_QUEUE_CAPACITY] = reference;
+    control->releaseWriteIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+void SharedMemoryRing::drainReleases()
+{
+    const auto writeIndex = control->releaseWriteIndex.load(std::memory_order_acquire);
+    auto readIndex = control->releaseReadIndex.load(std::memory_order_relaxed);
+
+    for (; readIndex != writeIndex; ++readIndex)
+        outOfOrderReleases.push(control->releases[readIndex % RELEASE_QUEUE_CAPACITY]);
+    control->releaseReadIndex.store(readIndex, std::memory_order_release);
+
+    while (!outOfOrderReleases.empty() && outOfOrderReleases.top().offset == tail)
+    {
+        tail += allocationSize(outOfOrderReleases.top().size);
+        outOfOrderReleases.pop();
+        --outstanding;
+    }
+}
+
+#ifdef __linux__
+
+namespace
+{
+    std::atomic<uint64_t> sharedMemoryRingIndex{0};
+
+    size_t roundUpToPageSize(size_t value)
+    {
+        const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return (value + pageSize - 1) / pageSize * pageSize;
+    }
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+    unmap();
+    if (producer)
+        shm_unlink(name.c_str());
+}
+
+bool SharedMemoryRing::IsSupported()
+{
+    return true;
+}
+
+void SharedMemoryRing::map(int fd, size_t dataSize)
+{
+    const size_t ctrlSize = roundUpToPageSize(sizeof(ControlBlock));
+
+    void* ctrl = mmap(nullptr, ctrlSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ctrl == MAP_FAILED)
+        throw PacketStreamingException(fmt::format("Failed to map shared memory control block {}", name));
+
+    // Reserve the whole range first so nothing else can be mapped between the two views of the data
+    void* reserved = mmap(nullptr, 2 * dataSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (reserved == MAP_FAILED)
+    {
+        munmap(ctrl, ctrlSize);
+        throw PacketStreamingException(fmt::format("Failed to reserve address space for shared memory ring {}", name));
+    }
+
+    auto base = static_cast<uint8_t*>(reserved);
+    const auto offset = static_cast<off_t>(ctrlSize);
+    if (mmap(base, dataSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, offset) == MAP_FAILED ||
+        mmap(base + dataSize, dataSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, offset) == MAP_FAILED)
+    {
+        munmap(ctrl, ctrlSize);
+        munmap(reserved, 2 * dataSize);
+        throw PacketStreamingException(fmt::format("Failed to map shared memory ring {}", name));
+    }
+
+    control = static_cast<ControlBlock*>(ctrl);
+    controlSize = ctrlSize;
+    data = base;
+    size = dataSize;
+}
+
+void SharedMemoryRing::unmap()
+{
+    if (data != nullptr)
+        munmap(data, 2 * size);
+    if (control != nullptr)
+        munmap(control, controlSize);
+
+    data = nullptr;
+    control = nullptr;
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::Create(size_t size)
+{
+    const auto name = fmt::format("/opendaq_packets_{}_{}", getpid(), sharedMemoryRingIndex++);
+
+    const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+        throw PacketStreamingException(fmt::format("Failed to create shared memory object {}", name));
+
+    std::shared_ptr<SharedMemoryRing> ring(new SharedMemoryRing(name, true));
+
+    const size_t dataSize = roundUpToPageSize(size);
+    const size_t ctrlSize = roundUpToPageSize(sizeof(ControlBlock));
+    if (ftruncate(fd, static_cast<off_t>(ctrlSize + dataSize)) != 0)
+    {
+        close(fd);
+        throw PacketStreamingException(fmt::format("Failed to resize shared memory object {}", name));
+    }
+
+    try
+    {
+        ring->map(fd, dataSize);
+    }
+    catch (...)
+    {
+        close(fd);
+        throw;
+    }
+    close(fd);
+
+    new (ring->control) ControlBlock{};
+    return ring;
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::Open(const std::string& name, size_t size)
+{
+    const int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+        throw PacketStreamingException(fmt::format("Failed to open shared memory object {}", name));
+
+    std::shared_ptr<SharedMemoryRing> ring(new SharedMemoryRing(name, false));
+
+    struct stat objectStat{};
+    const size_t ctrlSize = roundUpToPageSize(sizeof(ControlBlock));
+    if (fstat(fd, &objectStat) != 0 || size != roundUpToPageSize(size) || static_cast<size_t>(objectStat.st_size) != ctrlSize + size)
+    {
+        close(fd);
+        throw PacketStreamingException(fmt::format("Shared memory object {} has an unexpected size", name));
+    }
+
+    try
+    {
+        ring->map(fd, size);
+    }
+    catch (...)
+    {
+        close(fd);
+        throw;
+    }
+    close(fd);
+
+    return ring;
+}
+
+#else
+
+SharedMemoryRing::~SharedMemoryRing() = default;
+
+bool SharedMemoryRing::IsSupported()
+{
+    return false;
+}
+
+void SharedMemoryRing::map(int, size_t)
+{
+}
+
+void SharedMemoryRing::unmap()
+{
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::Create(size_t)
+{
+    throw PacketStreamingException("Shared memory rings are not supported on this platform");
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::Open(const std::string&, size_t)
+{
+    throw PacketStreamingException("Shared memory rings are not supported on this platform");
+}
+
+#endif
+
+}
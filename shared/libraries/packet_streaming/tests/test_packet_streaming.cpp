@@ -1,12 +1,15 @@
 #include <gtest/gtest.h>
 #include <packet_streaming/packet_streaming_client.h>
 #include <packet_streaming/packet_streaming_server.h>
+#include <packet_streaming/payload_codec.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/data_rule_factory.h>
 #include <opendaq/packet_destruct_callback_factory.h>
 #include <opendaq/sample_type_traits.h>
 #include "packet_transmission.h"
+#include <cstring>
+#include <limits>
 
 using namespace daq;
 using namespace packet_streaming;
@@ -140,6 +143,27 @@ TEST_F(PacketStreamingTest, DataDescNullEventPacket)
     ASSERT_TRUE(client.areReferencesCleared());
 }
 
+TEST_F(PacketStreamingTest, OtherEventPacket)
+{
+    auto parameters = Dict<IString, IBaseObject>();
+    parameters.set("Level", 1);
+    const auto serverEventPacket = EventPacket("STREAMING_RATE_CHANGED", parameters);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        server.addDaqPacket(1, serverEventPacket);
+        transmission.sendPacketBuffer(server.getNextPacketBuffer());
+        client.addPacketBuffer(transmission.recvPacketBuffer());
+
+        // unlike descriptor changes, repeated events are not filtered out
+        auto [signalId, clientEventPacket] = client.getNextDaqPacket();
+        ASSERT_EQ(signalId, 1u);
+        ASSERT_EQ(serverEventPacket, clientEventPacket);
+    }
+
+    ASSERT_TRUE(client.areReferencesCleared());
+}
+
 TEST_F(PacketStreamingTest, DataPacket)
 {
     const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
@@ -1077,4 +1101,269 @@ TEST_F(PacketStreamingTest, CacheablePacketsAny)
     EXPECT_EQ(server.getCountOfCacheableGroups(), 0u);
 }
 
+TEST_F(PacketStreamingTest, SharedMemoryDataPacket)
+{
+    if (!SharedMemoryRing::IsSupported())
+        GTEST_SKIP() << "Shared memory rings are not supported on this platform";
+
+    const auto serverRing = SharedMemoryRing::Create(SHARED_MEMORY_RING_SIZE_DEFAULT);
+    const auto clientRing = SharedMemoryRing::Open(serverRing->getName(), serverRing->getSize());
+    server.setSharedMemoryRing(serverRing);
+    client.setSharedMemoryRing(clientRing);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+
+    constexpr size_t sampleCount = 100;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount, 1024);
+    auto data = static_cast<float*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        *data++ = static_cast<float>(i);
+
+    server.addDaqPacket(1, serverDataPacket);
+    transmitAll();
+
+    client.getNextDaqPacket();
+    auto [signalIdOfDataPacket, clientPacket] = client.getNextDaqPacket();
+    DataPacketPtr clientDataPacket = clientPacket;
+
+    ASSERT_EQ(signalIdOfDataPacket, 1u);
+    ASSERT_EQ(serverDataPacket, clientDataPacket);
+    ASSERT_EQ(clientDataPacket.getRawDataSize(), serverDataPacket.getRawDataSize());
+
+    // the client packet wraps the ring memory directly
+    const auto clientData = static_cast<uint8_t*>(clientDataPacket.getRawData());
+    ASSERT_NE(clientData, serverDataPacket.getRawData());
+    ASSERT_GE(clientData, static_cast<uint8_t*>(clientRing->getPayload({0, 0})));
+    ASSERT_LT(clientData, static_cast<uint8_t*>(clientRing->getPayload({0, 0})) + clientRing->getSize());
+    ASSERT_GT(serverRing->getUsedSize(), 0u);
+
+    serverDataPacket.release();
+    clientDataPacket.release();
+    clientPacket.release();
+
+    completeTransmitAll();
+    ASSERT_TRUE(client.areReferencesCleared());
+    ASSERT_EQ(serverRing->getUsedSize(), 0u);
+}
+
+TEST_F(PacketStreamingTest, SharedMemoryPayloadInvalidSize)
+{
+    if (!SharedMemoryRing::IsSupported())
+        GTEST_SKIP() << "Shared memory rings are not supported on this platform";
+
+    const auto serverRing = SharedMemoryRing::Create(SHARED_MEMORY_RING_SIZE_DEFAULT);
+    const auto clientRing = SharedMemoryRing::Open(serverRing->getName(), serverRing->getSize());
+    server.setSharedMemoryRing(serverRing);
+    client.setSharedMemoryRing(clientRing);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+    transmitAll();
+
+    server.addDaqPacket(1, DataPacket(valueDescriptor, 100, 1024));
+    transmission.sendPacketBuffer(server.getNextPacketBuffer());
+    const auto clientPacketBuffer = transmission.recvPacketBuffer();
+    ASSERT_TRUE(clientPacketBuffer->packetHeader->flags & PACKET_FLAG_SHARED_MEMORY_PAYLOAD);
+
+    clientPacketBuffer->packetHeader->payloadSize -= 1;
+    ASSERT_THROW(client.addPacketBuffer(clientPacketBuffer), PacketStreamingException);
+}
+
+TEST_F(PacketStreamingTest, SharedMemoryRingOutOfOrderRelease)
+{
+    if (!SharedMemoryRing::IsSupported())
+        GTEST_SKIP() << "Shared memory rings are not supported on this platform";
+
+    const auto producer = SharedMemoryRing::Create(4096);
+    const auto consumer = SharedMemoryRing::Open(producer->getName(), producer->getSize());
+    const auto ringSize = producer->getSize();
+
+    std::vector<uint8_t> payload(ringSize / 4, 0xAB);
+    SharedMemoryPayloadReference first{};
+    SharedMemoryPayloadReference second{};
+    SharedMemoryPayloadReference third{};
+    ASSERT_TRUE(producer->write(payload.data(), payload.size(), first));
+    ASSERT_TRUE(producer->write(payload.data(), payload.size(), second));
+    ASSERT_TRUE(producer->write(payload.data(), payload.size(), third));
+    ASSERT_EQ(static_cast<uint8_t*>(consumer->getPayload(second))[0], 0xAB);
+
+    // the tail does not move past the first payload until it is released
+    consumer->release(second);
+    ASSERT_EQ(producer->getUsedSize(), 3 * payload.size());
+    consumer->release(first);
+    ASSERT_EQ(producer->getUsedSize(), payload.size());
+
+    // a payload wrapping around the end of the ring stays contiguous
+    std::vector<uint8_t> large(ringSize / 2);
+    for (size_t i = 0; i < large.size(); ++i)
+        large[i] = static_cast<uint8_t>(i);
+
+    SharedMemoryPayloadReference wrapped{};
+    ASSERT_TRUE(producer->write(large.data(), large.size(), wrapped));
+    ASSERT_EQ(std::memcmp(consumer->getPayload(wrapped), large.data(), large.size()), 0);
+
+    SharedMemoryPayloadReference full{};
+    ASSERT_FALSE(producer->write(large.data(), large.size(), full));
+
+    consumer->release(third);
+    consumer->release(wrapped);
+    ASSERT_EQ(producer->getUsedSize(), 0u);
+}
+
 INSTANTIATE_TEST_SUITE_P(MovePacket, ValuePacketDestroyedBeforeDomainSentTest, testing::Values(true, false));
+
+TEST_F(PacketStreamingTest, CompressedIntegerDataPacket)
+{
+    server.setPayloadCompressionEnabled(true);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int16).build();
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+
+    constexpr size_t sampleCount = 1000;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount);
+    auto data = static_cast<int16_t*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        data[i] = static_cast<int16_t>(-2000 + static_cast<int>(i % 40) * 3);
+
+    server.addDaqPacket(1, serverDataPacket);
+
+    transmission.sendPacketBuffer(server.getNextPacketBuffer());
+    const auto dataPacketBuffer = server.peekNextPacketBuffer();
+    ASSERT_TRUE(dataPacketBuffer->packetHeader->flags & PACKET_FLAG_COMPRESSED_PAYLOAD);
+    ASSERT_LT(dataPacketBuffer->packetHeader->payloadSize, serverDataPacket.getRawDataSize() * 3 / 4);
+
+    client.addPacketBuffer(transmission.recvPacketBuffer());
+    transmitAll();
+
+    client.getNextDaqPacket();
+    auto [signalIdOfDataPacket, clientPacket] = client.getNextDaqPacket();
+    ASSERT_EQ(signalIdOfDataPacket, 1u);
+    ASSERT_EQ(serverDataPacket, clientPacket);
+
+    serverDataPacket.release();
+    clientPacket.release();
+
+    completeTransmitAll();
+    ASSERT_TRUE(client.areReferencesCleared());
+}
+
+TEST_F(PacketStreamingTest, CompressedFloatDataPacket)
+{
+    server.setPayloadCompressionEnabled(true);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+
+    constexpr size_t sampleCount = 500;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount);
+    auto data = static_cast<double*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        data[i] = static_cast<double>(i / 10);
+
+    server.addDaqPacket(1, serverDataPacket);
+    transmitAll();
+
+    client.getNextDaqPacket();
+    auto [signalIdOfDataPacket, clientPacket] = client.getNextDaqPacket();
+    ASSERT_EQ(signalIdOfDataPacket, 1u);
+    ASSERT_EQ(serverDataPacket, clientPacket);
+}
+
+TEST_F(PacketStreamingTest, CompressionDisabledByDefault)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+
+    auto serverDataPacket = DataPacket(valueDescriptor, 100);
+    std::memset(serverDataPacket.getRawData(), 0, serverDataPacket.getRawDataSize());
+    server.addDaqPacket(1, serverDataPacket);
+
+    server.getNextPacketBuffer();
+    const auto dataPacketBuffer = server.getNextPacketBuffer();
+    ASSERT_FALSE(dataPacketBuffer->packetHeader->flags & PACKET_FLAG_COMPRESSED_PAYLOAD);
+    ASSERT_EQ(dataPacketBuffer->packetHeader->payloadSize, serverDataPacket.getRawDataSize());
+}
+
+template <typename T>
+static void testPayloadRoundTrip(PayloadCodec codec, const std::vector<T>& samples)
+{
+    std::vector<uint8_t> encoded;
+    ASSERT_TRUE(encodePayload(codec, sizeof(T), samples.data(), samples.size() * sizeof(T), encoded));
+    ASSERT_LT(encoded.size(), samples.size() * sizeof(T));
+    ASSERT_EQ(getDecodedPayloadSize(encoded.data(), encoded.size()), samples.size() * sizeof(T));
+
+    std::vector<T> decoded(samples.size());
+    decodePayload(encoded.data(), encoded.size(), decoded.data());
+    ASSERT_EQ(std::memcmp(decoded.data(), samples.data(), samples.size() * sizeof(T)), 0);
+}
+
+TEST_F(PacketStreamingTest, PayloadCodecRoundTrip)
+{
+    std::vector<uint16_t> unsigned16;
+    std::vector<int32_t> signed32;
+    std::vector<uint64_t> unsigned64;
+    std::vector<float> float32;
+    std::vector<double> float64;
+    std::vector<uint32_t> random32;
+    uint32_t seed = 1;
+    for (int i = 0; i < 256; ++i)
+    {
+        // wraps around the type limits to check that deltas are lossless
+        unsigned16.push_back(static_cast<uint16_t>(65500 + i));
+        signed32.push_back(i % 2 ? std::numeric_limits<int32_t>::min() + i : std::numeric_limits<int32_t>::max() - i);
+        unsigned64.push_back(std::numeric_limits<uint64_t>::max() - static_cast<uint64_t>(i % 7));
+        float32.push_back(static_cast<float>(i / 8) * 0.25f);
+        float64.push_back(i % 3 ? 1.0 : -1.0);
+        seed = seed * 1664525u + 1013904223u;
+        random32.push_back(seed);
+    }
+
+    testPayloadRoundTrip(PayloadCodec::integerDelta, unsigned16);
+    testPayloadRoundTrip(PayloadCodec::integerDelta, signed32);
+    testPayloadRoundTrip(PayloadCodec::integerDelta, unsigned64);
+    testPayloadRoundTrip(PayloadCodec::floatXor, float32);
+    testPayloadRoundTrip(PayloadCodec::floatXor, float64);
+
+    // noise does not get smaller, so it is sent raw
+    std::vector<uint8_t> encoded;
+    ASSERT_FALSE(encodePayload(PayloadCodec::integerDelta, sizeof(uint32_t), random32.data(), random32.size() * sizeof(uint32_t), encoded));
+}
+
+TEST_F(PacketStreamingTest, PayloadCodecMalformedInput)
+{
+    std::vector<uint16_t> samples(100, 7);
+    std::vector<uint8_t> encoded;
+    ASSERT_TRUE(encodePayload(PayloadCodec::integerDelta, sizeof(uint16_t), samples.data(), samples.size() * sizeof(uint16_t), encoded));
+
+    std::vector<uint16_t> decoded(samples.size());
+    ASSERT_THROW(decodePayload(encoded.data(), encoded.size() - 10, decoded.data()), PacketStreamingException);
+    ASSERT_THROW(decodePayload(encoded.data(), 4, decoded.data()), PacketStreamingException);
+}
+
+TEST_F(PacketStreamingTest, PayloadCodecSelection)
+{
+    ASSERT_EQ(selectPayloadCodec(DataDescriptorBuilder().setSampleType(SampleType::Int64).build()), PayloadCodec::integerDelta);
+    ASSERT_EQ(selectPayloadCodec(DataDescriptorBuilder().setSampleType(SampleType::Float32).build()), PayloadCodec::floatXor);
+    ASSERT_EQ(selectPayloadCodec(DataDescriptorBuilder().setSampleType(SampleType::Binary).build()), PayloadCodec::none);
+    ASSERT_EQ(selectPayloadCodec(DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(1, 0)).build()),
+              PayloadCodec::none);
+    ASSERT_EQ(selectPayloadCodec(nullptr), PayloadCodec::none);
+}
+
+TEST_F(PacketStreamingTest, PayloadBufferPoolReuse)
+{
+    const auto pool = std::make_shared<PayloadBufferPool>(1);
+
+    const auto first = pool->acquire(100);
+    const auto second = pool->acquire(50);
+    pool->release(first);
+    pool->release(second);
+    ASSERT_EQ(pool->getPooledCount(), 1u);
+
+    const auto reused = pool->acquire(80);
+    ASSERT_EQ(reused, first);
+    ASSERT_EQ(reused->size(), 80u);
+    pool->release(reused);
+}
+
@@ -28,12 +28,14 @@ class SignalGenerator
 {
 public:
     using GenerateSampleFunc = std::function<void(uint64_t tick, void* valueOut)>;
+    using GenerateBlockFunc = std::function<void(uint64_t startTick, size_t sampleCount, void* valuesOut)>;
     using UpdateGeneratorFunc = std::function<void(SignalGenerator& generator, uint64_t packetOffset)>;
 
     SignalGenerator(const SignalConfigPtr& signal,
                     std::chrono::time_point<std::chrono::system_clock> absTime);
 
     void setFunction(GenerateSampleFunc function);
+    void setBlockFunction(GenerateBlockFunc function);
     void setUpdateFunction(UpdateGeneratorFunc function);
     void generateSamplesTo(std::chrono::milliseconds currentTime);
     SignalConfigPtr getSignal();
@@ -47,6 +49,7 @@ protected:
 
     SignalConfigPtr signal;
     GenerateSampleFunc generateFunc;
+    GenerateBlockFunc generateBlockFunc;
     UpdateGeneratorFunc updateFunc;
     uint64_t tick;
     size_t sampleSize{};
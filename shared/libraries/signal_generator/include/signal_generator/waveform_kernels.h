@@ -0,0 +1,74 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <coretypes/common.h>
+#include <cstddef>
+#include <cstdint>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*
+ * Block-based waveform kernels used by simulated devices to fill whole packet buffers at once.
+ * Phases are expressed in cycles (1.0 == 2π) so that they can be accumulated without losing
+ * precision on long runs. All kernels are written over fixed-width lanes without cross-lane
+ * dependencies so that the compiler can vectorize them.
+ */
+namespace waveform
+{
+    // Returns the fractional phase (in cycles) of the given sample index.
+    double phaseAt(uint64_t sampleIndex, double frequency, double sampleRate);
+
+    // out[i] = amplitude * sin(2π * (phase + i * phaseIncrement)) + offset
+    void sine(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset);
+
+    // out[i] = ±amplitude + offset; positive for the first half of each cycle, matching the sign of the sine wave.
+    void square(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset);
+
+    // Triangle wave in phase with sine: 0 at phase 0, peak at 0.25, trough at 0.75.
+    void triangle(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset);
+
+    // Sawtooth wave in phase with sine: 0 at phase 0, rising to the peak just before 0.5.
+    void sawtooth(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset);
+
+    // out[i] = value
+    void constant(double* out, size_t count, double value);
+
+    // out[i] = (start + i) / divisor; returns the next counter value (start + count).
+    uint64_t counter(double* out, size_t count, uint64_t start, double divisor);
+
+    // Gaussian noise generator with independent xoshiro256+ streams per lane and a Box-Muller transform.
+    class NoiseGenerator
+    {
+    public:
+        static constexpr size_t Lanes = 4;
+
+        explicit NoiseGenerator(uint64_t seed = 0);
+
+        void seed(uint64_t seed);
+
+        // out[i] += amplitude * N(0, 1)
+        void add(double* out, size_t count, double amplitude);
+
+    private:
+        void nextUniform(double (&out)[Lanes]);
+
+        uint64_t state[4][Lanes];
+    };
+}
+
+END_NAMESPACE_OPENDAQ
@@ -23,6 +23,12 @@ SignalGenerator::SignalGenerator(const SignalConfigPtr& signal,
 void SignalGenerator::setFunction(GenerateSampleFunc function)
 {
     this->generateFunc = function;
+    this->generateBlockFunc = nullptr;
+}
+
+void SignalGenerator::setBlockFunction(GenerateBlockFunc function)
+{
+    this->generateBlockFunc = function;
 }
 
 void SignalGenerator::setUpdateFunction(UpdateGeneratorFunc function)
@@ -53,12 +59,19 @@ void SignalGenerator::generatePacket(uint64_t startTick, size_t sampleCount)
 
 
     uint8_t* currentSample = (uint8_t*) dataPacket.getRawData();
-    const size_t lastTick = startTick + sampleCount;
 
-    for (uint64_t i = startTick; i < lastTick; i++)
+    if (generateBlockFunc)
+    {
+        generateBlockFunc(startTick, sampleCount, currentSample);
+    }
+    else
     {
-        generateFunc(i, currentSample);
-        currentSample += sampleSize;
+        const size_t lastTick = startTick + sampleCount;
+        for (uint64_t i = startTick; i < lastTick; i++)
+        {
+            generateFunc(i, currentSample);
+            currentSample += sampleSize;
+        }
     }
 
     signal.sendPacket(dataPacket);
@@ -0,0 +1,190 @@
+#include "signal_generator/waveform_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace waveform
+{
+
+namespace
+{
+    constexpr double TwoPi = 6.283185307179586;
+    constexpr size_t Lanes = NoiseGenerator::Lanes;
+
+    // The sine recurrence is re-seeded from the exact phase after this many samples to bound the rounding drift.
+    constexpr size_t SineResyncInterval = 1024;
+
+    double wrapPhase(double phase)
+    {
+        return phase - std::floor(phase);
+    }
+
+    uint64_t rotl(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64_t splitMix64(uint64_t& x)
+    {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    template <typename TShape>
+    void shapeFromPhase(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset, TShape shape)
+    {
+        phase = wrapPhase(phase);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const double p = wrapPhase(phase + phaseIncrement * static_cast<double>(i));
+            out[i] = shape(p) * amplitude + offset;
+        }
+    }
+}
+
+double phaseAt(uint64_t sampleIndex, double frequency, double sampleRate)
+{
+    return wrapPhase(frequency / sampleRate * static_cast<double>(sampleIndex));
+}
+
+void sine(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset)
+{
+    const double stepAngle = TwoPi * phaseIncrement * static_cast<double>(Lanes);
+    const double stepRe = std::cos(stepAngle);
+    const double stepIm = std::sin(stepAngle);
+
+    for (size_t blockStart = 0; blockStart < count; blockStart += SineResyncInterval)
+    {
+        const size_t blockCount = std::min(SineResyncInterval, count - blockStart);
+        const double blockPhase = wrapPhase(phase + phaseIncrement * static_cast<double>(blockStart));
+        double* blockOut = out + blockStart;
+
+        // Each lane holds the phasor of every Lanes-th sample and is rotated by Lanes sample steps per iteration.
+        double re[Lanes];
+        double im[Lanes];
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            const double angle = TwoPi * (blockPhase + phaseIncrement * static_cast<double>(l));
+            re[l] = std::cos(angle);
+            im[l] = std::sin(angle);
+        }
+
+        size_t i = 0;
+        for (; i + Lanes <= blockCount; i += Lanes)
+        {
+            for (size_t l = 0; l < Lanes; ++l)
+                blockOut[i + l] = im[l] * amplitude + offset;
+
+            for (size_t l = 0; l < Lanes; ++l)
+            {
+                const double nextRe = re[l] * stepRe - im[l] * stepIm;
+                const double nextIm = re[l] * stepIm + im[l] * stepRe;
+                re[l] = nextRe;
+                im[l] = nextIm;
+            }
+        }
+
+        for (size_t l = 0; i < blockCount; ++i, ++l)
+            blockOut[i] = im[l] * amplitude + offset;
+    }
+}
+
+void square(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset)
+{
+    shapeFromPhase(out, count, phase, phaseIncrement, amplitude, offset,
+                   [](double p) { return p > 0.0 && p < 0.5 ? 1.0 : -1.0; });
+}
+
+void triangle(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset)
+{
+    shapeFromPhase(out, count, phase, phaseIncrement, amplitude, offset,
+                   [](double p) { return 1.0 - 4.0 * std::abs(wrapPhase(p + 0.25) - 0.5); });
+}
+
+void sawtooth(double* out, size_t count, double phase, double phaseIncrement, double amplitude, double offset)
+{
+    shapeFromPhase(out, count, phase, phaseIncrement, amplitude, offset,
+                   [](double p) { return 2.0 * wrapPhase(p + 0.5) - 1.0; });
+}
+
+void constant(double* out, size_t count, double value)
+{
+    std::fill_n(out, count, value);
+}
+
+uint64_t counter(double* out, size_t count, uint64_t start, double divisor)
+{
+    for (size_t i = 0; i < count; ++i)
+        out[i] = static_cast<double>(start + i) / divisor;
+
+    return start + count;
+}
+
+NoiseGenerator::NoiseGenerator(uint64_t seed)
+{
+    this->seed(seed);
+}
+
+void NoiseGenerator::seed(uint64_t seed)
+{
+    uint64_t x = seed;
+    for (size_t l = 0; l < Lanes; ++l)
+        for (auto& word : state)
+            word[l] = splitMix64(x);
+}
+
+void NoiseGenerator::nextUniform(double (&out)[Lanes])
+{
+    // xoshiro256+ evaluated on all lanes at once; the top 53 bits are mapped to (0, 1]
+    for (size_t l = 0; l < Lanes; ++l)
+    {
+        const uint64_t result = state[0][l] + state[3][l];
+        const uint64_t t = state[1][l] << 17;
+
+        state[2][l] ^= state[0][l];
+        state[3][l] ^= state[1][l];
+        state[1][l] ^= state[2][l];
+        state[0][l] ^= state[3][l];
+        state[2][l] ^= t;
+        state[3][l] = rotl(state[3][l], 45);
+
+        out[l] = (static_cast<double>(result >> 11) + 1.0) * 0x1.0p-53;
+    }
+}
+
+void NoiseGenerator::add(double* out, size_t count, double amplitude)
+{
+    double u1[Lanes];
+    double u2[Lanes];
+    double z0[Lanes];
+    double z1[Lanes];
+
+    size_t i = 0;
+    while (i < count)
+    {
+        nextUniform(u1);
+        nextUniform(u2);
+
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            const double r = std::sqrt(-2.0 * std::log(u1[l])) * amplitude;
+            const double theta = TwoPi * u2[l];
+            z0[l] = r * std::cos(theta);
+            z1[l] = r * std::sin(theta);
+        }
+
+        const size_t n = std::min(2 * Lanes, count - i);
+        for (size_t l = 0; l < n; ++l)
+            out[i + l] += l < Lanes ? z0[l] : z1[l - Lanes];
+
+        i += n;
+    }
+}
+
+}
+
+END_NAMESPACE_OPENDAQ
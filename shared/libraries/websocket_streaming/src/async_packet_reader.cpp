@@ -2,6 +2,7 @@
 #include <opendaq/instance_factory.h>
 #include <opendaq/custom_log.h>
 #include <opendaq/search_filter_factory.h>
+#include <opendaq/component_index_utils.h>
 
 BEGIN_NAMESPACE_OPENDAQ_WEBSOCKET_STREAMING
 
@@ -86,7 +87,7 @@ void AsyncPacketReader::startReadThread()
 void AsyncPacketReader::createReaders()
 {
     signalReaders.clear();
-    auto signals = device.getSignals(search::Recursive(search::Any()));
+    const ListPtr<ISignal> signals = component_index::getRecursiveItems(device, ComponentIndexQuery::Signals);
 
     for (const auto& signal : signals)
     {
@@ -4,6 +4,7 @@
 #include <opendaq/device_private.h>
 #include <coreobjects/property_factory.h>
 #include <opendaq/search_filter_factory.h>
+#include <opendaq/component_index_utils.h>
 #include <opendaq/device_info_factory.h>
 #include <opendaq/device_info_internal_ptr.h>
 #include <opendaq/custom_log.h>
@@ -54,7 +55,7 @@ void WebsocketStreamingServer::start()
     if (info.hasServerCapability("OpenDAQLTStreaming"))
         DAQ_THROW_EXCEPTION(InvalidStateException, fmt::format("Device \"{}\" already has an OpenDAQLTStreaming server capability.", info.getName()));
 
-    streamingServer.onAccept([this](const daq::streaming_protocol::StreamWriterPtr& writer) { return device.getSignals(search::Recursive(search::Any())); });
+    streamingServer.onAccept([this](const daq::streaming_protocol::StreamWriterPtr& writer) { return component_index::getRecursiveItems(device, ComponentIndexQuery::Signals); });
     streamingServer.onStartSignalsRead([this](const ListPtr<ISignal>& signals) { packetReader.startReadSignals(signals); } );
     streamingServer.onStopSignalsRead([this](const ListPtr<ISignal>& signals) { packetReader.stopReadSignals(signals); } );
     streamingServer.onClientConnected(
@@ -133,6 +134,7 @@ void WebsocketStreamingServer::coreEventCallback(ComponentPtr& sender, CoreEvent
     switch (static_cast<CoreEventId>(eventArgs.getEventId()))
     {
         case CoreEventId::ComponentAdded:
+        case CoreEventId::ComponentsAdded:
             componentAdded(sender, eventArgs);
             break;
         case CoreEventId::ComponentRemoved:
@@ -167,15 +169,29 @@ DictPtr<IString, ISignal> WebsocketStreamingServer::getSignalsOfComponent(Compon
 
 void WebsocketStreamingServer::componentAdded(ComponentPtr& /*sender*/, CoreEventArgsPtr& eventArgs)
 {
-    ComponentPtr addedComponent = eventArgs.getParameters().get("Component");
+    // "ComponentsAdded" carries all components added within a bulk construction scope; their signals are
+    // added with a single call
+    ListPtr<IComponent> addedComponents;
+    if (eventArgs.getEventId() == static_cast<Int>(CoreEventId::ComponentsAdded))
+        addedComponents = eventArgs.getParameters().get("Components");
+    else
+        addedComponents = List<IComponent>(ComponentPtr(eventArgs.getParameters().get("Component")));
 
     auto deviceGlobalId = device.getGlobalId().toStdString();
-    auto addedComponentGlobalId = addedComponent.getGlobalId().toStdString();
-    if (addedComponentGlobalId.find(deviceGlobalId) != 0)
-        return;
+    auto signals = List<ISignal>();
+    for (ComponentPtr addedComponent : addedComponents)
+    {
+        auto addedComponentGlobalId = addedComponent.getGlobalId().toStdString();
+        if (addedComponentGlobalId.find(deviceGlobalId) != 0)
+            continue;
+
+        LOG_I("Added Component: {};", addedComponentGlobalId);
+        for (const auto& signal : getSignalsOfComponent(addedComponent).getValueList())
+            signals.pushBack(signal);
+    }
 
-    LOG_I("Added Component: {};", addedComponentGlobalId);
-    streamingServer.addSignals(getSignalsOfComponent(addedComponent).getValueList());
+    if (signals.getCount() > 0)
+        streamingServer.addSignals(signals);
 }
 
 void WebsocketStreamingServer::componentRemoved(ComponentPtr& sender, CoreEventArgsPtr& eventArgs)
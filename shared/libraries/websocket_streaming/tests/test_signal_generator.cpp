@@ -4,6 +4,8 @@
 #include <opendaq/packet_factory.h>
 #include <opendaq/reader_factory.h>
 #include <signal_generator/signal_generator.h>
+#include <signal_generator/waveform_kernels.h>
+#include <cmath>
 #include <chrono>
 
 using namespace daq;
@@ -172,3 +174,107 @@ TEST_F(SignalGeneratorTest, SignalGeneratorCountCheck)
     auto packet2 = packets[2].asPtr<IDataPacket>();
     ASSERT_EQ(packet2.getSampleCount(), packetSize);
 }
+
+TEST_F(SignalGeneratorTest, BlockFunction)
+{
+    const size_t packetSize = 100;
+
+    auto expectedSamples1 = calculateExpectedSamples(0, packetSize, stepFunction10);
+    auto expectedSamples2 = calculateExpectedSamples(packetSize, packetSize, stepFunction10);
+
+    auto reader = PacketReader(signal);
+
+    size_t blockCalls = 0;
+    auto blockFunction = [&blockCalls](uint64_t startTick, size_t sampleCount, void* valuesOut)
+    {
+        int* intOut = (int*) valuesOut;
+        for (size_t i = 0; i < sampleCount; i++)
+            intOut[i] = (startTick + i) % 10;
+        blockCalls++;
+    };
+
+    auto generator = SignalGenerator(signal, std::chrono::system_clock::now());
+    generator.setBlockFunction(blockFunction);
+    generator.generateSamplesTo(std::chrono::milliseconds(packetSize));
+    generator.generateSamplesTo(std::chrono::milliseconds(packetSize * 2));
+
+    ASSERT_EQ(blockCalls, 2u);
+
+    auto packets = reader.readAll();
+    ASSERT_EQ(packets.getCount(), 3u);
+
+    auto packet1 = packets[1].asPtr<IDataPacket>();
+    ASSERT_EQ(packet1.getSampleCount(), packetSize);
+    ASSERT_TRUE(compareSamples(expectedSamples1.data(), packet1.getData(), packetSize));
+
+    auto packet2 = packets[2].asPtr<IDataPacket>();
+    ASSERT_EQ(packet2.getSampleCount(), packetSize);
+    ASSERT_TRUE(compareSamples(expectedSamples2.data(), packet2.getData(), packetSize));
+}
+
+TEST_F(SignalGeneratorTest, SineKernel)
+{
+    const size_t sampleCount = 10000;
+    const double frequency = 13.7;
+    const double sampleRate = 1000.0;
+    const uint64_t startSample = 123456;
+
+    std::vector<double> samples(sampleCount);
+    waveform::sine(samples.data(), sampleCount, waveform::phaseAt(startSample, frequency, sampleRate), frequency / sampleRate, 5.0, 1.0);
+
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        const double expected = std::sin(2.0 * 3.141592653589793 * frequency / sampleRate * static_cast<double>(startSample + i)) * 5.0 + 1.0;
+        ASSERT_NEAR(samples[i], expected, 1e-9);
+    }
+}
+
+TEST_F(SignalGeneratorTest, TriangleAndSawtoothKernels)
+{
+    // a quarter of the cycle per sample: 0, peak, 0, trough
+    std::vector<double> samples(4);
+
+    waveform::triangle(samples.data(), samples.size(), 0.0, 0.25, 2.0, 1.0);
+    ASSERT_NEAR(samples[0], 1.0, 1e-9);
+    ASSERT_NEAR(samples[1], 3.0, 1e-9);
+    ASSERT_NEAR(samples[2], 1.0, 1e-9);
+    ASSERT_NEAR(samples[3], -1.0, 1e-9);
+
+    waveform::sawtooth(samples.data(), samples.size(), 0.0, 0.25, 2.0, 1.0);
+    ASSERT_NEAR(samples[0], 1.0, 1e-9);
+    ASSERT_NEAR(samples[1], 2.0, 1e-9);
+    ASSERT_NEAR(samples[2], -1.0, 1e-9);
+    ASSERT_NEAR(samples[3], 0.0, 1e-9);
+}
+
+TEST_F(SignalGeneratorTest, CounterKernel)
+{
+    std::vector<double> samples(5);
+    const uint64_t next = waveform::counter(samples.data(), samples.size(), 10, 2.0);
+
+    ASSERT_EQ(next, 15u);
+    ASSERT_DOUBLE_EQ(samples[0], 5.0);
+    ASSERT_DOUBLE_EQ(samples[4], 7.0);
+}
+
+TEST_F(SignalGeneratorTest, NoiseKernel)
+{
+    const size_t sampleCount = 100000;
+    std::vector<double> samples(sampleCount, 0.0);
+
+    waveform::NoiseGenerator noise(42);
+    noise.add(samples.data(), sampleCount, 2.0);
+
+    double mean = 0.0;
+    double variance = 0.0;
+    for (const double sample : samples)
+    {
+        mean += sample;
+        variance += sample * sample;
+    }
+    mean /= sampleCount;
+    variance = variance / sampleCount - mean * mean;
+
+    ASSERT_NEAR(mean, 0.0, 0.05);
+    ASSERT_NEAR(variance, 4.0, 0.2);
+}